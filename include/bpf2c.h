@@ -128,6 +128,7 @@ extern "C"
         helper_function_data_t* helper_data;
         map_data_t* map_data;
         global_variable_section_data_t* global_variable_section_data;
+        map_data_t* map_value_data; ///< Value addresses of array maps, indexed like map_data.
     } program_runtime_context_t;
 
     /**
@@ -276,7 +277,7 @@ extern "C"
 
 #define EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_CURRENT_VERSION 1
 #define EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_CURRENT_VERSION_SIZE \
-    EBPF_SIZE_INCLUDING_FIELD(program_runtime_context_t, map_data)
+    EBPF_SIZE_INCLUDING_FIELD(program_runtime_context_t, map_value_data)
 #define EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_CURRENT_VERSION_TOTAL_SIZE sizeof(program_runtime_context_t)
 #define EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_HEADER             \
     {EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_CURRENT_VERSION,      \
@@ -530,3 +530,70 @@ EBPF_HELPER(int, bpf_perf_event_output, (void* ctx, void* perf_event_array, uint
 #ifndef __doxygen
 #define bpf_perf_event_output ((bpf_perf_event_output_t)BPF_FUNC_perf_event_output)
 #endif
+
+/**
+ * @brief Look up several keys in a map with a single call and copy their values. All keys are hashed and their
+ * entries prefetched before any of them is compared, which makes this cheaper than separate calls to
+ * bpf_map_lookup_elem when a program needs several entries from the same hash map.
+ *
+ * @param[in] map Map to search.
+ * @param[in] keys Array of up to EBPF_MAP_LOOKUP_BATCH_MAX_KEYS keys.
+ * @param[in] keys_size Size in bytes of the keys array. Must be a multiple of the map key size.
+ * @param[out] values Array that receives a copy of the value of each key, in the same order as the keys. The value
+ * of a key that isn't present is zeroed.
+ * @param[in] values_size Size in bytes of the values array.
+ *
+ * @returns A bit mask with bit n set if the key at index n was found, or a negative error code.
+ * @retval -EBPF_INVALID_ARGUMENT One or more parameters are invalid.
+ * @retval -EBPF_OPERATION_NOT_SUPPORTED Operation not supported on this map.
+ */
+EBPF_HELPER(
+    int64_t,
+    bpf_map_lookup_batch,
+    (void* map, const void* keys, uint32_t keys_size, void* values, uint32_t values_size));
+#ifndef __doxygen
+#define bpf_map_lookup_batch ((bpf_map_lookup_batch_t)BPF_FUNC_map_lookup_batch)
+#endif
+
+/**
+ * @brief Reserve a record in a ring buffer map so that the program can build it in place, without staging it on the
+ * stack first. The record must be passed to bpf_ringbuf_submit or bpf_ringbuf_discard before the program returns;
+ * a record still reserved when the program returns is discarded.
+ *
+ * The verifier bounds accesses to the record by the value_size of the map, so the map must declare value_size equal
+ * to the size of the records reserved from it. A program can hold one reservation at a time.
+ *
+ * @param[in] ring_buffer Ring buffer map to reserve the record in.
+ * @param[in] size Size in bytes of the record. Must equal the value_size of the map.
+ * @param[in] flags Must be 0.
+ *
+ * @returns Pointer to the reserved record, or NULL if the record could not be reserved.
+ */
+EBPF_HELPER(void*, bpf_ringbuf_reserve, (void* ring_buffer, uint64_t size, uint64_t flags));
+#ifndef __doxygen
+#define bpf_ringbuf_reserve ((bpf_ringbuf_reserve_t)BPF_FUNC_ringbuf_reserve)
+#endif
+
+/**
+ * @brief Make a record reserved by bpf_ringbuf_reserve available to the consumer of the ring buffer.
+ *
+ * @param[in] data Pointer returned by bpf_ringbuf_reserve.
+ * @param[in] flags BPF_RB_NO_WAKEUP to skip notifying the consumer, BPF_RB_FORCE_WAKEUP to notify it
+ * unconditionally, or 0 to notify it adaptively.
+ */
+EBPF_HELPER(void, bpf_ringbuf_submit, (void* data, uint64_t flags));
+#ifndef __doxygen
+#define bpf_ringbuf_submit ((bpf_ringbuf_submit_t)BPF_FUNC_ringbuf_submit)
+#endif
+
+/**
+ * @brief Release a record reserved by bpf_ringbuf_reserve without making it available to the consumer.
+ *
+ * @param[in] data Pointer returned by bpf_ringbuf_reserve.
+ * @param[in] flags BPF_RB_NO_WAKEUP to skip notifying the consumer, BPF_RB_FORCE_WAKEUP to notify it
+ * unconditionally, or 0 to notify it adaptively.
+ */
+EBPF_HELPER(void, bpf_ringbuf_discard, (void* data, uint64_t flags));
+#ifndef __doxygen
+#define bpf_ringbuf_discard ((bpf_ringbuf_discard_t)BPF_FUNC_ringbuf_discard)
+#endif
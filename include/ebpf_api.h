@@ -29,6 +29,7 @@ extern "C"
     struct bpf_program;
     struct bpf_map;
     struct bpf_link;
+    struct ring_buffer;
 
     /**
      * @brief Query info about an eBPF program.
@@ -328,6 +329,28 @@ extern "C"
         _Inout_opt_ uint32_t* info_size,
         _Out_opt_ ebpf_object_type_t* type) EBPF_NO_EXCEPT;
 
+    /**
+     * @brief Get the IDs of the objects of a given type, in ascending order, a page at a time. Unlike
+     * bpf_map_get_next_id and similar functions, each page of IDs is fetched from the execution context with a single
+     * call. To get the next page, call again with start_id set to the last ID returned.
+     *
+     * @param[in] type Type of object to get the IDs of.
+     * @param[in] start_id ID to get the IDs after, or 0 to start from the first ID.
+     * @param[out] ids Array that receives the IDs.
+     * @param[in, out] id_count On input, the capacity of ids. On output, the number of IDs returned. Fewer IDs than
+     * requested are returned if no more IDs follow, or if the page does not fit in a single call.
+     *
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_NO_MORE_KEYS There are no IDs after start_id.
+     * @retval EBPF_INVALID_ARGUMENT One or more parameters are wrong.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_get_next_object_ids(
+        ebpf_object_type_t type,
+        ebpf_id_t start_id,
+        _Out_writes_to_(*id_count, *id_count) ebpf_id_t* ids,
+        _Inout_ uint32_t* id_count) EBPF_NO_EXCEPT;
+
     /**
      * @brief Detach the eBPF program from the link.
      *
@@ -619,6 +642,47 @@ extern "C"
         size_t next_path_len,
         _Inout_ ebpf_object_type_t* type) EBPF_NO_EXCEPT;
 
+    /**
+     * @brief Pinned path returned by ebpf_get_pinned_object_paths_by_prefix.
+     */
+    typedef struct _ebpf_pinned_object_path
+    {
+        ebpf_object_type_t type; ///< Type of the pinned object.
+        char* path;              ///< Canonical pinned path.
+    } ebpf_pinned_object_path_t;
+
+    /**
+     * @brief Retrieve all pinned paths that start with a given prefix, in lexicographical order. The paths are fetched
+     * from the execution context in pages rather than one path per call.
+     *
+     * @param[in] prefix Prefix of the paths to retrieve, e.g. "/sys/fs/bpf/app/". It is canonicalized the same way
+     * as pin paths.
+     * @param[in] type Type of object to retrieve or EBPF_OBJECT_UNKNOWN for all types.
+     * @param[out] path_count Number of paths returned.
+     * @param[out] paths Array of paths. Must be freed by the caller using ebpf_free_pinned_object_paths.
+     *
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_NO_MEMORY Out of memory.
+     * @retval EBPF_INVALID_ARGUMENT One or more parameters are wrong.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_get_pinned_object_paths_by_prefix(
+        _In_z_ const char* prefix,
+        ebpf_object_type_t type,
+        _Out_ uint32_t* path_count,
+        _Outptr_result_buffer_maybenull_(*path_count) ebpf_pinned_object_path_t** paths) EBPF_NO_EXCEPT;
+
+    /**
+     * @brief Free an array of paths returned by ebpf_get_pinned_object_paths_by_prefix.
+     *
+     * @param[in] path_count Length of the array to be freed.
+     * @param[in] paths Array to be freed.
+     */
+    void
+    ebpf_free_pinned_object_paths(
+        uint32_t path_count, _In_opt_count_(path_count) _Post_ptr_invalid_ ebpf_pinned_object_path_t* paths)
+        EBPF_NO_EXCEPT;
+
     /**
      * @brief Canonicalize a path using filesystem canonicalization rules.
      *
@@ -647,6 +711,57 @@ extern "C"
     _Must_inspect_result_ ebpf_result_t
     ebpf_get_program_info_from_verifier(_Outptr_ const ebpf_program_info_t** program_info) EBPF_NO_EXCEPT;
 
+    typedef struct _ebpf_api_program_verification
+    {
+        const char* section_name;                ///< Name of the section in which the program exists.
+        const char* program_name;                ///< Name of the program to verify.
+        const ebpf_program_type_t* program_type; ///< Optional program type, derived from the section if NULL.
+        uint32_t result;                         ///< 0 if verification succeeded, 1 otherwise.
+        const char* report;                      ///< Verification report, if any.
+        const char* error_message;               ///< Description of the error, on failure.
+        ebpf_api_verifier_stats_t stats;         ///< Verification statistics.
+        ebpf_program_info_t* program_info;       ///< Program information used to verify the program, on success.
+    } ebpf_api_program_verification_t;
+
+    /**
+     * @brief Verify several programs from the same ELF file concurrently.
+     *
+     * Each program is verified on one of a bounded set of threads. The outcome of each verification is returned in
+     * its own entry, so diagnostics can be reported in the order of the entries regardless of which program
+     * finished first.
+     *
+     * @param[in] data Memory containing the ELF file containing the eBPF programs.
+     * @param[in] data_length Length of data.
+     * @param[in] verbosity How much additional info about the programs to obtain.
+     * @param[in] max_threads Maximum number of threads to use, or 0 to use one per logical processor.
+     * @param[in] program_count Number of programs to verify.
+     * @param[in,out] programs Programs to verify. On return, the result, report, error_message, stats and
+     *  program_info fields are set. Free them with ebpf_api_free_program_verifications.
+     * @retval EBPF_SUCCESS All programs passed verification.
+     * @retval EBPF_VERIFICATION_FAILED At least one program failed verification.
+     * @retval EBPF_ELF_PARSING_FAILED The ELF file is malformed.
+     * @retval EBPF_NO_MEMORY Unable to allocate resources for this
+     *  operation.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_api_elf_verify_programs_from_memory(
+        _In_reads_(data_length) const char* data,
+        size_t data_length,
+        ebpf_verification_verbosity_t verbosity,
+        uint32_t max_threads,
+        size_t program_count,
+        _Inout_updates_(program_count) ebpf_api_program_verification_t* programs) EBPF_NO_EXCEPT;
+
+    /**
+     * @brief Free the outputs of ebpf_api_elf_verify_programs_from_memory.
+     *
+     * @param[in] program_count Number of entries.
+     * @param[in,out] programs Entries whose report, error_message and program_info are freed.
+     */
+    void
+    ebpf_api_free_program_verifications(
+        size_t program_count, _Inout_updates_(program_count) ebpf_api_program_verification_t* programs) EBPF_NO_EXCEPT;
+
     typedef struct _ebpf_test_run_options
     {
         _Readable_bytes_(data_size_in) const uint8_t* data_in; ///< Input data to the program.
@@ -676,6 +791,42 @@ extern "C"
     _Must_inspect_result_ ebpf_result_t
     ebpf_program_test_run(fd_t program_fd, _Inout_ ebpf_test_run_options_t* options) EBPF_NO_EXCEPT;
 
+    typedef struct _ebpf_test_run_batch_input
+    {
+        _Readable_bytes_(data_size_in) const uint8_t* data_in;       ///< Input data to the program.
+        size_t data_size_in;                                         ///< Size of input data.
+        _Readable_bytes_(context_size_in) const uint8_t* context_in; ///< Input context to the program.
+        size_t context_size_in;                                      ///< Size of input context.
+    } ebpf_test_run_batch_input_t;
+
+    typedef struct _ebpf_test_run_batch_options
+    {
+        _Readable_elements_(input_count) const ebpf_test_run_batch_input_t* inputs; ///< Inputs to run round-robin.
+        size_t input_count;                                                          ///< Number of inputs.
+        _Writable_elements_(input_count) uint64_t* return_values; ///< Return value from the program for each input.
+        size_t repeat_count;   ///< Number of rounds over all of the inputs.
+        uint64_t duration;     ///< Mean duration in nanoseconds of a single program invocation.
+        uint64_t latency_p50;  ///< Median duration in nanoseconds of a single program invocation.
+        uint64_t latency_p99;  ///< 99th percentile duration in nanoseconds of a single program invocation.
+        uint64_t latency_p999; ///< 99.9th percentile duration in nanoseconds of a single program invocation.
+        uint32_t flags;        ///< Flags to control the test run.
+        uint32_t cpu;          ///< CPU to run the program on.
+        size_t batch_size;     ///< Number of invocations between epoch exits.
+    } ebpf_test_run_batch_options_t;
+
+    /**
+     * @brief Run the program once per input for repeat_count rounds in a single request, and return the return
+     * value of each input along with the mean and percentile latency of a single invocation.
+     *
+     * @param[in] program_fd File descriptor of the program to run.
+     * @param[in,out] options Inputs and options to control the test run, and results.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_INVALID_ARGUMENT The inputs do not fit in a single request.
+     * @retval EBPF_INVALID_OBJECT Invalid object was passed.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_program_test_run_batch(fd_t program_fd, _Inout_ ebpf_test_run_batch_options_t* options) EBPF_NO_EXCEPT;
+
     /**
      * @brief Write data into the ring buffer map.
      *
@@ -726,6 +877,105 @@ extern "C"
     ebpf_ring_buffer_map_unmap_buffer(
         fd_t map_fd, _In_ void* consumer, _In_ const void* producer, _In_ const void* data) EBPF_NO_EXCEPT;
 
+    /**
+     * @brief Indicate the records of a ring buffer map created with EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU in the
+     * order in which they were reserved across all of its sub-rings, rather than in the order each sub-ring is read.
+     * Records are held for a short reordering window before they are indicated. Ordering is best-effort: records
+     * that reach the consumer after the window has passed, or that are pushed out because too many records are held,
+     * may be indicated out of order.
+     */
+#define EBPF_RING_BUFFER_FLAG_ORDERED 0x1
+
+    typedef struct _ebpf_ring_buffer_opts
+    {
+        size_t sz;      ///< Size of this structure, for forward/backward compatibility.
+        uint64_t flags; ///< EBPF_RING_BUFFER_FLAG_* flags.
+        /**
+         * @brief If non-zero, records are consumed by a dedicated thread that polls the memory-mapped producer and
+         * consumer pages of the ring buffer, instead of posting an async query IOCTL for every batch. The thread keeps
+         * polling for this many microseconds after the last record it consumed, then blocks on a wait handle until the
+         * producer signals more records. Not supported on ring buffer maps backed by per-CPU sub-rings.
+         */
+        uint32_t busy_poll_budget_us;
+    } ebpf_ring_buffer_opts_t;
+
+    typedef struct _ebpf_ring_buffer_statistics
+    {
+        uint64_t records; ///< Count of records indicated to the sample callback.
+        uint64_t ioctls;  ///< Count of async query IOCTLs posted to consume records.
+        uint64_t waits;   ///< Count of async query completions, or of blocking waits when busy-polling.
+    } ebpf_ring_buffer_statistics_t;
+
+    typedef int (*ebpf_ring_buffer_sample_fn)(_Inout_opt_ void* ctx, _In_reads_bytes_(size) void* data, size_t size);
+
+    /**
+     * @brief Create a ring buffer manager, like ring_buffer__new, with Windows-specific options.
+     *
+     * The sub-rings of a ring buffer map created with EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU are all subscribed to and
+     * merged, so the callback sees a single stream of records.
+     *
+     * @param[in] map_fd File descriptor of the ring buffer map.
+     * @param[in] sample_callback Function invoked for each record.
+     * @param[in] callback_context Context passed to sample_callback.
+     * @param[in] opts Optional options, or NULL for the defaults.
+     * @param[out] ring_buffer Ring buffer manager, to be freed with ring_buffer__free.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_INVALID_ARGUMENT An option is not valid for this map.
+     * @retval EBPF_NO_MEMORY Out of memory.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_ring_buffer_create(
+        fd_t map_fd,
+        _In_ ebpf_ring_buffer_sample_fn sample_callback,
+        _Inout_opt_ void* callback_context,
+        _In_opt_ const ebpf_ring_buffer_opts_t* opts,
+        _Outptr_ struct ring_buffer** ring_buffer) EBPF_NO_EXCEPT;
+
+    /**
+     * @brief Get the consumer statistics of a ring buffer manager, e.g., to compare the IOCTL cost of consuming
+     * records with and without busy-polling.
+     *
+     * @param[in] ring_buffer Ring buffer manager.
+     * @param[out] statistics Statistics accumulated since the ring buffer manager was created.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_INVALID_ARGUMENT One or more parameters are incorrect.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_ring_buffer_get_statistics(
+        _In_ const struct ring_buffer* ring_buffer, _Out_ ebpf_ring_buffer_statistics_t* statistics) EBPF_NO_EXCEPT;
+
+    /**
+     * @brief Fetch the next batch of keys from a per-CPU map together with an aggregate of each value across all
+     * CPUs. The aggregate is computed by the execution context, so only one value per key is copied to user mode.
+     *
+     * Each value is treated as an array of little-endian unsigned integers of element_size bytes, and the aggregate
+     * is computed element-wise. Sums wrap at the element width.
+     *
+     * @param[in] map_fd File descriptor of a per-CPU hash or array map.
+     * @param[in] aggregate Aggregate to compute across CPUs.
+     * @param[in] element_size Size in bytes of each integer element of a value (1, 2, 4 or 8).
+     * @param[in] in_batch Key to continue the enumeration after, or NULL to start from the first key.
+     * @param[out] out_batch Key to pass as in_batch to fetch the next batch.
+     * @param[out] keys Buffer that receives up to count keys.
+     * @param[out] values Buffer that receives up to count aggregated values, each the size the map was created with.
+     * @param[in, out] count On input, the number of elements that fit in keys and values. On output, the number of
+     * elements returned.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_NO_MORE_KEYS There are no more keys to return.
+     * @retval EBPF_INVALID_ARGUMENT The aggregate or element size is not valid for this map.
+     * @retval EBPF_OPERATION_NOT_SUPPORTED The map is not a per-CPU map.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_map_aggregate_batch(
+        fd_t map_fd,
+        ebpf_map_aggregate_t aggregate,
+        uint32_t element_size,
+        _In_opt_ const void* in_batch,
+        _Out_ void* out_batch,
+        _Out_ void* keys,
+        _Out_ void* values,
+        _Inout_ uint32_t* count) EBPF_NO_EXCEPT;
+
     /**
      * @brief Set the wait handle that will be signaled for new data.
      *
@@ -810,6 +1060,18 @@ extern "C"
     _Must_inspect_result_ ebpf_result_t
     ebpf_program_synchronize() EBPF_NO_EXCEPT;
 
+    /**
+     * @brief Start or stop collecting run-time statistics for all eBPF programs. The run count, cumulative run time
+     * and tail call count of a program are reported in struct bpf_prog_info. Collection is off by default, as it
+     * adds two clock reads to every invocation.
+     *
+     * @param[in] enable True to start collecting statistics, false to stop. Statistics already collected are kept.
+     *
+     * @retval EBPF_SUCCESS The operation was successful.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_enable_program_statistics(bool enable) EBPF_NO_EXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
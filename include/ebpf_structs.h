@@ -110,8 +110,48 @@ typedef struct _ebpf_map_definition_in_memory
     uint32_t max_entries; ///< Maximum number of entries allowed in the map.
     ebpf_id_t inner_map_id;
     ebpf_pin_type_t pinning;
+    uint32_t map_flags; ///< Map creation flags (EBPF_MAP_CREATE_FLAG_*).
 } ebpf_map_definition_in_memory_t;
 
+/**
+ * @brief Windows-specific map creation flag for per-CPU hash and array maps. Each CPU's slot of a value is placed on
+ * its own cache lines, so that programs running on adjacent CPUs never false-share a line when updating the same key.
+ * The layout of values exchanged with user mode is unchanged.
+ */
+#define EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED 0x80000000
+
+/**
+ * @brief Windows-specific map creation flag for ring buffer maps. The map is backed by one sub-ring of max_entries
+ * bytes per CPU, and producers only write to the sub-ring of the CPU they run on, so they never contend with each
+ * other. Consumers see a single logical ring buffer: the sub-rings are merged by ebpf_map_subscribe and
+ * ring_buffer__new. Direct user-mode mapping of the buffer (ebpf_ring_buffer_map_map_buffer) is not supported.
+ */
+#define EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU 0x40000000
+
+/**
+ * @brief Windows-specific map creation flag that makes the map count its operations (lookups, misses, inserts,
+ * replaces, deletes, LRU evictions and failed updates) in per-CPU counters. The counters are reported in struct
+ * bpf_map_info. Lookups of BPF_MAP_TYPE_ARRAY maps that bpf2c inlines into native programs are not counted.
+ */
+#define EBPF_MAP_CREATE_FLAG_STATISTICS 0x20000000
+
+/**
+ * @brief Windows-specific map creation flag for LRU hash maps. Once the map fills past a high watermark, a background
+ * work item evicts a batch of the least recently used entries until it drops below a low watermark, so that inserts
+ * rarely have to evict an entry inline. The map may therefore hold fewer than max_entries entries.
+ */
+#define EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION 0x10000000
+
+/**
+ * @brief Aggregate computed across CPUs by \ref ebpf_map_aggregate_batch.
+ */
+typedef enum _ebpf_map_aggregate
+{
+    EBPF_MAP_AGGREGATE_SUM, ///< Sum of the per-CPU values, wrapping on overflow.
+    EBPF_MAP_AGGREGATE_MIN, ///< Minimum of the per-CPU values.
+    EBPF_MAP_AGGREGATE_MAX, ///< Maximum of the per-CPU values.
+} ebpf_map_aggregate_t;
+
 /**
  * @brief eBPF Map Definition as it appears in the maps section of an ELF file.
  */
@@ -171,6 +211,10 @@ typedef enum
     BPF_FUNC_ktime_get_boot_ms = 30,         ///< \ref bpf_ktime_get_boot_ms
     BPF_FUNC_ktime_get_ms = 31,              ///< \ref bpf_ktime_get_ms
     BPF_FUNC_perf_event_output = 32,         ///< \ref bpf_perf_event_output
+    BPF_FUNC_map_lookup_batch = 33,          ///< \ref bpf_map_lookup_batch
+    BPF_FUNC_ringbuf_reserve = 34,           ///< \ref bpf_ringbuf_reserve
+    BPF_FUNC_ringbuf_submit = 35,            ///< \ref bpf_ringbuf_submit
+    BPF_FUNC_ringbuf_discard = 36,           ///< \ref bpf_ringbuf_discard
 } ebpf_helper_id_t;
 
 // Cross-platform BPF program types.
@@ -421,6 +465,17 @@ struct bpf_map_info
     // Windows-specific fields.
     ebpf_id_t inner_map_id;     ///< ID of inner map template.
     uint32_t pinned_path_count; ///< Number of pinned paths.
+    uint64_t entry_count;       ///< Current number of entries, for hash maps.
+
+    // Operation statistics, only collected for maps created with EBPF_MAP_CREATE_FLAG_STATISTICS.
+    uint64_t lookup_count;       ///< Number of lookups that found an entry.
+    uint64_t lookup_miss_count;  ///< Number of lookups that didn't find an entry.
+    uint64_t insert_count;       ///< Number of updates that inserted a new entry.
+    uint64_t replace_count;      ///< Number of updates that replaced the value of an existing entry.
+    uint64_t delete_count;       ///< Number of entries deleted.
+    uint64_t eviction_count;     ///< Number of entries evicted from an LRU map to make room for new entries.
+    uint64_t out_of_space_count; ///< Number of updates that failed with EBPF_OUT_OF_SPACE.
+    uint64_t no_memory_count;    ///< Number of updates that failed with EBPF_NO_MEMORY.
 };
 
 #define BPF_ANY 0x0
@@ -445,8 +500,20 @@ struct bpf_prog_info
     ebpf_attach_type_t attach_type_uuid; ///< Attach type UUID.
     uint32_t pinned_path_count;          ///< Number of pinned paths.
     uint32_t link_count;                 ///< Number of attached links.
+
+    // Run-time statistics, only collected while enabled by ebpf_enable_program_statistics.
+    uint64_t run_time_ns;   ///< Cumulative run time of the program, in nanoseconds.
+    uint64_t run_cnt;       ///< Number of times the program was invoked.
+    uint64_t tail_call_cnt; ///< Number of tail calls made by the program.
 };
 
+/* Maximum number of keys passed to a single BPF_FUNC_map_lookup_batch call. */
+#define EBPF_MAP_LOOKUP_BATCH_MAX_KEYS 32
+
+/* BPF_FUNC_ringbuf_submit and BPF_FUNC_ringbuf_discard flags. */
+#define BPF_RB_NO_WAKEUP (1ULL << 0)
+#define BPF_RB_FORCE_WAKEUP (1ULL << 1)
+
 /* BPF_FUNC_perf_event_output flags. */
 #define EBPF_MAP_FLAG_INDEX_MASK 0xffffffffULL
 #define EBPF_MAP_FLAG_INDEX_SHIFT 0
@@ -227,18 +227,41 @@ typedef struct
 
 typedef struct
 {
-    enum bpf_prog_type type;         ///< Program type.
-    ebpf_id_t id;                    ///< Program ID.
-    char tag[8];                     ///< Program tag.
-    uint32_t jited_prog_len;         ///< Not supported.
-    uint32_t xlated_prog_len;        ///< Not supported.
-    uint64_t jited_prog_insns;       ///< Not supported.
-    uint64_t xlated_prog_insns;      ///< Not supported.
-    uint64_t load_time;              ///< Not supported.
-    uint32_t created_by_uid;         ///< Not supported.
-    uint32_t nr_map_ids;             ///< Number of maps associated with this program.
-    uint64_t map_ids;                ///< Pointer to caller-allocated array to fill map IDs into.
-    char name[SYS_BPF_OBJ_NAME_LEN]; ///< Null-terminated program name.
+    enum bpf_prog_type type;           ///< Program type.
+    ebpf_id_t id;                      ///< Program ID.
+    char tag[8];                       ///< Program tag.
+    uint32_t jited_prog_len;           ///< Not supported.
+    uint32_t xlated_prog_len;          ///< Not supported.
+    uint64_t jited_prog_insns;         ///< Not supported.
+    uint64_t xlated_prog_insns;        ///< Not supported.
+    uint64_t load_time;                ///< Not supported.
+    uint32_t created_by_uid;           ///< Not supported.
+    uint32_t nr_map_ids;               ///< Number of maps associated with this program.
+    uint64_t map_ids;                  ///< Pointer to caller-allocated array to fill map IDs into.
+    char name[SYS_BPF_OBJ_NAME_LEN];   ///< Null-terminated program name.
+    uint32_t ifindex;                  ///< Not supported.
+    uint32_t gpl_compatible;           ///< Not supported.
+    uint64_t netns_dev;                ///< Not supported.
+    uint64_t netns_ino;                ///< Not supported.
+    uint32_t nr_jited_ksyms;           ///< Not supported.
+    uint32_t nr_jited_func_lens;       ///< Not supported.
+    uint64_t jited_ksyms;              ///< Not supported.
+    uint64_t jited_func_lens;          ///< Not supported.
+    uint32_t btf_id;                   ///< Not supported.
+    uint32_t func_info_rec_size;       ///< Not supported.
+    uint64_t func_info;                ///< Not supported.
+    uint32_t nr_func_info;             ///< Not supported.
+    uint32_t nr_line_info;             ///< Not supported.
+    uint64_t line_info;                ///< Not supported.
+    uint64_t jited_line_info;          ///< Not supported.
+    uint32_t nr_jited_line_info;       ///< Not supported.
+    uint32_t line_info_rec_size;       ///< Not supported.
+    uint32_t jited_line_info_rec_size; ///< Not supported.
+    uint32_t nr_prog_tags;             ///< Not supported.
+    uint64_t prog_tags;                ///< Not supported.
+    uint64_t run_time_ns;              ///< Cumulative run time, if statistics are enabled.
+    uint64_t run_cnt;                  ///< Number of runs, if statistics are enabled.
+    uint64_t recursion_misses;         ///< Not supported.
 } sys_bpf_prog_info_t;
 
 typedef struct
@@ -847,3 +847,115 @@ _Success_(return == 0) uint32_t ebpf_api_elf_verify_section_from_memory(
     return ebpf_api_elf_verify_program_from_memory(
         data, data_length, section, {}, program_type, verbosity, report, error_message, stats);
 }
+
+/**
+ * @brief Record why the verification of a program failed, unless the verifier already reported an error for it.
+ *
+ * @param[in, out] program Verification entry of the program.
+ * @param[in] reason Reason for the failure.
+ */
+static void
+_set_program_verification_error(_Inout_ ebpf_api_program_verification_t* program, _In_z_ const char* reason) noexcept
+{
+    if (program->error_message != nullptr) {
+        return;
+    }
+    try {
+        program->error_message = allocate_string(std::string("error: ") + reason);
+    } catch (const std::bad_alloc&) {
+        // Leave the error message unset, the result still reports the failure.
+    }
+}
+
+_Must_inspect_result_ ebpf_result_t
+ebpf_api_elf_verify_programs_from_memory(
+    _In_reads_(data_length) const char* data,
+    size_t data_length,
+    ebpf_verification_verbosity_t verbosity,
+    uint32_t max_threads,
+    size_t program_count,
+    _Inout_updates_(program_count) ebpf_api_program_verification_t* programs) noexcept
+{
+    EBPF_LOG_ENTRY();
+    ebpf_result_t result = EBPF_SUCCESS;
+
+    for (size_t i = 0; i < program_count; i++) {
+        programs[i].result = 1;
+        programs[i].report = nullptr;
+        programs[i].error_message = nullptr;
+        programs[i].stats = {};
+        programs[i].program_info = nullptr;
+    }
+
+    try {
+        std::string elf(data, data_length);
+        if (!ElfCheckElf(
+                elf.size(),
+                const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(elf.data())),
+                static_cast<uint32_t>(elf.size()))) {
+            EBPF_RETURN_RESULT(EBPF_ELF_PARSING_FAILED);
+        }
+
+        // Each program is verified with its own thread local verifier state, and its outcome is only written to
+        // its own entry.
+        ebpf_api_parallel_for(program_count, max_threads, [&](size_t index) {
+            ebpf_api_program_verification_t* program = &programs[index];
+            try {
+                auto stream = std::stringstream(elf);
+                ebpf_clear_thread_local_storage();
+                set_global_program_and_attach_type(program->program_type, nullptr);
+                program->result = _ebpf_api_elf_verify_program_from_stream(
+                    stream,
+                    "memory",
+                    program->section_name,
+                    program->program_name,
+                    verbosity,
+                    &program->report,
+                    &program->error_message,
+                    &program->stats);
+                if (program->result != 0) {
+                    return;
+                }
+
+                // Keep a copy of the program information, since the thread local copy is freed with the thread.
+                const ebpf_program_info_t* program_info;
+                if (get_program_type_info_from_tls(&program_info) != EBPF_SUCCESS ||
+                    ebpf_duplicate_program_info(program_info, &program->program_info) != EBPF_SUCCESS) {
+                    program->result = 1;
+                    program->error_message = allocate_string("error: Failed to get program information");
+                }
+            } catch (const std::exception& ex) {
+                program->result = 1;
+                _set_program_verification_error(program, ex.what());
+            } catch (...) {
+                program->result = 1;
+                _set_program_verification_error(program, "Unknown exception");
+            }
+        });
+    } catch (const std::bad_alloc&) {
+        EBPF_RETURN_RESULT(EBPF_NO_MEMORY);
+    }
+
+    for (size_t i = 0; i < program_count; i++) {
+        if (programs[i].result != 0) {
+            result = EBPF_VERIFICATION_FAILED;
+            break;
+        }
+    }
+
+    EBPF_RETURN_RESULT(result);
+}
+
+void
+ebpf_api_free_program_verifications(
+    size_t program_count, _Inout_updates_(program_count) ebpf_api_program_verification_t* programs) noexcept
+{
+    for (size_t i = 0; i < program_count; i++) {
+        ebpf_free_string(programs[i].report);
+        programs[i].report = nullptr;
+        ebpf_free_string(programs[i].error_message);
+        programs[i].error_message = nullptr;
+        ebpf_program_info_free(programs[i].program_info);
+        programs[i].program_info = nullptr;
+    }
+}
@@ -7,6 +7,8 @@
 #include "ebpf_api.h"
 #include "spec_type_descriptors.hpp"
 
+#include <functional>
+
 #if !defined(EBPF_API_LOCKING)
 #define EBPF_API_LOCKING
 #endif
@@ -611,14 +613,17 @@ ebpf_object_unload(_Inout_ struct bpf_object* object) noexcept;
  *
  * @param[in] map_fd File descriptor to the perf event array or a ring buffer map.
  * @param[in] cpu_ids The CPU Ids corresponding to this subscription. For a ring buffer map this is a single value with
- * Id 0.
+ * Id 0. If the ring buffer map is backed by per-CPU sub-rings, all of them are subscribed to and merged.
  * @param[in] cpu_id_count The count of the elements in the cpu_ids parameter.
  * @param[in] callback_context Pointer to supplied context to be passed in notification callback.
  * @param[in] sample_callback Function pointer to notification handler.
  * @param[in] lost_callback Function pointer to lost record notification handler.
+ * @param[in] opts Ring buffer options, or NULL for the defaults. EBPF_RING_BUFFER_FLAG_ORDERED is only supported on
+ * ring buffer maps backed by per-CPU sub-rings, and busy-polling only on ring buffer maps with a single ring.
  * @param[out] subscription Opaque pointer to the subscription object.
  *
  * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_INVALID_ARGUMENT The options are not supported on the map.
  * @retval EBPF_NO_MEMORY Out of memory.
  */
 _Must_inspect_result_ ebpf_result_t
@@ -629,8 +634,19 @@ ebpf_map_subscribe(
     _Inout_opt_ void* callback_context,
     _In_ const void* sample_callback,
     _In_opt_ const void* lost_callback,
+    _In_opt_ const ebpf_ring_buffer_opts_t* opts,
     _Outptr_ ebpf_map_subscription_t** subscription) noexcept;
 
+/**
+ * @brief Add the consumer statistics of a subscription to the supplied totals.
+ *
+ * @param[in] subscription Subscription to query.
+ * @param[in, out] statistics Totals to add the statistics of the subscription to.
+ */
+void
+ebpf_map_subscription_add_statistics(
+    _In_ const ebpf_map_subscription_t* subscription, _Inout_ ebpf_ring_buffer_statistics_t* statistics) noexcept;
+
 /**
  * @brief Unsubscribe from the map event notifications.
  *
@@ -716,6 +732,18 @@ ebpf_api_thread_local_cleanup() noexcept;
 void
 ebpf_api_thread_local_initialize() noexcept;
 
+/**
+ * @brief Invoke a work function for each index in [0, count) on a bounded set of threads.
+ *
+ * The calling thread is one of the workers. Other worker threads clear their thread local storage before exiting.
+ *
+ * @param[in] count Number of work items.
+ * @param[in] max_threads Maximum number of threads to use, or 0 to use one per logical processor.
+ * @param[in] work Function invoked with the index of each work item. It must not throw.
+ */
+void
+ebpf_api_parallel_for(size_t count, size_t max_threads, _In_ const std::function<void(size_t)>& work) noexcept;
+
 static inline bool
 prog_is_subprog(const struct bpf_object* obj, const struct bpf_program* prog)
 {
@@ -459,6 +459,8 @@ convert_to_sys_prog_info(_Out_ sys_bpf_prog_info_t* sys, _In_ const struct bpf_p
     BPF_TO_SYS(nr_map_ids);
     BPF_TO_SYS(map_ids);
     BPF_TO_SYS_STR(name);
+    BPF_TO_SYS(run_time_ns);
+    BPF_TO_SYS(run_cnt);
 }
 
 static void
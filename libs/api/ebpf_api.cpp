@@ -37,11 +37,14 @@ typedef unsigned char boolean;
 #include "windows_platform_common.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <codecvt>
 #include <fcntl.h>
 #include <io.h>
 #include <mutex>
 #include <rpc.h>
+#include <thread>
 
 using namespace peparse;
 using namespace Platform;
@@ -316,7 +319,10 @@ ebpf_map_create(
 
     ebpf_assert(map_fd);
 
-    if (opts && (opts->map_flags != 0 || opts->numa_node != 0 || opts->map_ifindex != 0)) {
+    const uint32_t supported_map_flags = EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED |
+                                         EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU | EBPF_MAP_CREATE_FLAG_STATISTICS |
+                                         EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION;
+    if (opts && ((opts->map_flags & ~supported_map_flags) != 0 || opts->numa_node != 0 || opts->map_ifindex != 0)) {
         result = EBPF_INVALID_ARGUMENT;
         goto Exit;
     }
@@ -327,6 +333,7 @@ ebpf_map_create(
         map_definition.key_size = key_size;
         map_definition.value_size = value_size;
         map_definition.max_entries = max_entries;
+        map_definition.map_flags = opts ? opts->map_flags : 0;
 
         // bpf_map_create_opts has inner_map_fd defined as __u32, so it cannot be set to
         // ebpf_fd_invalid (-1). Hence treat inner_map_fd = 0 as ebpf_fd_invalid.
@@ -692,6 +699,133 @@ ebpf_map_lookup_and_delete_element_batch(
 }
 CATCH_NO_MEMORY_EBPF_RESULT
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_map_aggregate_batch(
+    fd_t map_fd,
+    ebpf_map_aggregate_t aggregate,
+    uint32_t element_size,
+    _In_opt_ const void* in_batch,
+    _Out_ void* out_batch,
+    _Out_ void* keys,
+    _Out_ void* values,
+    _Inout_ uint32_t* count) NO_EXCEPT_TRY
+{
+    EBPF_LOG_ENTRY();
+    ebpf_result_t result = EBPF_SUCCESS;
+    ebpf_handle_t map_handle = ebpf_handle_invalid;
+    uint32_t key_size_u32 = 0;
+    uint32_t value_size_u32 = 0;
+    uint32_t max_entries_u32 = 0;
+    uint32_t type = BPF_MAP_TYPE_UNSPEC;
+
+    size_t input_count = *count;
+    size_t count_returned = 0;
+    size_t max_entries_per_batch = 0;
+    size_t key_size = 0;
+    size_t value_size = 0;
+
+    const uint8_t* previous_key = reinterpret_cast<const uint8_t*>(in_batch);
+
+    ebpf_assert(keys);
+    ebpf_assert(values);
+    ebpf_assert(count);
+
+    if (*count == 0) {
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
+    map_handle = _get_handle_from_file_descriptor(map_fd);
+    if (map_handle == ebpf_handle_invalid) {
+        result = EBPF_INVALID_FD;
+        goto Exit;
+    }
+
+    result = _get_map_descriptor_properties(map_handle, &type, &key_size_u32, &value_size_u32, &max_entries_u32);
+    if (result != EBPF_SUCCESS) {
+        goto Exit;
+    }
+
+    if (!BPF_MAP_TYPE_PER_CPU(type)) {
+        result = EBPF_OPERATION_NOT_SUPPORTED;
+        goto Exit;
+    }
+
+    // Aggregated values have the size the map was created with, not the per-CPU size.
+    key_size = key_size_u32;
+    value_size = value_size_u32;
+
+    if (key_size == 0 || value_size == 0) {
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
+    max_entries_per_batch = UINT16_MAX - EBPF_OFFSET_OF(_ebpf_operation_map_get_next_key_aggregate_batch_reply, data);
+    max_entries_per_batch /= (key_size + value_size);
+
+    while (count_returned < input_count) {
+        size_t entries_to_fetch = min(input_count - count_returned, max_entries_per_batch);
+
+        ebpf_protocol_buffer_t request_buffer(
+            EBPF_OFFSET_OF(_ebpf_operation_map_get_next_key_aggregate_batch_request, previous_key) +
+            (previous_key ? key_size : 0));
+        auto request =
+            reinterpret_cast<_ebpf_operation_map_get_next_key_aggregate_batch_request*>(request_buffer.data());
+        ebpf_protocol_buffer_t reply_buffer(
+            EBPF_OFFSET_OF(_ebpf_operation_map_get_next_key_aggregate_batch_reply, data) +
+            entries_to_fetch * (key_size + value_size));
+        auto reply = reinterpret_cast<_ebpf_operation_map_get_next_key_aggregate_batch_reply*>(reply_buffer.data());
+
+        request->header.length = static_cast<uint16_t>(request_buffer.size());
+        request->header.id = ebpf_operation_id_t::EBPF_OPERATION_MAP_GET_NEXT_KEY_AGGREGATE_BATCH;
+        request->handle = map_handle;
+        request->aggregate = aggregate;
+        request->element_size = element_size;
+        if (previous_key) {
+            std::copy(previous_key, previous_key + key_size, request->previous_key);
+        }
+
+        result = win32_error_code_to_ebpf_result(invoke_ioctl(request_buffer, reply_buffer));
+        if (result != EBPF_SUCCESS) {
+            goto Exit;
+        }
+
+        size_t entries_returned =
+            reply->header.length - EBPF_OFFSET_OF(_ebpf_operation_map_get_next_key_aggregate_batch_reply, data);
+        entries_returned /= (key_size + value_size);
+
+        if (entries_returned == 0) {
+            result = EBPF_INVALID_ARGUMENT;
+            goto Exit;
+        }
+
+        for (uint32_t index = 0; index < entries_returned; index++) {
+            uint8_t* key_data = reply->data + index * (key_size + value_size);
+            uint8_t* value_data = key_data + key_size;
+            std::copy(key_data, key_data + key_size, (uint8_t*)keys + (count_returned + index) * key_size);
+            std::copy(value_data, value_data + value_size, (uint8_t*)values + (count_returned + index) * value_size);
+        }
+        count_returned += entries_returned;
+        previous_key = (uint8_t*)keys + (count_returned - 1) * key_size;
+
+        // Partial return signals last no more entries.
+        if (entries_returned != entries_to_fetch) {
+            break;
+        }
+    }
+
+    memset((uint8_t*)out_batch, 0, key_size);
+    if (previous_key != nullptr) {
+        std::copy(previous_key, previous_key + key_size, (uint8_t*)out_batch);
+    }
+
+    *count = static_cast<uint32_t>(count_returned);
+
+Exit:
+    EBPF_RETURN_RESULT(result);
+}
+CATCH_NO_MEMORY_EBPF_RESULT
+
 static ebpf_result_t
 _update_map_element(
     ebpf_handle_t map_handle,
@@ -3364,6 +3498,18 @@ _Requires_lock_not_held_(_ebpf_state_mutex) static ebpf_result_t
     ebpf_assert(object);
     ebpf_result_t result = EBPF_SUCCESS;
     std::vector<original_fd_handle_map_t> handle_map;
+    std::vector<ebpf_program_t*> programs;
+    std::vector<ebpf_program_load_info> load_infos;
+
+    for (auto& map : object->maps) {
+        ebpf_id_t inner_map_id = (map->inner_map) ? map->inner_map->map_id : EBPF_ID_NONE;
+        handle_map.emplace_back(
+            map->original_fd,
+            map->map_id,
+            map->inner_map_original_fd,
+            inner_map_id,
+            reinterpret_cast<file_handle_t>(map->map_handle));
+    }
 
     for (ebpf_program_t* program : object->programs) {
         if (!program->autoload) {
@@ -3398,25 +3544,26 @@ _Requires_lock_not_held_(_ebpf_state_mutex) static ebpf_result_t
         load_info.instructions = reinterpret_cast<ebpf_instruction_t*>(program->instructions);
         load_info.instruction_count = program->instruction_count;
         load_info.execution_context = execution_context_kernel_mode;
-        load_info.map_count = (uint32_t)object->maps.size();
-
-        if (load_info.map_count > 0) {
-            for (auto& map : object->maps) {
-                ebpf_id_t inner_map_id = (map->inner_map) ? map->inner_map->map_id : EBPF_ID_NONE;
-                handle_map.emplace_back(
-                    map->original_fd,
-                    map->map_id,
-                    map->inner_map_original_fd,
-                    inner_map_id,
-                    reinterpret_cast<file_handle_t>(map->map_handle));
-            }
+        load_info.map_count = (uint32_t)handle_map.size();
+        load_info.handle_map = (load_info.map_count > 0) ? handle_map.data() : nullptr;
 
-            load_info.handle_map = handle_map.data();
-        }
+        programs.push_back(program);
+        load_infos.push_back(load_info);
+    }
 
-        result = ebpf_rpc_load_program(&load_info, &program->log_buffer, &program->log_buffer_size);
-        if (result != EBPF_SUCCESS) {
-            break;
+    if (result == EBPF_SUCCESS) {
+        // Verify and load the programs concurrently. Each program has its own handle and log buffer, and the first
+        // failure in program order is the one reported.
+        std::vector<ebpf_result_t> results(programs.size(), EBPF_SUCCESS);
+        ebpf_api_parallel_for(programs.size(), 0, [&](size_t index) {
+            ebpf_program_t* program = programs[index];
+            results[index] = ebpf_rpc_load_program(&load_infos[index], &program->log_buffer, &program->log_buffer_size);
+        });
+        for (ebpf_result_t program_result : results) {
+            if (program_result != EBPF_SUCCESS) {
+                result = program_result;
+                break;
+            }
         }
     }
 
@@ -3524,73 +3671,6 @@ _Requires_lock_not_held_(_ebpf_state_mutex) _Must_inspect_result_ ebpf_result_t
 }
 CATCH_NO_MEMORY_EBPF_RESULT
 
-/**
- * @brief Load native module for the specified driver service.
- *
- * @param[in] service_path Path to the driver service.
- * @param[in] module_id Module ID corresponding to the native module.
- * @param[out] count_of_maps Count of maps present in the native module.
- * @param[out] count_of_programs Count of programs present in the native module.
- *
- * @retval EBPF_SUCCESS The operation was successful.
- * @retval EBPF_NO_MEMORY Unable to allocate resources for this
- *  operation.
- * @retval EBPF_OBJECT_NOT_FOUND Native module for that module ID not found.
- * @retval EBPF_OBJECT_ALREADY_EXISTS Native module for this module ID is already
- *  initialized.
- */
-static ebpf_result_t
-_load_native_module(
-    _In_ const std::wstring& service_path,
-    _In_ const GUID* module_id,
-    _Out_ ebpf_handle_t* module_handle,
-    _Out_ size_t* count_of_maps,
-    _Out_ size_t* count_of_programs) noexcept(false)
-{
-    EBPF_LOG_ENTRY();
-    ebpf_assert(module_id);
-    ebpf_assert(count_of_maps);
-    ebpf_assert(count_of_programs);
-
-    ebpf_result_t result = EBPF_SUCCESS;
-    uint32_t error = ERROR_SUCCESS;
-    ebpf_protocol_buffer_t request_buffer;
-    ebpf_operation_load_native_module_request_t* request;
-    ebpf_operation_load_native_module_reply_t reply;
-    size_t service_path_size = service_path.size() * 2;
-
-    *count_of_maps = 0;
-    *count_of_programs = 0;
-    *module_handle = ebpf_handle_invalid;
-
-    size_t buffer_size = offsetof(ebpf_operation_load_native_module_request_t, data) + service_path_size;
-    request_buffer.resize(buffer_size);
-
-    request = reinterpret_cast<ebpf_operation_load_native_module_request_t*>(request_buffer.data());
-    request->header.id = ebpf_operation_id_t::EBPF_OPERATION_LOAD_NATIVE_MODULE;
-    request->header.length = static_cast<uint16_t>(request_buffer.size());
-    request->module_id = *module_id;
-    memcpy(
-        request_buffer.data() + offsetof(ebpf_operation_load_native_module_request_t, data),
-        (char*)service_path.c_str(),
-        service_path_size);
-
-    error = invoke_ioctl(request_buffer, reply);
-    if (error != ERROR_SUCCESS) {
-        result = win32_error_code_to_ebpf_result(error);
-        EBPF_LOG_WIN32_WSTRING_API_FAILURE(EBPF_TRACELOG_KEYWORD_API, service_path.c_str(), invoke_ioctl);
-        goto Done;
-    }
-
-    ebpf_assert(reply.header.id == ebpf_operation_id_t::EBPF_OPERATION_LOAD_NATIVE_MODULE);
-    *count_of_maps = reply.count_of_maps;
-    *count_of_programs = reply.count_of_programs;
-    *module_handle = reply.native_module_handle;
-
-Done:
-    EBPF_RETURN_RESULT(result);
-}
-
 /**
  * @brief Create maps and load programs from a loaded native module.
  *
@@ -3713,6 +3793,130 @@ _ebpf_free_handles(size_t count, _In_reads_opt_(count) _Post_ptr_invalid_ ebpf_h
     ebpf_free(handles);
 }
 
+// Number of map and program handles that the reply to EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE has room for.
+#define EBPF_NATIVE_MODULE_INITIAL_HANDLE_COUNT 256
+
+/**
+ * @brief Load the native module for the specified driver service, then create its maps and load its programs.
+ * Both are done by one request to the execution context, unless the module has more maps and programs than
+ * EBPF_NATIVE_MODULE_INITIAL_HANDLE_COUNT, in which case the maps and programs are created by a second request.
+ *
+ * @param[in] service_path Path to the driver service.
+ * @param[in] module_id Module ID corresponding to the native module.
+ * @param[out] module_handle Handle to the native module.
+ * @param[out] count_of_maps Count of maps present in the native module.
+ * @param[out] map_handles Array of size count_of_maps which contains the map handles.
+ * @param[out] count_of_programs Count of programs present in the native module.
+ * @param[out] program_handles Array of size count_of_programs which contains the program handles.
+ *
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Unable to allocate resources for this
+ *  operation.
+ * @retval EBPF_OBJECT_NOT_FOUND Native module for that module ID not found.
+ * @retval EBPF_OBJECT_ALREADY_EXISTS Native module for this module ID is already
+ *  initialized.
+ */
+static ebpf_result_t
+_instantiate_native_module(
+    _In_ const std::wstring& service_path,
+    _In_ const GUID* module_id,
+    _Out_ ebpf_handle_t* module_handle,
+    _Out_ size_t* count_of_maps,
+    _Outptr_result_buffer_maybenull_(*count_of_maps) ebpf_handle_t** map_handles,
+    _Out_ size_t* count_of_programs,
+    _Outptr_result_buffer_maybenull_(*count_of_programs) ebpf_handle_t** program_handles) noexcept(false)
+{
+    EBPF_LOG_ENTRY();
+    ebpf_assert(module_id);
+
+    ebpf_result_t result = EBPF_SUCCESS;
+    uint32_t error = ERROR_SUCCESS;
+    ebpf_protocol_buffer_t request_buffer;
+    ebpf_protocol_buffer_t reply_buffer;
+    ebpf_operation_instantiate_native_module_request_t* request;
+    ebpf_operation_instantiate_native_module_reply_t* reply;
+    size_t service_path_size = service_path.size() * 2;
+    size_t map_handles_size;
+    size_t program_handles_size;
+
+    *module_handle = ebpf_handle_invalid;
+    *count_of_maps = 0;
+    *map_handles = nullptr;
+    *count_of_programs = 0;
+    *program_handles = nullptr;
+
+    request_buffer.resize(offsetof(ebpf_operation_instantiate_native_module_request_t, data) + service_path_size);
+    reply_buffer.resize(
+        offsetof(ebpf_operation_instantiate_native_module_reply_t, data) +
+        EBPF_NATIVE_MODULE_INITIAL_HANDLE_COUNT * sizeof(ebpf_handle_t));
+
+    request = reinterpret_cast<ebpf_operation_instantiate_native_module_request_t*>(request_buffer.data());
+    request->header.id = ebpf_operation_id_t::EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE;
+    request->header.length = static_cast<uint16_t>(request_buffer.size());
+    request->module_id = *module_id;
+    memcpy(
+        request_buffer.data() + offsetof(ebpf_operation_instantiate_native_module_request_t, data),
+        (char*)service_path.c_str(),
+        service_path_size);
+
+    error = invoke_ioctl(request_buffer, reply_buffer);
+    if (error != ERROR_SUCCESS) {
+        result = win32_error_code_to_ebpf_result(error);
+        EBPF_LOG_WIN32_WSTRING_API_FAILURE(EBPF_TRACELOG_KEYWORD_API, service_path.c_str(), invoke_ioctl);
+        goto Done;
+    }
+
+    reply = reinterpret_cast<ebpf_operation_instantiate_native_module_reply_t*>(reply_buffer.data());
+    ebpf_assert(reply->header.id == ebpf_operation_id_t::EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE);
+    *module_handle = reply->native_module_handle;
+    *count_of_maps = reply->count_of_maps;
+    *count_of_programs = reply->count_of_programs;
+
+    if (!reply->programs_loaded) {
+        // The handles did not fit in the reply, create the maps and programs with a separate request.
+        result = _load_native_programs(module_id, *count_of_maps, map_handles, *count_of_programs, program_handles);
+        goto Done;
+    }
+
+    map_handles_size = *count_of_maps * sizeof(ebpf_handle_t);
+    program_handles_size = *count_of_programs * sizeof(ebpf_handle_t);
+    if (*count_of_maps > 0) {
+        *map_handles = (ebpf_handle_t*)ebpf_allocate(map_handles_size);
+    }
+    if (*count_of_programs > 0) {
+        *program_handles = (ebpf_handle_t*)ebpf_allocate(program_handles_size);
+    }
+    if ((*count_of_maps > 0 && *map_handles == nullptr) || (*count_of_programs > 0 && *program_handles == nullptr)) {
+        EBPF_LOG_MESSAGE(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_API,
+            "_instantiate_native_module: Failed to allocate map and program handles");
+        result = EBPF_NO_MEMORY;
+
+        // Close the handles created by the execution context.
+        for (size_t i = 0; i < *count_of_maps + *count_of_programs; i++) {
+            ebpf_handle_t handle;
+            memcpy(&handle, reply->data + i * sizeof(handle), sizeof(handle));
+            Platform::CloseHandle(handle);
+        }
+        ebpf_free(*map_handles);
+        *map_handles = nullptr;
+        ebpf_free(*program_handles);
+        *program_handles = nullptr;
+        goto Done;
+    }
+
+    if (*map_handles != nullptr) {
+        memcpy(*map_handles, reply->data, map_handles_size);
+    }
+    if (*program_handles != nullptr) {
+        memcpy(*program_handles, reply->data + map_handles_size, program_handles_size);
+    }
+
+Done:
+    EBPF_RETURN_RESULT(result);
+}
+
 _Must_inspect_result_ ebpf_result_t
 _ebpf_object_load_native(
     _In_z_ const char* file_name,
@@ -3813,27 +4017,22 @@ _ebpf_object_load_native(
         }
 
         service_path = service_path + service_name.c_str();
-        result = _load_native_module(
-            service_path, &provider_module_id, native_module_handle, count_of_maps, count_of_programs);
+        result = _instantiate_native_module(
+            service_path,
+            &provider_module_id,
+            native_module_handle,
+            count_of_maps,
+            map_handles,
+            count_of_programs,
+            program_handles);
         if (result != EBPF_SUCCESS) {
             EBPF_LOG_MESSAGE_WSTRING(
                 EBPF_TRACELOG_LEVEL_ERROR,
                 EBPF_TRACELOG_KEYWORD_API,
-                "_ebpf_object_load_native: load native module failed",
+                "_ebpf_object_load_native: instantiate native module failed",
                 service_path.c_str());
             goto Done;
         }
-
-        result = _load_native_programs(
-            &provider_module_id, *count_of_maps, map_handles, *count_of_programs, program_handles);
-        if (result != EBPF_SUCCESS) {
-            EBPF_LOG_MESSAGE_STRING(
-                EBPF_TRACELOG_LEVEL_ERROR,
-                EBPF_TRACELOG_KEYWORD_API,
-                "_ebpf_object_load_native: load native programs failed",
-                file_name);
-            goto Done;
-        }
     } catch (const std::bad_alloc&) {
         result = EBPF_NO_MEMORY;
         goto Done;
@@ -4266,6 +4465,111 @@ ebpf_get_next_pinned_object_path(
 }
 CATCH_NO_MEMORY_EBPF_RESULT
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_get_pinned_object_paths_by_prefix(
+    _In_z_ const char* prefix,
+    ebpf_object_type_t type,
+    _Out_ uint32_t* path_count,
+    _Outptr_result_buffer_maybenull_(*path_count) ebpf_pinned_object_path_t** paths) NO_EXCEPT_TRY
+{
+    EBPF_LOG_ENTRY();
+    if (prefix == nullptr || path_count == nullptr || paths == nullptr) {
+        EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+    }
+    *path_count = 0;
+    *paths = nullptr;
+
+    char canonical_prefix[MAX_PATH];
+    ebpf_result_t result = ebpf_canonicalize_path(canonical_prefix, sizeof(canonical_prefix), prefix);
+    if (result != EBPF_SUCCESS) {
+        EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+    }
+    size_t canonical_prefix_length = strlen(canonical_prefix);
+
+    std::vector<std::pair<ebpf_object_type_t, std::string>> found_paths;
+    std::string start_path;
+    ebpf_protocol_buffer_t reply_buffer(UINT16_MAX);
+    auto reply = reinterpret_cast<ebpf_operation_get_pinned_paths_by_prefix_reply_t*>(reply_buffer.data());
+
+    // Fetch a page of paths at a time, resuming after the last path returned.
+    for (;;) {
+        ebpf_protocol_buffer_t request_buffer(
+            EBPF_OFFSET_OF(ebpf_operation_get_pinned_paths_by_prefix_request_t, data) + canonical_prefix_length +
+            start_path.size());
+        auto request = reinterpret_cast<ebpf_operation_get_pinned_paths_by_prefix_request_t*>(request_buffer.data());
+        request->header.id = ebpf_operation_id_t::EBPF_OPERATION_GET_PINNED_PATHS_BY_PREFIX;
+        request->header.length = static_cast<uint16_t>(request_buffer.size());
+        request->type = type;
+        request->prefix_length = static_cast<uint16_t>(canonical_prefix_length);
+        memcpy(request->data, canonical_prefix, canonical_prefix_length);
+        memcpy(request->data + canonical_prefix_length, start_path.data(), start_path.size());
+
+        result = win32_error_code_to_ebpf_result(invoke_ioctl(request_buffer, reply_buffer));
+        if (result == EBPF_NO_MORE_KEYS) {
+            break;
+        }
+        if (result != EBPF_SUCCESS) {
+            EBPF_RETURN_RESULT(result);
+        }
+        ebpf_assert(reply->header.id == ebpf_operation_id_t::EBPF_OPERATION_GET_PINNED_PATHS_BY_PREFIX);
+
+        size_t data_length =
+            reply->header.length - EBPF_OFFSET_OF(ebpf_operation_get_pinned_paths_by_prefix_reply_t, data);
+        size_t offset = 0;
+        for (uint32_t index = 0; index < reply->path_count; index++) {
+            auto entry = reinterpret_cast<const ebpf_operation_pinned_path_entry_t*>(reply->data + offset);
+            if (offset + EBPF_OFFSET_OF(ebpf_operation_pinned_path_entry_t, path) > data_length ||
+                offset + EBPF_OPERATION_PINNED_PATH_ENTRY_SIZE(entry->path_length) > data_length) {
+                EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+            }
+            found_paths.emplace_back(
+                entry->type, std::string(reinterpret_cast<const char*>(entry->path), entry->path_length));
+            offset += EBPF_OPERATION_PINNED_PATH_ENTRY_SIZE(entry->path_length);
+        }
+        if (reply->path_count == 0) {
+            EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+        }
+        start_path = found_paths.back().second;
+    }
+
+    if (found_paths.empty()) {
+        EBPF_RETURN_RESULT(EBPF_SUCCESS);
+    }
+
+    ebpf_pinned_object_path_t* local_paths =
+        reinterpret_cast<ebpf_pinned_object_path_t*>(ebpf_allocate(found_paths.size() * sizeof(*local_paths)));
+    if (local_paths == nullptr) {
+        EBPF_RETURN_RESULT(EBPF_NO_MEMORY);
+    }
+    for (size_t index = 0; index < found_paths.size(); index++) {
+        local_paths[index].type = found_paths[index].first;
+        local_paths[index].path = cxplat_duplicate_string(found_paths[index].second.c_str());
+        if (local_paths[index].path == nullptr) {
+            ebpf_free_pinned_object_paths(static_cast<uint32_t>(index), local_paths);
+            EBPF_RETURN_RESULT(EBPF_NO_MEMORY);
+        }
+    }
+
+    *path_count = static_cast<uint32_t>(found_paths.size());
+    *paths = local_paths;
+    EBPF_RETURN_RESULT(EBPF_SUCCESS);
+}
+CATCH_NO_MEMORY_EBPF_RESULT
+
+void
+ebpf_free_pinned_object_paths(
+    uint32_t path_count, _In_opt_count_(path_count) _Post_ptr_invalid_ ebpf_pinned_object_path_t* paths) noexcept
+{
+    EBPF_LOG_ENTRY();
+    if (paths != nullptr) {
+        for (uint32_t index = 0; index < path_count; index++) {
+            ebpf_free(paths[index].path);
+        }
+        ebpf_free(paths);
+    }
+    EBPF_LOG_EXIT();
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_canonicalize_pin_path(_Out_writes_(output_size) char* output, size_t output_size, _In_z_ const char* input)
     NO_EXCEPT_TRY
@@ -4323,6 +4627,45 @@ ebpf_get_next_program_id(ebpf_id_t start_id, _Out_ ebpf_id_t* next_id) NO_EXCEPT
 }
 CATCH_NO_MEMORY_EBPF_RESULT
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_get_next_object_ids(
+    ebpf_object_type_t type,
+    ebpf_id_t start_id,
+    _Out_writes_to_(*id_count, *id_count) ebpf_id_t* ids,
+    _Inout_ uint32_t* id_count) NO_EXCEPT_TRY
+{
+    EBPF_LOG_ENTRY();
+    if (ids == nullptr || id_count == nullptr || *id_count == 0) {
+        EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+    }
+
+    // The reply length is limited to 16 bits.
+    size_t max_ids_per_call =
+        (UINT16_MAX - EBPF_OFFSET_OF(ebpf_operation_get_next_ids_reply_t, ids)) / sizeof(ebpf_id_t);
+    size_t ids_to_fetch = (*id_count < max_ids_per_call) ? *id_count : max_ids_per_call;
+    *id_count = 0;
+
+    ebpf_operation_get_next_ids_request_t request{
+        sizeof(request), ebpf_operation_id_t::EBPF_OPERATION_GET_NEXT_IDS, type, start_id};
+    ebpf_protocol_buffer_t reply_buffer(
+        EBPF_OFFSET_OF(ebpf_operation_get_next_ids_reply_t, ids) + ids_to_fetch * sizeof(ebpf_id_t));
+    auto reply = reinterpret_cast<ebpf_operation_get_next_ids_reply_t*>(reply_buffer.data());
+
+    ebpf_result_t result = win32_error_code_to_ebpf_result(invoke_ioctl(request, reply_buffer));
+    if (result != EBPF_SUCCESS) {
+        EBPF_RETURN_RESULT(result);
+    }
+    ebpf_assert(reply->header.id == ebpf_operation_id_t::EBPF_OPERATION_GET_NEXT_IDS);
+    if (reply->id_count > ids_to_fetch) {
+        EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+    }
+
+    std::copy(reply->ids, reply->ids + reply->id_count, ids);
+    *id_count = reply->id_count;
+    EBPF_RETURN_RESULT(EBPF_SUCCESS);
+}
+CATCH_NO_MEMORY_EBPF_RESULT
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_object_get_info_by_fd(
     fd_t bpf_fd,
@@ -4463,12 +4806,30 @@ typedef struct _ebpf_map_async_query_context
 
 } ebpf_map_async_query_context_t;
 
+// Time for which records of an ordered subscription to a per-CPU ring buffer map are held, so that records
+// reserved earlier on other sub-rings can still be indicated ahead of them. Ordering is best-effort: a record that
+// reaches the consumer more than this long after a later record from another sub-ring is indicated out of order.
+#define EBPF_RING_BUFFER_REORDER_WINDOW std::chrono::milliseconds(2)
+
+// Maximum number of records an ordered subscription holds. Once exceeded, the oldest records are indicated before
+// their reordering window ends, so that a fast producer cannot grow the held records without bound.
+#define EBPF_RING_BUFFER_REORDER_MAXIMUM_RECORDS 4096
+
+typedef struct _ebpf_map_ordered_record
+{
+    std::chrono::steady_clock::time_point arrival_time;
+    std::vector<uint8_t> data;
+} ebpf_map_ordered_record_t;
+
 typedef struct _ebpf_map_subscription
 {
     _ebpf_map_subscription()
         : unsubscribed(false), map_handle(ebpf_handle_invalid), callback_context(nullptr),
           ring_buffer_sample_callback(nullptr), perf_buffer_sample_callback(nullptr), lost_callback(nullptr),
-          key_size(0), value_size(0), max_entries(0), type(BPF_MAP_TYPE_UNSPEC)
+          key_size(0), value_size(0), max_entries(0), type(BPF_MAP_TYPE_UNSPEC), per_cpu_rings(false), flags(0),
+          reorder_timer(nullptr), busy_poll_budget_us(0), consumer_offset(nullptr), producer_offset(nullptr),
+          data(nullptr), data_size(0), busy_poll_wait_event(nullptr), busy_poll_stop(false), record_count(0),
+          ioctl_count(0), wait_count(0)
     {
     }
 
@@ -4476,6 +4837,30 @@ typedef struct _ebpf_map_subscription
     {
         EBPF_LOG_ENTRY();
 
+        ebpf_assert(!busy_poll_thread.joinable());
+
+        if (consumer_offset != nullptr) {
+            ebpf_operation_ring_buffer_map_unmap_buffer_request_t request{
+                sizeof(request),
+                ebpf_operation_id_t::EBPF_OPERATION_RING_BUFFER_MAP_UNMAP_BUFFER,
+                map_handle,
+                reinterpret_cast<uint64_t>(consumer_offset),
+                reinterpret_cast<uint64_t>(producer_offset),
+                reinterpret_cast<uint64_t>(data)};
+            (void)invoke_ioctl(request);
+        }
+
+        if (busy_poll_wait_event != nullptr) {
+            ::CloseHandle(busy_poll_wait_event);
+        }
+
+        if (reorder_timer != nullptr) {
+            // Cancel the timer and wait for any running flush before the held records are freed.
+            SetThreadpoolTimer(reorder_timer, nullptr, 0, 0);
+            WaitForThreadpoolTimerCallbacks(reorder_timer, TRUE);
+            CloseThreadpoolTimer(reorder_timer);
+        }
+
         if (map_handle != ebpf_handle_invalid) {
             Platform::CloseHandle(map_handle);
         }
@@ -4494,13 +4879,77 @@ typedef struct _ebpf_map_subscription
     uint32_t value_size;
     uint32_t max_entries;
     uint32_t type;
+    // True if the map is a ring buffer map backed by per-CPU sub-rings, each with its own async query context.
+    bool per_cpu_rings;
+    uint64_t flags; ///< EBPF_RING_BUFFER_FLAG_* flags.
+    // Serializes the indication of records from the sub-rings of a per-CPU ring buffer map.
+    std::mutex indication_lock;
+    // Records of an ordered subscription that are held for the reordering window, keyed by reservation timestamp.
+    _Guarded_by_(indication_lock) std::multimap<uint64_t, ebpf_map_ordered_record_t> ordered_records;
+    PTP_TIMER reorder_timer;
     std::map<uint32_t, std::unique_ptr<ebpf_map_async_query_context_t>> async_query_contexts;
     std::condition_variable cleanup_complete_event;
+    // Non-zero if records are consumed by busy_poll_thread from the memory-mapped ring instead of by async queries.
+    uint32_t busy_poll_budget_us;
+    volatile uint64_t* consumer_offset;
+    const volatile uint64_t* producer_offset;
+    const uint8_t* data;
+    size_t data_size;
+    // Auto-reset event that the producer signals when it submits a record to a non-empty ring.
+    HANDLE busy_poll_wait_event;
+    std::atomic<bool> busy_poll_stop;
+    std::thread busy_poll_thread;
+    std::atomic<uint64_t> record_count;
+    std::atomic<uint64_t> ioctl_count;
+    std::atomic<uint64_t> wait_count;
 } ebpf_map_subscription_t;
 
 typedef std::unique_ptr<ebpf_map_subscription_t> ebpf_map_subscription_ptr;
 typedef std::unique_ptr<ebpf_map_async_query_context_t> ebpf_map_async_query_context_ptr;
 
+/**
+ * @brief Indicate, in timestamp order, the held records of an ordered subscription that have been held for the
+ * reordering window, and arm the reorder timer for the remaining records.
+ *
+ * @param[in, out] subscription Ordered subscription to a per-CPU ring buffer map.
+ */
+static void
+_ebpf_map_subscription_indicate_ordered_records(_Inout_ ebpf_map_subscription_t* subscription)
+{
+    std::scoped_lock lock{subscription->indication_lock};
+    auto now = std::chrono::steady_clock::now();
+
+    while (!subscription->ordered_records.empty()) {
+        auto record = subscription->ordered_records.begin();
+        if (now - record->second.arrival_time < EBPF_RING_BUFFER_REORDER_WINDOW &&
+            subscription->ordered_records.size() <= EBPF_RING_BUFFER_REORDER_MAXIMUM_RECORDS) {
+            break;
+        }
+        int callback_result = subscription->ring_buffer_sample_callback(
+            subscription->callback_context, record->second.data.data(), record->second.data.size());
+        subscription->ordered_records.erase(record);
+        if (callback_result != 0 &&
+            subscription->ordered_records.size() <= EBPF_RING_BUFFER_REORDER_MAXIMUM_RECORDS) {
+            break;
+        }
+    }
+
+    if (!subscription->ordered_records.empty()) {
+        // Indicate the remaining records once the oldest of them has been held for the reordering window, even if no
+        // more records arrive. A negative due time is relative, in 100ns units.
+        auto remaining =
+            subscription->ordered_records.begin()->second.arrival_time + EBPF_RING_BUFFER_REORDER_WINDOW - now;
+        if (remaining < std::chrono::steady_clock::duration::zero()) {
+            remaining = std::chrono::steady_clock::duration::zero();
+        }
+        auto delay = std::chrono::duration_cast<std::chrono::microseconds>(remaining);
+        ULARGE_INTEGER due_time;
+        due_time.QuadPart = static_cast<ULONGLONG>(-(static_cast<LONGLONG>(delay.count()) * 10));
+        FILETIME due_file_time{due_time.LowPart, due_time.HighPart};
+        SetThreadpoolTimer(subscription->reorder_timer, &due_file_time, 0, 0);
+    }
+}
+
 static ebpf_result_t
 _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
 {
@@ -4540,6 +4989,8 @@ _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
         // Async IOCTL operation returned with success status. Read the records and indicate it to the
         // subscriber.
 
+        subscription->wait_count++;
+
         ebpf_operation_map_async_query_reply_t* reply = &async_query_context->reply;
         ebpf_map_async_query_result_t* async_query_result = &reply->async_query_result;
         consumer = async_query_result->consumer;
@@ -4572,13 +5023,45 @@ _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
                 }
 
                 if (!ebpf_ring_buffer_record_is_discarded(record)) {
-                    int callback_result = subscription->ring_buffer_sample_callback(
-                        subscription->callback_context,
-                        const_cast<void*>(reinterpret_cast<const void*>(record->data)),
-                        ebpf_ring_buffer_record_length(record));
+                    const uint8_t* data = record->data;
+                    size_t length = ebpf_ring_buffer_record_length(record);
+                    uint64_t timestamp = 0;
+                    if (subscription->per_cpu_rings) {
+                        // Strip the prefix that the execution context stores ahead of each record in a sub-ring.
+                        ebpf_assert(length >= sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t));
+                        timestamp = reinterpret_cast<const ebpf_ring_buffer_per_cpu_record_prefix_t*>(data)->timestamp;
+                        data += sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t);
+                        length -= sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t);
+                    }
 
-                    if (callback_result != 0) {
-                        break;
+                    subscription->record_count++;
+                    if (subscription->flags & EBPF_RING_BUFFER_FLAG_ORDERED) {
+                        // Hold a copy of the record, so that the sub-ring space can be returned right away.
+                        bool limit_reached;
+                        {
+                            std::scoped_lock lock{subscription->indication_lock};
+                            subscription->ordered_records.insert(
+                                {timestamp,
+                                 ebpf_map_ordered_record_t{
+                                     std::chrono::steady_clock::now(), std::vector<uint8_t>(data, data + length)}});
+                            limit_reached =
+                                subscription->ordered_records.size() > EBPF_RING_BUFFER_REORDER_MAXIMUM_RECORDS;
+                        }
+                        if (limit_reached) {
+                            _ebpf_map_subscription_indicate_ordered_records(subscription);
+                        }
+                    } else {
+                        // Sub-rings complete on different threads, but records are indicated one at a time.
+                        std::unique_lock<std::mutex> lock(subscription->indication_lock, std::defer_lock);
+                        if (subscription->per_cpu_rings) {
+                            lock.lock();
+                        }
+                        int callback_result = subscription->ring_buffer_sample_callback(
+                            subscription->callback_context, const_cast<uint8_t*>(data), length);
+
+                        if (callback_result != 0) {
+                            break;
+                        }
                     }
                 }
             } else {
@@ -4588,6 +5071,7 @@ _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
                     // The lock bit check read-acquires the header, so spinning will get a fresh value.
                 }
 
+                subscription->record_count++;
                 subscription->perf_buffer_sample_callback(
                     subscription->callback_context,
                     cpu_id,
@@ -4597,6 +5081,10 @@ _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
 
             consumer += ebpf_ring_buffer_record_total_size(record);
         }
+
+        if (subscription->flags & EBPF_RING_BUFFER_FLAG_ORDERED) {
+            _ebpf_map_subscription_indicate_ordered_records(subscription);
+        }
     }
 
     {
@@ -4629,6 +5117,7 @@ _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
                 cpu_id,
                 consumer};
             memset(&async_query_context->reply, 0, sizeof(ebpf_operation_map_async_query_reply_t));
+            subscription->ioctl_count++;
             result = win32_error_code_to_ebpf_result(invoke_ioctl(
                 async_query_request,
                 async_query_context->reply,
@@ -4647,6 +5136,135 @@ _ebpf_map_async_query_completion(_Inout_ void* completion_context) NO_EXCEPT_TRY
 }
 CATCH_NO_MEMORY_EBPF_RESULT
 
+/**
+ * @brief Consume the records of a busy-polled ring buffer subscription until it is unsubscribed.
+ *
+ * The producer offset is polled for busy_poll_budget_us after the last record consumed, so that a busy ring is drained
+ * without any IOCTLs or thread wakeups. Once the ring has been idle for the whole budget, the thread blocks on the wait
+ * event. The producer signals the event whenever it submits a record while the ring is not empty, so a record
+ * submitted after the last poll wakes the thread up.
+ *
+ * @param[in, out] subscription Busy-polled subscription to a ring buffer map.
+ */
+static void
+_ebpf_map_subscription_busy_poll(_Inout_ ebpf_map_subscription_t* subscription) noexcept
+{
+    const auto budget = std::chrono::microseconds(subscription->busy_poll_budget_us);
+    uint64_t consumer = ReadULong64NoFence(subscription->consumer_offset);
+    auto last_record_time = std::chrono::steady_clock::now();
+
+    while (!subscription->busy_poll_stop) {
+        uint64_t producer = ReadULong64Acquire(subscription->producer_offset);
+        bool consumed = false;
+
+        for (;;) {
+            auto record =
+                ebpf_ring_buffer_next_record(subscription->data, subscription->data_size, consumer, producer);
+            if ((record == nullptr) || ebpf_ring_buffer_record_is_locked(record)) {
+                // No more records, or the next record is not submitted yet.
+                break;
+            }
+
+            int callback_result = 0;
+            if (!ebpf_ring_buffer_record_is_discarded(record)) {
+                subscription->record_count++;
+                callback_result = subscription->ring_buffer_sample_callback(
+                    subscription->callback_context,
+                    const_cast<uint8_t*>(record->data),
+                    ebpf_ring_buffer_record_length(record));
+            }
+
+            // Return the record space once the callback is done with it. The record is returned even if the callback
+            // stops the batch, so that it is not indicated again. The release orders the reads of the record before
+            // the producer can see the space as free and overwrite it.
+            consumer += ebpf_ring_buffer_record_total_size(record);
+            WriteULong64Release(subscription->consumer_offset, consumer);
+            consumed = true;
+
+            if (callback_result != 0) {
+                break;
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (consumed) {
+            last_record_time = now;
+        } else if (now - last_record_time < budget) {
+            YieldProcessor();
+        } else {
+            // The ring has been idle for the whole budget.
+            subscription->wait_count++;
+            WaitForSingleObject(subscription->busy_poll_wait_event, INFINITE);
+            last_record_time = std::chrono::steady_clock::now();
+        }
+    }
+}
+
+/**
+ * @brief Map the ring of a ring buffer map into the process, register the wait event and start the thread that
+ * busy-polls it.
+ *
+ * @param[in, out] subscription Subscription to a ring buffer map with a single ring.
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Out of memory.
+ */
+static _Must_inspect_result_ ebpf_result_t
+_ebpf_map_subscription_start_busy_poll(_Inout_ ebpf_map_subscription_t* subscription)
+{
+    ebpf_operation_ring_buffer_map_map_buffer_request_t map_buffer_request{
+        sizeof(map_buffer_request),
+        ebpf_operation_id_t::EBPF_OPERATION_RING_BUFFER_MAP_MAP_BUFFER,
+        subscription->map_handle};
+    ebpf_operation_ring_buffer_map_map_buffer_reply_t map_buffer_reply{};
+    ebpf_result_t result = win32_error_code_to_ebpf_result(invoke_ioctl(map_buffer_request, map_buffer_reply));
+    if (result != EBPF_SUCCESS) {
+        return result;
+    }
+    subscription->consumer_offset =
+        reinterpret_cast<volatile uint64_t*>(static_cast<uintptr_t>(map_buffer_reply.consumer_address));
+    subscription->producer_offset =
+        reinterpret_cast<const volatile uint64_t*>(static_cast<uintptr_t>(map_buffer_reply.producer_address));
+    subscription->data = reinterpret_cast<const uint8_t*>(static_cast<uintptr_t>(map_buffer_reply.data_address));
+    subscription->data_size = map_buffer_reply.data_size;
+
+    subscription->busy_poll_wait_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (subscription->busy_poll_wait_event == nullptr) {
+        result = win32_error_code_to_ebpf_result(GetLastError());
+        _Analysis_assume_(result != EBPF_SUCCESS);
+        EBPF_LOG_WIN32_API_FAILURE(EBPF_TRACELOG_KEYWORD_API, CreateEvent);
+        return result;
+    }
+
+    ebpf_operation_map_set_wait_handle_request_t wait_handle_request{
+        sizeof(wait_handle_request),
+        ebpf_operation_id_t::EBPF_OPERATION_MAP_SET_WAIT_HANDLE,
+        subscription->map_handle,
+        reinterpret_cast<ebpf_handle_t>(subscription->busy_poll_wait_event),
+        0,
+        0};
+    result = win32_error_code_to_ebpf_result(invoke_ioctl(wait_handle_request));
+    if (result != EBPF_SUCCESS) {
+        return result;
+    }
+
+    try {
+        subscription->busy_poll_thread = std::thread(_ebpf_map_subscription_busy_poll, subscription);
+    } catch (const std::system_error&) {
+        return EBPF_NO_MEMORY;
+    }
+
+    return EBPF_SUCCESS;
+}
+
+void
+ebpf_map_subscription_add_statistics(
+    _In_ const ebpf_map_subscription_t* subscription, _Inout_ ebpf_ring_buffer_statistics_t* statistics) noexcept
+{
+    statistics->records += subscription->record_count;
+    statistics->ioctls += subscription->ioctl_count;
+    statistics->waits += subscription->wait_count;
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_map_subscribe(
     fd_t map_fd,
@@ -4655,9 +5273,12 @@ ebpf_map_subscribe(
     _Inout_opt_ void* callback_context,
     _In_ const void* sample_callback,
     _In_opt_ const void* lost_callback,
+    _In_opt_ const ebpf_ring_buffer_opts_t* opts,
     _Outptr_ ebpf_map_subscription_t** subscription) NO_EXCEPT_TRY
 {
     EBPF_LOG_ENTRY();
+    uint64_t flags = (opts != nullptr) ? opts->flags : 0;
+    uint32_t busy_poll_budget_us = (opts != nullptr) ? opts->busy_poll_budget_us : 0;
 
     try {
 
@@ -4708,6 +5329,50 @@ ebpf_map_subscribe(
             EBPF_RETURN_RESULT(result);
         }
 
+        bool per_cpu_rings = false;
+        if (type == BPF_MAP_TYPE_RINGBUF) {
+            struct bpf_map_info info = {0};
+            uint32_t info_size = (uint32_t)sizeof(info);
+            result = ebpf_object_get_info(map_handle, &info, &info_size, NULL);
+            if (result != EBPF_SUCCESS) {
+                EBPF_RETURN_RESULT(result);
+            }
+            per_cpu_rings = (info.map_flags & EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU) != 0;
+        }
+
+        if ((flags & ~EBPF_RING_BUFFER_FLAG_ORDERED) || ((flags & EBPF_RING_BUFFER_FLAG_ORDERED) && !per_cpu_rings)) {
+            result = EBPF_INVALID_ARGUMENT;
+            EBPF_LOG_MESSAGE_ERROR(
+                EBPF_TRACELOG_LEVEL_ERROR,
+                EBPF_TRACELOG_KEYWORD_API,
+                "ebpf_map_subscribe API is called with flags that are not supported on the map.",
+                result);
+            EBPF_RETURN_RESULT(result);
+        }
+
+        // Only a ring buffer map with a single ring can be mapped into the process and busy-polled.
+        if ((busy_poll_budget_us != 0) && ((type != BPF_MAP_TYPE_RINGBUF) || per_cpu_rings)) {
+            result = EBPF_INVALID_ARGUMENT;
+            EBPF_LOG_MESSAGE_ERROR(
+                EBPF_TRACELOG_LEVEL_ERROR,
+                EBPF_TRACELOG_KEYWORD_API,
+                "ebpf_map_subscribe API is called with a busy-poll budget on a map that cannot be busy-polled.",
+                result);
+            EBPF_RETURN_RESULT(result);
+        }
+
+        // A ring buffer map backed by per-CPU sub-rings is consumed as a single ring buffer, by subscribing to every
+        // sub-ring and merging their records.
+        std::vector<uint32_t> ring_ids;
+        if (per_cpu_rings) {
+            uint32_t ring_count = libbpf_num_possible_cpus();
+            for (uint32_t ring_id = 0; ring_id < ring_count; ring_id++) {
+                ring_ids.push_back(ring_id);
+            }
+            cpu_ids = ring_ids.data();
+            cpu_id_count = ring_ids.size();
+        }
+
         *subscription = nullptr;
         ebpf_map_subscription_ptr local_subscription = std::make_unique<ebpf_map_subscription_t>();
         local_subscription->map_handle = ebpf_handle_invalid;
@@ -4716,6 +5381,9 @@ ebpf_map_subscribe(
         local_subscription->type = type;
         local_subscription->max_entries = max_entries;
         local_subscription->callback_context = callback_context;
+        local_subscription->per_cpu_rings = per_cpu_rings;
+        local_subscription->flags = flags;
+        local_subscription->busy_poll_budget_us = busy_poll_budget_us;
 
         if (local_subscription->type == BPF_MAP_TYPE_PERF_EVENT_ARRAY) {
             local_subscription->perf_buffer_sample_callback = reinterpret_cast<perf_buffer_sample_fn>(sample_callback);
@@ -4739,6 +5407,33 @@ ebpf_map_subscribe(
             EBPF_RETURN_RESULT(result);
         }
 
+        if (flags & EBPF_RING_BUFFER_FLAG_ORDERED) {
+            local_subscription->reorder_timer = CreateThreadpoolTimer(
+                [](_Inout_ TP_CALLBACK_INSTANCE* instance, _Inout_ void* context, _Inout_ PTP_TIMER timer) {
+                    UNREFERENCED_PARAMETER(instance);
+                    UNREFERENCED_PARAMETER(timer);
+                    _ebpf_map_subscription_indicate_ordered_records(
+                        reinterpret_cast<ebpf_map_subscription_t*>(context));
+                },
+                local_subscription.get(),
+                nullptr);
+            if (local_subscription->reorder_timer == nullptr) {
+                result = win32_error_code_to_ebpf_result(GetLastError());
+                _Analysis_assume_(result != EBPF_SUCCESS);
+                EBPF_LOG_WIN32_API_FAILURE(EBPF_TRACELOG_KEYWORD_API, CreateThreadpoolTimer);
+                EBPF_RETURN_RESULT(result);
+            }
+        }
+
+        if (busy_poll_budget_us != 0) {
+            result = _ebpf_map_subscription_start_busy_poll(local_subscription.get());
+            if (result != EBPF_SUCCESS) {
+                EBPF_RETURN_RESULT(result);
+            }
+            *subscription = local_subscription.release();
+            EBPF_RETURN_RESULT(result);
+        }
+
         for (size_t cpu_index = 0; cpu_index < cpu_id_count; cpu_index++) {
             ebpf_map_async_query_context_ptr local_async_query_context =
                 std::make_unique<ebpf_map_async_query_context_t>();
@@ -4777,6 +5472,7 @@ ebpf_map_subscribe(
                 local_subscription->map_handle,
                 cpu_ids[cpu_index],
                 query_buffer_reply.consumer_offset};
+            local_subscription->ioctl_count++;
             result = win32_error_code_to_ebpf_result(invoke_ioctl(
                 async_query_request,
                 local_async_query_context->reply,
@@ -4841,6 +5537,13 @@ ebpf_map_unsubscribe(_In_ _Post_invalid_ ebpf_map_subscription_t* subscription)
     ebpf_assert(subscription);
     boolean cancel_result = true;
 
+    if (subscription->busy_poll_thread.joinable()) {
+        // Wake the thread up in case it is blocked on an idle ring.
+        subscription->busy_poll_stop = true;
+        SetEvent(subscription->busy_poll_wait_event);
+        subscription->busy_poll_thread.join();
+    }
+
     {
         std::scoped_lock lock{subscription->lock};
 
@@ -5077,6 +5780,97 @@ ebpf_program_test_run(fd_t program_fd, _Inout_ ebpf_test_run_options_t* options)
 }
 CATCH_NO_MEMORY_EBPF_RESULT
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_program_test_run_batch(fd_t program_fd, _Inout_ ebpf_test_run_batch_options_t* options) NO_EXCEPT_TRY
+{
+    EBPF_LOG_ENTRY();
+
+    ebpf_result_t result;
+
+    size_t input_buffer_size = EBPF_OFFSET_OF(ebpf_operation_program_test_run_batch_request_t, data);
+    size_t output_buffer_size = EBPF_OFFSET_OF(ebpf_operation_program_test_run_batch_reply_t, return_values);
+    ebpf_signal_t completion_event;
+    OVERLAPPED overlapped;
+    memset(&overlapped, 0, sizeof(overlapped));
+    overlapped.hEvent = completion_event.get();
+
+    if (options->input_count == 0 || options->inputs == nullptr || options->return_values == nullptr) {
+        EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+    }
+
+    // Each input is packed as a record header followed by its data and context, padded to 8 bytes.
+    for (size_t index = 0; index < options->input_count; index++) {
+        const ebpf_test_run_batch_input_t& input = options->inputs[index];
+        if (input.data_size_in > MAXUINT16 || input.context_size_in > MAXUINT16) {
+            EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+        }
+        input_buffer_size += sizeof(ebpf_operation_program_test_run_batch_record_t) + input.data_size_in +
+                             input.context_size_in;
+        input_buffer_size = EBPF_PAD_8(input_buffer_size);
+        if (input_buffer_size > MAXUINT16) {
+            EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+        }
+    }
+
+    if (options->input_count > (MAXUINT16 - output_buffer_size) / sizeof(uint64_t)) {
+        EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
+    }
+    output_buffer_size += options->input_count * sizeof(uint64_t);
+
+    ebpf_protocol_buffer_t request_buffer(input_buffer_size);
+    ebpf_protocol_buffer_t reply_buffer(output_buffer_size);
+
+    ebpf_operation_program_test_run_batch_request_t* request =
+        reinterpret_cast<ebpf_operation_program_test_run_batch_request_t*>(request_buffer.data());
+    ebpf_operation_program_test_run_batch_reply_t* reply =
+        reinterpret_cast<ebpf_operation_program_test_run_batch_reply_t*>(reply_buffer.data());
+
+    request->header.id = EBPF_OPERATION_PROGRAM_TEST_RUN_BATCH;
+    request->header.length = static_cast<uint16_t>(request_buffer.size());
+    request->program_handle = _get_handle_from_file_descriptor(program_fd);
+    request->repeat_count = options->repeat_count;
+    request->flags = options->flags;
+    request->cpu = options->cpu;
+    request->batch_size = options->batch_size;
+    request->input_count = static_cast<uint32_t>(options->input_count);
+
+    size_t offset = EBPF_OFFSET_OF(ebpf_operation_program_test_run_batch_request_t, data);
+    for (size_t index = 0; index < options->input_count; index++) {
+        const ebpf_test_run_batch_input_t& input = options->inputs[index];
+        auto record = reinterpret_cast<ebpf_operation_program_test_run_batch_record_t*>(request_buffer.data() + offset);
+        record->data_size = static_cast<uint16_t>(input.data_size_in);
+        record->context_size = static_cast<uint16_t>(input.context_size_in);
+        offset += sizeof(*record);
+        std::copy(input.data_in, input.data_in + input.data_size_in, request_buffer.data() + offset);
+        offset += input.data_size_in;
+        std::copy(input.context_in, input.context_in + input.context_size_in, request_buffer.data() + offset);
+        offset = EBPF_PAD_8(offset + input.context_size_in);
+    }
+
+    result = win32_error_code_to_ebpf_result(invoke_ioctl(request_buffer, reply_buffer, &overlapped));
+    if (result == EBPF_PENDING) {
+        unsigned long bytes_returned;
+        completion_event.wait();
+        if (GetOverlappedResult(
+                reinterpret_cast<HANDLE>(get_async_device_handle()), &overlapped, &bytes_returned, FALSE)) {
+            result = EBPF_SUCCESS;
+        } else {
+            result = win32_error_code_to_ebpf_result(GetLastError());
+        }
+    }
+
+    if (result == EBPF_SUCCESS) {
+        std::copy(reply->return_values, reply->return_values + options->input_count, options->return_values);
+        options->duration = reply->duration;
+        options->latency_p50 = reply->latency_p50;
+        options->latency_p99 = reply->latency_p99;
+        options->latency_p999 = reply->latency_p999;
+    }
+
+    EBPF_RETURN_RESULT(result);
+}
+CATCH_NO_MEMORY_EBPF_RESULT
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_program_synchronize() NO_EXCEPT_TRY
 {
@@ -5118,6 +5912,39 @@ ebpf_api_thread_local_initialize() noexcept
     // Added for symmetry with ebpf_api_thread_local_cleanup.
 }
 
+void
+ebpf_api_parallel_for(size_t count, size_t max_threads, _In_ const std::function<void(size_t)>& work) noexcept
+{
+    std::atomic<size_t> next_index = 0;
+    auto run = [&]() {
+        for (size_t index = next_index++; index < count; index = next_index++) {
+            work(index);
+        }
+    };
+
+    if (max_threads == 0) {
+        max_threads = std::thread::hardware_concurrency();
+    }
+    size_t thread_count = (count < max_threads) ? count : max_threads;
+
+    // If a thread can't be started, the threads that did start pick up its share of the work.
+    std::vector<std::thread> threads;
+    try {
+        for (size_t i = 1; i < thread_count; i++) {
+            threads.emplace_back([&]() {
+                run();
+                ebpf_clear_thread_local_storage();
+            });
+        }
+    } catch (const std::exception&) {
+    }
+
+    run();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_program_set_flags(fd_t program_fd, uint64_t flags) noexcept
 {
@@ -5135,6 +5962,19 @@ ebpf_program_set_flags(fd_t program_fd, uint64_t flags) noexcept
     return win32_error_code_to_ebpf_result(invoke_ioctl(request));
 }
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_enable_program_statistics(bool enable) NO_EXCEPT_TRY
+{
+    EBPF_LOG_ENTRY();
+    ebpf_operation_program_enable_stats_request_t request;
+    request.header.id = ebpf_operation_id_t::EBPF_OPERATION_PROGRAM_ENABLE_STATS;
+    request.header.length = sizeof(request);
+    request.enable = enable ? 1 : 0;
+
+    EBPF_RETURN_RESULT(win32_error_code_to_ebpf_result(invoke_ioctl(request)));
+}
+CATCH_NO_MEMORY_EBPF_RESULT
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_ring_buffer_map_map_buffer(
     fd_t map_fd,
@@ -361,42 +361,71 @@ typedef struct ring_buffer
     std::vector<ebpf_map_subscription_t*> subscriptions;
 } ring_buffer_t;
 
-struct ring_buffer*
-ring_buffer__new(int map_fd, ring_buffer_sample_fn sample_cb, void* ctx, const struct ring_buffer_opts* /* opts */)
-{
+_Must_inspect_result_ ebpf_result_t
+ebpf_ring_buffer_create(
+    fd_t map_fd,
+    _In_ ebpf_ring_buffer_sample_fn sample_callback,
+    _Inout_opt_ void* callback_context,
+    _In_opt_ const ebpf_ring_buffer_opts_t* opts,
+    _Outptr_ struct ring_buffer** ring_buffer) noexcept
+{
+    EBPF_LOG_ENTRY();
     ebpf_result result = EBPF_SUCCESS;
-    ring_buffer_t* local_ring_buffer = nullptr;
+    ebpf_ring_buffer_opts_t local_opts = {sizeof(local_opts)};
 
-    if (sample_cb == nullptr) {
+    *ring_buffer = nullptr;
+
+    if (sample_callback == nullptr) {
         result = EBPF_INVALID_ARGUMENT;
         goto Exit;
     }
 
+    if (opts != nullptr) {
+        // Older callers may pass a smaller structure, but it must at least include the flags.
+        if (opts->sz < offsetof(ebpf_ring_buffer_opts_t, flags) + sizeof(opts->flags)) {
+            result = EBPF_INVALID_ARGUMENT;
+            goto Exit;
+        }
+        // Options that an older caller does not know about keep their defaults.
+        memcpy(&local_opts, opts, (opts->sz < sizeof(local_opts)) ? opts->sz : sizeof(local_opts));
+        local_opts.sz = sizeof(local_opts);
+    }
+
     try {
-        std::unique_ptr<ring_buffer_t> ring_buffer = std::make_unique<ring_buffer_t>();
+        std::unique_ptr<ring_buffer_t> local_ring_buffer = std::make_unique<ring_buffer_t>();
         ebpf_map_subscription_t* subscription = nullptr;
         uint32_t cpu_id = 0;
 
-        result = ebpf_map_subscribe(map_fd, &cpu_id, 1, ctx, (void*)sample_cb, nullptr, &subscription);
+        result = ebpf_map_subscribe(
+            map_fd, &cpu_id, 1, callback_context, (void*)sample_callback, nullptr, &local_opts, &subscription);
 
         if (result != EBPF_SUCCESS) {
             goto Exit;
         }
 
         try {
-            ring_buffer->subscriptions.push_back(subscription);
+            local_ring_buffer->subscriptions.push_back(subscription);
         } catch (const std::bad_alloc&) {
             ebpf_map_unsubscribe(subscription);
             result = EBPF_NO_MEMORY;
             goto Exit;
         }
 
-        local_ring_buffer = ring_buffer.release();
+        *ring_buffer = local_ring_buffer.release();
     } catch (const std::bad_alloc&) {
         result = EBPF_NO_MEMORY;
         goto Exit;
     }
 Exit:
+    EBPF_RETURN_RESULT(result);
+}
+
+struct ring_buffer*
+ring_buffer__new(int map_fd, ring_buffer_sample_fn sample_cb, void* ctx, const struct ring_buffer_opts* /* opts */)
+{
+    struct ring_buffer* local_ring_buffer = nullptr;
+
+    ebpf_result result = ebpf_ring_buffer_create(map_fd, sample_cb, ctx, nullptr, &local_ring_buffer);
     if (result != EBPF_SUCCESS) {
         errno = libbpf_result_err(result);
         EBPF_LOG_FUNCTION_ERROR(result);
@@ -404,6 +433,22 @@ Exit:
     EBPF_RETURN_POINTER(ring_buffer_t*, local_ring_buffer);
 }
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_ring_buffer_get_statistics(
+    _In_ const struct ring_buffer* ring_buffer, _Out_ ebpf_ring_buffer_statistics_t* statistics) noexcept
+{
+    if ((ring_buffer == nullptr) || (statistics == nullptr)) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    *statistics = {};
+    for (const auto& subscription : ring_buffer->subscriptions) {
+        ebpf_map_subscription_add_statistics(subscription, statistics);
+    }
+
+    return EBPF_SUCCESS;
+}
+
 void
 ring_buffer__free(struct ring_buffer* ring_buffer)
 {
@@ -463,7 +508,7 @@ perf_buffer__new(
         }
 
         result = ebpf_map_subscribe(
-            map_fd, cpu_ids.data(), cpu_ids.size(), ctx, (void*)sample_cb, (void*)lost_cb, &subscription);
+            map_fd, cpu_ids.data(), cpu_ids.size(), ctx, (void*)sample_cb, (void*)lost_cb, nullptr, &subscription);
 
         if (result != EBPF_SUCCESS) {
             goto Exit;
@@ -774,16 +774,23 @@ _Success_(return == EBPF_SUCCESS) ebpf_result_t
 {
     const GUID* program_type =
         reinterpret_cast<const GUID*>(prevail::thread_local_program_info->type.platform_specific_data);
+
+    return get_program_info_from_tls(*program_type, info);
+}
+
+_Success_(return == EBPF_SUCCESS) ebpf_result_t
+    get_program_info_from_tls(const GUID& program_type, _Outptr_ const ebpf_program_info_t** info)
+{
     ebpf_result_t result = EBPF_SUCCESS;
 
     _load_ebpf_provider_data();
 
     // Get program information from the TLS cache.
-    auto it = _program_info_cache.find(*program_type);
+    auto it = _program_info_cache.find(program_type);
     if (it == _program_info_cache.end()) {
         result = EBPF_OBJECT_NOT_FOUND;
     } else {
-        *info = (const ebpf_program_info_t*)_program_info_cache[*program_type].get();
+        *info = (const ebpf_program_info_t*)it->second.get();
     }
 
     return result;
@@ -826,6 +826,13 @@ handle_ebpf_show_programs(
 
                     std::cout << "# pinned paths : " << info.pinned_path_count << "\n";
                     std::cout << "# links        : " << info.link_count << "\n";
+
+                    // Run-time statistics are only collected while enabled, so only show them once collected.
+                    if (info.run_cnt > 0) {
+                        std::cout << "# runs         : " << info.run_cnt << "\n";
+                        std::cout << "# run time (ns): " << info.run_time_ns << "\n";
+                        std::cout << "# tail calls   : " << info.tail_call_cnt << "\n";
+                    }
                 }
             }
         }
@@ -112,6 +112,27 @@ static int
 _ebpf_core_perf_event_output(
     _In_ void* ctx, _Inout_ ebpf_map_t* map, uint64_t flags, _In_reads_bytes_(length) uint8_t* data, size_t length);
 
+static int64_t
+_ebpf_core_map_lookup_batch(
+    _Inout_ ebpf_map_t* map,
+    _In_reads_bytes_(keys_length) const uint8_t* keys,
+    size_t keys_length,
+    _Out_writes_bytes_(values_length) uint8_t* values,
+    size_t values_length);
+
+static void*
+_ebpf_core_ring_buffer_reserve(_Inout_ ebpf_map_t* map, uint64_t size, uint64_t flags);
+
+static void
+_ebpf_core_ring_buffer_submit(_In_opt_ uint8_t* data, uint64_t flags);
+
+static void
+_ebpf_core_ring_buffer_discard(_In_opt_ uint8_t* data, uint64_t flags);
+
+// State indices recording the ring buffer record reserved by the running program invocation, if any.
+static size_t _ebpf_core_ring_buffer_reservation_map_state_index = MAXUINT64;
+static size_t _ebpf_core_ring_buffer_reservation_data_state_index = MAXUINT64;
+
 #define EBPF_CORE_GLOBAL_HELPER_EXTENSION_VERSION 0
 
 static ebpf_program_type_descriptor_t _ebpf_global_helper_program_descriptor = {
@@ -159,6 +180,12 @@ static const void* _ebpf_general_helpers[] = {
     (void*)&_ebpf_core_get_time_ms,
     // Perf event array (perf buffer) output.
     (void*)&_ebpf_core_perf_event_output,
+    // Batched map lookup.
+    (void*)&_ebpf_core_map_lookup_batch,
+    // Ring buffer in-place record construction.
+    (void*)&_ebpf_core_ring_buffer_reserve,
+    (void*)&_ebpf_core_ring_buffer_submit,
+    (void*)&_ebpf_core_ring_buffer_discard,
 };
 
 static const ebpf_helper_function_addresses_t _ebpf_global_helper_function_dispatch_table = {
@@ -262,6 +289,16 @@ ebpf_core_initiate()
         goto Done;
     }
 
+    return_value = ebpf_state_allocate_index(&_ebpf_core_ring_buffer_reservation_map_state_index);
+    if (return_value != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    return_value = ebpf_state_allocate_index(&_ebpf_core_ring_buffer_reservation_data_state_index);
+    if (return_value != EBPF_SUCCESS) {
+        goto Done;
+    }
+
     return_value = ebpf_async_initiate();
     if (return_value != EBPF_SUCCESS) {
         goto Done;
@@ -853,6 +890,106 @@ Done:
     EBPF_RETURN_RESULT(result);
 }
 
+static ebpf_result_t
+_ebpf_core_protocol_instantiate_native_module(
+    _In_ const ebpf_operation_instantiate_native_module_request_t* request,
+    _Inout_updates_bytes_(reply_length) ebpf_operation_instantiate_native_module_reply_t* reply,
+    uint16_t reply_length)
+{
+    EBPF_LOG_ENTRY();
+    ebpf_result_t result;
+    size_t service_name_length = 0;
+    ebpf_handle_t module_handle = ebpf_handle_invalid;
+    size_t count_of_maps = 0;
+    size_t count_of_programs = 0;
+    ebpf_handle_t* handles = NULL;
+    size_t handle_count = 0;
+    size_t handles_size = 0;
+    size_t required_reply_length = 0;
+
+    result = ebpf_safe_size_t_subtract(
+        request->header.length,
+        EBPF_OFFSET_OF(ebpf_operation_instantiate_native_module_request_t, data),
+        &service_name_length);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    // Service name is wide char
+    if (service_name_length % 2 != 0) {
+        result = EBPF_INVALID_ARGUMENT;
+        goto Done;
+    }
+
+    result = ebpf_native_load(
+        (wchar_t*)request->data,
+        (uint16_t)service_name_length,
+        &request->module_id,
+        &module_handle,
+        &count_of_maps,
+        &count_of_programs);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    result = ebpf_safe_size_t_add(count_of_maps, count_of_programs, &handle_count);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+    result = ebpf_safe_size_t_multiply(handle_count, sizeof(ebpf_handle_t), &handles_size);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+    result = ebpf_safe_size_t_add(
+        EBPF_OFFSET_OF(ebpf_operation_instantiate_native_module_reply_t, data), handles_size, &required_reply_length);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    reply->count_of_maps = count_of_maps;
+    reply->count_of_programs = count_of_programs;
+    reply->programs_loaded = false;
+    reply->header.length = (uint16_t)EBPF_OFFSET_OF(ebpf_operation_instantiate_native_module_reply_t, data);
+
+    // If the handles don't fit, return just the module and let the caller load the programs separately.
+    if (reply_length >= required_reply_length) {
+        if (handle_count > 0) {
+            handles = ebpf_allocate_with_tag(handles_size, EBPF_POOL_TAG_CORE);
+            if (handles == NULL) {
+                result = EBPF_NO_MEMORY;
+                goto Done;
+            }
+        }
+
+        result = ebpf_native_load_programs(
+            &request->module_id,
+            count_of_maps,
+            handles,
+            count_of_programs,
+            (handles != NULL) ? handles + count_of_maps : NULL);
+        if (result != EBPF_SUCCESS) {
+            goto Done;
+        }
+
+        if (handles) {
+            memcpy(reply->data, handles, handles_size);
+        }
+        reply->programs_loaded = true;
+        reply->header.length = (uint16_t)required_reply_length;
+    }
+
+    reply->native_module_handle = module_handle;
+    module_handle = ebpf_handle_invalid;
+
+Done:
+    if (module_handle != ebpf_handle_invalid) {
+        ebpf_assert_success(ebpf_handle_close(module_handle));
+    }
+    ebpf_free(handles);
+
+    EBPF_RETURN_RESULT(result);
+}
+
 static ebpf_result_t
 _ebpf_core_protocol_map_find_element(
     _In_ const ebpf_operation_map_find_element_request_t* request,
@@ -964,7 +1101,8 @@ _ebpf_core_protocol_map_update_element_batch(
         goto Done;
     }
 
-    key_and_value_length = (size_t)map_definition->key_size + (size_t)map_definition->value_size;
+    size_t value_length = ebpf_map_get_user_value_size(map);
+    key_and_value_length = (size_t)map_definition->key_size + value_length;
 
     if (key_and_value_length == 0) {
         retval = EBPF_INVALID_ARGUMENT;
@@ -983,7 +1121,7 @@ _ebpf_core_protocol_map_update_element_batch(
             map,
             map_definition->key_size,
             request->data + output_count * key_and_value_length,
-            map_definition->value_size,
+            value_length,
             request->data + output_count * key_and_value_length + (size_t)map_definition->key_size,
             request->option,
             0);
@@ -1224,6 +1362,67 @@ Done:
     EBPF_RETURN_RESULT(retval);
 }
 
+static ebpf_result_t
+_ebpf_core_protocol_map_get_next_key_aggregate_batch(
+    _In_ const ebpf_operation_map_get_next_key_aggregate_batch_request_t* request,
+    _Inout_ ebpf_operation_map_get_next_key_aggregate_batch_reply_t* reply,
+    uint16_t reply_length)
+{
+    EBPF_LOG_ENTRY();
+    ebpf_result_t retval;
+    ebpf_map_t* map = NULL;
+    size_t previous_key_length;
+    size_t reply_data_length = 0;
+
+    retval = EBPF_OBJECT_REFERENCE_BY_HANDLE(request->handle, EBPF_OBJECT_MAP, (ebpf_core_object_t**)&map);
+    if (retval != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    const ebpf_map_definition_in_memory_t* map_definition = ebpf_map_get_definition(map);
+
+    retval = ebpf_safe_size_t_subtract(
+        request->header.length,
+        EBPF_OFFSET_OF(ebpf_operation_map_get_next_key_aggregate_batch_request_t, previous_key),
+        &previous_key_length);
+    if (retval != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    if (previous_key_length != 0 && previous_key_length != map_definition->key_size) {
+        retval = EBPF_INVALID_ARGUMENT;
+        goto Done;
+    }
+
+    retval = ebpf_safe_size_t_subtract(
+        reply_length,
+        EBPF_OFFSET_OF(ebpf_operation_map_get_next_key_aggregate_batch_reply_t, data),
+        &reply_data_length);
+    if (retval != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    retval = ebpf_map_get_next_key_and_aggregate_batch(
+        map,
+        (ebpf_map_aggregate_t)request->aggregate,
+        request->element_size,
+        previous_key_length,
+        previous_key_length == 0 ? NULL : request->previous_key,
+        &reply_data_length,
+        reply->data);
+    if (retval != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    reply->header.length =
+        (uint16_t)(EBPF_OFFSET_OF(ebpf_operation_map_get_next_key_aggregate_batch_reply_t, data) + reply_data_length);
+
+Done:
+    EBPF_OBJECT_RELEASE_REFERENCE((ebpf_core_object_t*)map);
+
+    EBPF_RETURN_RESULT(retval);
+}
+
 /**
  * @brief Complete the test run of an eBPF program. This is called when a program test run has completed. This
  * function will build the reply message and send it to the client.
@@ -1351,6 +1550,118 @@ Done:
     EBPF_RETURN_RESULT(retval);
 }
 
+/**
+ * @brief Complete a batched test run by filling in the per-input return values and latency percentiles.
+ *
+ * @param[in] result Result of the test run.
+ * @param[in] program Program that was run.
+ * @param[in] options Results of the test run.
+ * @param[in] completion_context The reply message to send to the client.
+ * @param[in] async_context Handle to the async operation to complete.
+ */
+static void
+_ebpf_core_protocol_program_test_run_batch_complete(
+    _In_ ebpf_result_t result,
+    _In_ const ebpf_program_t* program,
+    _In_ const ebpf_program_test_run_options_t* options,
+    _Inout_ void* completion_context,
+    _Inout_ void* async_context)
+{
+    ebpf_operation_program_test_run_batch_reply_t* reply =
+        (ebpf_operation_program_test_run_batch_reply_t*)completion_context;
+    if (result == EBPF_SUCCESS) {
+        reply->header.length = (uint16_t)(EBPF_OFFSET_OF(ebpf_operation_program_test_run_batch_reply_t, return_values) +
+                                          options->input_count * sizeof(uint64_t));
+        reply->duration = options->duration;
+        reply->latency_p50 = options->latency_p50;
+        reply->latency_p99 = options->latency_p99;
+        reply->latency_p999 = options->latency_p999;
+    }
+
+    ebpf_async_complete(async_context, reply->header.length, result);
+    EBPF_OBJECT_RELEASE_REFERENCE((ebpf_core_object_t*)program);
+    ebpf_free((void*)options);
+}
+
+static ebpf_result_t
+_ebpf_core_protocol_program_test_run_batch(
+    _In_ const ebpf_operation_program_test_run_batch_request_t* request,
+    _Inout_updates_bytes_(reply_length) ebpf_operation_program_test_run_batch_reply_t* reply,
+    uint16_t reply_length,
+    _Inout_ void* async_context)
+{
+    EBPF_LOG_ENTRY();
+
+    ebpf_program_test_run_options_t* options = NULL;
+    ebpf_program_test_run_input_t* inputs = NULL;
+    ebpf_result_t retval;
+    ebpf_program_t* program = NULL;
+    size_t options_size;
+    size_t offset = EBPF_OFFSET_OF(ebpf_operation_program_test_run_batch_request_t, data);
+
+    if (request->input_count == 0 ||
+        reply_length < EBPF_OFFSET_OF(ebpf_operation_program_test_run_batch_reply_t, return_values) +
+                           (size_t)request->input_count * sizeof(uint64_t)) {
+        retval = EBPF_INVALID_ARGUMENT;
+        goto Done;
+    }
+
+    retval =
+        EBPF_OBJECT_REFERENCE_BY_HANDLE(request->program_handle, EBPF_OBJECT_PROGRAM, (ebpf_core_object_t**)&program);
+    if (retval != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    // The inputs are stored after the options so that both are freed together on completion.
+    options_size = EBPF_PAD_8(sizeof(ebpf_program_test_run_options_t));
+    options = (ebpf_program_test_run_options_t*)ebpf_allocate(
+        options_size + (size_t)request->input_count * sizeof(ebpf_program_test_run_input_t));
+    if (!options) {
+        retval = EBPF_NO_MEMORY;
+        goto Done;
+    }
+    inputs = (ebpf_program_test_run_input_t*)((uint8_t*)options + options_size);
+
+    // Walk the input records, checking that each one lies entirely within the request.
+    for (uint32_t index = 0; index < request->input_count; index++) {
+        const ebpf_operation_program_test_run_batch_record_t* record;
+        if (offset + sizeof(*record) > request->header.length) {
+            retval = EBPF_INVALID_ARGUMENT;
+            goto Done;
+        }
+        record = (const ebpf_operation_program_test_run_batch_record_t*)((const uint8_t*)request + offset);
+        offset += sizeof(*record);
+        if (offset + record->data_size + record->context_size > request->header.length) {
+            retval = EBPF_INVALID_ARGUMENT;
+            goto Done;
+        }
+        inputs[index].data_in = record->data_size ? (const uint8_t*)request + offset : NULL;
+        inputs[index].data_size_in = record->data_size;
+        offset += record->data_size;
+        inputs[index].context_in = record->context_size ? (const uint8_t*)request + offset : NULL;
+        inputs[index].context_size_in = record->context_size;
+        offset = EBPF_PAD_8(offset + record->context_size);
+    }
+
+    options->repeat_count = request->repeat_count ? request->repeat_count : 1;
+    options->flags = request->flags;
+    options->cpu = request->cpu;
+    options->batch_size = request->batch_size;
+    options->input_count = request->input_count;
+    options->inputs = inputs;
+    options->return_values = reply->return_values;
+
+    retval = ebpf_program_execute_test_run(
+        program, options, async_context, reply, _ebpf_core_protocol_program_test_run_batch_complete);
+
+Done:
+    if (retval != EBPF_PENDING) {
+        ebpf_free(options);
+        EBPF_OBJECT_RELEASE_REFERENCE((ebpf_core_object_t*)program);
+    }
+    EBPF_RETURN_RESULT(retval);
+}
+
 static ebpf_result_t
 _ebpf_core_protocol_query_program_info(
     _In_ const struct _ebpf_operation_query_program_info_request* request,
@@ -2000,6 +2311,35 @@ _ebpf_core_protocol_get_next_program_id(
     EBPF_RETURN_RESULT(_get_next_id(EBPF_OBJECT_PROGRAM, request, reply));
 }
 
+static ebpf_result_t
+_ebpf_core_protocol_get_next_ids(
+    _In_ const ebpf_operation_get_next_ids_request_t* request,
+    _Inout_updates_bytes_(reply_length) ebpf_operation_get_next_ids_reply_t* reply,
+    uint16_t reply_length)
+{
+    EBPF_LOG_ENTRY();
+    ebpf_result_t result;
+    size_t id_capacity =
+        (reply_length - EBPF_OFFSET_OF(ebpf_operation_get_next_ids_reply_t, ids)) / sizeof(reply->ids[0]);
+
+    if (id_capacity == 0) {
+        result = EBPF_INSUFFICIENT_BUFFER;
+        goto Done;
+    }
+
+    result =
+        ebpf_object_get_next_ids(request->start_id, request->type, (uint32_t)id_capacity, reply->ids, &reply->id_count);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+
+    reply->header.length =
+        (uint16_t)(EBPF_OFFSET_OF(ebpf_operation_get_next_ids_reply_t, ids) + reply->id_count * sizeof(reply->ids[0]));
+
+Done:
+    EBPF_RETURN_RESULT(result);
+}
+
 static ebpf_result_t
 _ebpf_core_protocol_get_next_pinned_program_path(
     _In_ const ebpf_operation_get_next_pinned_program_path_request_t* request,
@@ -2079,6 +2419,96 @@ _ebpf_core_protocol_get_next_pinned_object_path(
     EBPF_RETURN_RESULT(result);
 }
 
+static ebpf_result_t
+_ebpf_core_protocol_get_pinned_paths_by_prefix(
+    _In_ const ebpf_operation_get_pinned_paths_by_prefix_request_t* request,
+    _Inout_updates_bytes_(reply_length) ebpf_operation_get_pinned_paths_by_prefix_reply_t* reply,
+    uint16_t reply_length)
+{
+    EBPF_LOG_ENTRY();
+    uint16_t entry_count = 0;
+    ebpf_pinning_entry_t* pinning_entries = NULL;
+    cxplat_utf8_string_t prefix;
+    cxplat_utf8_string_t start_path;
+
+    size_t path_length;
+    ebpf_result_t result = ebpf_safe_size_t_subtract(
+        request->header.length,
+        EBPF_OFFSET_OF(ebpf_operation_get_pinned_paths_by_prefix_request_t, data),
+        &path_length);
+    if (result != EBPF_SUCCESS) {
+        goto Exit;
+    }
+    if (request->prefix_length > path_length) {
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+    prefix.value = (uint8_t*)request->data;
+    prefix.length = request->prefix_length;
+    start_path.value = (uint8_t*)request->data + request->prefix_length;
+    start_path.length = path_length - request->prefix_length;
+
+    size_t capacity;
+    result = ebpf_safe_size_t_subtract(
+        reply_length, EBPF_OFFSET_OF(ebpf_operation_get_pinned_paths_by_prefix_reply_t, data), &capacity);
+    if (result != EBPF_SUCCESS) {
+        goto Exit;
+    }
+
+    // Don't take references on more entries than could possibly fit in the reply.
+    size_t max_entry_count = capacity / EBPF_OPERATION_PINNED_PATH_ENTRY_SIZE(1);
+    if (max_entry_count == 0) {
+        result = EBPF_INSUFFICIENT_BUFFER;
+        goto Exit;
+    }
+
+    result = ebpf_pinning_table_enumerate_entries_with_prefix(
+        _ebpf_core_map_pinning_table,
+        request->type,
+        &prefix,
+        &start_path,
+        (max_entry_count < UINT16_MAX) ? (uint16_t)max_entry_count : UINT16_MAX,
+        &entry_count,
+        &pinning_entries);
+    if (result != EBPF_SUCCESS) {
+        goto Exit;
+    }
+
+    if (entry_count == 0) {
+        result = EBPF_NO_MORE_KEYS;
+        goto Exit;
+    }
+
+    // Serialize as many entries as fit, the caller resumes after the last path returned.
+    size_t offset = 0;
+    uint32_t path_count = 0;
+    for (uint16_t index = 0; index < entry_count; index++) {
+        size_t entry_size = EBPF_OPERATION_PINNED_PATH_ENTRY_SIZE(pinning_entries[index].path.length);
+        if (offset + entry_size > capacity) {
+            break;
+        }
+        ebpf_operation_pinned_path_entry_t* entry = (ebpf_operation_pinned_path_entry_t*)(reply->data + offset);
+        entry->type = ebpf_object_get_type(pinning_entries[index].object);
+        entry->path_length = (uint16_t)pinning_entries[index].path.length;
+        memcpy(entry->path, pinning_entries[index].path.value, pinning_entries[index].path.length);
+        offset += entry_size;
+        path_count++;
+    }
+
+    if (path_count == 0) {
+        result = EBPF_INSUFFICIENT_BUFFER;
+        goto Exit;
+    }
+
+    reply->path_count = path_count;
+    reply->header.length =
+        (uint16_t)(EBPF_OFFSET_OF(ebpf_operation_get_pinned_paths_by_prefix_reply_t, data) + offset);
+
+Exit:
+    ebpf_pinning_entries_release(entry_count, pinning_entries);
+    EBPF_RETURN_RESULT(result);
+}
+
 _Must_inspect_result_ ebpf_result_t
 _ebpf_core_protocol_map_set_wait_handle(_In_ const ebpf_operation_map_set_wait_handle_request_t* request)
 {
@@ -2302,6 +2732,14 @@ Exit:
     EBPF_RETURN_RESULT(result);
 }
 
+static ebpf_result_t
+_ebpf_core_protocol_program_enable_stats(_In_ const ebpf_operation_program_enable_stats_request_t* request)
+{
+    EBPF_LOG_ENTRY();
+    ebpf_program_enable_stats(request->enable != 0);
+    EBPF_RETURN_RESULT(EBPF_SUCCESS);
+}
+
 static ebpf_result_t
 _ebpf_core_protocol_authorize_native_module(_In_ const ebpf_operation_authorize_native_module_request_t* request)
 {
@@ -2372,6 +2810,46 @@ _ebpf_core_map_find_element(ebpf_map_t* map, const uint8_t* key)
     }
 }
 
+static int64_t
+_ebpf_core_map_lookup_batch(
+    _Inout_ ebpf_map_t* map,
+    _In_reads_bytes_(keys_length) const uint8_t* keys,
+    size_t keys_length,
+    _Out_writes_bytes_(values_length) uint8_t* values,
+    size_t values_length)
+{
+    uint8_t* value_pointers[EBPF_MAP_LOOKUP_BATCH_MAX_KEYS];
+    size_t key_size = ebpf_map_get_definition(map)->key_size;
+    size_t value_size = ebpf_map_get_effective_value_size(map);
+    size_t key_count;
+    int64_t found = 0;
+
+    if (key_size == 0 || (keys_length % key_size) != 0) {
+        return -EBPF_INVALID_ARGUMENT;
+    }
+    key_count = keys_length / key_size;
+    if (key_count == 0 || key_count > EBPF_MAP_LOOKUP_BATCH_MAX_KEYS || values_length < key_count * value_size) {
+        return -EBPF_INVALID_ARGUMENT;
+    }
+
+    ebpf_result_t result = ebpf_map_find_entry_batch(map, key_count, keys, value_pointers, EBPF_MAP_FLAG_HELPER);
+    if (result != EBPF_SUCCESS) {
+        return -result;
+    }
+
+    // Programs can't dereference pointers read back from memory, so return copies of the values.
+    for (size_t index = 0; index < key_count; index++) {
+        uint8_t* value = values + index * value_size;
+        if (value_pointers[index]) {
+            ebpf_map_copy_helper_value(map, value_pointers[index], value);
+            found |= (int64_t)1 << index;
+        } else {
+            memset(value, 0, value_size);
+        }
+    }
+    return found;
+}
+
 static int64_t
 _ebpf_core_map_update_element(ebpf_map_t* map, const uint8_t* key, const uint8_t* value, uint64_t flags)
 {
@@ -2653,6 +3131,93 @@ _ebpf_core_ring_buffer_output(
     return -ebpf_ring_buffer_map_output(map, data, length);
 }
 
+static void*
+_ebpf_core_ring_buffer_reserve(_Inout_ ebpf_map_t* map, uint64_t size, uint64_t flags)
+{
+    ebpf_execution_context_state_t execution_context_state = {0};
+    uintptr_t reserved_data;
+    uint8_t* data;
+
+    // The verifier bounds accesses to the returned pointer by the value size of the map, so only records of exactly
+    // that size can be reserved. A map created with a value size of 0 can't be reserved from.
+    if (flags != 0 || size == 0 || size != ebpf_map_get_definition(map)->value_size) {
+        return NULL;
+    }
+
+    // Only one record can be reserved at a time, so that it can be found and discarded if the program returns
+    // without submitting it.
+    if (ebpf_state_load(_ebpf_core_ring_buffer_reservation_data_state_index, &reserved_data) != EBPF_SUCCESS ||
+        reserved_data != 0) {
+        return NULL;
+    }
+
+    if (ebpf_ring_buffer_map_reserve(map, &data, size) != EBPF_SUCCESS) {
+        return NULL;
+    }
+
+    ebpf_get_execution_context_state(&execution_context_state);
+    ebpf_result_t result = ebpf_state_store(
+        _ebpf_core_ring_buffer_reservation_map_state_index, (uintptr_t)map, &execution_context_state);
+    if (result == EBPF_SUCCESS) {
+        result = ebpf_state_store(
+            _ebpf_core_ring_buffer_reservation_data_state_index, (uintptr_t)data, &execution_context_state);
+    }
+    if (result != EBPF_SUCCESS) {
+        ebpf_assert_success(ebpf_ring_buffer_map_discard(map, data, BPF_RB_NO_WAKEUP));
+        return NULL;
+    }
+    return data;
+}
+
+static void
+_ebpf_core_ring_buffer_release(_In_opt_ uint8_t* data, uint64_t flags, bool submit)
+{
+    ebpf_execution_context_state_t execution_context_state = {0};
+    uintptr_t reserved_data;
+    uintptr_t map;
+
+    // Ignore any pointer other than the record reserved by this invocation, as the program could pass any value.
+    if (data == NULL ||
+        ebpf_state_load(_ebpf_core_ring_buffer_reservation_data_state_index, &reserved_data) != EBPF_SUCCESS ||
+        (uint8_t*)reserved_data != data ||
+        ebpf_state_load(_ebpf_core_ring_buffer_reservation_map_state_index, &map) != EBPF_SUCCESS) {
+        return;
+    }
+
+    ebpf_get_execution_context_state(&execution_context_state);
+    ebpf_assert_success(
+        ebpf_state_store(_ebpf_core_ring_buffer_reservation_data_state_index, 0, &execution_context_state));
+
+    flags &= BPF_RB_NO_WAKEUP | BPF_RB_FORCE_WAKEUP;
+    if (submit) {
+        ebpf_assert_success(ebpf_ring_buffer_map_submit((ebpf_map_t*)map, data, flags));
+    } else {
+        ebpf_assert_success(ebpf_ring_buffer_map_discard((ebpf_map_t*)map, data, flags));
+    }
+}
+
+static void
+_ebpf_core_ring_buffer_submit(_In_opt_ uint8_t* data, uint64_t flags)
+{
+    _ebpf_core_ring_buffer_release(data, flags, true);
+}
+
+static void
+_ebpf_core_ring_buffer_discard(_In_opt_ uint8_t* data, uint64_t flags)
+{
+    _ebpf_core_ring_buffer_release(data, flags, false);
+}
+
+void
+ebpf_core_discard_ring_buffer_reservation()
+{
+    uintptr_t reserved_data;
+    if (ebpf_state_load(_ebpf_core_ring_buffer_reservation_data_state_index, &reserved_data) == EBPF_SUCCESS &&
+        reserved_data != 0) {
+        _ebpf_core_ring_buffer_release((uint8_t*)reserved_data, BPF_RB_NO_WAKEUP, false);
+    }
+}
+
 static ebpf_result_t
 _ebpf_core_protocol_ring_buffer_map_map_buffer(
     _In_ const ebpf_operation_ring_buffer_map_map_buffer_request_t* request,
@@ -2999,6 +3564,16 @@ static ebpf_protocol_handler_t _ebpf_protocol_handlers[] = {
     DECLARE_PROTOCOL_HANDLER_FIXED_REQUEST_FIXED_REPLY(ring_buffer_map_map_buffer, PROTOCOL_ALL_MODES),
     DECLARE_PROTOCOL_HANDLER_FIXED_REQUEST_NO_REPLY(ring_buffer_map_unmap_buffer, PROTOCOL_ALL_MODES),
     DECLARE_PROTOCOL_HANDLER_FIXED_REQUEST_NO_REPLY_ASYNC(epoch_synchronize, PROTOCOL_ALL_MODES),
+    DECLARE_PROTOCOL_HANDLER_VARIABLE_REQUEST_VARIABLE_REPLY(
+        map_get_next_key_aggregate_batch, previous_key, data, PROTOCOL_ALL_MODES),
+    DECLARE_PROTOCOL_HANDLER_VARIABLE_REQUEST_VARIABLE_REPLY_ASYNC(
+        program_test_run_batch, data, return_values, PROTOCOL_ALL_MODES),
+    DECLARE_PROTOCOL_HANDLER_FIXED_REQUEST_VARIABLE_REPLY(get_next_ids, ids, PROTOCOL_ALL_MODES),
+    DECLARE_PROTOCOL_HANDLER_VARIABLE_REQUEST_VARIABLE_REPLY(
+        get_pinned_paths_by_prefix, data, data, PROTOCOL_ALL_MODES),
+    DECLARE_PROTOCOL_HANDLER_VARIABLE_REQUEST_VARIABLE_REPLY(
+        instantiate_native_module, data, data, PROTOCOL_NATIVE_MODE),
+    DECLARE_PROTOCOL_HANDLER_FIXED_REQUEST_NO_REPLY(program_enable_stats, PROTOCOL_ALL_MODES),
 };
 
 _Must_inspect_result_ ebpf_result_t
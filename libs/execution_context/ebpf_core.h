@@ -295,6 +295,13 @@ extern "C"
         _In_reads_(count_of_maps) const ebpf_handle_t* map_handles,
         _Out_writes_(count_of_maps) uintptr_t* map_value_addresses);
 
+    /**
+     * @brief Discard the ring buffer record reserved with bpf_ringbuf_reserve by the current program invocation
+     * and neither submitted nor discarded before the program returned, if there is one.
+     */
+    void
+    ebpf_core_discard_ring_buffer_reservation();
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,7 +4,6 @@
 #define EBPF_FILE_ID EBPF_FILE_ID_MAPS
 
 #include "ebpf_async.h"
-#include "ebpf_bitmap.h"
 #include "ebpf_epoch.h"
 #include "ebpf_handle.h"
 #include "ebpf_hash_table.h"
@@ -14,13 +13,42 @@
 #include "ebpf_ring_buffer.h"
 #include "ebpf_tracelog.h"
 
+/**
+ * @brief Operation counters kept for maps created with EBPF_MAP_CREATE_FLAG_STATISTICS.
+ */
+typedef enum _ebpf_map_stat
+{
+    EBPF_MAP_STAT_LOOKUP,       ///< Lookup that found an entry.
+    EBPF_MAP_STAT_LOOKUP_MISS,  ///< Lookup that didn't find an entry.
+    EBPF_MAP_STAT_INSERT,       ///< Update that inserted a new entry.
+    EBPF_MAP_STAT_REPLACE,      ///< Update that replaced the value of an existing entry.
+    EBPF_MAP_STAT_DELETE,       ///< Entry deleted.
+    EBPF_MAP_STAT_EVICTION,     ///< Entry evicted from an LRU map to make room for a new entry.
+    EBPF_MAP_STAT_OUT_OF_SPACE, ///< Update that failed with EBPF_OUT_OF_SPACE.
+    EBPF_MAP_STAT_NO_MEMORY,    ///< Update that failed with EBPF_NO_MEMORY.
+    EBPF_MAP_STAT_COUNT,
+} ebpf_map_stat_t;
+
+/**
+ * @brief Map operation counters of one CPU, padded to a cache line so that CPUs don't contend on the same line.
+ */
+typedef __declspec(align(EBPF_CACHE_LINE_SIZE)) struct _ebpf_map_cpu_stats
+{
+    volatile int64_t counters[EBPF_MAP_STAT_COUNT];
+} ebpf_map_cpu_stats_t;
+
 typedef struct _ebpf_core_map
 {
     ebpf_core_object_t object;
     cxplat_utf8_string_t name;
     ebpf_map_definition_in_memory_t ebpf_map_definition;
     uint32_t original_value_size;
+    uint32_t per_cpu_value_stride; ///< Distance in bytes between the CPU slots of a per-CPU value.
+    ebpf_lock_t value_scratch_lock; ///< Lock serializing use of value_scratch.
+    _Guarded_by_(value_scratch_lock) uint8_t* value_scratch; ///< Per-CPU maps: buffer of one stored value.
     uint8_t* data;
+    uint32_t cpu_stats_count;
+    ebpf_map_cpu_stats_t* cpu_stats; ///< Per-CPU operation counters, or NULL if statistics are not collected.
 } ebpf_core_map_t;
 
 typedef struct _ebpf_core_object_map
@@ -32,6 +60,43 @@ typedef struct _ebpf_core_object_map
     ebpf_program_type_t program_type;
 } ebpf_core_object_map_t;
 
+/**
+ * @brief Count an operation on a map, if the map collects statistics.
+ *
+ * @param[in] map Map the operation was performed on.
+ * @param[in] stat Counter to increment.
+ */
+static inline void
+_ebpf_map_record_stat(_In_ const ebpf_core_map_t* map, ebpf_map_stat_t stat)
+{
+    ebpf_map_cpu_stats_t* cpu_stats = map->cpu_stats;
+    if (cpu_stats == NULL) {
+        return;
+    }
+    // Callers at PASSIVE_LEVEL can migrate to another CPU, so the counter is still updated atomically.
+    uint32_t cpu = ebpf_get_current_cpu();
+    if (cpu >= map->cpu_stats_count) {
+        cpu = 0;
+    }
+    ebpf_interlocked_increment_int64_no_fence(&cpu_stats[cpu].counters[stat]);
+}
+
+/**
+ * @brief Count an update that failed because the map is full or memory is exhausted.
+ *
+ * @param[in] map Map the update was performed on.
+ * @param[in] result Result of the update.
+ */
+static inline void
+_ebpf_map_record_update_failure(_In_ const ebpf_core_map_t* map, ebpf_result_t result)
+{
+    if (result == EBPF_OUT_OF_SPACE) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_OUT_OF_SPACE);
+    } else if (result == EBPF_NO_MEMORY) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_NO_MEMORY);
+    }
+}
+
 // Generations:
 // 0: Uninitialized.
 // 1 to 2^64-2: Valid generations.
@@ -50,6 +115,16 @@ typedef struct _ebpf_core_object_map
 // Limit maximum map allocation size to 128GB.
 #define EBPF_MAP_MAXIMUM_ALLOCATION (((uint64_t)1) << 37)
 
+// Background eviction of LRU maps (EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION) starts once the map holds more than
+// 7/8 of max_entries and evicts entries until the map holds no more than 3/4 of max_entries.
+#define EBPF_LRU_EVICTION_HIGH_WATERMARK(max_entries) ((max_entries) - (max_entries) / 8)
+#define EBPF_LRU_EVICTION_LOW_WATERMARK(max_entries) ((max_entries) - (max_entries) / 4)
+
+// Map creation flags accepted by ebpf_map_create.
+#define EBPF_MAP_CREATE_SUPPORTED_FLAGS                                                                          \
+    (EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED | EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU |                          \
+     EBPF_MAP_CREATE_FLAG_STATISTICS | EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION)
+
 /**
  * @brief The BPF_MAP_TYPE_LRU_HASH is a hash table that stores a limited number of entries. When the map is full, the
  * least recently used entry is removed to make room for a new entry. The map is implemented as a hash table with a pair
@@ -177,11 +252,19 @@ typedef struct _ebpf_core_lru_map
 {
     ebpf_core_map_t core_map; //< Core map structure.
     size_t partition_count;   //< Number of LRU partitions. Limited to a maximum of EBPF_LRU_MAXIMUM_PARTITIONS.
-    uint8_t padding[24];      //< Required to ensure partitions are cache aligned.
+    ebpf_epoch_work_item_t* volatile eviction_work_item; //< Background eviction work item, NULL while it is scheduled.
+    uint32_t eviction_high_watermark; //< Entry count that triggers background eviction, 0 if it is disabled.
+    uint32_t eviction_low_watermark;  //< Entry count at which background eviction stops.
+    KEVENT eviction_idle_event;       //< Signaled while no background eviction is scheduled or running.
+    uint8_t padding[32];              //< Required to ensure partitions are cache aligned.
     ebpf_lru_partition_t
         partitions[1]; //< Array of LRU partitions. Limited to a maximum of EBPF_LRU_MAXIMUM_PARTITIONS.
 } ebpf_core_lru_map_t;
 
+static_assert(
+    EBPF_OFFSET_OF(ebpf_core_lru_map_t, partitions) % EBPF_CACHE_LINE_SIZE == 0,
+    "ebpf_core_lru_map_t partitions are not cache aligned.");
+
 /**
  * @brief Operation being performed on the LRU maps key history.
  *
@@ -209,12 +292,36 @@ typedef enum _ebpf_lru_key_state
                          // will be freed when the current epoch is retired.
 } ebpf_lru_key_state_t;
 
+#define EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE 0x1
+
+/**
+ * @brief Node in a path-compressed LPM trie. A node stores a prefix of prefix_length bits. Children share the first
+ * prefix_length bits of their parent and are indexed by the bit immediately following it. Intermediate nodes are
+ * created to join two prefixes that diverge and carry no value; they always have two children.
+ */
+typedef struct _ebpf_lpm_trie_node
+{
+    struct _ebpf_lpm_trie_node* children[2];
+    uint32_t prefix_length;
+    uint32_t flags;
+    // Prefix data followed by the value at EBPF_PAD_8(data_size) for non-intermediate nodes.
+    uint8_t data[1];
+} ebpf_lpm_trie_node_t;
+
+/**
+ * @brief LPM trie map. Readers walk the trie under the current epoch without taking a lock. Writers are serialized by
+ * the lock and publish new nodes with release semantics, retiring replaced nodes through the epoch allocator.
+ */
 typedef struct _ebpf_core_lpm_map
 {
     ebpf_core_map_t core_map;
     uint32_t max_prefix;
-    // Bitmap of prefix lengths inserted into the map.
-    uint64_t data[1];
+    // Size of the prefix data in bytes.
+    uint32_t data_size;
+    ebpf_lock_t lock;
+    ebpf_lpm_trie_node_t* root;
+    // Number of nodes holding a value. Protected by lock.
+    uint32_t entry_count;
 } ebpf_core_lpm_map_t;
 
 typedef struct _ebpf_core_lpm_key
@@ -278,119 +385,185 @@ typedef struct _ebpf_core_map_async_query_context
 
 /**
  * Core map structure for BPF_MAP_TYPE_QUEUE and BPF_MAP_TYPE_STACK
- * ebpf_core_circular_map_t stores an array of uint8_t* pointers. Each pointer
- * stores a version of a value that has been pushed to the queue or stack. The
- * structure can't store the map values directly as the caller expects items
- * returned from peek to remain unmodified. If items are stored directly in
- * the array, then a sequence of:
+ * Values are stored inline in core_map.data, in a ring of max_entries slots
+ * of value_size bytes each. begin and end are monotonically increasing
+ * positions; position p is stored in slot p % max_entries.
+ *
+ * Queues are a bounded multi-producer multi-consumer ring that doesn't take a
+ * lock. Each slot has a sequence number: a slot is free for the push at
+ * position p when its sequence is p, and holds the value pushed at position p
+ * when its sequence is p + 1. A push claims end with a compare-exchange,
+ * copies the value in and then publishes it by advancing the sequence. A pop
+ * claims begin the same way, copies the value out and then frees the slot for
+ * the push at p + max_entries.
+ *
+ * Stacks push and pop at the same end and are serialized by the lock.
+ *
+ * Values are always copied out to the caller rather than returned by
+ * reference. If a caller was handed a pointer into the ring, then a sequence
+ * of:
  * 1) push
  * 2) peek
  * 3) pop
  * 4) push
- * can result in aliasing the record, which would result in unexpected behavior.
+ * would alias the record it peeked at. A queue peek copies the value and then
+ * checks that begin hasn't moved, retrying if the value was popped (and could
+ * have been overwritten) while it was being copied, so the caller never sees
+ * a torn value.
  */
 
 typedef struct _ebpf_core_circular_map
 {
     ebpf_core_map_t core_map;
-    ebpf_lock_t lock;
-    size_t begin;
-    size_t end;
+    ebpf_lock_t lock; ///< Serializes stack operations. Queue operations don't take the lock.
+    volatile int64_t begin;
+    volatile int64_t end;
     enum
     {
         EBPF_CORE_QUEUE = 1,
         EBPF_CORE_STACK = 2,
     } type;
-    uint8_t* slots[1];
+    volatile int64_t sequences[1]; ///< Per-slot sequence numbers, only used by queues.
 } ebpf_core_circular_map_t;
 
-static size_t
-_ebpf_core_circular_map_add(_In_ const ebpf_core_circular_map_t* map, size_t value, int delta)
+static uint8_t*
+_ebpf_core_circular_map_slot(_In_ const ebpf_core_circular_map_t* map, int64_t position)
 {
-    return (map->core_map.ebpf_map_definition.max_entries + value + (size_t)delta) %
-           map->core_map.ebpf_map_definition.max_entries;
+    return map->core_map.data + ((uint64_t)position % map->core_map.ebpf_map_definition.max_entries) *
+                                    map->core_map.ebpf_map_definition.value_size;
 }
 
-static uint8_t*
-_ebpf_core_circular_map_peek_or_pop(_Inout_ ebpf_core_circular_map_t* map, bool pop)
+static ebpf_result_t
+_ebpf_core_queue_map_peek_or_pop(_Inout_ ebpf_core_circular_map_t* map, bool pop, _Out_opt_ uint8_t* value)
 {
-    uint8_t* return_value = NULL;
+    uint32_t max_entries = map->core_map.ebpf_map_definition.max_entries;
+    uint32_t value_size = map->core_map.ebpf_map_definition.value_size;
+    ebpf_result_t result;
+
+    // Stay at DISPATCH while a position is claimed, so that a preempted consumer can't stall the producers waiting for
+    // its slot to be freed.
+    KIRQL irql_at_enter = ebpf_raise_irql_to_dispatch_if_needed();
+    for (;;) {
+        int64_t position = ReadNoFence64(&map->begin);
+        volatile int64_t* sequence = &map->sequences[(uint64_t)position % max_entries];
+        int64_t difference = ReadAcquire64(sequence) - (position + 1);
 
-    if (map->type == EBPF_CORE_QUEUE) {
-        // Remove from the beginning.
-        return_value = map->slots[map->begin];
-        if (return_value == NULL) {
-            ebpf_assert(map->begin == map->end);
+        if (difference < 0) {
+            // The slot hasn't been published yet, so the queue is empty.
+            result = EBPF_OBJECT_NOT_FOUND;
             goto Done;
+        } else if (difference > 0) {
+            // Another consumer popped this position; reload begin.
+            continue;
         }
-        if (pop) {
-            map->slots[map->begin] = NULL;
-            map->begin = _ebpf_core_circular_map_add(map, map->begin, 1);
+
+        if (!pop) {
+            if (value) {
+                memcpy(value, _ebpf_core_circular_map_slot(map, position), value_size);
+            }
+            // Make sure the copy completes before re-checking that the value wasn't popped while it was copied. A slot
+            // can only be overwritten after it has been popped.
+            MemoryBarrier();
+            if (ReadNoFence64(&map->begin) == position) {
+                result = EBPF_SUCCESS;
+                goto Done;
+            }
+            continue;
         }
-    } else {
-        // Remove from the end.
-        size_t new_end = _ebpf_core_circular_map_add(map, map->end, -1);
-        return_value = map->slots[new_end];
-        if (return_value == NULL) {
-            ebpf_assert(map->begin == map->end);
+
+        if (ebpf_interlocked_compare_exchange_int64(&map->begin, position + 1, position) == position) {
+            if (value) {
+                memcpy(value, _ebpf_core_circular_map_slot(map, position), value_size);
+            }
+            // Free the slot for the push one lap later.
+            WriteRelease64(sequence, position + max_entries);
+            result = EBPF_SUCCESS;
             goto Done;
         }
-        if (pop) {
-            map->slots[new_end] = NULL;
-            map->end = new_end;
-        }
-    }
-    if (pop) {
-        // The return_value is not freed until the current epoch is retired.
-        ebpf_epoch_free(return_value);
     }
+
 Done:
-#pragma warning(push)
-#pragma warning(disable : 6001) // Using uninitialized memory 'return_value'.
-    return return_value;
-#pragma warning(pop)
+    ebpf_lower_irql_from_dispatch_if_needed(irql_at_enter);
+    return result;
 }
 
 static ebpf_result_t
-_ebpf_core_circular_map_push(_Inout_ ebpf_core_circular_map_t* map, _In_ const uint8_t* data, bool replace)
-{
-    ebpf_result_t return_value;
-    uint8_t* new_data = NULL;
-    uint8_t* old_data = NULL;
-    new_data = ebpf_epoch_allocate_with_tag(map->core_map.ebpf_map_definition.value_size, EBPF_POOL_TAG_MAP);
-    if (new_data == NULL) {
-        return_value = EBPF_NO_MEMORY;
-        goto Done;
-    }
-    memcpy(new_data, data, map->core_map.ebpf_map_definition.value_size);
+_ebpf_core_queue_map_push(_Inout_ ebpf_core_circular_map_t* map, _In_ const uint8_t* data, bool replace)
+{
+    uint32_t max_entries = map->core_map.ebpf_map_definition.max_entries;
+    ebpf_result_t result;
 
-    if (map->slots[map->end] != NULL) {
-        ebpf_assert(map->begin == map->end);
-        if (replace) {
-            old_data = map->slots[map->end];
-            map->slots[map->end] = NULL;
-            map->begin = _ebpf_core_circular_map_add(map, map->begin, 1);
-        } else {
-            return_value = EBPF_OUT_OF_SPACE;
+    // Stay at DISPATCH from the claim until the publish, so that a preempted producer can't stall the consumers and
+    // producers waiting on its slot. This also keeps the BPF_EXIST replace loop from spinning on a consumer that was
+    // preempted while popping the oldest entry.
+    KIRQL irql_at_enter = ebpf_raise_irql_to_dispatch_if_needed();
+    for (;;) {
+        int64_t position = ReadNoFence64(&map->end);
+        volatile int64_t* sequence = &map->sequences[(uint64_t)position % max_entries];
+        int64_t difference = ReadAcquire64(sequence) - position;
+
+        if (difference < 0) {
+            // The slot still holds the value pushed one lap earlier, so the queue is full.
+            if (!replace) {
+                result = EBPF_OUT_OF_SPACE;
+                goto Done;
+            }
+            // Discard the oldest entry and try again. If a consumer is already popping it, wait for the slot instead.
+            if (position - ReadNoFence64(&map->begin) >= max_entries) {
+                (void)_ebpf_core_queue_map_peek_or_pop(map, true, NULL);
+            }
+            continue;
+        } else if (difference > 0) {
+            // Another producer claimed this position; reload end.
+            continue;
+        }
+
+        if (ebpf_interlocked_compare_exchange_int64(&map->end, position + 1, position) == position) {
+            memcpy(_ebpf_core_circular_map_slot(map, position), data, map->core_map.ebpf_map_definition.value_size);
+            // Publish the value to consumers.
+            WriteRelease64(sequence, position + 1);
+            result = EBPF_SUCCESS;
             goto Done;
         }
     }
 
-    // Insert at the end.
-    map->slots[map->end] = new_data;
-    new_data = NULL;
-    map->end = _ebpf_core_circular_map_add(map, map->end, 1);
+Done:
+    ebpf_lower_irql_from_dispatch_if_needed(irql_at_enter);
+    return result;
+}
 
-    return_value = EBPF_SUCCESS;
+_Requires_lock_held_(map->lock) static ebpf_result_t _ebpf_core_stack_map_peek_or_pop(
+    _Inout_ ebpf_core_circular_map_t* map, bool pop, _Out_opt_ uint8_t* value)
+{
+    if (map->end == map->begin) {
+        return EBPF_OBJECT_NOT_FOUND;
+    }
 
-Done:
-    if (new_data) {
-        ebpf_epoch_free(new_data);
+    // Remove from the end.
+    if (value) {
+        memcpy(value, _ebpf_core_circular_map_slot(map, map->end - 1), map->core_map.ebpf_map_definition.value_size);
+    }
+    if (pop) {
+        map->end--;
     }
-    if (old_data) {
-        ebpf_epoch_free(old_data);
+    return EBPF_SUCCESS;
+}
+
+_Requires_lock_held_(map->lock) static ebpf_result_t _ebpf_core_stack_map_push(
+    _Inout_ ebpf_core_circular_map_t* map, _In_ const uint8_t* data, bool replace)
+{
+    if (map->end - map->begin == map->core_map.ebpf_map_definition.max_entries) {
+        if (!replace) {
+            return EBPF_OUT_OF_SPACE;
+        }
+        // Drop the oldest entry, at the bottom of the stack.
+        map->begin++;
     }
-    return return_value;
+
+    // Insert at the end.
+    memcpy(_ebpf_core_circular_map_slot(map, map->end), data, map->core_map.ebpf_map_definition.value_size);
+    map->end++;
+    return EBPF_SUCCESS;
 }
 
 static ebpf_program_type_t
@@ -411,6 +584,12 @@ typedef struct _ebpf_map_metadata_table
     ebpf_result_t (*associate_program)(_Inout_ ebpf_map_t* map, _In_ const ebpf_program_t* program);
     ebpf_result_t (*find_entry)(
         _Inout_ ebpf_core_map_t* map, _In_opt_ const uint8_t* key, bool delete_on_success, _Outptr_ uint8_t** data);
+    ebpf_result_t (*find_entry_batch)(
+        _Inout_ ebpf_core_map_t* map,
+        size_t key_count,
+        _In_ const uint8_t* keys,
+        _Out_writes_(key_count) uint8_t** data);
+    ebpf_result_t (*peek_or_pop_entry)(_Inout_ ebpf_core_map_t* map, bool pop, _Out_opt_ uint8_t* value);
     ebpf_core_object_t* (*get_object_from_entry)(_Inout_ ebpf_core_map_t* map, _In_ const uint8_t* key);
     ebpf_result_t (*update_entry)(
         _Inout_ ebpf_core_map_t* map, _In_opt_ const uint8_t* key, _In_ const uint8_t* value, ebpf_map_option_t option);
@@ -424,6 +603,7 @@ typedef struct _ebpf_map_metadata_table
         _In_ const uint8_t* previous_key,
         _Out_ uint8_t* next_key,
         _Inout_opt_ uint8_t** next_value);
+    void (*copy_value)(_In_ const ebpf_core_map_t* map, _In_ const uint8_t* value, _Out_ uint8_t* buffer);
     ebpf_result_t (*query_buffer)(
         _In_ const ebpf_core_map_t* map, uint64_t index, _Outptr_ uint8_t** data, _Out_ uint64_t* consumer_offset);
     ebpf_result_t (*return_buffer)(_In_ const ebpf_core_map_t* map, uint64_t index, uint64_t consumer_offset);
@@ -472,6 +652,25 @@ ebpf_map_get_effective_value_size(_In_ const ebpf_map_t* map)
     return map->original_value_size;
 }
 
+uint32_t
+ebpf_map_get_user_value_size(_In_ const ebpf_map_t* map)
+{
+    if (map->per_cpu_value_stride == 0) {
+        return map->ebpf_map_definition.value_size;
+    }
+    return ebpf_get_cpu_count() * EBPF_PAD_8(map->original_value_size);
+}
+
+/**
+ * @brief Determine whether the per-CPU slots of a value are laid out differently in the map than in the buffers
+ * exchanged with user mode.
+ */
+static inline bool
+_ebpf_map_is_per_cpu_padded(_In_ const ebpf_core_map_t* map)
+{
+    return map->per_cpu_value_stride != 0 && map->per_cpu_value_stride != EBPF_PAD_8(map->original_value_size);
+}
+
 static ebpf_result_t
 _create_array_map_with_map_struct_size(
     size_t map_struct_size, _In_ const ebpf_map_definition_in_memory_t* map_definition, _Outptr_ ebpf_core_map_t** map)
@@ -597,6 +796,8 @@ _update_array_map_entry(
     } else {
         memset(entry, 0, map->ebpf_map_definition.value_size);
     }
+    // Array entries always exist, so an update always replaces a value.
+    _ebpf_map_record_stat(map, EBPF_MAP_STAT_REPLACE);
     return EBPF_SUCCESS;
 }
 
@@ -1032,6 +1233,7 @@ _create_hash_map_internal(
     _In_ const ebpf_map_definition_in_memory_t* map_definition,
     size_t supplemental_value_size,
     bool fixed_size_map,
+    bool update_in_place,
     _In_opt_ void (*extract_function)(
         _In_ const uint8_t* value, _Outptr_ const uint8_t** data, _Out_ size_t* length_in_bits),
     _In_opt_ ebpf_hash_table_notification_function notification_callback,
@@ -1053,13 +1255,17 @@ _create_hash_map_internal(
     const ebpf_hash_table_creation_options_t options = {
         .key_size = local_map->ebpf_map_definition.key_size,
         .value_size = local_map->ebpf_map_definition.value_size,
-        .minimum_bucket_count = local_map->ebpf_map_definition.max_entries,
+        // Start small and let the bucket array follow the number of entries rather than sizing it for max_entries.
+        .minimum_bucket_count = min(local_map->ebpf_map_definition.max_entries, EBPF_HASH_TABLE_DEFAULT_BUCKET_COUNT),
         .max_entries = fixed_size_map ? local_map->ebpf_map_definition.max_entries : EBPF_HASH_TABLE_NO_LIMIT,
         .extract_function = extract_function,
         .allocation_tag = EBPF_POOL_TAG_MAP,
         .supplemental_value_size = supplemental_value_size,
         .notification_context = local_map,
         .notification_callback = notification_callback,
+        .grow_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_GROW_LOAD_FACTOR_PERCENT,
+        .shrink_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT,
+        .update_in_place = update_in_place,
     };
 
     // Note:
@@ -1095,7 +1301,11 @@ _create_hash_map(
     if (inner_map_handle != ebpf_handle_invalid) {
         return EBPF_INVALID_ARGUMENT;
     }
-    return _create_hash_map_internal(sizeof(ebpf_core_map_t), map_definition, 0, false, NULL, NULL, map);
+    // Hash map values hold no references, so updates to existing keys can overwrite the value in place. Per-CPU hash
+    // values hold a slot for every CPU and are far larger than the in-place limit, so they keep replacing the value.
+    bool update_in_place = map_definition->type == BPF_MAP_TYPE_HASH;
+    return _create_hash_map_internal(
+        sizeof(ebpf_core_map_t), map_definition, 0, false, update_in_place, NULL, NULL, map);
 }
 
 static void
@@ -1144,8 +1354,8 @@ _create_object_hash_map(
 
     *map = NULL;
 
-    result =
-        _create_hash_map_internal(sizeof(ebpf_core_object_map_t), map_definition, 0, false, NULL, NULL, &local_map);
+    result = _create_hash_map_internal(
+        sizeof(ebpf_core_object_map_t), map_definition, 0, false, false, NULL, NULL, &local_map);
     if (result != EBPF_SUCCESS) {
         goto Exit;
     }
@@ -1372,6 +1582,9 @@ _lru_hash_table_notification(
     }
 }
 
+static void
+_lru_map_background_eviction(_Inout_ void* context);
+
 static ebpf_result_t
 _create_lru_hash_map(
     _In_ const ebpf_map_definition_in_memory_t* map_definition,
@@ -1424,6 +1637,7 @@ _create_lru_hash_map(
         map_definition,
         supplemental_value_size,
         true,
+        false,
         NULL,
         _lru_hash_table_notification,
         (ebpf_core_map_t**)&lru_map);
@@ -1449,6 +1663,17 @@ _create_lru_hash_map(
             max(average_entries_per_partition / EBPF_LRU_GENERATION_COUNT, 1);
     }
 
+    if (map_definition->map_flags & EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION) {
+        lru_map->eviction_work_item = ebpf_epoch_allocate_work_item(lru_map, _lru_map_background_eviction);
+        if (!lru_map->eviction_work_item) {
+            retval = EBPF_NO_MEMORY;
+            goto Exit;
+        }
+        lru_map->eviction_high_watermark = EBPF_LRU_EVICTION_HIGH_WATERMARK(map_definition->max_entries);
+        lru_map->eviction_low_watermark = EBPF_LRU_EVICTION_LOW_WATERMARK(map_definition->max_entries);
+    }
+    KeInitializeEvent(&lru_map->eviction_idle_event, NotificationEvent, true);
+
     *map = &lru_map->core_map;
 
 Exit:
@@ -1467,6 +1692,8 @@ static void
 _delete_lru_hash_map(_In_ _Post_invalid_ ebpf_core_map_t* map)
 {
     ebpf_core_lru_map_t* lru_map = EBPF_FROM_FIELD(ebpf_core_lru_map_t, core_map, map);
+    // A scheduled eviction holds a reference on the map, so the work item can't be in flight here.
+    ebpf_epoch_cancel_work_item(lru_map->eviction_work_item);
     ebpf_hash_table_destroy((ebpf_hash_table_t*)lru_map->core_map.data);
     ebpf_epoch_free_cache_aligned(map);
 }
@@ -1559,8 +1786,10 @@ _reap_lru_cold_lists(ebpf_core_lru_map_t* lru_map)
  * @brief Helper function to reap the oldest entry from the map.
  *
  * @param[in,out] map Pointer to the map.
+ * @retval true An entry was selected for eviction.
+ * @retval false The cold lists are empty.
  */
-static void
+static bool
 _reap_oldest_map_entry(_Inout_ ebpf_core_map_t* map)
 {
     ebpf_core_lru_map_t* lru_map;
@@ -1573,8 +1802,77 @@ _reap_oldest_map_entry(_Inout_ ebpf_core_map_t* map)
         // Attempt to delete the entry from the cold list.
         // This may fail if the entry has already been freed, but that's okay as the caller will
         // attempt to reap again if the next insert fails.
-        (void)_delete_hash_map_entry(map, EBPF_LRU_ENTRY_KEY_PTR(lru_map, entry));
+        if (_delete_hash_map_entry(map, EBPF_LRU_ENTRY_KEY_PTR(lru_map, entry)) == EBPF_SUCCESS) {
+            _ebpf_map_record_stat(map, EBPF_MAP_STAT_EVICTION);
+        }
+    }
+    return entry != NULL;
+}
+
+/**
+ * @brief Epoch work item that evicts the least recently used entries of an LRU map until it holds no more than
+ * eviction_low_watermark entries, then re-arms the work item for the next time the map crosses the high watermark.
+ *
+ * @param[in,out] context Pointer to the ebpf_core_lru_map_t. The reference taken when the work item was scheduled is
+ * released on return.
+ */
+_IRQL_requires_max_(PASSIVE_LEVEL) static void _lru_map_background_eviction(_Inout_ void* context)
+{
+    ebpf_core_lru_map_t* lru_map = (ebpf_core_lru_map_t*)context;
+    ebpf_hash_table_t* hash_table = (ebpf_hash_table_t*)lru_map->core_map.data;
+    ebpf_epoch_state_t epoch_state = {0};
+
+    ebpf_epoch_enter(&epoch_state);
+    // Bound the batch by the excess at the start, so that a concurrent insert storm can't keep this running forever.
+    size_t key_count = ebpf_hash_table_key_count(hash_table);
+    size_t batch_size = (key_count > lru_map->eviction_low_watermark) ? key_count - lru_map->eviction_low_watermark : 0;
+    for (size_t index = 0; index < batch_size; index++) {
+        if (ebpf_hash_table_key_count(hash_table) <= lru_map->eviction_low_watermark) {
+            break;
+        }
+        if (!_reap_oldest_map_entry(&lru_map->core_map)) {
+            break;
+        }
+    }
+    ebpf_epoch_exit(&epoch_state);
+
+    // Signal idle before re-arming, so that an eviction scheduled after the re-arm can't have its clear undone.
+    KeSetEvent(&lru_map->eviction_idle_event, 0, false);
+
+    // If the work item can't be re-armed, background eviction stops and inserts fall back to evicting inline.
+    ebpf_epoch_work_item_t* work_item = ebpf_epoch_allocate_work_item(lru_map, _lru_map_background_eviction);
+    if (work_item) {
+        ebpf_interlocked_compare_exchange_pointer((void* volatile*)&lru_map->eviction_work_item, work_item, NULL);
+    }
+
+    EBPF_OBJECT_RELEASE_REFERENCE(&lru_map->core_map.object);
+}
+
+/**
+ * @brief Schedule background eviction if the LRU map has crossed its high watermark and no eviction is pending.
+ *
+ * @param[in,out] map Pointer to the map.
+ */
+static void
+_schedule_lru_eviction_if_needed(_Inout_ ebpf_core_map_t* map)
+{
+    ebpf_core_lru_map_t* lru_map = EBPF_FROM_FIELD(ebpf_core_lru_map_t, core_map, map);
+
+    if (lru_map->eviction_high_watermark == 0 ||
+        ebpf_hash_table_key_count((ebpf_hash_table_t*)map->data) < lru_map->eviction_high_watermark) {
+        return;
+    }
+
+    // Claim the work item. It is NULL while an eviction is scheduled or running.
+    ebpf_epoch_work_item_t* work_item = lru_map->eviction_work_item;
+    if (!work_item || ebpf_interlocked_compare_exchange_pointer(
+                          (void* volatile*)&lru_map->eviction_work_item, NULL, work_item) != work_item) {
+        return;
     }
+
+    KeClearEvent(&lru_map->eviction_idle_event);
+    EBPF_OBJECT_ACQUIRE_REFERENCE(&map->object);
+    ebpf_epoch_schedule_work_item(work_item);
 }
 
 static ebpf_result_t
@@ -1602,6 +1900,19 @@ _find_hash_map_entry(
     return value == NULL ? EBPF_OBJECT_NOT_FOUND : EBPF_SUCCESS;
 }
 
+static ebpf_result_t
+_find_hash_map_entry_batch(
+    _Inout_ ebpf_core_map_t* map, size_t key_count, _In_ const uint8_t* keys, _Out_writes_(key_count) uint8_t** data)
+{
+    return ebpf_hash_table_find_batch((ebpf_hash_table_t*)map->data, key_count, keys, data);
+}
+
+static void
+_copy_hash_map_value(_In_ const ebpf_core_map_t* map, _In_ const uint8_t* value, _Out_ uint8_t* buffer)
+{
+    ebpf_hash_table_copy_value((ebpf_hash_table_t*)map->data, value, buffer);
+}
+
 /**
  * @brief Get an object from a map entry that holds objects, such
  * as a hash of maps.  The object returned holds a
@@ -1657,8 +1968,10 @@ _update_hash_map_entry(
 
     // If the map is full, try to delete the oldest entry and try again.
     // Repeat while the insert fails with EBPF_NO_MEMORY.
+    bool inserted = false;
     for (;;) {
-        result = ebpf_hash_table_update((ebpf_hash_table_t*)map->data, key, data, hash_table_operation);
+        result = ebpf_hash_table_update_and_report_insert(
+            (ebpf_hash_table_t*)map->data, key, data, hash_table_operation, &inserted);
         if (result != EBPF_OUT_OF_SPACE) {
             break;
         }
@@ -1674,6 +1987,12 @@ _update_hash_map_entry(
         _reap_oldest_map_entry(map);
     }
 
+    if (result == EBPF_SUCCESS) {
+        _ebpf_map_record_stat(map, inserted ? EBPF_MAP_STAT_INSERT : EBPF_MAP_STAT_REPLACE);
+        if (inserted && table->key_history) {
+            _schedule_lru_eviction_if_needed(map);
+        }
+    }
     return result;
 }
 
@@ -1834,7 +2153,7 @@ _ebpf_adjust_value_pointer(_In_ const ebpf_map_t* map, _Inout_ uint8_t** value)
 
     current_cpu = ebpf_get_current_cpu();
 
-    (*value) += EBPF_PAD_8((size_t)map->original_value_size) * current_cpu;
+    (*value) += (size_t)map->per_cpu_value_stride * current_cpu;
     return EBPF_SUCCESS;
 }
 
@@ -1861,6 +2180,7 @@ _update_entry_per_cpu(
     const ebpf_map_metadata_table_t* table = ebpf_map_get_table(map->ebpf_map_definition.type);
     uint8_t* target;
     if (table->find_entry(map, key, false, &target) != EBPF_SUCCESS) {
+        // The update that creates the entry counts the insert.
         ebpf_result_t return_value = table->update_entry(map, key, NULL, option);
         if (return_value != EBPF_SUCCESS) {
             return return_value;
@@ -1868,6 +2188,8 @@ _update_entry_per_cpu(
         if (table->find_entry(map, key, false, &target) != EBPF_SUCCESS) {
             return EBPF_NO_MEMORY;
         }
+    } else {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_REPLACE);
     }
     if (_ebpf_adjust_value_pointer(map, &target) != EBPF_SUCCESS) {
         return EBPF_INVALID_ARGUMENT;
@@ -1877,13 +2199,74 @@ _update_entry_per_cpu(
     return EBPF_SUCCESS;
 }
 
-static void
-_lpm_extract(_In_ const uint8_t* value, _Outptr_ const uint8_t** data, _Out_ size_t* length_in_bits)
+static inline ebpf_lpm_trie_node_t*
+_lpm_trie_read_node(_In_ ebpf_lpm_trie_node_t* const* slot)
 {
-    const ebpf_core_lpm_key_t* key = (const ebpf_core_lpm_key_t*)value;
-    *data = value;
-    // The length of the hash table key is the size of the prefix length (32 bits) plus the prefix length.
-    *length_in_bits = sizeof(uint32_t) * 8 + key->prefix_length;
+    return (ebpf_lpm_trie_node_t*)ReadSizeTAcquire((ULONG_PTR*)slot);
+}
+
+static inline void
+_lpm_trie_publish_node(_Inout_ ebpf_lpm_trie_node_t** slot, _In_opt_ const ebpf_lpm_trie_node_t* node)
+{
+    WriteSizeTRelease((ULONG_PTR*)slot, (ULONG_PTR)node);
+}
+
+static inline uint8_t*
+_lpm_trie_node_value(_In_ const ebpf_core_lpm_map_t* trie_map, _In_ const ebpf_lpm_trie_node_t* node)
+{
+    return (uint8_t*)node + EBPF_OFFSET_OF(ebpf_lpm_trie_node_t, data) + EBPF_PAD_8(trie_map->data_size);
+}
+
+/**
+ * @brief Return bit index of the prefix data, counting from the most significant bit of the first byte.
+ */
+static inline uint32_t
+_lpm_trie_extract_bit(_In_ const uint8_t* data, uint32_t index)
+{
+    return (data[index / 8] >> (7 - (index % 8))) & 1;
+}
+
+/**
+ * @brief Compute the number of leading bits shared by the node and the key, capped at the shorter of the two prefix
+ * lengths.
+ */
+static uint32_t
+_lpm_trie_longest_prefix_match(
+    _In_ const ebpf_core_lpm_map_t* trie_map,
+    _In_ const ebpf_lpm_trie_node_t* node,
+    _In_ const ebpf_core_lpm_key_t* lpm_key)
+{
+    uint32_t limit = node->prefix_length < lpm_key->prefix_length ? node->prefix_length : lpm_key->prefix_length;
+    uint32_t prefix_length = 0;
+    uint32_t index = 0;
+    unsigned long msb_index;
+
+    // Compare 8 bytes at a time while the prefixes are long enough, then fall back to single bytes.
+    for (; index + sizeof(uint64_t) <= trie_map->data_size && prefix_length < limit; index += sizeof(uint64_t)) {
+        uint64_t node_bits;
+        uint64_t key_bits;
+        memcpy(&node_bits, node->data + index, sizeof(uint64_t));
+        memcpy(&key_bits, lpm_key->prefix + index, sizeof(uint64_t));
+        uint64_t difference = _byteswap_uint64(node_bits ^ key_bits);
+        if (difference != 0) {
+            _BitScanReverse64(&msb_index, difference);
+            prefix_length += 63 - msb_index;
+            return prefix_length < limit ? prefix_length : limit;
+        }
+        prefix_length += 64;
+    }
+
+    for (; index < trie_map->data_size && prefix_length < limit; index++) {
+        uint8_t difference = node->data[index] ^ lpm_key->prefix[index];
+        if (difference != 0) {
+            _BitScanReverse(&msb_index, difference);
+            prefix_length += 7 - msb_index;
+            break;
+        }
+        prefix_length += 8;
+    }
+
+    return prefix_length < limit ? prefix_length : limit;
 }
 
 static ebpf_result_t
@@ -1893,34 +2276,32 @@ _create_lpm_map(
     _Outptr_ ebpf_core_map_t** map)
 {
     ebpf_result_t result = EBPF_SUCCESS;
-    // Key is uint32_t prefix length plus space for a max length prefix.
-    // - Only the prefix length plus prefix_length bits are actually used in an lpm key.
-    size_t max_prefix_length = (map_definition->key_size - sizeof(uint32_t)) * 8;
     ebpf_core_lpm_map_t* lpm_map = NULL;
 
     EBPF_LOG_ENTRY();
 
     *map = NULL;
 
-    if (inner_map_handle != ebpf_handle_invalid) {
+    // Key is uint32_t prefix length plus space for a max length prefix.
+    // - Only the prefix length plus prefix_length bits are actually used in an lpm key.
+    if (inner_map_handle != ebpf_handle_invalid || map_definition->key_size < sizeof(uint32_t)) {
         result = EBPF_INVALID_ARGUMENT;
         goto Exit;
     }
 
-    result = _create_hash_map_internal(
-        EBPF_OFFSET_OF(ebpf_core_lpm_map_t, data) + ebpf_bitmap_size(max_prefix_length + 1),
-        map_definition,
-        0,
-        false,
-        _lpm_extract,
-        NULL,
-        (ebpf_core_map_t**)&lpm_map);
-    if (result != EBPF_SUCCESS) {
+    lpm_map = ebpf_epoch_allocate_cache_aligned_with_tag(sizeof(ebpf_core_lpm_map_t), EBPF_POOL_TAG_MAP);
+    if (lpm_map == NULL) {
+        result = EBPF_NO_MEMORY;
         goto Exit;
     }
-    lpm_map->max_prefix = (uint32_t)max_prefix_length;
-    // Add one to max_prefix_length to account for max length prefixes in the prefix_length bitmap.
-    ebpf_bitmap_initialize((ebpf_bitmap_t*)lpm_map->data, max_prefix_length + 1);
+
+    lpm_map->core_map.ebpf_map_definition = *map_definition;
+    lpm_map->core_map.data = NULL;
+    lpm_map->data_size = map_definition->key_size - sizeof(uint32_t);
+    lpm_map->max_prefix = lpm_map->data_size * 8;
+    lpm_map->root = NULL;
+    lpm_map->entry_count = 0;
+    ebpf_lock_create(&lpm_map->lock);
 
     *map = &lpm_map->core_map;
 
@@ -1928,6 +2309,30 @@ Exit:
     EBPF_RETURN_RESULT(result);
 }
 
+static void
+_delete_lpm_map(_In_ _Post_invalid_ ebpf_core_map_t* map)
+{
+    ebpf_core_lpm_map_t* trie_map = EBPF_FROM_FIELD(ebpf_core_lpm_map_t, core_map, map);
+    ebpf_lpm_trie_node_t* node = trie_map->root;
+
+    // Free all nodes without recursion by rotating left children up until the current node has none.
+    while (node != NULL) {
+        ebpf_lpm_trie_node_t* left = node->children[0];
+        if (left != NULL) {
+            node->children[0] = left->children[1];
+            left->children[1] = node;
+            node = left;
+        } else {
+            ebpf_lpm_trie_node_t* right = node->children[1];
+            ebpf_epoch_free(node);
+            node = right;
+        }
+    }
+
+    ebpf_lock_destroy(&trie_map->lock);
+    ebpf_epoch_free_cache_aligned(trie_map);
+}
+
 static ebpf_result_t
 _find_lpm_map_entry(
     _Inout_ ebpf_core_map_t* map, _In_opt_ const uint8_t* key, bool delete_on_success, _Outptr_ uint8_t** data)
@@ -1937,46 +2342,103 @@ _find_lpm_map_entry(
     }
 
     ebpf_core_lpm_map_t* trie_map = EBPF_FROM_FIELD(ebpf_core_lpm_map_t, core_map, map);
-    ebpf_core_lpm_key_t* lpm_key = (ebpf_core_lpm_key_t*)key;
-    if (!lpm_key || lpm_key->prefix_length > trie_map->max_prefix) {
+    const ebpf_core_lpm_key_t* lpm_key = (const ebpf_core_lpm_key_t*)key;
+    if (lpm_key->prefix_length > trie_map->max_prefix) {
         return EBPF_INVALID_ARGUMENT;
     }
-    uint32_t original_prefix_length = lpm_key->prefix_length;
-    uint8_t* value = NULL;
 
-    ebpf_bitmap_cursor_t cursor;
-    // Start the key size search from the size of the passed in key.
-    // Iterate down through the inserted key lengths until we find a match.
-    // - Uses the passed in key for iteration by overwriting the prefix length.
-    ebpf_bitmap_start_reverse_search_at((ebpf_bitmap_t*)trie_map->data, &cursor, original_prefix_length);
-    lpm_key->prefix_length = (uint32_t)ebpf_bitmap_reverse_search_next_bit(&cursor);
-    while (lpm_key->prefix_length != MAXUINT32) {
-        if (_find_hash_map_entry(map, key, false, &value) == EBPF_SUCCESS) {
+    // Walk down the trie, remembering the deepest node holding a value whose prefix matches the key.
+    const ebpf_lpm_trie_node_t* found = NULL;
+    const ebpf_lpm_trie_node_t* node = _lpm_trie_read_node(&trie_map->root);
+    while (node != NULL) {
+        uint32_t matched = _lpm_trie_longest_prefix_match(trie_map, node, lpm_key);
+        if (matched == trie_map->max_prefix) {
+            found = node;
+            break;
+        }
+
+        // The node has more bits than the key matches, so no node below it can match either.
+        if (matched < node->prefix_length) {
             break;
         }
-        lpm_key->prefix_length = (uint32_t)ebpf_bitmap_reverse_search_next_bit(&cursor);
+
+        if (!(node->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE)) {
+            found = node;
+        }
+
+        node = _lpm_trie_read_node(&node->children[_lpm_trie_extract_bit(lpm_key->prefix, node->prefix_length)]);
     }
 
-    // Restore the original prefix length.
-    lpm_key->prefix_length = original_prefix_length;
-    if (!value) {
+    if (!found) {
         return EBPF_KEY_NOT_FOUND;
-    } else {
-        *data = value;
-        return EBPF_SUCCESS;
     }
+
+    *data = _lpm_trie_node_value(trie_map, found);
+    return EBPF_SUCCESS;
 }
 
 static ebpf_result_t
 _delete_lpm_map_entry(_In_ ebpf_core_map_t* map, _Inout_ const uint8_t* key)
 {
     ebpf_core_lpm_map_t* trie_map = EBPF_FROM_FIELD(ebpf_core_lpm_map_t, core_map, map);
-    uint32_t prefix_length = *(uint32_t*)key;
-    if (prefix_length > trie_map->max_prefix) {
+    const ebpf_core_lpm_key_t* lpm_key = (const ebpf_core_lpm_key_t*)key;
+    if (!key) {
         return EBPF_INVALID_ARGUMENT;
     }
+    if (lpm_key->prefix_length > trie_map->max_prefix) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    ebpf_result_t result = EBPF_SUCCESS;
+    ebpf_lock_state_t state = ebpf_lock_lock(&trie_map->lock);
+
+    // Find the node with an exact match, tracking the slot pointing at it and the slot pointing at its parent.
+    ebpf_lpm_trie_node_t** slot = &trie_map->root;
+    ebpf_lpm_trie_node_t** parent_slot = slot;
+    ebpf_lpm_trie_node_t* parent = NULL;
+    ebpf_lpm_trie_node_t* node;
+    uint32_t matched = 0;
+    while ((node = *slot) != NULL) {
+        matched = _lpm_trie_longest_prefix_match(trie_map, node, lpm_key);
+        if (node->prefix_length != matched || node->prefix_length == lpm_key->prefix_length) {
+            break;
+        }
+        parent = node;
+        parent_slot = slot;
+        slot = &node->children[_lpm_trie_extract_bit(lpm_key->prefix, node->prefix_length)];
+    }
 
-    return _delete_hash_map_entry(map, key);
+    if (!node || node->prefix_length != lpm_key->prefix_length || node->prefix_length != matched ||
+        (node->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE)) {
+        result = EBPF_KEY_NOT_FOUND;
+        goto Done;
+    }
+
+    if (node->children[0] && node->children[1]) {
+        // The node is still needed to join its children, so convert it to an intermediate node.
+        WriteNoFence((volatile long*)&node->flags, (long)(node->flags | EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE));
+        goto Done;
+    }
+
+    if (parent && (parent->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE) && !node->children[0] &&
+        !node->children[1]) {
+        // Removing a leaf leaves the intermediate parent with a single child, so replace the parent with the sibling.
+        _lpm_trie_publish_node(parent_slot, (node == parent->children[0]) ? parent->children[1] : parent->children[0]);
+        ebpf_epoch_free(parent);
+        ebpf_epoch_free(node);
+        goto Done;
+    }
+
+    // The node has at most one child, which takes its place.
+    _lpm_trie_publish_node(slot, node->children[0] ? node->children[0] : node->children[1]);
+    ebpf_epoch_free(node);
+
+Done:
+    if (result == EBPF_SUCCESS) {
+        trie_map->entry_count--;
+    }
+    ebpf_lock_unlock(&trie_map->lock, state);
+    return result;
 }
 
 static ebpf_result_t
@@ -1987,46 +2449,206 @@ _update_lpm_map_entry(
     if (!key) {
         return EBPF_INVALID_ARGUMENT;
     }
-    ebpf_core_lpm_key_t* lpm_key = (ebpf_core_lpm_key_t*)key;
+    const ebpf_core_lpm_key_t* lpm_key = (const ebpf_core_lpm_key_t*)key;
     if (lpm_key->prefix_length > trie_map->max_prefix) {
         return EBPF_INVALID_ARGUMENT;
     }
 
-    ebpf_result_t result = _update_hash_map_entry(map, key, data, option);
-    if (result == EBPF_SUCCESS) {
-        // Test if the bit is set before setting it. This avoids the overhead of a the interlocked operation.
-        if (!ebpf_bitmap_test_bit((ebpf_bitmap_t*)trie_map->data, lpm_key->prefix_length)) {
-            ebpf_bitmap_set_bit((ebpf_bitmap_t*)trie_map->data, lpm_key->prefix_length, true);
-        }
+    ebpf_result_t result = EBPF_SUCCESS;
+    bool replaced = false;
+    ebpf_lpm_trie_node_t* intermediate_node = NULL;
+    size_t node_size = EBPF_OFFSET_OF(ebpf_lpm_trie_node_t, data) + EBPF_PAD_8(trie_map->data_size) +
+                       map->ebpf_map_definition.value_size;
+
+    // Allocate and fill in the new node outside the lock.
+    ebpf_lpm_trie_node_t* new_node = ebpf_epoch_allocate_with_tag(node_size, EBPF_POOL_TAG_MAP);
+    if (!new_node) {
+        return EBPF_NO_MEMORY;
+    }
+    new_node->prefix_length = lpm_key->prefix_length;
+    memcpy(new_node->data, lpm_key->prefix, trie_map->data_size);
+    if (data) {
+        memcpy(_lpm_trie_node_value(trie_map, new_node), data, map->ebpf_map_definition.value_size);
     }
-    return result;
-}
 
-static ebpf_result_t
-_next_lpm_map_key_and_value(
-    _Inout_ ebpf_core_map_t* map,
-    _In_opt_ const uint8_t* previous_key,
-    _Inout_ uint8_t* next_key,
-    _Inout_opt_ uint8_t** next_value)
-{
-    ebpf_core_lpm_map_t* trie_map = EBPF_FROM_FIELD(ebpf_core_lpm_map_t, core_map, map);
-    ebpf_core_lpm_key_t* lpm_key = (ebpf_core_lpm_key_t*)next_key;
-    ebpf_core_lpm_key_t* previous_lpm_key = (ebpf_core_lpm_key_t*)previous_key;
+    ebpf_lock_state_t state = ebpf_lock_lock(&trie_map->lock);
 
-    // Validate prefix length.
-    if (!lpm_key || lpm_key->prefix_length > trie_map->max_prefix) {
-        return EBPF_INVALID_ARGUMENT;
+    // Find the slot where the new node belongs: either an empty slot, an exact match, or the first node that does not
+    // share the new node's prefix.
+    ebpf_lpm_trie_node_t** slot = &trie_map->root;
+    ebpf_lpm_trie_node_t* node;
+    uint32_t matched = 0;
+    while ((node = *slot) != NULL) {
+        matched = _lpm_trie_longest_prefix_match(trie_map, node, lpm_key);
+        if (node->prefix_length != matched || node->prefix_length == lpm_key->prefix_length ||
+            node->prefix_length == trie_map->max_prefix) {
+            break;
+        }
+        slot = &node->children[_lpm_trie_extract_bit(lpm_key->prefix, node->prefix_length)];
+    }
+
+    // Only an exact match with a node that holds a value replaces an entry; anything else adds one.
+    replaced = node && node->prefix_length == matched && node->prefix_length == lpm_key->prefix_length &&
+               !(node->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE);
+    if (!replaced && option != EBPF_EXIST && trie_map->entry_count >= map->ebpf_map_definition.max_entries) {
+        result = EBPF_OUT_OF_SPACE;
+        goto Done;
+    }
+
+    if (!node) {
+        if (option == EBPF_EXIST) {
+            result = EBPF_KEY_NOT_FOUND;
+            goto Done;
+        }
+        _lpm_trie_publish_node(slot, new_node);
+        new_node = NULL;
+        goto Done;
+    }
+
+    if (node->prefix_length == matched && node->prefix_length == lpm_key->prefix_length) {
+        bool intermediate = (node->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE) != 0;
+        if (!intermediate && option == EBPF_NOEXIST) {
+            result = EBPF_OBJECT_ALREADY_EXISTS;
+            goto Done;
+        }
+        if (intermediate && option == EBPF_EXIST) {
+            result = EBPF_KEY_NOT_FOUND;
+            goto Done;
+        }
+        // Replace the existing node, inheriting its children.
+        new_node->children[0] = node->children[0];
+        new_node->children[1] = node->children[1];
+        _lpm_trie_publish_node(slot, new_node);
+        new_node = NULL;
+        ebpf_epoch_free(node);
+        goto Done;
+    }
+
+    if (option == EBPF_EXIST) {
+        result = EBPF_KEY_NOT_FOUND;
+        goto Done;
+    }
+
+    if (matched == lpm_key->prefix_length) {
+        // The new node is a prefix of the existing node, so insert it above the existing node.
+        new_node->children[_lpm_trie_extract_bit(node->data, matched)] = node;
+        _lpm_trie_publish_node(slot, new_node);
+        new_node = NULL;
+        goto Done;
+    }
+
+    // The prefixes diverge after matched bits, so join them with an intermediate node.
+    intermediate_node = ebpf_epoch_allocate_with_tag(
+        EBPF_OFFSET_OF(ebpf_lpm_trie_node_t, data) + trie_map->data_size, EBPF_POOL_TAG_MAP);
+    if (!intermediate_node) {
+        result = EBPF_NO_MEMORY;
+        goto Done;
+    }
+    intermediate_node->prefix_length = matched;
+    intermediate_node->flags = EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE;
+    memcpy(intermediate_node->data, node->data, trie_map->data_size);
+    if (_lpm_trie_extract_bit(lpm_key->prefix, matched)) {
+        intermediate_node->children[0] = node;
+        intermediate_node->children[1] = new_node;
+    } else {
+        intermediate_node->children[0] = new_node;
+        intermediate_node->children[1] = node;
+    }
+    _lpm_trie_publish_node(slot, intermediate_node);
+    new_node = NULL;
+
+Done:
+    if (result == EBPF_SUCCESS && !replaced) {
+        trie_map->entry_count++;
+    }
+    ebpf_lock_unlock(&trie_map->lock, state);
+    ebpf_epoch_free(new_node);
+    if (result == EBPF_SUCCESS) {
+        _ebpf_map_record_stat(map, replaced ? EBPF_MAP_STAT_REPLACE : EBPF_MAP_STAT_INSERT);
+    }
+    return result;
+}
+
+/**
+ * @brief Return the first node with a value in pre-order starting at the given subtree.
+ */
+static const ebpf_lpm_trie_node_t*
+_lpm_trie_first_value_node(_In_opt_ const ebpf_lpm_trie_node_t* node)
+{
+    while (node && (node->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE)) {
+        const ebpf_lpm_trie_node_t* child = _lpm_trie_read_node(&node->children[0]);
+        node = child ? child : _lpm_trie_read_node(&node->children[1]);
+    }
+    return node;
+}
+
+static ebpf_result_t
+_next_lpm_map_key_and_value(
+    _Inout_ ebpf_core_map_t* map,
+    _In_opt_ const uint8_t* previous_key,
+    _Inout_ uint8_t* next_key,
+    _Inout_opt_ uint8_t** next_value)
+{
+    ebpf_core_lpm_map_t* trie_map = EBPF_FROM_FIELD(ebpf_core_lpm_map_t, core_map, map);
+    const ebpf_core_lpm_key_t* previous_lpm_key = (const ebpf_core_lpm_key_t*)previous_key;
+    const ebpf_lpm_trie_node_t* next_node = NULL;
+
+    if (!next_key) {
+        return EBPF_INVALID_ARGUMENT;
     }
 
     if (previous_lpm_key && previous_lpm_key->prefix_length > trie_map->max_prefix) {
         return EBPF_INVALID_ARGUMENT;
     }
 
-    return _next_hash_map_key_and_value(map, previous_key, next_key, next_value);
+    if (!previous_lpm_key) {
+        next_node = _lpm_trie_first_value_node(_lpm_trie_read_node(&trie_map->root));
+    } else {
+        // Keys are returned in pre-order. Locate the previous key, remembering the right sibling subtree of the
+        // deepest ancestor where the walk went left, which is where iteration resumes once the key's subtree is done.
+        const ebpf_lpm_trie_node_t* resume = NULL;
+        const ebpf_lpm_trie_node_t* node = _lpm_trie_read_node(&trie_map->root);
+        uint32_t matched = 0;
+        while (node != NULL) {
+            matched = _lpm_trie_longest_prefix_match(trie_map, node, previous_lpm_key);
+            if (node->prefix_length != matched || node->prefix_length == previous_lpm_key->prefix_length) {
+                break;
+            }
+            uint32_t next_bit = _lpm_trie_extract_bit(previous_lpm_key->prefix, node->prefix_length);
+            if (next_bit == 0) {
+                const ebpf_lpm_trie_node_t* right = _lpm_trie_read_node(&node->children[1]);
+                if (right) {
+                    resume = right;
+                }
+            }
+            node = _lpm_trie_read_node(&node->children[next_bit]);
+        }
+
+        if (!node || node->prefix_length != previous_lpm_key->prefix_length || node->prefix_length != matched ||
+            (node->flags & EBPF_LPM_TRIE_NODE_FLAG_INTERMEDIATE)) {
+            return EBPF_KEY_NOT_FOUND;
+        }
+
+        const ebpf_lpm_trie_node_t* left = _lpm_trie_read_node(&node->children[0]);
+        const ebpf_lpm_trie_node_t* right = _lpm_trie_read_node(&node->children[1]);
+        next_node = _lpm_trie_first_value_node(left ? left : (right ? right : resume));
+    }
+
+    if (!next_node) {
+        return EBPF_NO_MORE_KEYS;
+    }
+
+    ebpf_core_lpm_key_t* lpm_key = (ebpf_core_lpm_key_t*)next_key;
+    lpm_key->prefix_length = next_node->prefix_length;
+    memcpy(lpm_key->prefix, next_node->data, trie_map->data_size);
+    if (next_value) {
+        *next_value = _lpm_trie_node_value(trie_map, next_node);
+    }
+    return EBPF_SUCCESS;
 }
 
 static ebpf_result_t
-_create_queue_map(
+_create_circular_map(
     _In_ const ebpf_map_definition_in_memory_t* map_definition,
     ebpf_handle_t inner_map_handle,
     _Outptr_ ebpf_core_map_t** map)
@@ -2035,9 +2657,26 @@ _create_queue_map(
     if (inner_map_handle != ebpf_handle_invalid || map_definition->key_size != 0) {
         return EBPF_INVALID_ARGUMENT;
     }
+    // Values are stored inline in the map data, which is sized for max_entries values.
     size_t circular_map_size =
-        EBPF_OFFSET_OF(ebpf_core_circular_map_t, slots) + map_definition->max_entries * sizeof(uint8_t*);
+        EBPF_OFFSET_OF(ebpf_core_circular_map_t, sequences) + map_definition->max_entries * sizeof(int64_t);
     result = _create_array_map_with_map_struct_size(circular_map_size, map_definition, map);
+    if (result == EBPF_SUCCESS) {
+        ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, *map);
+        for (uint32_t i = 0; i < map_definition->max_entries; i++) {
+            circular_map->sequences[i] = i;
+        }
+    }
+    return result;
+}
+
+static ebpf_result_t
+_create_queue_map(
+    _In_ const ebpf_map_definition_in_memory_t* map_definition,
+    ebpf_handle_t inner_map_handle,
+    _Outptr_ ebpf_core_map_t** map)
+{
+    ebpf_result_t result = _create_circular_map(map_definition, inner_map_handle, map);
     if (result == EBPF_SUCCESS) {
         ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, *map);
         circular_map->type = EBPF_CORE_QUEUE;
@@ -2051,13 +2690,7 @@ _create_stack_map(
     ebpf_handle_t inner_map_handle,
     _Outptr_ ebpf_core_map_t** map)
 {
-    ebpf_result_t result;
-    if (inner_map_handle != ebpf_handle_invalid || map_definition->key_size != 0) {
-        return EBPF_INVALID_ARGUMENT;
-    }
-    size_t circular_map_size =
-        EBPF_OFFSET_OF(ebpf_core_circular_map_t, slots) + map_definition->max_entries * sizeof(uint8_t*);
-    result = _create_array_map_with_map_struct_size(circular_map_size, map_definition, map);
+    ebpf_result_t result = _create_circular_map(map_definition, inner_map_handle, map);
     if (result == EBPF_SUCCESS) {
         ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, *map);
         circular_map->type = EBPF_CORE_STACK;
@@ -2069,30 +2702,23 @@ static void
 _delete_circular_map(_In_ _Post_invalid_ ebpf_core_map_t* map)
 {
     ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, map);
-    // Free all the elements stored in the stack.
-    for (size_t i = 0; i < circular_map->core_map.ebpf_map_definition.max_entries; i++) {
-        ebpf_epoch_free(circular_map->slots[i]);
-    }
     ebpf_epoch_free(circular_map);
 }
 
 static ebpf_result_t
-_find_circular_map_entry(
-    _Inout_ ebpf_core_map_t* map, _In_opt_ const uint8_t* key, bool delete_on_success, _Outptr_ uint8_t** data)
+_peek_or_pop_circular_map_entry(_Inout_ ebpf_core_map_t* map, bool pop, _Out_opt_ uint8_t* value)
 {
-    if (!map) {
-        return EBPF_INVALID_ARGUMENT;
-    }
+    ebpf_result_t result;
+    ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, map);
 
-    // Queue uses no key, but the caller always passes in a non-null pointer (with a 0 key size)
-    // so we cannot require key to be null.
-    UNREFERENCED_PARAMETER(key);
+    if (circular_map->type == EBPF_CORE_QUEUE) {
+        return _ebpf_core_queue_map_peek_or_pop(circular_map, pop, value);
+    }
 
-    ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, map);
     ebpf_lock_state_t state = ebpf_lock_lock(&circular_map->lock);
-    *data = _ebpf_core_circular_map_peek_or_pop(circular_map, delete_on_success);
+    result = _ebpf_core_stack_map_peek_or_pop(circular_map, pop, value);
     ebpf_lock_unlock(&circular_map->lock, state);
-    return *data == NULL ? EBPF_OBJECT_NOT_FOUND : EBPF_SUCCESS;
+    return result;
 }
 
 static ebpf_result_t
@@ -2110,9 +2736,16 @@ _update_circular_map_entry(
     UNREFERENCED_PARAMETER(key);
 
     ebpf_core_circular_map_t* circular_map = EBPF_FROM_FIELD(ebpf_core_circular_map_t, core_map, map);
-    ebpf_lock_state_t state = ebpf_lock_lock(&circular_map->lock);
-    result = _ebpf_core_circular_map_push(circular_map, data, option & BPF_EXIST);
-    ebpf_lock_unlock(&circular_map->lock, state);
+    if (circular_map->type == EBPF_CORE_QUEUE) {
+        result = _ebpf_core_queue_map_push(circular_map, data, option & BPF_EXIST);
+    } else {
+        ebpf_lock_state_t state = ebpf_lock_lock(&circular_map->lock);
+        result = _ebpf_core_stack_map_push(circular_map, data, option & BPF_EXIST);
+        ebpf_lock_unlock(&circular_map->lock, state);
+    }
+    if (result == EBPF_SUCCESS) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_INSERT);
+    }
     return result;
 }
 
@@ -2251,11 +2884,70 @@ _map_async_query_cancel(
     ebpf_free(context);
 }
 
+static void
+_query_perf_event_array_map(
+    _In_ const ebpf_core_map_t* map, uint64_t index, _Inout_ ebpf_map_async_query_result_t* async_query_result);
+
+static ebpf_result_t
+_query_buffer_perf_event_array_map(
+    _In_ const ebpf_core_map_t* map, uint64_t index, _Outptr_ uint8_t** buffer, _Out_ size_t* consumer_offset);
+
+static ebpf_result_t
+_async_query_perf_event_array_map(
+    _In_ const ebpf_core_map_t* map,
+    uint64_t index,
+    _Inout_ ebpf_map_async_query_result_t* async_query_result,
+    _Inout_ void* async_context);
+
+static ebpf_result_t
+_return_buffer_perf_event_array_map(_In_ const ebpf_core_map_t* map, uint64_t index, size_t consumer_offset);
+
+static void
+_delete_perf_event_array_map(_In_ _Post_invalid_ ebpf_core_map_t* map);
+
+static ebpf_result_t
+_create_perf_event_array_map(
+    _In_ const ebpf_map_definition_in_memory_t* map_definition,
+    ebpf_handle_t inner_map_handle,
+    _Outptr_ ebpf_core_map_t** map);
+
+/**
+ * @brief Determine if a ring buffer map is backed by per-CPU sub-rings (EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU).
+ *
+ * Such maps use the perf event array map layout, so their per-ring operations are delegated to the perf event array
+ * map functions, with the index naming the sub-ring.
+ *
+ * @param[in] map Pointer to the ring buffer map.
+ * @return True if the map is backed by per-CPU sub-rings.
+ */
+static inline bool
+_ring_buffer_map_is_per_cpu(_In_ const ebpf_core_map_t* map)
+{
+    return (map->ebpf_map_definition.map_flags & EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU) != 0;
+}
+
+/**
+ * @brief Determine if an index names a sub-ring of a per-CPU ring buffer map.
+ *
+ * @param[in] map Pointer to the per-CPU ring buffer map.
+ * @param[in] index Index to check.
+ * @return True if the index is valid.
+ */
+static inline bool
+_ring_buffer_map_is_valid_ring_index(_In_ const ebpf_core_map_t* map, uint64_t index)
+{
+    ebpf_core_perf_event_array_map_t* per_cpu_map = EBPF_FROM_FIELD(ebpf_core_perf_event_array_map_t, core_map, map);
+    return index < per_cpu_map->ring_count;
+}
+
 static void
 _query_ring_buffer_map(
     _In_ const ebpf_core_map_t* map, uint64_t index, _Inout_ ebpf_map_async_query_result_t* async_query_result)
 {
-    UNREFERENCED_PARAMETER(index);
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        _query_perf_event_array_map(map, index, async_query_result);
+        return;
+    }
     ebpf_ring_buffer_query(
         (ebpf_ring_buffer_t*)map->data, &async_query_result->consumer, &async_query_result->producer);
 }
@@ -2264,6 +2956,9 @@ static ebpf_result_t
 _set_wait_handle_ring_buffer_map(
     _In_ const ebpf_core_map_t* map, uint64_t index, _In_ ebpf_handle_t wait_handle, uint64_t flags)
 {
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        return EBPF_OPERATION_NOT_SUPPORTED;
+    }
     if (index != 0) {
         return EBPF_INVALID_ARGUMENT;
     }
@@ -2362,6 +3057,10 @@ _map_user_ring_buffer_map(
     _Outptr_result_buffer_(*data_size) uint8_t** data,
     _Out_ size_t* data_size)
 {
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        // The sub-rings can only be consumed through the async query interface, which merges them.
+        return EBPF_OPERATION_NOT_SUPPORTED;
+    }
     ebpf_ring_buffer_t* ring_buffer = (ebpf_ring_buffer_t*)map->data;
     return ebpf_ring_buffer_map_user(ring_buffer, consumer, producer, data, data_size);
 }
@@ -2370,6 +3069,9 @@ static ebpf_result_t
 _unmap_user_ring_buffer_map(
     _In_ const ebpf_core_map_t* map, _In_ const void* consumer, _In_ const void* producer, _In_ const void* data)
 {
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        return EBPF_OPERATION_NOT_SUPPORTED;
+    }
     ebpf_ring_buffer_t* ring_buffer = (ebpf_ring_buffer_t*)map->data;
     return ebpf_ring_buffer_unmap_user(ring_buffer, consumer, producer, data);
 }
@@ -2378,7 +3080,12 @@ static ebpf_result_t
 _query_buffer_ring_buffer_map(
     _In_ const ebpf_core_map_t* map, uint64_t index, _Outptr_ uint8_t** buffer, _Out_ size_t* consumer_offset)
 {
-    UNREFERENCED_PARAMETER(index);
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        if (!_ring_buffer_map_is_valid_ring_index(map, index)) {
+            return EBPF_INVALID_ARGUMENT;
+        }
+        return _query_buffer_perf_event_array_map(map, index, buffer, consumer_offset);
+    }
     size_t producer_offset;
     ebpf_ring_buffer_query((ebpf_ring_buffer_t*)map->data, consumer_offset, &producer_offset);
     void* consumer = NULL;
@@ -2400,7 +3107,12 @@ _async_query_ring_buffer_map(
     _Inout_ ebpf_map_async_query_result_t* async_query_result,
     _Inout_ void* async_context)
 {
-    UNREFERENCED_PARAMETER(index);
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        if (!_ring_buffer_map_is_valid_ring_index(map, index)) {
+            return EBPF_INVALID_ARGUMENT;
+        }
+        return _async_query_perf_event_array_map(map, index, async_query_result, async_context);
+    }
 
     ebpf_core_ring_buffer_map_t* ring_buffer_map = EBPF_FROM_FIELD(ebpf_core_ring_buffer_map_t, core_map, map);
     ebpf_core_map_async_contexts_t* async_contexts = &ring_buffer_map->async;
@@ -2417,7 +3129,12 @@ _async_query_ring_buffer_map(
 static ebpf_result_t
 _return_buffer_ring_buffer_map(_In_ const ebpf_core_map_t* map, uint64_t index, size_t consumer_offset)
 {
-    UNREFERENCED_PARAMETER(index);
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        if (!_ring_buffer_map_is_valid_ring_index(map, index)) {
+            return EBPF_INVALID_ARGUMENT;
+        }
+        return _return_buffer_perf_event_array_map(map, index, consumer_offset);
+    }
     return ebpf_ring_buffer_return_buffer((ebpf_ring_buffer_t*)map->data, consumer_offset);
 }
 
@@ -2494,6 +3211,11 @@ _write_data_perf_event_array_map(_Inout_ ebpf_core_map_t* map, uint64_t flags, _
 static void
 _delete_ring_buffer_map(_In_ _Post_invalid_ ebpf_core_map_t* map)
 {
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        _delete_perf_event_array_map(map);
+        return;
+    }
+
     EBPF_LOG_ENTRY();
     // Free the ring buffer.
     ebpf_ring_buffer_destroy((ebpf_ring_buffer_t*)map->data);
@@ -2538,6 +3260,12 @@ _create_ring_buffer_map(
         goto Exit;
     }
 
+    if (map_definition->map_flags & EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU) {
+        // One sub-ring of max_entries bytes per CPU, laid out like a perf event array map.
+        result = _create_perf_event_array_map(map_definition, inner_map_handle, map);
+        goto Exit;
+    }
+
     ring_buffer_map = ebpf_epoch_allocate_with_tag(sizeof(ebpf_core_ring_buffer_map_t), EBPF_POOL_TAG_MAP);
     if (ring_buffer_map == NULL) {
         result = EBPF_NO_MEMORY;
@@ -2566,6 +3294,105 @@ Exit:
     EBPF_RETURN_RESULT(result);
 }
 
+/**
+ * @brief Reserve a record in the sub-ring of the current CPU of a per-CPU ring buffer map and timestamp it.
+ *
+ * @param[in, out] map Pointer to the per-CPU ring buffer map.
+ * @param[out] data Pointer to the record data (following the record prefix) on success.
+ * @param[in] length Length of the record data.
+ * @param[out] cpu_id CPU whose sub-ring holds the record.
+ * @retval EBPF_SUCCESS Successfully reserved the record.
+ * @retval EBPF_INVALID_ARGUMENT The length is invalid or the sub-ring is full.
+ */
+static ebpf_result_t
+_ring_buffer_map_reserve_per_cpu(
+    _Inout_ ebpf_core_map_t* map,
+    _Outptr_result_bytebuffer_(length) uint8_t** data,
+    size_t length,
+    _Out_ uint32_t* cpu_id)
+{
+    ebpf_core_perf_event_array_map_t* per_cpu_map = EBPF_FROM_FIELD(ebpf_core_perf_event_array_map_t, core_map, map);
+    const size_t prefix_size = sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t);
+    uint8_t* record_data;
+
+    *cpu_id = 0;
+    if (length == 0 || length > EBPF_RINGBUF_MAX_RECORD_SIZE - prefix_size) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    // Stay at dispatch while picking the sub-ring and reserving from it, so each sub-ring only ever has a single
+    // producer reserving from it at a time and no compare-exchange is needed.
+    KIRQL irql_at_enter = ebpf_raise_irql_to_dispatch_if_needed();
+    *cpu_id = ebpf_get_current_cpu();
+    ebpf_core_perf_ring_t* ring = &per_cpu_map->rings[*cpu_id];
+    ebpf_result_t result = ebpf_ring_buffer_reserve_exclusive(&ring->ring, &record_data, prefix_size + length);
+    if (result == EBPF_SUCCESS) {
+        ebpf_ring_buffer_per_cpu_record_prefix_t* prefix = (ebpf_ring_buffer_per_cpu_record_prefix_t*)record_data;
+        prefix->timestamp = cxplat_query_time_since_boot_precise(false);
+        *data = record_data + prefix_size;
+    } else {
+        ring->lost_records++;
+    }
+    ebpf_lower_irql_from_dispatch_if_needed(irql_at_enter);
+    return result;
+}
+
+/**
+ * @brief Determine if a record lies in a sub-ring.
+ *
+ * @param[in] ring Pointer to the sub-ring.
+ * @param[in] data Pointer into the record.
+ * @return True if the record lies in the sub-ring's data buffer.
+ */
+static inline bool
+_ring_buffer_contains(_In_ const ebpf_ring_buffer_t* ring, _In_ const uint8_t* data)
+{
+    // The data buffer is double mapped, so a record can start in the first mapping and end in the second.
+    return data >= ring->data && data < ring->data + 2 * ring->length;
+}
+
+/**
+ * @brief Find the sub-ring of a per-CPU ring buffer map that holds a reserved record.
+ *
+ * @param[in] map Pointer to the per-CPU ring buffer map.
+ * @param[in] data Pointer to the record data returned by _ring_buffer_map_reserve_per_cpu.
+ * @return Index of the sub-ring, or the sub-ring count if the record is not in any sub-ring.
+ */
+static uint32_t
+_ring_buffer_map_find_ring_per_cpu(_In_ const ebpf_core_map_t* map, _In_ const uint8_t* data)
+{
+    ebpf_core_perf_event_array_map_t* per_cpu_map = EBPF_FROM_FIELD(ebpf_core_perf_event_array_map_t, core_map, map);
+
+    // Records are almost always released on the CPU that reserved them, so check that sub-ring first.
+    uint32_t current_cpu = ebpf_get_current_cpu();
+    if (current_cpu < per_cpu_map->ring_count && _ring_buffer_contains(&per_cpu_map->rings[current_cpu].ring, data)) {
+        return current_cpu;
+    }
+    for (uint32_t cpu_id = 0; cpu_id < per_cpu_map->ring_count; cpu_id++) {
+        if (_ring_buffer_contains(&per_cpu_map->rings[cpu_id].ring, data)) {
+            return cpu_id;
+        }
+    }
+    return per_cpu_map->ring_count;
+}
+
+/**
+ * @brief Signal pending async queries on a sub-ring of a per-CPU ring buffer map.
+ *
+ * @param[in] map Pointer to the per-CPU ring buffer map.
+ * @param[in] cpu_id Index of the sub-ring.
+ */
+static void
+_ring_buffer_map_signal_per_cpu(_In_ const ebpf_core_map_t* map, uint32_t cpu_id)
+{
+    ebpf_core_perf_event_array_map_t* per_cpu_map = EBPF_FROM_FIELD(ebpf_core_perf_event_array_map_t, core_map, map);
+    ebpf_core_perf_ring_t* ring = &per_cpu_map->rings[cpu_id];
+
+    ebpf_lock_state_t state = ebpf_lock_lock(&ring->async.lock);
+    _ebpf_perf_event_array_map_signal_async_query_complete(map, cpu_id);
+    ebpf_lock_unlock(&ring->async.lock, state);
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_ring_buffer_map_output(_Inout_ ebpf_core_map_t* map, _In_reads_bytes_(length) uint8_t* data, size_t length)
 {
@@ -2573,6 +3400,19 @@ ebpf_ring_buffer_map_output(_Inout_ ebpf_core_map_t* map, _In_reads_bytes_(lengt
 
     EBPF_LOG_ENTRY();
 
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        uint8_t* record_data;
+        uint32_t cpu_id;
+        result = _ring_buffer_map_reserve_per_cpu(map, &record_data, length, &cpu_id);
+        if (result != EBPF_SUCCESS) {
+            goto Exit;
+        }
+        memcpy(record_data, data, length);
+        result = ebpf_ring_buffer_submit(record_data - sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t), 0);
+        _ring_buffer_map_signal_per_cpu(map, cpu_id);
+        goto Exit;
+    }
+
     result = ebpf_ring_buffer_output((ebpf_ring_buffer_t*)map->data, data, length);
     if (result != EBPF_SUCCESS) {
         goto Exit;
@@ -2588,6 +3428,63 @@ Exit:
     EBPF_RETURN_RESULT(result);
 }
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_ring_buffer_map_reserve(_Inout_ ebpf_map_t* map, _Outptr_result_bytebuffer_(length) uint8_t** data, size_t length)
+{
+    // High volume call - Skip entry/exit logging.
+    if (map->ebpf_map_definition.type != BPF_MAP_TYPE_RINGBUF) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        uint32_t cpu_id;
+        return _ring_buffer_map_reserve_per_cpu(map, data, length, &cpu_id);
+    }
+    return ebpf_ring_buffer_reserve((ebpf_ring_buffer_t*)map->data, data, length);
+}
+
+_Must_inspect_result_ ebpf_result_t
+ebpf_ring_buffer_map_submit(_Inout_ ebpf_map_t* map, _In_ uint8_t* data, uint64_t flags)
+{
+    // High volume call - Skip entry/exit logging.
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        uint32_t cpu_id = _ring_buffer_map_find_ring_per_cpu(map, data);
+        if (!_ring_buffer_map_is_valid_ring_index(map, cpu_id)) {
+            return EBPF_INVALID_ARGUMENT;
+        }
+        ebpf_result_t result = ebpf_ring_buffer_submit(data - sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t), flags);
+        if (result == EBPF_SUCCESS && !(flags & EBPF_RINGBUF_FLAG_NO_WAKEUP)) {
+            _ring_buffer_map_signal_per_cpu(map, cpu_id);
+        }
+        return result;
+    }
+
+    ebpf_result_t result = ebpf_ring_buffer_submit(data, flags);
+    if (result != EBPF_SUCCESS || (flags & EBPF_RINGBUF_FLAG_NO_WAKEUP)) {
+        return result;
+    }
+
+    ebpf_core_ring_buffer_map_t* ring_buffer_map = EBPF_FROM_FIELD(ebpf_core_ring_buffer_map_t, core_map, map);
+
+    ebpf_lock_state_t state = ebpf_lock_lock(&ring_buffer_map->async.lock);
+    _ebpf_ring_buffer_map_signal_async_query_complete(map, 0);
+    ebpf_lock_unlock(&ring_buffer_map->async.lock, state);
+
+    return EBPF_SUCCESS;
+}
+
+_Must_inspect_result_ ebpf_result_t
+ebpf_ring_buffer_map_discard(_Inout_ ebpf_map_t* map, _In_ uint8_t* data, uint64_t flags)
+{
+    // High volume call - Skip entry/exit logging.
+    if (_ring_buffer_map_is_per_cpu(map)) {
+        if (!_ring_buffer_map_is_valid_ring_index(map, _ring_buffer_map_find_ring_per_cpu(map, data))) {
+            return EBPF_INVALID_ARGUMENT;
+        }
+        return ebpf_ring_buffer_discard(data - sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t), flags);
+    }
+    return ebpf_ring_buffer_discard(data, flags);
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_map_query_buffer(
     _In_ const ebpf_map_t* map, uint64_t index, _Outptr_ uint8_t** buffer, _Out_ size_t* consumer_offset)
@@ -2932,9 +3829,11 @@ const ebpf_map_metadata_table_t ebpf_map_metadata_tables[] = {
         .create_map = _create_hash_map,
         .delete_map = _delete_hash_map,
         .find_entry = _find_hash_map_entry,
+        .find_entry_batch = _find_hash_map_entry_batch,
         .update_entry = _update_hash_map_entry,
         .delete_entry = _delete_hash_map_entry,
         .next_key_and_value = _next_hash_map_key_and_value,
+        .copy_value = _copy_hash_map_value,
     },
     {
         .map_type = BPF_MAP_TYPE_ARRAY,
@@ -2961,10 +3860,12 @@ const ebpf_map_metadata_table_t ebpf_map_metadata_tables[] = {
         .create_map = _create_hash_map,
         .delete_map = _delete_hash_map,
         .find_entry = _find_hash_map_entry,
+        .find_entry_batch = _find_hash_map_entry_batch,
         .update_entry = _update_hash_map_entry,
         .update_entry_per_cpu = _update_entry_per_cpu,
         .delete_entry = _delete_hash_map_entry,
         .next_key_and_value = _next_hash_map_key_and_value,
+        .copy_value = _copy_hash_map_value,
         .per_cpu = true,
     },
     {
@@ -3003,16 +3904,16 @@ const ebpf_map_metadata_table_t ebpf_map_metadata_tables[] = {
         .create_map = _create_lru_hash_map,
         .delete_map = _delete_hash_map,
         .find_entry = _find_hash_map_entry,
+        .find_entry_batch = _find_hash_map_entry_batch,
         .update_entry = _update_hash_map_entry,
         .delete_entry = _delete_hash_map_entry,
         .next_key_and_value = _next_hash_map_key_and_value,
         .key_history = true,
     },
-    // LPM_TRIE is currently a hash-map with special behavior for find.
     {
         .map_type = BPF_MAP_TYPE_LPM_TRIE,
         .create_map = _create_lpm_map,
-        .delete_map = _delete_hash_map,
+        .delete_map = _delete_lpm_map,
         .find_entry = _find_lpm_map_entry,
         .update_entry = _update_lpm_map_entry,
         .delete_entry = _delete_lpm_map_entry,
@@ -3022,7 +3923,7 @@ const ebpf_map_metadata_table_t ebpf_map_metadata_tables[] = {
         .map_type = BPF_MAP_TYPE_QUEUE,
         .create_map = _create_queue_map,
         .delete_map = _delete_circular_map,
-        .find_entry = _find_circular_map_entry,
+        .peek_or_pop_entry = _peek_or_pop_circular_map_entry,
         .update_entry = _update_circular_map_entry,
         .zero_length_key = true,
     },
@@ -3031,6 +3932,7 @@ const ebpf_map_metadata_table_t ebpf_map_metadata_tables[] = {
         .create_map = _create_lru_hash_map,
         .delete_map = _delete_hash_map,
         .find_entry = _find_hash_map_entry,
+        .find_entry_batch = _find_hash_map_entry_batch,
         .update_entry = _update_hash_map_entry,
         .update_entry_per_cpu = _update_entry_per_cpu,
         .delete_entry = _delete_hash_map_entry,
@@ -3042,7 +3944,7 @@ const ebpf_map_metadata_table_t ebpf_map_metadata_tables[] = {
         .map_type = BPF_MAP_TYPE_STACK,
         .create_map = _create_stack_map,
         .delete_map = _delete_circular_map,
-        .find_entry = _find_circular_map_entry,
+        .peek_or_pop_entry = _peek_or_pop_circular_map_entry,
         .update_entry = _update_circular_map_entry,
         .zero_length_key = true,
     },
@@ -3087,6 +3989,121 @@ ebpf_map_get_table(_In_range_(0, EBPF_COUNT_OF(ebpf_map_metadata_tables) - 1) co
     return &ebpf_map_metadata_tables[type];
 }
 
+/**
+ * @brief Allocate the scratch buffer needed by _ebpf_map_update_padded_value to convert a cache-aligned per-CPU value
+ * from the layout exchanged with user mode.
+ *
+ * @param[in] map Map whose values will be converted.
+ * @param[out] scratch Scratch buffer, or NULL if the map doesn't need one.
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Unable to allocate the scratch buffer.
+ */
+static ebpf_result_t
+_ebpf_map_allocate_value_scratch(_In_ const ebpf_core_map_t* map, _Outptr_result_maybenull_ uint8_t** scratch)
+{
+    *scratch = NULL;
+    if (!_ebpf_map_is_per_cpu_padded(map)) {
+        return EBPF_SUCCESS;
+    }
+    *scratch = ebpf_allocate_with_tag(map->ebpf_map_definition.value_size, EBPF_POOL_TAG_MAP);
+    return (*scratch == NULL) ? EBPF_NO_MEMORY : EBPF_SUCCESS;
+}
+
+/**
+ * @brief Copy a value as stored in the map, through the map's copy routine if it has one.
+ *
+ * @param[in] table Metadata table of the map.
+ * @param[in] map Map the value belongs to.
+ * @param[in] value Value as stored in the map.
+ * @param[out] buffer Buffer of the stored value size to copy the value into.
+ */
+static inline void
+_ebpf_map_copy_stored_value(
+    _In_ const ebpf_map_metadata_table_t* table,
+    _In_ const ebpf_core_map_t* map,
+    _In_ const uint8_t* value,
+    _Out_ uint8_t* buffer)
+{
+    if (table->copy_value) {
+        table->copy_value(map, value, buffer);
+    } else {
+        memcpy(buffer, value, map->ebpf_map_definition.value_size);
+    }
+}
+
+/**
+ * @brief Copy a value returned by find_entry or next_key_and_value into a caller supplied buffer, in the layout
+ * exchanged with user mode.
+ *
+ * @param[in] table Metadata table of the map.
+ * @param[in, out] map Map the value belongs to.
+ * @param[in] value Value as stored in the map.
+ * @param[out] buffer Buffer to copy the value into.
+ */
+static inline void
+_ebpf_map_copy_value(
+    _In_ const ebpf_map_metadata_table_t* table,
+    _Inout_ ebpf_core_map_t* map,
+    _In_ const uint8_t* value,
+    _Out_ uint8_t* buffer)
+{
+    if (!_ebpf_map_is_per_cpu_padded(map)) {
+        _ebpf_map_copy_stored_value(table, map, value, buffer);
+        return;
+    }
+
+    // Copy the whole value into the map's scratch buffer, then gather the cache-aligned CPU slots into the packed
+    // layout.
+    ebpf_lock_state_t lock_state = ebpf_lock_lock(&map->value_scratch_lock);
+    _ebpf_map_copy_stored_value(table, map, value, map->value_scratch);
+    size_t user_stride = EBPF_PAD_8((size_t)map->original_value_size);
+    uint32_t cpu_count = ebpf_get_cpu_count();
+    for (uint32_t cpu = 0; cpu < cpu_count; cpu++) {
+        memcpy(buffer + cpu * user_stride, map->value_scratch + (size_t)cpu * map->per_cpu_value_stride, user_stride);
+    }
+    ebpf_lock_unlock(&map->value_scratch_lock, lock_state);
+}
+
+/**
+ * @brief Update a cache-aligned per-CPU map from a value in the layout exchanged with user mode.
+ *
+ * @param[in] table Metadata table of the map.
+ * @param[in, out] map Map to update.
+ * @param[in] key Key to update.
+ * @param[in] value Value in the packed per-CPU layout.
+ * @param[in] option Update option.
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Unable to allocate resources for this entry.
+ */
+static ebpf_result_t
+_ebpf_map_update_padded_value(
+    _In_ const ebpf_map_metadata_table_t* table,
+    _Inout_ ebpf_core_map_t* map,
+    _In_ const uint8_t* key,
+    _In_ const uint8_t* value,
+    ebpf_map_option_t option)
+{
+    uint8_t* scratch;
+    ebpf_result_t result = _ebpf_map_allocate_value_scratch(map, &scratch);
+    if (result != EBPF_SUCCESS) {
+        return result;
+    }
+    ebpf_assert(scratch != NULL);
+    _Analysis_assume_(scratch != NULL);
+
+    // Scatter the packed CPU slots into the cache-aligned layout, leaving the padding zeroed.
+    memset(scratch, 0, map->ebpf_map_definition.value_size);
+    size_t user_stride = EBPF_PAD_8((size_t)map->original_value_size);
+    uint32_t cpu_count = ebpf_get_cpu_count();
+    for (uint32_t cpu = 0; cpu < cpu_count; cpu++) {
+        memcpy(scratch + (size_t)cpu * map->per_cpu_value_stride, value + cpu * user_stride, user_stride);
+    }
+
+    result = table->update_entry(map, key, scratch, option);
+    ebpf_free(scratch);
+    return result;
+}
+
 static void
 _ebpf_map_delete(_In_ _Post_invalid_ ebpf_core_object_t* object)
 {
@@ -3094,6 +4111,11 @@ _ebpf_map_delete(_In_ _Post_invalid_ ebpf_core_object_t* object)
     ebpf_map_t* map = (ebpf_map_t*)object;
 
     ebpf_free(map->name.value);
+    if (map->cpu_stats) {
+        cxplat_free(map->cpu_stats, CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED, EBPF_POOL_TAG_MAP);
+    }
+    ebpf_free(map->value_scratch);
+    ebpf_lock_destroy(&map->value_scratch_lock);
     ebpf_map_get_table(map->ebpf_map_definition.type)->delete_map(map);
     EBPF_RETURN_VOID();
 }
@@ -3137,8 +4159,59 @@ ebpf_map_create(
         goto Exit;
     }
 
+    if (ebpf_map_definition->map_flags & ~EBPF_MAP_CREATE_SUPPORTED_FLAGS) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "Unsupported map flags",
+            ebpf_map_definition->map_flags);
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
+    // Cache-aligned per-CPU slots are only supported for per-CPU maps whose values are exchanged with user mode.
+    if ((ebpf_map_definition->map_flags & EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED) &&
+        (type != BPF_MAP_TYPE_PERCPU_HASH && type != BPF_MAP_TYPE_PERCPU_ARRAY &&
+         type != BPF_MAP_TYPE_LRU_PERCPU_HASH)) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED not supported on map",
+            type);
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
+    if ((ebpf_map_definition->map_flags & EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU) && type != BPF_MAP_TYPE_RINGBUF) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU not supported on map",
+            type);
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
+    if ((ebpf_map_definition->map_flags & EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION) &&
+        (type != BPF_MAP_TYPE_LRU_HASH && type != BPF_MAP_TYPE_LRU_PERCPU_HASH)) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION not supported on map",
+            type);
+        result = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
+    uint32_t per_cpu_value_stride = 0;
     if (table->per_cpu) {
-        local_map_definition.value_size = cpu_count * EBPF_PAD_8(local_map_definition.value_size);
+        per_cpu_value_stride = EBPF_PAD_8(local_map_definition.value_size);
+        if (ebpf_map_definition->map_flags & EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED) {
+            // Values are only guaranteed to be 8-byte aligned, so reserve enough slack that a slot starting at any
+            // 8-byte offset within a cache line never shares a line with the next slot.
+            per_cpu_value_stride = EBPF_PAD_CACHE(per_cpu_value_stride + EBPF_CACHE_LINE_SIZE - 8);
+        }
+        local_map_definition.value_size = cpu_count * per_cpu_value_stride;
     }
 
     if (map_name->length >= BPF_OBJ_NAME_LEN) {
@@ -3161,6 +4234,31 @@ ebpf_map_create(
     ebpf_assert(type == local_map->ebpf_map_definition.type);
 
     local_map->original_value_size = ebpf_map_definition->value_size;
+    local_map->per_cpu_value_stride = per_cpu_value_stride;
+
+    local_map->cpu_stats = NULL;
+    local_map->value_scratch = NULL;
+    ebpf_lock_create(&local_map->value_scratch_lock);
+    if (table->per_cpu) {
+        // Lookups from user mode copy per-CPU values through this buffer rather than allocating one each time.
+        local_map->value_scratch = ebpf_allocate_with_tag(local_map_definition.value_size, EBPF_POOL_TAG_MAP);
+        if (local_map->value_scratch == NULL) {
+            result = EBPF_NO_MEMORY;
+            goto Exit;
+        }
+    }
+
+    if (ebpf_map_definition->map_flags & EBPF_MAP_CREATE_FLAG_STATISTICS) {
+        local_map->cpu_stats_count = cpu_count;
+        local_map->cpu_stats = cxplat_allocate(
+            CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED,
+            sizeof(ebpf_map_cpu_stats_t) * cpu_count,
+            EBPF_POOL_TAG_MAP);
+        if (local_map->cpu_stats == NULL) {
+            result = EBPF_NO_MEMORY;
+            goto Exit;
+        }
+    }
 
     result = ebpf_duplicate_utf8_string(&local_map->name, map_name);
     if (result != EBPF_SUCCESS) {
@@ -3206,19 +4304,37 @@ ebpf_map_find_entry(
         return EBPF_INVALID_ARGUMENT;
     }
 
-    if (!(flags & EBPF_MAP_FLAG_HELPER) && (value_size != map->ebpf_map_definition.value_size)) {
+    if (!(flags & EBPF_MAP_FLAG_HELPER) && (value_size != ebpf_map_get_user_value_size(map))) {
         EBPF_LOG_MESSAGE_UINT64_UINT64(
             EBPF_TRACELOG_LEVEL_ERROR,
             EBPF_TRACELOG_KEYWORD_MAP,
             "Incorrect map value size",
             value_size,
-            map->ebpf_map_definition.value_size);
+            ebpf_map_get_user_value_size(map));
         return EBPF_INVALID_ARGUMENT;
     }
 
     ebpf_map_type_t type = map->ebpf_map_definition.type;
     const ebpf_map_metadata_table_t* table = ebpf_map_get_table(type);
 
+    if (table->peek_or_pop_entry != NULL) {
+        // Queue and stack values are stored inline and can be overwritten as soon as they are popped, so they are
+        // only ever copied out, never returned by reference to a program.
+        if (flags & EBPF_MAP_FLAG_HELPER) {
+            return EBPF_OPERATION_NOT_SUPPORTED;
+        }
+        ebpf_result_t result = table->peek_or_pop_entry(map, (flags & EBPF_MAP_FIND_FLAG_DELETE) != 0, value);
+        if (result != EBPF_SUCCESS) {
+            _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP_MISS);
+            return result;
+        }
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP);
+        if (flags & EBPF_MAP_FIND_FLAG_DELETE) {
+            _ebpf_map_record_stat(map, EBPF_MAP_STAT_DELETE);
+        }
+        return EBPF_SUCCESS;
+    }
+
     if (table->find_entry == NULL) {
         EBPF_LOG_MESSAGE_UINT64(
             EBPF_TRACELOG_LEVEL_ERROR, EBPF_TRACELOG_KEYWORD_MAP, "ebpf_map_find_entry not supported on map", type);
@@ -3244,12 +4360,18 @@ ebpf_map_find_entry(
         ebpf_result_t result =
             table->find_entry(map, key, flags & EBPF_MAP_FIND_FLAG_DELETE ? true : false, &return_value);
         if (result != EBPF_SUCCESS) {
+            _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP_MISS);
             return result;
         }
     }
     if (return_value == NULL) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP_MISS);
         return EBPF_OBJECT_NOT_FOUND;
     }
+    _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP);
+    if (flags & EBPF_MAP_FIND_FLAG_DELETE) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_DELETE);
+    }
 
     if (flags & EBPF_MAP_FLAG_HELPER) {
         if (_ebpf_adjust_value_pointer(map, &return_value) != EBPF_SUCCESS) {
@@ -3258,11 +4380,77 @@ ebpf_map_find_entry(
 
         *(uint8_t**)value = return_value;
     } else {
-        memcpy(value, return_value, map->ebpf_map_definition.value_size);
+        _ebpf_map_copy_value(table, map, return_value, value);
     }
     return EBPF_SUCCESS;
 }
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_map_find_entry_batch(
+    _Inout_ ebpf_map_t* map,
+    size_t key_count,
+    _In_ const uint8_t* keys,
+    _Out_writes_(key_count) uint8_t** values,
+    int flags)
+{
+    // High volume call - Skip entry/exit logging.
+    ebpf_result_t result;
+    ebpf_map_type_t type = map->ebpf_map_definition.type;
+    const ebpf_map_metadata_table_t* table = ebpf_map_get_table(type);
+
+    // Maps whose entries are objects or that have no keys don't support batched lookups.
+    if (table->find_entry == NULL || table->get_object_from_entry != NULL || table->zero_length_key) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "ebpf_map_find_entry_batch not supported on map",
+            type);
+        return EBPF_OPERATION_NOT_SUPPORTED;
+    }
+
+    if (table->find_entry_batch) {
+        result = table->find_entry_batch(map, key_count, keys, values);
+        if (result != EBPF_SUCCESS) {
+            return result;
+        }
+    } else {
+        for (size_t index = 0; index < key_count; index++) {
+            const uint8_t* key = keys + index * map->ebpf_map_definition.key_size;
+            if (table->find_entry(map, key, false, &values[index]) != EBPF_SUCCESS) {
+                values[index] = NULL;
+            }
+        }
+    }
+
+    if (map->cpu_stats) {
+        for (size_t index = 0; index < key_count; index++) {
+            _ebpf_map_record_stat(map, values[index] ? EBPF_MAP_STAT_LOOKUP : EBPF_MAP_STAT_LOOKUP_MISS);
+        }
+    }
+
+    if (flags & EBPF_MAP_FLAG_HELPER) {
+        for (size_t index = 0; index < key_count; index++) {
+            if (values[index] && _ebpf_adjust_value_pointer(map, &values[index]) != EBPF_SUCCESS) {
+                return EBPF_INVALID_ARGUMENT;
+            }
+        }
+    }
+    return EBPF_SUCCESS;
+}
+
+void
+ebpf_map_copy_helper_value(_In_ const ebpf_map_t* map, _In_ const uint8_t* value, _Out_ uint8_t* buffer)
+{
+    const ebpf_map_metadata_table_t* table = ebpf_map_get_table(map->ebpf_map_definition.type);
+
+    // Per-CPU values are only written by the current CPU, so only shared values need the map's copy routine.
+    if (table->copy_value && !table->per_cpu) {
+        table->copy_value(map, value, buffer);
+    } else {
+        memcpy(buffer, value, map->original_value_size);
+    }
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_map_associate_program(_Inout_ ebpf_map_t* map, _In_ const ebpf_program_t* program)
 {
@@ -3339,13 +4527,13 @@ ebpf_map_update_entry(
         }
     }
 
-    if (!(flags & EBPF_MAP_FLAG_HELPER) && (value_size != map->ebpf_map_definition.value_size)) {
+    if (!(flags & EBPF_MAP_FLAG_HELPER) && (value_size != ebpf_map_get_user_value_size(map))) {
         EBPF_LOG_MESSAGE_UINT64_UINT64(
             EBPF_TRACELOG_LEVEL_ERROR,
             EBPF_TRACELOG_KEYWORD_MAP,
             "Incorrect map value size",
             value_size,
-            map->ebpf_map_definition.value_size);
+            ebpf_map_get_user_value_size(map));
         return EBPF_INVALID_ARGUMENT;
     }
 
@@ -3363,9 +4551,12 @@ ebpf_map_update_entry(
 
     if ((flags & EBPF_MAP_FLAG_HELPER) && (table->update_entry_per_cpu != NULL)) {
         result = table->update_entry_per_cpu(map, key, value, option);
+    } else if (!(flags & EBPF_MAP_FLAG_HELPER) && _ebpf_map_is_per_cpu_padded(map)) {
+        result = _ebpf_map_update_padded_value(table, map, key, value, option);
     } else {
         result = table->update_entry(map, key, value, option);
     }
+    _ebpf_map_record_update_failure(map, result);
     return result;
 }
 
@@ -3398,7 +4589,9 @@ ebpf_map_update_entry_with_handle(
             map->ebpf_map_definition.type);
         return EBPF_OPERATION_NOT_SUPPORTED;
     }
-    return table->update_entry_with_handle(map, key, value_handle, option);
+    ebpf_result_t result = table->update_entry_with_handle(map, key, value_handle, option);
+    _ebpf_map_record_update_failure(map, result);
+    return result;
 }
 
 _Must_inspect_result_ ebpf_result_t
@@ -3429,6 +4622,9 @@ ebpf_map_delete_entry(_In_ ebpf_map_t* map, size_t key_size, _In_reads_(key_size
     EBPF_LOG_MAP_OPERATION(flags, "delete", map, key);
 
     ebpf_result_t result = table->delete_entry(map, key);
+    if (result == EBPF_SUCCESS) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_DELETE);
+    }
     return result;
 }
 
@@ -3490,7 +4686,7 @@ ebpf_map_get_info(
     info->key_size = map->ebpf_map_definition.key_size;
     info->value_size = map->original_value_size;
     info->max_entries = map->ebpf_map_definition.max_entries;
-    info->map_flags = 0;
+    info->map_flags = map->ebpf_map_definition.map_flags;
     if (info->type == BPF_MAP_TYPE_ARRAY_OF_MAPS || info->type == BPF_MAP_TYPE_HASH_OF_MAPS) {
         ebpf_core_object_map_t* object_map = EBPF_FROM_FIELD(ebpf_core_object_map_t, core_map, map);
         info->inner_map_id = object_map->core_map.ebpf_map_definition.inner_map_id
@@ -3500,6 +4696,20 @@ ebpf_map_get_info(
         info->inner_map_id = EBPF_ID_NONE;
     }
     info->pinned_path_count = map->object.pinned_path_count;
+    if (ebpf_map_get_table(info->type)->find_entry == _find_hash_map_entry) {
+        info->entry_count = ebpf_hash_table_key_count((ebpf_hash_table_t*)map->data);
+    }
+    for (uint32_t cpu = 0; map->cpu_stats != NULL && cpu < map->cpu_stats_count; cpu++) {
+        const volatile int64_t* counters = map->cpu_stats[cpu].counters;
+        info->lookup_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_LOOKUP]);
+        info->lookup_miss_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_LOOKUP_MISS]);
+        info->insert_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_INSERT]);
+        info->replace_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_REPLACE]);
+        info->delete_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_DELETE]);
+        info->eviction_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_EVICTION]);
+        info->out_of_space_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_OUT_OF_SPACE]);
+        info->no_memory_count += (uint64_t)ReadNoFence64(&counters[EBPF_MAP_STAT_NO_MEMORY]);
+    }
     ebpf_assert(sizeof(info->name) >= map->name.length);
     strncpy_s(info->name, sizeof(info->name), (char*)map->name.value, map->name.length);
     if (map->name.length < sizeof(info->name)) {
@@ -3514,6 +4724,17 @@ ebpf_map_get_info(
     return EBPF_SUCCESS;
 }
 
+_IRQL_requires_max_(PASSIVE_LEVEL) void ebpf_map_wait_for_background_eviction(_In_ const ebpf_map_t* map)
+{
+    if (map->ebpf_map_definition.type != BPF_MAP_TYPE_LRU_HASH &&
+        map->ebpf_map_definition.type != BPF_MAP_TYPE_LRU_PERCPU_HASH) {
+        return;
+    }
+
+    ebpf_core_lru_map_t* lru_map = EBPF_FROM_FIELD(ebpf_core_lru_map_t, core_map, map);
+    KeWaitForSingleObject(&lru_map->eviction_idle_event, Executive, KernelMode, false, NULL);
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_map_push_entry(_Inout_ ebpf_map_t* map, size_t value_size, _In_reads_(value_size) const uint8_t* value, int flags)
 {
@@ -3532,7 +4753,9 @@ ebpf_map_push_entry(_Inout_ ebpf_map_t* map, size_t value_size, _In_reads_(value
         return EBPF_OPERATION_NOT_SUPPORTED;
     }
 
-    return table->update_entry(map, NULL, value, flags);
+    ebpf_result_t result = table->update_entry(map, NULL, value, flags);
+    _ebpf_map_record_update_failure(map, result);
+    return result;
 }
 
 _Must_inspect_result_ ebpf_result_t
@@ -3545,7 +4768,7 @@ ebpf_map_pop_entry(_Inout_ ebpf_map_t* map, size_t value_size, _Out_writes_(valu
 
     const ebpf_map_metadata_table_t* table = ebpf_map_get_table(map->ebpf_map_definition.type);
 
-    if (table->find_entry == NULL) {
+    if (table->peek_or_pop_entry == NULL && table->find_entry == NULL) {
         EBPF_LOG_MESSAGE_UINT64(
             EBPF_TRACELOG_LEVEL_ERROR,
             EBPF_TRACELOG_KEYWORD_MAP,
@@ -3554,12 +4777,21 @@ ebpf_map_pop_entry(_Inout_ ebpf_map_t* map, size_t value_size, _Out_writes_(valu
         return EBPF_OPERATION_NOT_SUPPORTED;
     }
 
-    ebpf_result_t result = table->find_entry(map, NULL, true, &return_value);
+    ebpf_result_t result;
+    if (table->peek_or_pop_entry != NULL) {
+        result = table->peek_or_pop_entry(map, true, value);
+    } else {
+        result = table->find_entry(map, NULL, true, &return_value);
+        if (result == EBPF_SUCCESS) {
+            memcpy(value, return_value, map->ebpf_map_definition.value_size);
+        }
+    }
     if (result != EBPF_SUCCESS) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP_MISS);
         return result;
     }
-
-    memcpy(value, return_value, map->ebpf_map_definition.value_size);
+    _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP);
+    _ebpf_map_record_stat(map, EBPF_MAP_STAT_DELETE);
     return EBPF_SUCCESS;
 }
 
@@ -3573,7 +4805,7 @@ ebpf_map_peek_entry(_Inout_ ebpf_map_t* map, size_t value_size, _Out_writes_(val
 
     const ebpf_map_metadata_table_t* table = ebpf_map_get_table(map->ebpf_map_definition.type);
 
-    if (table->find_entry == NULL) {
+    if (table->peek_or_pop_entry == NULL && table->find_entry == NULL) {
         EBPF_LOG_MESSAGE_UINT64(
             EBPF_TRACELOG_LEVEL_ERROR,
             EBPF_TRACELOG_KEYWORD_MAP,
@@ -3582,12 +4814,20 @@ ebpf_map_peek_entry(_Inout_ ebpf_map_t* map, size_t value_size, _Out_writes_(val
         return EBPF_OPERATION_NOT_SUPPORTED;
     }
 
-    ebpf_result_t result = table->find_entry(map, NULL, false, &return_value);
+    ebpf_result_t result;
+    if (table->peek_or_pop_entry != NULL) {
+        result = table->peek_or_pop_entry(map, false, value);
+    } else {
+        result = table->find_entry(map, NULL, false, &return_value);
+        if (result == EBPF_SUCCESS) {
+            memcpy(value, return_value, map->ebpf_map_definition.value_size);
+        }
+    }
     if (result != EBPF_SUCCESS) {
+        _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP_MISS);
         return result;
     }
-
-    memcpy(value, return_value, map->ebpf_map_definition.value_size);
+    _ebpf_map_record_stat(map, EBPF_MAP_STAT_LOOKUP);
     return EBPF_SUCCESS;
 }
 
@@ -3608,7 +4848,7 @@ ebpf_map_get_next_key_and_value_batch(
 {
     ebpf_result_t result = EBPF_SUCCESS;
     size_t key_size = map->ebpf_map_definition.key_size;
-    size_t value_size = map->ebpf_map_definition.value_size;
+    size_t value_size = ebpf_map_get_user_value_size(map);
     size_t output_length = 0;
     size_t maximum_output_length = *key_and_value_length;
 
@@ -3659,7 +4899,7 @@ ebpf_map_get_next_key_and_value_batch(
             break;
         }
 
-        memcpy(key_and_value + output_length + key_size, next_value, value_size);
+        _ebpf_map_copy_value(table, map, next_value, key_and_value + output_length + key_size);
 
         if ((flags & EBPF_MAP_FIND_FLAG_DELETE) && (previous_key != NULL)) {
             // If the caller requested deletion, delete the previous entry.
@@ -3697,6 +4937,143 @@ ebpf_map_get_next_key_and_value_batch(
     return result;
 }
 
+/**
+ * @brief Combine the CPU slots of a per-CPU value element-wise into a single value.
+ *
+ * @param[in] table Metadata table of the map.
+ * @param[in, out] map Per-CPU map the value belongs to.
+ * @param[in] aggregate Aggregate to compute.
+ * @param[in] element_size Size in bytes of each unsigned integer element of the value.
+ * @param[in] stored_value Value as stored in the map.
+ * @param[out] output Buffer of the original value size to write the aggregate into.
+ */
+static void
+_ebpf_map_aggregate_value(
+    _In_ const ebpf_map_metadata_table_t* table,
+    _Inout_ ebpf_core_map_t* map,
+    ebpf_map_aggregate_t aggregate,
+    uint32_t element_size,
+    _In_ const uint8_t* stored_value,
+    _Out_writes_bytes_(map->original_value_size) uint8_t* output)
+{
+    uint32_t cpu_count = ebpf_get_cpu_count();
+
+    // Fold a copy of the value taken through the map's copy routine, so the slots are not read while being replaced.
+    ebpf_lock_state_t lock_state = ebpf_lock_lock(&map->value_scratch_lock);
+    const uint8_t* value = map->value_scratch;
+    _ebpf_map_copy_stored_value(table, map, stored_value, map->value_scratch);
+
+    // Walk the CPU slots in storage order so each slot is read sequentially, folding it into the output.
+    memcpy(output, value, map->original_value_size);
+    for (uint32_t cpu = 1; cpu < cpu_count; cpu++) {
+        const uint8_t* slot = value + (size_t)cpu * map->per_cpu_value_stride;
+        for (uint32_t offset = 0; offset < map->original_value_size; offset += element_size) {
+            // Elements are little-endian unsigned integers; sums wrap at the element width.
+            uint64_t accumulator = 0;
+            uint64_t element = 0;
+            memcpy(&accumulator, output + offset, element_size);
+            memcpy(&element, slot + offset, element_size);
+            switch (aggregate) {
+            case EBPF_MAP_AGGREGATE_SUM:
+                accumulator += element;
+                break;
+            case EBPF_MAP_AGGREGATE_MIN:
+                accumulator = min(accumulator, element);
+                break;
+            case EBPF_MAP_AGGREGATE_MAX:
+                accumulator = max(accumulator, element);
+                break;
+            }
+            memcpy(output + offset, &accumulator, element_size);
+        }
+    }
+    ebpf_lock_unlock(&map->value_scratch_lock, lock_state);
+}
+
+_Must_inspect_result_ ebpf_result_t
+ebpf_map_get_next_key_and_aggregate_batch(
+    _Inout_ ebpf_map_t* map,
+    ebpf_map_aggregate_t aggregate,
+    uint32_t element_size,
+    size_t previous_key_length,
+    _In_reads_bytes_opt_(previous_key_length) const uint8_t* previous_key,
+    _Inout_ size_t* key_and_value_length,
+    _Out_writes_bytes_to_(*key_and_value_length, *key_and_value_length) uint8_t* key_and_value)
+{
+    ebpf_result_t result = EBPF_SUCCESS;
+    size_t key_size = map->ebpf_map_definition.key_size;
+    size_t value_size = map->original_value_size;
+    size_t output_length = 0;
+    size_t maximum_output_length = *key_and_value_length;
+
+    const ebpf_map_metadata_table_t* table = ebpf_map_get_table(map->ebpf_map_definition.type);
+
+    if (!table->per_cpu || table->next_key_and_value == NULL) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "ebpf_map_get_next_key_and_aggregate_batch not supported on map",
+            map->ebpf_map_definition.type);
+        return EBPF_OPERATION_NOT_SUPPORTED;
+    }
+
+    if (aggregate != EBPF_MAP_AGGREGATE_SUM && aggregate != EBPF_MAP_AGGREGATE_MIN &&
+        aggregate != EBPF_MAP_AGGREGATE_MAX) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR, EBPF_TRACELOG_KEYWORD_MAP, "Unsupported map aggregate", aggregate);
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    if ((element_size != 1 && element_size != 2 && element_size != 4 && element_size != 8) ||
+        (value_size % element_size) != 0) {
+        EBPF_LOG_MESSAGE_UINT64_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "Incorrect map aggregate element size",
+            element_size,
+            value_size);
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    if (previous_key && previous_key_length != key_size) {
+        EBPF_LOG_MESSAGE_UINT64_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_MAP,
+            "Incorrect map key size",
+            previous_key_length,
+            key_size);
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    // Aggregate as many values as we can fit in the output buffer.
+    for (;;) {
+        if ((output_length + key_size + value_size) > maximum_output_length) {
+            // Output buffer is full.
+            break;
+        }
+
+        uint8_t* next_value = NULL;
+        result = table->next_key_and_value(map, previous_key, key_and_value + output_length, &next_value);
+        if (result != EBPF_SUCCESS) {
+            break;
+        }
+
+        _ebpf_map_aggregate_value(
+            table, map, aggregate, element_size, next_value, key_and_value + output_length + key_size);
+
+        previous_key = key_and_value + output_length;
+        output_length += key_size + value_size;
+    }
+
+    if (result == EBPF_NO_MORE_KEYS && output_length != 0) {
+        // Returned at least one key/value pair.
+        result = EBPF_SUCCESS;
+    }
+
+    *key_and_value_length = output_length;
+    return result;
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_map_get_value_address(_In_ const ebpf_map_t* map, _Out_ uintptr_t* value_address)
 {
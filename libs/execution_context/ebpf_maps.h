@@ -56,6 +56,17 @@ extern "C"
     uint32_t
     ebpf_map_get_effective_value_size(_In_ const ebpf_map_t* map);
 
+    /**
+     * @brief Get the size of a value as exchanged with user mode. For per-cpu
+     * maps this is the effective value size, padded to 8 bytes, times the
+     * number of CPUs, regardless of how the map lays out the CPU slots.
+     *
+     * @param[in] map Map to query.
+     * @return Size of a value in user mode buffers.
+     */
+    uint32_t
+    ebpf_map_get_user_value_size(_In_ const ebpf_map_t* map);
+
     /**
      * @brief Get a pointer to an entry in the map.
      *
@@ -74,6 +85,37 @@ extern "C"
         _Out_writes_(value_size) uint8_t* value,
         int flags);
 
+    /**
+     * @brief Get pointers to the entries of several keys in the map. Hash maps look up all of the keys together so
+     * that the cache misses of the individual lookups overlap.
+     *
+     * @param[in, out] map Map to search and update metadata in.
+     * @param[in] key_count Number of keys to search for.
+     * @param[in] keys Buffer of key_count keys, each the size of the map key.
+     * @param[out] values Pointer to the value of each key, or NULL if the key is not present.
+     * @param[in] flags Zero or more EBPF_MAP_FIND_ENTRY_FLAG_* flags.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_OPERATION_NOT_SUPPORTED The map doesn't support batched lookups.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_map_find_entry_batch(
+        _Inout_ ebpf_map_t* map,
+        size_t key_count,
+        _In_ const uint8_t* keys,
+        _Out_writes_(key_count) uint8_t** values,
+        int flags);
+
+    /**
+     * @brief Copy a value returned to a helper by ebpf_map_find_entry or ebpf_map_find_entry_batch into a buffer,
+     * without observing a partially written value.
+     *
+     * @param[in] map Map the value belongs to.
+     * @param[in] value Value pointer returned with EBPF_MAP_FLAG_HELPER.
+     * @param[out] buffer Buffer of ebpf_map_get_effective_value_size bytes to copy the value into.
+     */
+    void
+    ebpf_map_copy_helper_value(_In_ const ebpf_map_t* map, _In_ const uint8_t* value, _Out_ uint8_t* buffer);
+
     /**
      * @brief Insert or update an entry in the map.
      *
@@ -192,6 +234,14 @@ extern "C"
         _Out_writes_to_(*info_size, *info_size) uint8_t* buffer,
         _Inout_ uint16_t* info_size);
 
+    /**
+     * @brief Wait until no background eviction is scheduled or running on an LRU map. Returns immediately for any
+     * other map type.
+     *
+     * @param[in] map Map to wait on.
+     */
+    _IRQL_requires_max_(PASSIVE_LEVEL) void ebpf_map_wait_for_background_eviction(_In_ const ebpf_map_t* map);
+
     /**
      * @brief Get pointer to the shared data for a map.
      *
@@ -308,6 +358,44 @@ extern "C"
     _Must_inspect_result_ ebpf_result_t
     ebpf_ring_buffer_map_output(_Inout_ ebpf_map_t* map, _In_reads_bytes_(length) uint8_t* data, size_t length);
 
+    /**
+     * @brief Reserve a record in a ring buffer map. The record must be written and then passed to
+     * ebpf_ring_buffer_map_submit or ebpf_ring_buffer_map_discard before the current epoch ends. For maps created with
+     * EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU the record is reserved in the sub-ring of the current CPU.
+     *
+     * @param[in, out] map Pointer to map of type EBPF_MAP_TYPE_RINGBUF.
+     * @param[out] data Pointer to the reserved record on success.
+     * @param[in] length Length of the record.
+     * @retval EBPF_SUCCESS Successfully reserved the record.
+     * @retval EBPF_INVALID_ARGUMENT The map is not a ring buffer map or the length is invalid.
+     * @retval EBPF_NO_MEMORY The ring buffer is full.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_ring_buffer_map_reserve(
+        _Inout_ ebpf_map_t* map, _Outptr_result_bytebuffer_(length) uint8_t** data, size_t length);
+
+    /**
+     * @brief Make a record reserved by ebpf_ring_buffer_map_reserve available to the consumer.
+     *
+     * @param[in, out] map Ring buffer map the record was reserved in.
+     * @param[in] data Pointer to the reserved record.
+     * @param[in] flags BPF_RB_* flags controlling the notification of the consumer.
+     * @retval EBPF_SUCCESS Successfully submitted the record.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_ring_buffer_map_submit(_Inout_ ebpf_map_t* map, _In_ uint8_t* data, uint64_t flags);
+
+    /**
+     * @brief Release a record reserved by ebpf_ring_buffer_map_reserve without making it available to the consumer.
+     *
+     * @param[in, out] map Ring buffer map the record was reserved in.
+     * @param[in] data Pointer to the reserved record.
+     * @param[in] flags BPF_RB_* flags controlling the notification of the consumer.
+     * @retval EBPF_SUCCESS Successfully discarded the record.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_ring_buffer_map_discard(_Inout_ ebpf_map_t* map, _In_ uint8_t* data, uint64_t flags);
+
     /**
      * @brief Write out a variable sized record to the perf event array.
      *
@@ -425,6 +513,34 @@ extern "C"
         _Out_writes_bytes_to_(*key_and_value_length, *key_and_value_length) uint8_t* key_and_value,
         int flags);
 
+    /**
+     * @brief Copy keys and the cross-CPU aggregate of their values from a per-CPU map to the caller provided buffer.
+     * Each value is treated as an array of little-endian unsigned integers of element_size bytes, and each output
+     * value has the size the map was created with.
+     *
+     * @param[in, out] map Per-CPU map to search.
+     * @param[in] aggregate Aggregate to compute across CPUs.
+     * @param[in] element_size Size in bytes of each integer element (1, 2, 4 or 8).
+     * @param[in] previous_key_length The length of the previous key.
+     * @param[in] previous_key The previous key need not be present. This is the key to start the search from.
+     * @param[in,out] key_and_value_length Length of the key and value buffer on input. On output, the number of bytes
+     * actually written.
+     * @param[out] key_and_value Buffer to write the keys and aggregated values into.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_NO_MORE_KEYS There is no key following the specified key.
+     * @retval EBPF_INVALID_ARGUMENT The aggregate or element size is not valid for this map.
+     * @retval EBPF_OPERATION_NOT_SUPPORTED The map is not a per-CPU map.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_map_get_next_key_and_aggregate_batch(
+        _Inout_ ebpf_map_t* map,
+        ebpf_map_aggregate_t aggregate,
+        uint32_t element_size,
+        size_t previous_key_length,
+        _In_reads_bytes_opt_(previous_key_length) const uint8_t* previous_key,
+        _Inout_ size_t* key_and_value_length,
+        _Out_writes_bytes_to_(*key_and_value_length, *key_and_value_length) uint8_t* key_and_value);
+
     /**
      * @brief Get the address of the first value in the map if it is an array or
      * return EBPF_INVALID_ARGUMENT if it is not an array map.
@@ -473,6 +473,7 @@ _ebpf_native_clean_up_program(_In_opt_ _Post_invalid_ ebpf_native_program_t* pro
         program->addresses_changed_callback_context = NULL;
         ebpf_free(program->runtime_context.helper_data);
         ebpf_free(program->runtime_context.map_data);
+        ebpf_free(program->runtime_context.map_value_data);
         ebpf_free(program->runtime_context.global_variable_section_data);
         ebpf_free(program->program_entry.helpers);
         program->program_entry.helpers = NULL;
@@ -1625,6 +1626,20 @@ _ebpf_native_resolve_maps_for_program(
         program->runtime_context.map_data[map_indices[i]].address = map_addresses[i];
     }
 
+    // Resolve the value addresses of array maps, which bpf2c uses to inline lookups into them.
+    for (uint16_t i = 0; i < map_count; i++) {
+        ebpf_native_map_t* native_map = &native_maps[map_indices[i]];
+        if (native_map->entry.definition.type != BPF_MAP_TYPE_ARRAY) {
+            continue;
+        }
+
+        result = ebpf_core_resolve_map_value_address(
+            1, &native_map->handle, &program->runtime_context.map_value_data[map_indices[i]].address);
+        if (result != EBPF_SUCCESS) {
+            goto Done;
+        }
+    }
+
 Done:
     ebpf_free(map_handles);
     ebpf_free(map_addresses);
@@ -1847,6 +1862,13 @@ _ebpf_native_load_programs(_Inout_ ebpf_native_module_instance_t* instance)
                 result = EBPF_NO_MEMORY;
                 goto Done;
             }
+
+            native_program->runtime_context.map_value_data =
+                ebpf_allocate_with_tag(map_data_size, EBPF_POOL_TAG_NATIVE);
+            if (native_program->runtime_context.map_value_data == NULL) {
+                result = EBPF_NO_MEMORY;
+                goto Done;
+            }
         }
 
         program_name_length = strnlen_s(program->program_name, BPF_OBJ_NAME_LEN);
@@ -28,12 +28,51 @@ static size_t _ebpf_program_state_index = MAXUINT64;
 // Global flag to disable invoking programs. This is used when fuzzing the IOCTL interface.
 bool ebpf_program_disable_invoke = false;
 
+// Non-zero while run-time statistics are collected for every program (see ebpf_program_enable_stats).
+static volatile long _ebpf_program_stats_enabled = 0;
+
+/**
+ * @brief Run-time statistics of a program on one CPU. Each entry is padded to a cache line so that invocations on
+ * different CPUs don't contend on the same line. Callers at PASSIVE_LEVEL can migrate between reading the CPU and
+ * updating its entry, so the counters are still updated with interlocked operations.
+ */
+typedef __declspec(align(EBPF_CACHE_LINE_SIZE)) struct _ebpf_program_cpu_stats
+{
+    volatile int64_t run_count;       ///< Number of times the program was invoked.
+    volatile int64_t run_time;        ///< Cumulative run time of the program (and its tail calls), in nanoseconds.
+    volatile int64_t tail_call_count; ///< Number of tail calls made by the program.
+} ebpf_program_cpu_stats_t;
+
 typedef struct _ebpf_context_header
 {
     EBPF_CONTEXT_HEADER;
     uint8_t context[1];
 } ebpf_context_header_t;
 
+// Helper IDs spanning more entries than this are resolved by scanning the program data instead.
+#define EBPF_HELPER_DISPATCH_TABLE_MAXIMUM_SPAN 1024
+
+/**
+ * @brief Dense helper function dispatch table for one program information provider. General helper IDs index
+ * general_helpers directly and program type specific helper IDs index program_type_specific_helpers after subtracting
+ * EBPF_MAX_GENERAL_HELPER_FUNCTION. An entry with a zero address is not implemented. The table is built when the
+ * first program binds to the provider, is shared by every program bound to it and is immutable once published.
+ */
+typedef struct _ebpf_helper_dispatch_table
+{
+    ebpf_list_entry_t entry;
+    uint32_t reference_count; ///< Protected by _ebpf_helper_dispatch_table_lock.
+    const void* provider_data;
+    const ebpf_program_data_t* general_program_data;
+    uint32_t general_helper_count;
+    uint32_t program_type_specific_helper_count;
+    helper_function_address_t* general_helpers;
+    helper_function_address_t* program_type_specific_helpers;
+} ebpf_helper_dispatch_table_t;
+
+static ebpf_lock_t _ebpf_helper_dispatch_table_lock = {0};
+static _Guarded_by_(_ebpf_helper_dispatch_table_lock) ebpf_list_entry_t _ebpf_helper_dispatch_tables;
+
 typedef struct _ebpf_program
 {
     ebpf_core_object_t object;
@@ -72,6 +111,8 @@ typedef struct _ebpf_program
 
     const ebpf_program_data_t* general_helper_program_data;
     const ebpf_program_data_t* extension_program_data;
+    // Shared dense helper table for the attached provider, or NULL if its helper IDs are too sparse.
+    const ebpf_helper_dispatch_table_t* helper_dispatch_table;
 
     bpf_prog_type_t bpf_prog_type;
 
@@ -86,8 +127,14 @@ typedef struct _ebpf_program
     size_t helper_function_count;
     uint32_t* helper_function_ids;
     bool helper_ids_set;
+    // Whether the program calls bpf_ringbuf_reserve, and so may return with a ring buffer record still reserved.
+    bool reserves_ring_buffer_records;
     uint64_t flags;
 
+    // Per-CPU run-time statistics, updated only while statistics collection is enabled.
+    uint32_t cpu_stats_count;
+    ebpf_program_cpu_stats_t* cpu_stats;
+
     // Lock protecting the fields below.
     ebpf_lock_t lock;
 
@@ -197,12 +244,197 @@ _Requires_lock_held_(program->lock) static ebpf_result_t _ebpf_program_get_helpe
 _Must_inspect_result_ ebpf_result_t
 ebpf_program_initiate()
 {
+    ebpf_lock_create(&_ebpf_helper_dispatch_table_lock);
+    ebpf_list_initialize(&_ebpf_helper_dispatch_tables);
     return ebpf_state_allocate_index(&_ebpf_program_state_index);
 }
 
 void
 ebpf_program_terminate()
 {
+    // Every program releases its dispatch table when it detaches from its provider.
+    ebpf_assert(ebpf_list_is_empty(&_ebpf_helper_dispatch_tables));
+    ebpf_lock_destroy(&_ebpf_helper_dispatch_table_lock);
+    _ebpf_program_stats_enabled = 0;
+}
+
+/**
+ * @brief Compute the number of dense entries needed to index a set of helper prototypes.
+ *
+ * @param[in] count Number of prototypes.
+ * @param[in] prototypes Helper prototypes.
+ * @param[in] base Helper ID of the first entry.
+ * @param[in, out] span Number of entries, raised to cover the prototypes.
+ * @retval true The prototypes fit in a dense table.
+ * @retval false A helper ID is out of range for a dense table.
+ */
+static bool
+_ebpf_helper_dispatch_table_compute_span(
+    uint32_t count,
+    _In_reads_opt_(count) const ebpf_helper_function_prototype_t* prototypes,
+    uint32_t base,
+    _Inout_ uint32_t* span)
+{
+    for (uint32_t index = 0; index < count; index++) {
+        uint32_t helper_id = prototypes[index].helper_id;
+        if (helper_id < base || helper_id - base >= EBPF_HELPER_DISPATCH_TABLE_MAXIMUM_SPAN) {
+            return false;
+        }
+        *span = max(*span, helper_id - base + 1);
+    }
+    return true;
+}
+
+/**
+ * @brief Copy the addresses of a set of helpers into a dense table, overwriting any existing entries.
+ */
+static void
+_ebpf_helper_dispatch_table_fill(
+    _Inout_updates_(span) helper_function_address_t* entries,
+    uint32_t span,
+    uint32_t base,
+    uint32_t count,
+    _In_reads_opt_(count) const ebpf_helper_function_prototype_t* prototypes,
+    _In_opt_ const ebpf_helper_function_addresses_t* addresses)
+{
+    if (addresses == NULL) {
+        return;
+    }
+    for (uint32_t index = 0; index < count; index++) {
+        uint32_t slot = prototypes[index].helper_id - base;
+        ebpf_assert(slot < span);
+        entries[slot].address = addresses->helper_function_address[index];
+        entries[slot].implicit_context = prototypes[index].implicit_context;
+    }
+}
+
+/**
+ * @brief Find or build the dispatch table for a program information provider and acquire a reference on it.
+ *
+ * @param[in] provider_data Provider data as registered by the provider, identifying the provider instance.
+ * @param[in] extension_program_data Program data of the provider.
+ * @param[in] general_program_data Program data of the general helper provider.
+ * @param[out] table Dispatch table, or NULL if the provider's helper IDs are too sparse for a dense table.
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Unable to allocate the dispatch table.
+ */
+static ebpf_result_t
+_ebpf_helper_dispatch_table_acquire(
+    _In_ const void* provider_data,
+    _In_ const ebpf_program_data_t* extension_program_data,
+    _In_ const ebpf_program_data_t* general_program_data,
+    _Outptr_result_maybenull_ const ebpf_helper_dispatch_table_t** table)
+{
+    ebpf_result_t result = EBPF_SUCCESS;
+    ebpf_helper_dispatch_table_t* local_table = NULL;
+    const ebpf_program_info_t* program_info = extension_program_data->program_info;
+    const ebpf_program_info_t* general_program_info = general_program_data->program_info;
+    uint32_t general_span = 0;
+    uint32_t specific_span = 0;
+
+    *table = NULL;
+
+    ebpf_lock_state_t state = ebpf_lock_lock(&_ebpf_helper_dispatch_table_lock);
+    for (ebpf_list_entry_t* entry = _ebpf_helper_dispatch_tables.Flink; entry != &_ebpf_helper_dispatch_tables;
+         entry = entry->Flink) {
+        ebpf_helper_dispatch_table_t* existing = CONTAINING_RECORD(entry, ebpf_helper_dispatch_table_t, entry);
+        if (existing->provider_data == provider_data && existing->general_program_data == general_program_data) {
+            existing->reference_count++;
+            *table = existing;
+            goto Done;
+        }
+    }
+
+    if (!_ebpf_helper_dispatch_table_compute_span(
+            general_program_info->count_of_global_helpers,
+            general_program_info->global_helper_prototype,
+            0,
+            &general_span) ||
+        !_ebpf_helper_dispatch_table_compute_span(
+            program_info->count_of_global_helpers, program_info->global_helper_prototype, 0, &general_span) ||
+        !_ebpf_helper_dispatch_table_compute_span(
+            program_info->count_of_program_type_specific_helpers,
+            program_info->program_type_specific_helper_prototype,
+            EBPF_MAX_GENERAL_HELPER_FUNCTION,
+            &specific_span)) {
+        EBPF_LOG_MESSAGE_GUID(
+            EBPF_TRACELOG_LEVEL_INFO,
+            EBPF_TRACELOG_KEYWORD_PROGRAM,
+            "Helper IDs too sparse for a dispatch table",
+            &program_info->program_type_descriptor->program_type);
+        goto Done;
+    }
+
+    local_table = ebpf_allocate_with_tag(
+        sizeof(ebpf_helper_dispatch_table_t) + (general_span + specific_span) * sizeof(helper_function_address_t),
+        EBPF_POOL_TAG_PROGRAM);
+    if (local_table == NULL) {
+        result = EBPF_NO_MEMORY;
+        goto Done;
+    }
+
+    local_table->reference_count = 1;
+    local_table->provider_data = provider_data;
+    local_table->general_program_data = general_program_data;
+    local_table->general_helper_count = general_span;
+    local_table->program_type_specific_helper_count = specific_span;
+    local_table->general_helpers = (helper_function_address_t*)(local_table + 1);
+    local_table->program_type_specific_helpers = local_table->general_helpers + general_span;
+
+    // Helpers overridden by the program type take precedence over the general implementations.
+    _ebpf_helper_dispatch_table_fill(
+        local_table->general_helpers,
+        general_span,
+        0,
+        general_program_info->count_of_global_helpers,
+        general_program_info->global_helper_prototype,
+        general_program_data->global_helper_function_addresses);
+    _ebpf_helper_dispatch_table_fill(
+        local_table->general_helpers,
+        general_span,
+        0,
+        program_info->count_of_global_helpers,
+        program_info->global_helper_prototype,
+        extension_program_data->global_helper_function_addresses);
+    _ebpf_helper_dispatch_table_fill(
+        local_table->program_type_specific_helpers,
+        specific_span,
+        EBPF_MAX_GENERAL_HELPER_FUNCTION,
+        program_info->count_of_program_type_specific_helpers,
+        program_info->program_type_specific_helper_prototype,
+        extension_program_data->program_type_specific_helper_function_addresses);
+
+    ebpf_list_insert_tail(&_ebpf_helper_dispatch_tables, &local_table->entry);
+    *table = local_table;
+
+Done:
+    ebpf_lock_unlock(&_ebpf_helper_dispatch_table_lock, state);
+    return result;
+}
+
+/**
+ * @brief Release a reference on a dispatch table, freeing it when the last program bound to the provider releases it.
+ *
+ * @param[in] table Dispatch table to release.
+ */
+static void
+_ebpf_helper_dispatch_table_release(_In_opt_ const ebpf_helper_dispatch_table_t* table)
+{
+    if (table == NULL) {
+        return;
+    }
+
+    ebpf_helper_dispatch_table_t* local_table = (ebpf_helper_dispatch_table_t*)table;
+    ebpf_lock_state_t state = ebpf_lock_lock(&_ebpf_helper_dispatch_table_lock);
+    ebpf_assert(local_table->reference_count > 0);
+    if (--local_table->reference_count == 0) {
+        ebpf_list_remove_entry(&local_table->entry);
+    } else {
+        local_table = NULL;
+    }
+    ebpf_lock_unlock(&_ebpf_helper_dispatch_table_lock, state);
+
+    ebpf_free(local_table);
 }
 
 _Requires_lock_not_held_(program->lock) static void _ebpf_program_detach_links(_Inout_ ebpf_program_t* program)
@@ -438,6 +670,7 @@ _ebpf_program_type_specific_program_information_attach_provider(
     uint32_t* actual_helper_function_ids = NULL;
     size_t actual_helper_function_count = 0;
     bool actual_helper_ids_set = false;
+    const ebpf_helper_dispatch_table_t* helper_dispatch_table = NULL;
 
     void* provider_binding_context;
     void* provider_dispatch;
@@ -507,6 +740,17 @@ _ebpf_program_type_specific_program_information_attach_provider(
     ebpf_lock_unlock(&program->lock, state);
     lock_held = false;
 
+    // Programs bound to the same provider share one dispatch table, so only the first one builds it.
+    result = _ebpf_helper_dispatch_table_acquire(
+        provider_registration_instance->NpiSpecificCharacteristics,
+        extension_program_data,
+        general_program_information_data,
+        &helper_dispatch_table);
+    if (result != EBPF_SUCCESS) {
+        status = ebpf_result_to_ntstatus(result);
+        goto Done;
+    }
+
     // Compute (and compare) the hash only if the actual helper IDs have been set.
     if (actual_helper_ids_set) {
         // Compute the hash of the program information. This requires passive IRQL
@@ -558,6 +802,8 @@ _ebpf_program_type_specific_program_information_attach_provider(
     // Unblock calls to use the program information.
     program->extension_program_data = extension_program_data;
     extension_program_data = NULL;
+    program->helper_dispatch_table = helper_dispatch_table;
+    helper_dispatch_table = NULL;
     ExInitializeRundownProtection(&program->program_information_rundown_reference);
 
     program->program_type_specific_helper_function_count =
@@ -606,6 +852,7 @@ Done:
         ebpf_lock_unlock(&program->lock, state);
     }
     ebpf_program_data_free((ebpf_program_data_t*)extension_program_data);
+    _ebpf_helper_dispatch_table_release(helper_dispatch_table);
 
     return status;
 }
@@ -622,10 +869,13 @@ _ebpf_program_type_specific_program_information_detach_provider(_In_ void* clien
     ebpf_program_data_free((ebpf_program_data_t*)program->extension_program_data);
     // Set the extension program data to NULL to prevent any further use of the program information by programs.
     program->extension_program_data = NULL;
+    const ebpf_helper_dispatch_table_t* helper_dispatch_table = program->helper_dispatch_table;
+    program->helper_dispatch_table = NULL;
     // ebpf_lock_unlock imposes a full memory barrier that synchronizes with the
     // _ebpf_epoch_messenger_propose_release_epoch memory barrier. This prevents any thread from using a stale pointer
     // to the program information.
     ebpf_lock_unlock(&program->lock, state);
+    _ebpf_helper_dispatch_table_release(helper_dispatch_table);
 
     // Note: NmrRegisterClient can synchronously call the attach and then the detach callback. This can result in the
     // detach callback being called inside an epoch, which will result in a deadlock. To prevent this, detect when
@@ -719,6 +969,7 @@ _IRQL_requires_max_(PASSIVE_LEVEL) static void _ebpf_program_free(_In_opt_ _Post
     }
 
     ebpf_program_data_free((ebpf_program_data_t*)program->extension_program_data);
+    _ebpf_helper_dispatch_table_release(program->helper_dispatch_table);
     ebpf_lock_destroy(&program->lock);
 
     switch (program->parameters.code_type) {
@@ -757,6 +1008,11 @@ _IRQL_requires_max_(PASSIVE_LEVEL) static void _ebpf_program_free(_In_opt_ _Post
 
     ebpf_free(program->helper_function_ids);
 
+    if (program->cpu_stats) {
+        cxplat_free(
+            program->cpu_stats, CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED, EBPF_POOL_TAG_PROGRAM);
+    }
+
     ebpf_free(program);
     EBPF_RETURN_VOID();
 }
@@ -801,6 +1057,16 @@ ebpf_program_create(_In_ const ebpf_program_parameters_t* program_parameters, _O
         goto Done;
     }
 
+    local_program->cpu_stats_count = ebpf_get_cpu_count();
+    local_program->cpu_stats = cxplat_allocate(
+        CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED,
+        sizeof(ebpf_program_cpu_stats_t) * local_program->cpu_stats_count,
+        EBPF_POOL_TAG_PROGRAM);
+    if (!local_program->cpu_stats) {
+        retval = EBPF_NO_MEMORY;
+        goto Done;
+    }
+
     local_program->module_id.Type = MIT_GUID;
     local_program->module_id.Length = sizeof(local_program->module_id);
     retval = ebpf_guid_create(&local_program->module_id.Guid);
@@ -1567,6 +1833,9 @@ ebpf_program_invoke(
 
     // High volume call - Skip entry/exit logging.
     const ebpf_program_t* current_program = program;
+    bool reserves_ring_buffer_records = false;
+    bool collect_stats = ReadNoFence(&_ebpf_program_stats_enabled) != 0;
+    uint64_t start_time = collect_stats ? cxplat_query_time_since_boot_precise(false) : 0;
 
     ebpf_assert(context != NULL);
 
@@ -1581,6 +1850,8 @@ ebpf_program_invoke(
     for (execution_state->tail_call_state.count = 0; execution_state->tail_call_state.count < MAX_TAIL_CALL_CNT + 1;
          execution_state->tail_call_state.count++) {
 
+        reserves_ring_buffer_records |= current_program->reserves_ring_buffer_records;
+
         EBPF_LOG_MESSAGE_UTF8_STRING(
             EBPF_TRACELOG_LEVEL_VERBOSE,
             EBPF_TRACELOG_KEYWORD_PROGRAM,
@@ -1622,11 +1893,42 @@ ebpf_program_invoke(
             execution_state->tail_call_state.next_program = NULL;
         }
     }
+
+    // A reserved record blocks the consumer of the ring buffer until it is released, so release any record the
+    // program failed to submit or discard.
+    if (reserves_ring_buffer_records) {
+        ebpf_core_discard_ring_buffer_reservation();
+    }
+
+    if (collect_stats) {
+        // The run time of tail called programs is attributed to the program that was invoked.
+        uint64_t run_time = (cxplat_query_time_since_boot_precise(false) - start_time) * EBPF_NS_PER_FILETIME;
+        uint32_t tail_call_count = execution_state->tail_call_state.count;
+        if (tail_call_count > MAX_TAIL_CALL_CNT) {
+            tail_call_count = MAX_TAIL_CALL_CNT;
+        }
+        uint32_t cpu = ebpf_get_current_cpu();
+        if (cpu >= program->cpu_stats_count) {
+            cpu = 0;
+        }
+        ebpf_program_cpu_stats_t* cpu_stats = &program->cpu_stats[cpu];
+        ebpf_interlocked_increment_int64_no_fence(&cpu_stats->run_count);
+        ebpf_interlocked_add_int64_no_fence(&cpu_stats->run_time, (int64_t)run_time);
+        if (tail_call_count > 0) {
+            ebpf_interlocked_add_int64_no_fence(&cpu_stats->tail_call_count, tail_call_count);
+        }
+    }
     return EBPF_SUCCESS;
 }
 
+void
+ebpf_program_enable_stats(bool enable)
+{
+    WriteNoFence(&_ebpf_program_stats_enabled, enable ? 1 : 0);
+}
+
 _Success_(return == true)
-    _Requires_lock_held_(program->lock) static bool _ebpf_program_get_helper_address_info_from_program_data(
+    _Requires_lock_held_(program->lock) static bool _ebpf_program_scan_helper_address_info_from_program_data(
         _In_ const ebpf_program_t* program, uint32_t helper_function_id, _Out_ helper_function_address_t* address)
 {
     bool found = false;
@@ -1695,6 +1997,38 @@ _Success_(return == true)
     return found;
 }
 
+_Success_(return == true)
+    _Requires_lock_held_(program->lock) static bool _ebpf_program_get_helper_address_info_from_program_data(
+        _In_ const ebpf_program_t* program, uint32_t helper_function_id, _Out_ helper_function_address_t* address)
+{
+    const ebpf_helper_dispatch_table_t* table = program->helper_dispatch_table;
+    const helper_function_address_t* entry = NULL;
+
+    if (table == NULL) {
+        return _ebpf_program_scan_helper_address_info_from_program_data(program, helper_function_id, address);
+    }
+
+    if (helper_function_id < EBPF_MAX_GENERAL_HELPER_FUNCTION) {
+        if (helper_function_id < table->general_helper_count) {
+            entry = &table->general_helpers[helper_function_id];
+        }
+    } else if (helper_function_id - EBPF_MAX_GENERAL_HELPER_FUNCTION < table->program_type_specific_helper_count) {
+        entry = &table->program_type_specific_helpers[helper_function_id - EBPF_MAX_GENERAL_HELPER_FUNCTION];
+    }
+
+    if (entry == NULL || entry->address == 0) {
+        EBPF_LOG_MESSAGE_UINT64(
+            EBPF_TRACELOG_LEVEL_ERROR,
+            EBPF_TRACELOG_KEYWORD_PROGRAM,
+            "No implementation found for helper ID",
+            helper_function_id);
+        return false;
+    }
+
+    *address = *entry;
+    return true;
+}
+
 _Requires_lock_held_(program->lock) static ebpf_result_t _ebpf_program_get_helper_function_address(
     _In_ const ebpf_program_t* program, uint32_t helper_function_id, _Out_ helper_function_address_t* address)
 {
@@ -1833,6 +2167,9 @@ ebpf_program_set_helper_function_ids(
 
     for (size_t index = 0; index < helper_function_count; index++) {
         program->helper_function_ids[index] = helper_function_ids[index];
+        if (helper_function_ids[index] == BPF_FUNC_ringbuf_reserve) {
+            program->reserves_ring_buffer_records = true;
+        }
     }
 
     program->helper_ids_set = true;
@@ -1854,6 +2191,7 @@ ebpf_program_clear_helper_function_ids(_Inout_ ebpf_program_t* program)
     program->helper_function_ids = NULL;
     program->helper_function_count = 0;
     program->helper_ids_set = false;
+    program->reserves_ring_buffer_records = false;
 
     ebpf_lock_unlock(&program->lock, state);
 }
@@ -2172,6 +2510,12 @@ ebpf_program_get_info(
     output_info->attach_type_uuid = ebpf_expected_attach_type(program);
     output_info->pinned_path_count = program->object.pinned_path_count;
     output_info->link_count = program->link_count;
+    for (uint32_t cpu = 0; cpu < program->cpu_stats_count; cpu++) {
+        const ebpf_program_cpu_stats_t* cpu_stats = &program->cpu_stats[cpu];
+        output_info->run_cnt += (uint64_t)ReadNoFence64(&cpu_stats->run_count);
+        output_info->run_time_ns += (uint64_t)ReadNoFence64(&cpu_stats->run_time);
+        output_info->tail_call_cnt += (uint64_t)ReadNoFence64(&cpu_stats->tail_call_count);
+    }
 
     // Copy the local map info to the user supplied buffer, as much as will fit.
     uint16_t out_size = min(sizeof(*output_info), *output_buffer_size);
@@ -2574,6 +2918,245 @@ Done:
     ebpf_free(work_item_context);
 }
 
+// Latency histogram buckets are exact below 2^EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS ticks and then split each
+// power of two into 2^EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS linear buckets, bounding the error to 12.5%.
+#define EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS 3
+#define EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT (1 << EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS)
+#define EBPF_TEST_RUN_HISTOGRAM_BUCKET_COUNT (64 * EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT)
+
+static inline uint32_t
+_ebpf_program_test_run_histogram_bucket(uint64_t ticks)
+{
+    unsigned long msb_index;
+    if (ticks < EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT) {
+        return (uint32_t)ticks;
+    }
+    _BitScanReverse64(&msb_index, ticks);
+    uint32_t shift = msb_index - EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS;
+    uint32_t sub_bucket = (uint32_t)(ticks >> shift) & (EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT - 1);
+    return ((shift + 1) << EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS) + sub_bucket;
+}
+
+/**
+ * @brief Compute a percentile of the latency histogram.
+ *
+ * @param[in] histogram Count of samples in each bucket.
+ * @param[in] sample_count Total number of samples.
+ * @param[in] per_mille Percentile to compute, in thousandths.
+ * @return Upper bound in counter ticks of the bucket holding the percentile.
+ */
+static uint64_t
+_ebpf_program_test_run_histogram_percentile(
+    _In_reads_(EBPF_TEST_RUN_HISTOGRAM_BUCKET_COUNT) const uint64_t* histogram,
+    uint64_t sample_count,
+    uint64_t per_mille)
+{
+    uint64_t rank = max((sample_count * per_mille + 999) / 1000, 1);
+    uint64_t cumulative_count = 0;
+    uint32_t bucket;
+    for (bucket = 0; bucket < EBPF_TEST_RUN_HISTOGRAM_BUCKET_COUNT - 1; bucket++) {
+        cumulative_count += histogram[bucket];
+        if (cumulative_count >= rank) {
+            break;
+        }
+    }
+
+    uint64_t upper_bound;
+    if (bucket < EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT) {
+        upper_bound = bucket;
+    } else {
+        uint32_t shift = (bucket >> EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_BITS) - 1;
+        uint64_t sub_bucket = (bucket & (EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT - 1)) |
+                              EBPF_TEST_RUN_HISTOGRAM_SUB_BUCKET_COUNT;
+        upper_bound = ((sub_bucket + 1) << shift) - 1;
+    }
+    return upper_bound;
+}
+
+// A single invocation typically completes well within the 100ns resolution of the system time, so each invocation
+// is timed with the time stamp counter where it is available and the result is converted to nanoseconds using a
+// counter frequency calibrated against the performance counter over the whole run.
+static inline uint64_t
+_ebpf_program_test_run_read_counter()
+{
+#if defined(_M_X64)
+    return __rdtsc();
+#else
+    return (uint64_t)KeQueryPerformanceCounter(NULL).QuadPart;
+#endif
+}
+
+/**
+ * @brief Compute value * numerator / denominator without overflowing the intermediate product.
+ *
+ * @param[in] value Value to scale.
+ * @param[in] numerator Scale numerator.
+ * @param[in] denominator Scale denominator, must not be zero.
+ * @return Scaled value.
+ */
+static inline uint64_t
+_ebpf_program_test_run_scale(uint64_t value, uint64_t numerator, uint64_t denominator)
+{
+    return (value / denominator) * numerator + ((value % denominator) * numerator) / denominator;
+}
+
+static void
+_ebpf_program_test_run_multiple_inputs_work_item(
+    _In_ cxplat_preemptible_work_item_t* work_item, _In_opt_ void* work_item_context)
+{
+    _Analysis_assume_(work_item_context != NULL);
+
+    ebpf_program_test_run_context_t* context = (ebpf_program_test_run_context_t*)work_item_context;
+    ebpf_program_test_run_options_t* options = context->options;
+    ebpf_result_t result = EBPF_SUCCESS;
+    uint32_t return_value = 0;
+    uint8_t old_irql = 0;
+    GROUP_AFFINITY old_thread_affinity;
+    size_t batch_size = options->batch_size ? options->batch_size : 1024;
+    ebpf_execution_context_state_t execution_context_state = {0};
+    ebpf_epoch_state_t epoch_state = {0};
+    bool in_epoch = false;
+    bool irql_raised = false;
+    bool thread_affinity_set = false;
+    void** program_contexts = NULL;
+    size_t program_context_count = 0;
+    uint64_t* histogram = NULL;
+    uint64_t cumulative_time = 0;
+    uint64_t sample_count = 0;
+    LARGE_INTEGER performance_frequency;
+    LARGE_INTEGER performance_start;
+    uint64_t counter_start;
+
+    program_contexts = ebpf_allocate_with_tag(options->input_count * sizeof(void*), EBPF_POOL_TAG_PROGRAM);
+    histogram = ebpf_allocate_with_tag(EBPF_TEST_RUN_HISTOGRAM_BUCKET_COUNT * sizeof(uint64_t), EBPF_POOL_TAG_PROGRAM);
+    if (program_contexts == NULL || histogram == NULL) {
+        result = EBPF_NO_MEMORY;
+        goto Done;
+    }
+
+    result = ebpf_set_current_thread_cpu_affinity(options->cpu, &old_thread_affinity);
+    if (result != EBPF_SUCCESS) {
+        goto Done;
+    }
+    thread_affinity_set = true;
+
+    ebpf_epoch_synchronize();
+
+    old_irql = ebpf_raise_irql(context->required_irql);
+    irql_raised = true;
+
+    // Convert every input to a program type specific context structure up front, so that only program execution is
+    // timed.
+    const ebpf_context_descriptor_t* context_descriptor =
+        context->program_data->program_info->program_type_descriptor->context_descriptor;
+    for (; program_context_count < options->input_count; program_context_count++) {
+        const ebpf_program_test_run_input_t* input = &options->inputs[program_context_count];
+        result = context->program_data->context_create(
+            input->data_in,
+            input->data_size_in,
+            input->context_in,
+            input->context_size_in,
+            &program_contexts[program_context_count]);
+        if (result != EBPF_SUCCESS) {
+            result = EBPF_INVALID_ARGUMENT;
+            goto Done;
+        }
+        ebpf_program_set_runtime_state(&execution_context_state, program_contexts[program_context_count]);
+        ebpf_program_set_header_context_descriptor(context_descriptor, program_contexts[program_context_count]);
+    }
+
+    ebpf_epoch_enter(&epoch_state);
+    in_epoch = true;
+
+    performance_start = KeQueryPerformanceCounter(&performance_frequency);
+    counter_start = _ebpf_program_test_run_read_counter();
+
+    size_t batch_counter = batch_size;
+    for (size_t round = 0; round < options->repeat_count && result == EBPF_SUCCESS; round++) {
+        for (size_t input = 0; input < options->input_count; input++) {
+            batch_counter--;
+            // Start a new epoch every batch_size invocations. Time spent yielding falls between two timed
+            // invocations and is therefore excluded.
+            if (!batch_counter) {
+                batch_counter = batch_size;
+                ebpf_epoch_exit(&epoch_state);
+                if (ebpf_should_yield_processor()) {
+                    ebpf_lower_irql(old_irql);
+                    old_irql = ebpf_raise_irql(context->required_irql);
+                }
+                ebpf_epoch_enter(&epoch_state);
+            }
+
+            uint64_t start_time = _ebpf_program_test_run_read_counter();
+            result =
+                ebpf_program_invoke(context->program, program_contexts[input], &return_value, &execution_context_state);
+            uint64_t elapsed_time = _ebpf_program_test_run_read_counter() - start_time;
+            if (result != EBPF_SUCCESS) {
+                break;
+            }
+
+            cumulative_time += elapsed_time;
+            histogram[_ebpf_program_test_run_histogram_bucket(elapsed_time)]++;
+            sample_count++;
+            options->return_values[input] = return_value;
+        }
+    }
+
+    if (result == EBPF_SUCCESS) {
+        uint64_t counter_elapsed = _ebpf_program_test_run_read_counter() - counter_start;
+        uint64_t performance_elapsed =
+            max((uint64_t)(KeQueryPerformanceCounter(NULL).QuadPart - performance_start.QuadPart), 1);
+        uint64_t counter_frequency = max(
+            _ebpf_program_test_run_scale(
+                counter_elapsed, (uint64_t)performance_frequency.QuadPart, performance_elapsed),
+            1);
+        options->duration = _ebpf_program_test_run_scale(cumulative_time, EBPF_NS_PER_SECOND, counter_frequency) /
+                             sample_count;
+        options->latency_p50 = _ebpf_program_test_run_scale(
+            _ebpf_program_test_run_histogram_percentile(histogram, sample_count, 500),
+            EBPF_NS_PER_SECOND,
+            counter_frequency);
+        options->latency_p99 = _ebpf_program_test_run_scale(
+            _ebpf_program_test_run_histogram_percentile(histogram, sample_count, 990),
+            EBPF_NS_PER_SECOND,
+            counter_frequency);
+        options->latency_p999 = _ebpf_program_test_run_scale(
+            _ebpf_program_test_run_histogram_percentile(histogram, sample_count, 999),
+            EBPF_NS_PER_SECOND,
+            counter_frequency);
+        options->return_value = return_value;
+    }
+
+Done:
+    if (in_epoch) {
+        ebpf_epoch_exit(&epoch_state);
+    }
+
+    // Per-input output data and context are not returned.
+    for (size_t index = 0; index < program_context_count; index++) {
+        size_t data_size_out = 0;
+        size_t context_size_out = 0;
+        context->program_data->context_destroy(program_contexts[index], NULL, &data_size_out, NULL, &context_size_out);
+    }
+
+    if (irql_raised) {
+        ebpf_lower_irql(old_irql);
+    }
+
+    if (thread_affinity_set) {
+        ebpf_restore_current_thread_cpu_affinity(&old_thread_affinity);
+    }
+
+    ebpf_free(histogram);
+    ebpf_free(program_contexts);
+
+    context->completion_callback(
+        result, context->program, context->options, context->completion_context, context->async_context);
+    ebpf_program_dereference_providers((ebpf_program_t*)context->program);
+    cxplat_free_preemptible_work_item(work_item);
+    ebpf_free(work_item_context);
+}
+
 static void
 _ebpf_program_test_run_cancel(_Inout_opt_ void* context)
 {
@@ -2617,6 +3200,12 @@ ebpf_program_execute_test_run(
         goto Exit;
     }
 
+    if (options->input_count != 0 &&
+        (options->inputs == NULL || options->return_values == NULL || options->repeat_count == 0)) {
+        return_value = EBPF_INVALID_ARGUMENT;
+        goto Exit;
+    }
+
     test_run_context = (ebpf_program_test_run_context_t*)ebpf_allocate_with_tag(
         sizeof(ebpf_program_test_run_context_t), EBPF_POOL_TAG_PROGRAM);
     if (test_run_context == NULL) {
@@ -2634,7 +3223,10 @@ ebpf_program_execute_test_run(
 
     // Queue the work item so that it can be executed on the target CPU and at the target dispatch level.
     // The work item will signal the completion event when it is done.
-    return_value = ebpf_allocate_preemptible_work_item(&work_item, _ebpf_program_test_run_work_item, test_run_context);
+    return_value = ebpf_allocate_preemptible_work_item(
+        &work_item,
+        options->input_count ? _ebpf_program_test_run_multiple_inputs_work_item : _ebpf_program_test_run_work_item,
+        test_run_context);
     if (return_value != EBPF_SUCCESS) {
         goto Exit;
     }
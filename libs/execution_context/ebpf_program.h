@@ -214,6 +214,15 @@ extern "C"
         _Out_ uint32_t* result,
         _Inout_ ebpf_execution_context_state_t* execution_state);
 
+    /**
+     * @brief Start or stop collecting run-time statistics (run count, run time and tail call count) for all
+     * programs. Statistics already collected are kept and reported by ebpf_program_get_info.
+     *
+     * @param[in] enable True to start collecting statistics, false to stop.
+     */
+    void
+    ebpf_program_enable_stats(bool enable);
+
     /**
      * @brief Store the helper function IDs that are used by the eBPF program in an array
      *  inside the program object. The array index is the helper function ID to be used by
@@ -355,8 +364,26 @@ extern "C"
         uint32_t flags;          ///< Flags to control the test run.
         uint32_t cpu;            ///< CPU to run the program on.
         size_t batch_size;       ///< Number of times to repeat the program in a batch.
+        size_t input_count; ///< Number of inputs of a multi-input test run, or zero to run data_in and context_in.
+        _Field_size_(input_count) const struct _ebpf_program_test_run_input* inputs; ///< Inputs of a multi-input run.
+        _Field_size_(input_count) uint64_t* return_values; ///< Return value of the last run of each input.
+        uint64_t latency_p50;  ///< Median duration in nanoseconds of a single invocation of a multi-input run.
+        uint64_t latency_p99;  ///< 99th percentile duration in nanoseconds of a single invocation.
+        uint64_t latency_p999; ///< 99.9th percentile duration in nanoseconds of a single invocation.
     } ebpf_program_test_run_options_t;
 
+    /**
+     * @brief One input of a multi-input test run. Each input gets its own program context, and the inputs are run
+     * round-robin repeat_count times.
+     */
+    typedef struct _ebpf_program_test_run_input
+    {
+        _Field_size_bytes_(data_size_in) const uint8_t* data_in;       ///< Input data to the program.
+        size_t data_size_in;                                           ///< Size of input data.
+        _Field_size_bytes_(context_size_in) const uint8_t* context_in; ///< Input context to the program.
+        size_t context_size_in;                                        ///< Size of input context.
+    } ebpf_program_test_run_input_t;
+
     /**
      * @brief Function called when the program test run completes.
      *
@@ -371,6 +398,10 @@ extern "C"
     /**
      * @brief Run the program with the given input and output buffers and measure the duration.
      *
+     * If options->input_count is non-zero, a program context is created for each input, the inputs are run
+     * round-robin options->repeat_count times, and each invocation is timed individually. The return value of each
+     * input and the p50/p99/p999 latencies are returned in options instead of the output buffers.
+     *
      * @param[in] program Program to run.
      * @param[in, out] options Options to control the test run.
      * @param[in] async_context Async context to receive cancellation notifications on.
@@ -54,6 +54,12 @@ typedef enum _ebpf_operation_id
     EBPF_OPERATION_RING_BUFFER_MAP_MAP_BUFFER,
     EBPF_OPERATION_RING_BUFFER_MAP_UNMAP_BUFFER,
     EBPF_OPERATION_EPOCH_SYNCHRONIZE,
+    EBPF_OPERATION_MAP_GET_NEXT_KEY_AGGREGATE_BATCH,
+    EBPF_OPERATION_PROGRAM_TEST_RUN_BATCH,
+    EBPF_OPERATION_GET_NEXT_IDS,
+    EBPF_OPERATION_GET_PINNED_PATHS_BY_PREFIX,
+    EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE,
+    EBPF_OPERATION_PROGRAM_ENABLE_STATS,
 } ebpf_operation_id_t;
 
 typedef enum _ebpf_code_type
@@ -345,6 +351,20 @@ typedef struct _ebpf_operation_get_next_id_reply
     ebpf_id_t next_id;
 } ebpf_operation_get_next_id_reply_t;
 
+typedef struct _ebpf_operation_get_next_ids_request
+{
+    struct _ebpf_operation_header header;
+    ebpf_object_type_t type;
+    ebpf_id_t start_id; ///< Return IDs greater than this ID, or 0 to start from the first ID.
+} ebpf_operation_get_next_ids_request_t;
+
+typedef struct _ebpf_operation_get_next_ids_reply
+{
+    struct _ebpf_operation_header header;
+    uint32_t id_count;
+    ebpf_id_t ids[1]; ///< As many IDs, in ascending order, as fit in the reply.
+} ebpf_operation_get_next_ids_reply_t;
+
 typedef struct _ebpf_operation_get_next_pinned_program_path_request
 {
     struct _ebpf_operation_header header;
@@ -371,6 +391,32 @@ typedef struct _ebpf_operation_get_next_pinned_object_path_reply
     uint8_t next_path[1];
 } ebpf_operation_get_next_pinned_object_path_reply_t;
 
+typedef struct _ebpf_operation_get_pinned_paths_by_prefix_request
+{
+    struct _ebpf_operation_header header;
+    ebpf_object_type_t type; ///< Object type to return, or EBPF_OBJECT_UNKNOWN for all types.
+    uint16_t prefix_length;
+    uint8_t data[1]; ///< Prefix (prefix_length bytes) followed by the path to start after, which may be empty.
+} ebpf_operation_get_pinned_paths_by_prefix_request_t;
+
+typedef struct _ebpf_operation_pinned_path_entry
+{
+    ebpf_object_type_t type;
+    uint16_t path_length;
+    uint8_t path[1];
+} ebpf_operation_pinned_path_entry_t;
+
+// Size of a serialized ebpf_operation_pinned_path_entry_t, padded so the next entry is aligned.
+#define EBPF_OPERATION_PINNED_PATH_ENTRY_SIZE(path_length) \
+    ((EBPF_OFFSET_OF(ebpf_operation_pinned_path_entry_t, path) + (path_length) + 3) & ~(size_t)3)
+
+typedef struct _ebpf_operation_get_pinned_paths_by_prefix_reply
+{
+    struct _ebpf_operation_header header;
+    uint32_t path_count;
+    uint8_t data[1]; ///< path_count ebpf_operation_pinned_path_entry_t entries, in path order.
+} ebpf_operation_get_pinned_paths_by_prefix_reply_t;
+
 typedef struct _ebpf_operation_get_object_info_request
 {
     struct _ebpf_operation_header header;
@@ -484,6 +530,27 @@ typedef struct _ebpf_operation_load_native_programs_reply
     uint8_t data[1];
 } ebpf_operation_load_native_programs_reply_t;
 
+typedef struct _ebpf_operation_instantiate_native_module_request
+{
+    struct _ebpf_operation_header header;
+    GUID module_id;
+    // Service name (UTF16)
+    uint8_t data[1];
+} ebpf_operation_instantiate_native_module_request_t;
+
+typedef struct _ebpf_operation_instantiate_native_module_reply
+{
+    struct _ebpf_operation_header header;
+    ebpf_handle_t native_module_handle;
+    size_t count_of_maps;
+    size_t count_of_programs;
+    // False if the reply is too small for the handles. The module is loaded and the caller has to use
+    // EBPF_OPERATION_LOAD_NATIVE_PROGRAMS to create the maps and programs.
+    bool programs_loaded;
+    // Map handles followed by program handles.
+    uint8_t data[1];
+} ebpf_operation_instantiate_native_module_reply_t;
+
 typedef struct _ebpf_operation_program_test_run_request
 {
     struct _ebpf_operation_header header;
@@ -505,6 +572,39 @@ typedef struct _ebpf_operation_program_test_run_reply
     uint8_t data[1];
 } ebpf_operation_program_test_run_reply_t;
 
+/**
+ * @brief Header of one input record of a batched test run. The record is followed by data_size bytes of data and
+ * context_size bytes of context, and the next record starts at the following 8-byte boundary.
+ */
+typedef struct _ebpf_operation_program_test_run_batch_record
+{
+    uint16_t data_size;
+    uint16_t context_size;
+} ebpf_operation_program_test_run_batch_record_t;
+
+typedef struct _ebpf_operation_program_test_run_batch_request
+{
+    struct _ebpf_operation_header header;
+    ebpf_handle_t program_handle;
+    size_t repeat_count; ///< Number of rounds over all of the inputs.
+    uint32_t flags;
+    uint32_t cpu;
+    size_t batch_size;
+    uint32_t input_count;
+    // Concatenation of input_count ebpf_operation_program_test_run_batch_record_t records.
+    uint8_t data[1];
+} ebpf_operation_program_test_run_batch_request_t;
+
+typedef struct _ebpf_operation_program_test_run_batch_reply
+{
+    struct _ebpf_operation_header header;
+    uint64_t duration;     ///< Mean duration in nanoseconds of a single invocation.
+    uint64_t latency_p50;  ///< Median duration in nanoseconds of a single invocation.
+    uint64_t latency_p99;  ///< 99th percentile duration in nanoseconds of a single invocation.
+    uint64_t latency_p999; ///< 99.9th percentile duration in nanoseconds of a single invocation.
+    uint64_t return_values[1]; ///< Return value of the last run of each input.
+} ebpf_operation_program_test_run_batch_reply_t;
+
 typedef struct _ebpf_operation_map_update_element_batch_request
 {
     struct _ebpf_operation_header header;
@@ -552,6 +652,23 @@ typedef struct _ebpf_operation_map_get_next_key_value_batch_reply
     uint8_t data[1];
 } ebpf_operation_map_get_next_key_value_batch_reply_t;
 
+typedef struct _ebpf_operation_map_get_next_key_aggregate_batch_request
+{
+    struct _ebpf_operation_header header;
+    ebpf_handle_t handle;
+    uint32_t aggregate;    ///< One of ebpf_map_aggregate_t.
+    uint32_t element_size; ///< Size in bytes of each integer element of a value.
+    uint8_t previous_key[1];
+} ebpf_operation_map_get_next_key_aggregate_batch_request_t;
+
+typedef struct _ebpf_operation_map_get_next_key_aggregate_batch_reply
+{
+    struct _ebpf_operation_header header;
+    // Count of elements is derived from the length of the reply.
+    // Data is a concatenation of key+aggregated value, where each value has the size the map was created with.
+    uint8_t data[1];
+} ebpf_operation_map_get_next_key_aggregate_batch_reply_t;
+
 typedef struct _ebpf_operation_program_set_flags_request
 {
     struct _ebpf_operation_header header;
@@ -559,6 +676,12 @@ typedef struct _ebpf_operation_program_set_flags_request
     uint64_t flags;
 } ebpf_operation_program_set_flags_request_t;
 
+typedef struct _ebpf_operation_program_enable_stats_request
+{
+    struct _ebpf_operation_header header;
+    uint32_t enable; // Non-zero to start collecting program run-time statistics, zero to stop.
+} ebpf_operation_program_enable_stats_request_t;
+
 typedef struct _ebpf_operation_authorize_native_module_request
 {
     struct _ebpf_operation_header header;
@@ -6,6 +6,7 @@
 #include "catch_wrapper.hpp"
 #include "ebpf_async.h"
 #include "ebpf_core.h"
+#include "ebpf_epoch.h"
 #include "ebpf_maps.h"
 #include "ebpf_object.h"
 #include "ebpf_program.h"
@@ -13,9 +14,11 @@
 #include "helpers.h"
 #include "test_helper.hpp"
 
+#include <atomic>
 #include <iomanip>
 #include <optional>
 #include <set>
+#include <thread>
 
 extern "C"
 {
@@ -281,6 +284,30 @@ _test_crud_operations(ebpf_map_type_t map_type)
         }
     }
 
+    // Look up every key, plus one that isn't present, in a single batch.
+    std::vector<uint32_t> batch_keys(_test_map_size + 1);
+    std::vector<uint8_t*> batch_values(batch_keys.size());
+    for (uint32_t key = 0; key < batch_keys.size(); key++) {
+        batch_keys[key] = key;
+    }
+    REQUIRE(
+        ebpf_map_find_entry_batch(
+            map.get(),
+            batch_keys.size(),
+            reinterpret_cast<const uint8_t*>(batch_keys.data()),
+            batch_values.data(),
+            0) == EBPF_SUCCESS);
+    for (uint32_t key = 0; key < batch_keys.size(); key++) {
+        // If map behavior is MAP_BEHAVIOR_REPLACE, then the 0th entry was evicted to make room for bad_key.
+        bool present = (behavior_on_max_entries == MAP_BEHAVIOR_REPLACE) ? (key != 0) : (key < _test_map_size);
+        if (present) {
+            REQUIRE(batch_values[key] != nullptr);
+            REQUIRE(*reinterpret_cast<uint64_t*>(batch_values[key]) == static_cast<uint64_t>(key) * key);
+        } else {
+            REQUIRE(batch_values[key] == nullptr);
+        }
+    }
+
     uint32_t previous_key;
     uint32_t next_key;
     std::set<uint32_t> keys;
@@ -637,6 +664,28 @@ TEST_CASE("map_crud_operations_lpm_trie_32", "[execution_context]")
                 EBPF_MAP_FLAG_HELPER) == EBPF_SUCCESS);
     }
 
+    // Iterate over the map and verify every key is returned exactly once.
+    {
+        std::set<std::string> visited_keys;
+        lpm_trie_32_key_t previous_key;
+        lpm_trie_32_key_t next_key;
+        for (bool first = true;; first = false) {
+            ebpf_result_t result = ebpf_map_next_key(
+                map.get(),
+                sizeof(next_key),
+                first ? nullptr : reinterpret_cast<const uint8_t*>(&previous_key),
+                reinterpret_cast<uint8_t*>(&next_key));
+            if (result == EBPF_NO_MORE_KEYS) {
+                break;
+            }
+            REQUIRE(result == EBPF_SUCCESS);
+            REQUIRE(visited_keys.insert(_ip32_prefix_string(next_key.prefix_length, next_key.value)).second);
+            previous_key = next_key;
+        }
+        // All the original keys plus the one inserted afterwards.
+        REQUIRE(visited_keys.size() == keys.size() + 1);
+    }
+
     // Delete all the keys.
     for (const auto& [key, key_string] : keys) {
         CAPTURE(key_string);
@@ -644,6 +693,26 @@ TEST_CASE("map_crud_operations_lpm_trie_32", "[execution_context]")
             ebpf_map_delete_entry(map.get(), 0, reinterpret_cast<const uint8_t*>(&key), EBPF_MAP_FLAG_HELPER) ==
             EBPF_SUCCESS);
     }
+
+    // Only the key inserted after the initial set remains.
+    for (const auto& [key, correct_value] : tests) {
+        std::string key_string = _ip32_prefix_string(key.prefix_length, key.value);
+        CAPTURE(key_string);
+        char* return_value = nullptr;
+        ebpf_result_t result = ebpf_map_find_entry(
+            map.get(),
+            0,
+            reinterpret_cast<const uint8_t*>(&key),
+            0,
+            reinterpret_cast<uint8_t*>(&return_value),
+            EBPF_MAP_FLAG_HELPER);
+        if (key.prefix_length == 32 && key.value[0] == 192 && key.value[1] == 168 && key.value[2] == 15 &&
+            key.value[3] == 1) {
+            CHECK(result == EBPF_SUCCESS);
+        } else {
+            CHECK(result == EBPF_KEY_NOT_FOUND);
+        }
+    }
 }
 
 TEST_CASE("map_crud_operations_lpm_trie_32", "[execution_context][negative]")
@@ -822,6 +891,67 @@ _lpm_128_prefix_pair(uint32_t prefix_length, uint8_t value, std::string prefix_s
     return {key, prefix_string};
 }
 
+TEST_CASE("map_lpm_trie_max_entries", "[execution_context]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+    const uint32_t max_entries = 4;
+    ebpf_map_definition_in_memory_t map_definition{
+        BPF_MAP_TYPE_LPM_TRIE, sizeof(lpm_trie_32_key_t), sizeof(uint32_t), max_entries};
+    map_ptr map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) == EBPF_SUCCESS);
+        map.reset(local_map);
+    }
+
+    auto update = [&](const lpm_trie_32_key_t& key, ebpf_map_option_t option) {
+        uint32_t value = key.prefix_length;
+        return ebpf_map_update_entry(
+            map.get(),
+            0,
+            reinterpret_cast<const uint8_t*>(&key),
+            0,
+            reinterpret_cast<const uint8_t*>(&value),
+            option,
+            EBPF_MAP_FLAG_HELPER);
+    };
+
+    // 192.168.15.0/24 and 192.168.16.0/24 diverge, so the trie also holds an intermediate node that is not counted.
+    std::vector<std::pair<lpm_trie_32_key_t, std::string>> keys{
+        _lpm_ip32_prefix_pair(24, 192, 168, 15, 0),
+        _lpm_ip32_prefix_pair(24, 192, 168, 16, 0),
+        _lpm_ip32_prefix_pair(16, 192, 168, 0, 0),
+        _lpm_ip32_prefix_pair(8, 10, 0, 0, 0),
+    };
+    for (const auto& [key, key_string] : keys) {
+        CAPTURE(key_string);
+        REQUIRE(update(key, EBPF_ANY) == EBPF_SUCCESS);
+    }
+
+    // A new key is rejected once the map is full.
+    lpm_trie_32_key_t extra_key = _lpm_ip32_prefix_pair(24, 10, 1, 1, 0).first;
+    REQUIRE(update(extra_key, EBPF_ANY) == EBPF_OUT_OF_SPACE);
+    REQUIRE(update(extra_key, EBPF_NOEXIST) == EBPF_OUT_OF_SPACE);
+
+    // Replacing an existing key doesn't need space.
+    REQUIRE(update(keys[0].first, EBPF_ANY) == EBPF_SUCCESS);
+    REQUIRE(update(keys[0].first, EBPF_EXIST) == EBPF_SUCCESS);
+
+    // Filling the prefix of the intermediate node adds an entry, so it is rejected too.
+    lpm_trie_32_key_t intermediate_key = _lpm_ip32_prefix_pair(19, 192, 168, 0, 0).first;
+    REQUIRE(update(intermediate_key, EBPF_ANY) == EBPF_OUT_OF_SPACE);
+
+    // Deleting an entry makes room for one more.
+    REQUIRE(
+        ebpf_map_delete_entry(map.get(), 0, reinterpret_cast<const uint8_t*>(&keys[3].first), EBPF_MAP_FLAG_HELPER) ==
+        EBPF_SUCCESS);
+    REQUIRE(update(extra_key, EBPF_ANY) == EBPF_SUCCESS);
+    REQUIRE(update(intermediate_key, EBPF_ANY) == EBPF_OUT_OF_SPACE);
+}
+
 TEST_CASE("map_crud_operations_lpm_trie_128", "[execution_context]")
 {
     _ebpf_core_initializer core;
@@ -1103,6 +1233,189 @@ TEST_CASE("map_crud_operations_stack", "[execution_context]")
         EBPF_OBJECT_NOT_FOUND);
 }
 
+TEST_CASE("map_queue_concurrent_push_pop", "[execution_context]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+    ebpf_map_definition_in_memory_t map_definition{BPF_MAP_TYPE_QUEUE, 0, sizeof(uint32_t), 16};
+    map_ptr map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) == EBPF_SUCCESS);
+        map.reset(local_map);
+    }
+
+    const uint32_t thread_count = 4;
+    const uint32_t values_per_thread = 10000;
+    std::atomic<uint32_t> popped_count = 0;
+    std::atomic<bool> out_of_order = false;
+    std::vector<std::vector<uint32_t>> popped_values(thread_count);
+    std::vector<std::thread> threads;
+
+    for (uint32_t thread_index = 0; thread_index < thread_count; thread_index++) {
+        threads.emplace_back([&, thread_index]() {
+            for (uint32_t i = 0; i < values_per_thread; i++) {
+                uint32_t value = thread_index * values_per_thread + i;
+                while (ebpf_map_push_entry(map.get(), sizeof(value), reinterpret_cast<uint8_t*>(&value), 0) ==
+                       EBPF_OUT_OF_SPACE) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&, thread_index]() {
+            // Values from the same producer must be popped in the order they were pushed.
+            std::vector<int64_t> last_value(thread_count, -1);
+            while (popped_count < thread_count * values_per_thread) {
+                uint32_t value;
+                if (ebpf_map_pop_entry(map.get(), sizeof(value), reinterpret_cast<uint8_t*>(&value), 0) !=
+                    EBPF_SUCCESS) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                uint32_t producer = value / values_per_thread;
+                if (producer >= thread_count || (int64_t)value <= last_value[producer]) {
+                    out_of_order = true;
+                } else {
+                    last_value[producer] = value;
+                }
+                popped_values[thread_index].push_back(value);
+                popped_count++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every pushed value was popped exactly once.
+    REQUIRE(!out_of_order);
+    std::set<uint32_t> values;
+    for (const auto& thread_values : popped_values) {
+        values.insert(thread_values.begin(), thread_values.end());
+    }
+    REQUIRE(values.size() == thread_count * values_per_thread);
+    REQUIRE(popped_count == thread_count * values_per_thread);
+
+    uint32_t value;
+    REQUIRE(
+        ebpf_map_peek_entry(map.get(), sizeof(value), reinterpret_cast<uint8_t*>(&value), 0) ==
+        EBPF_OBJECT_NOT_FOUND);
+
+    // Push with BPF_EXIST, discarding the oldest entry instead of failing when the queue is full. Values may be
+    // discarded, but every push succeeds and no value is popped twice or out of order.
+    std::atomic<uint32_t> producers_done = 0;
+    std::atomic<bool> push_failed = false;
+    popped_count = 0;
+    popped_values.assign(thread_count, {});
+    threads.clear();
+    for (uint32_t thread_index = 0; thread_index < thread_count; thread_index++) {
+        threads.emplace_back([&, thread_index]() {
+            for (uint32_t i = 0; i < values_per_thread; i++) {
+                uint32_t pushed_value = thread_index * values_per_thread + i;
+                if (ebpf_map_push_entry(
+                        map.get(), sizeof(pushed_value), reinterpret_cast<uint8_t*>(&pushed_value), BPF_EXIST) !=
+                    EBPF_SUCCESS) {
+                    push_failed = true;
+                }
+            }
+            producers_done++;
+        });
+        threads.emplace_back([&, thread_index]() {
+            std::vector<int64_t> last_value(thread_count, -1);
+            for (;;) {
+                bool done = producers_done == thread_count;
+                uint32_t popped_value;
+                if (ebpf_map_pop_entry(
+                        map.get(), sizeof(popped_value), reinterpret_cast<uint8_t*>(&popped_value), 0) !=
+                    EBPF_SUCCESS) {
+                    if (done) {
+                        break;
+                    }
+                    std::this_thread::yield();
+                    continue;
+                }
+                uint32_t producer = popped_value / values_per_thread;
+                if (producer >= thread_count || (int64_t)popped_value <= last_value[producer]) {
+                    out_of_order = true;
+                } else {
+                    last_value[producer] = popped_value;
+                }
+                popped_values[thread_index].push_back(popped_value);
+                popped_count++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(!push_failed);
+    REQUIRE(!out_of_order);
+    values.clear();
+    for (const auto& thread_values : popped_values) {
+        values.insert(thread_values.begin(), thread_values.end());
+    }
+    REQUIRE(values.size() == popped_count.load());
+    REQUIRE(popped_count.load() > 0u);
+    REQUIRE(popped_count.load() <= thread_count * values_per_thread);
+    REQUIRE(
+        ebpf_map_peek_entry(map.get(), sizeof(value), reinterpret_cast<uint8_t*>(&value), 0) ==
+        EBPF_OBJECT_NOT_FOUND);
+}
+
+TEST_CASE("map_lru_background_eviction", "[execution_context]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+    ebpf_map_definition_in_memory_t map_definition{BPF_MAP_TYPE_LRU_HASH, sizeof(uint32_t), sizeof(uint64_t), 64};
+    map_definition.map_flags = EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION | EBPF_MAP_CREATE_FLAG_STATISTICS;
+    map_ptr map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) == EBPF_SUCCESS);
+        map.reset(local_map);
+    }
+
+    // Fill the map past its high watermark (7/8 of max_entries) without filling it. The eviction scheduled by the
+    // insert that crosses the watermark can't run until this epoch is exited, so it sees all of the inserts.
+    ebpf_epoch_state_t epoch_state;
+    ebpf_epoch_enter(&epoch_state);
+    uint64_t value = 0;
+    for (uint32_t key = 0; key < 60; key++) {
+        REQUIRE(
+            ebpf_map_update_entry(
+                map.get(),
+                sizeof(key),
+                reinterpret_cast<const uint8_t*>(&key),
+                sizeof(value),
+                reinterpret_cast<const uint8_t*>(&value),
+                EBPF_ANY,
+                0) == EBPF_SUCCESS);
+    }
+    ebpf_epoch_exit(&epoch_state);
+
+    // Eviction runs in the background until the map is down to its low watermark (3/4 of max_entries).
+    ebpf_map_wait_for_background_eviction(map.get());
+
+    bpf_map_info info;
+    uint16_t info_size = sizeof(info);
+    REQUIRE(ebpf_map_get_info(map.get(), reinterpret_cast<uint8_t*>(&info), &info_size) == EBPF_SUCCESS);
+    REQUIRE(info.entry_count == 48);
+    REQUIRE(info.eviction_count == 12);
+    REQUIRE(info.insert_count == 60);
+
+    // The most recently inserted key is still present.
+    uint32_t key = 59;
+    REQUIRE(
+        ebpf_map_find_entry(
+            map.get(), sizeof(key), reinterpret_cast<const uint8_t*>(&key), sizeof(value), (uint8_t*)&value, 0) ==
+        EBPF_SUCCESS);
+}
+
 #define TEST_FUNCTION_RETURN 42
 #define TOTAL_HELPER_COUNT 3
 
@@ -1293,6 +1606,119 @@ TEST_CASE("program", "[execution_context]")
 }
 #endif
 
+#if !defined(CONFIG_BPF_INTERPRETER_DISABLED)
+/**
+ * @brief Append the two instructions that load a 64-bit immediate into a register.
+ */
+static void
+_append_load_imm64(std::vector<ebpf_instruction_t>& byte_code, uint8_t dst, uint64_t value)
+{
+    byte_code.push_back({0x18, dst, 0, 0, static_cast<int32_t>(static_cast<uint32_t>(value))}); // lddw dst, value
+    byte_code.push_back({0, 0, 0, 0, static_cast<int32_t>(static_cast<uint32_t>(value >> 32))});
+}
+
+/**
+ * @brief Interpret byte code as a sample program and return the value it returns. Call instructions in the byte code
+ * refer to helpers by their index in helper_function_ids.
+ */
+static uint32_t
+_run_byte_code(
+    const std::vector<ebpf_instruction_t>& byte_code,
+    const std::vector<uint32_t>& helper_function_ids,
+    std::vector<ebpf_map_t*> maps = {})
+{
+    program_info_provider_t program_info_provider;
+    REQUIRE(program_info_provider.initialize(EBPF_PROGRAM_TYPE_SAMPLE) == EBPF_SUCCESS);
+    const ebpf_program_parameters_t program_parameters{EBPF_PROGRAM_TYPE_SAMPLE, EBPF_ATTACH_TYPE_SAMPLE};
+    program_ptr program;
+    {
+        ebpf_program_t* local_program = nullptr;
+        REQUIRE(ebpf_program_create(&program_parameters, &local_program) == EBPF_SUCCESS);
+        program.reset(local_program);
+    }
+    if (!maps.empty()) {
+        REQUIRE(
+            ebpf_program_associate_maps(program.get(), maps.data(), static_cast<uint32_t>(maps.size())) ==
+            EBPF_SUCCESS);
+    }
+    REQUIRE(
+        ebpf_program_set_helper_function_ids(program.get(), helper_function_ids.size(), helper_function_ids.data()) ==
+        EBPF_SUCCESS);
+    REQUIRE(
+        ebpf_program_load_code(
+            program.get(),
+            EBPF_CODE_EBPF,
+            nullptr,
+            reinterpret_cast<const uint8_t*>(byte_code.data()),
+            byte_code.size() * sizeof(ebpf_instruction_t)) == EBPF_SUCCESS);
+
+    uint32_t result = 0;
+    sample_program_context_header_t ctx_header{0};
+    ebpf_execution_context_state_t state{};
+    ebpf_epoch_state_t epoch_state;
+    ebpf_epoch_enter(&epoch_state);
+    ebpf_get_execution_context_state(&state);
+    ebpf_result_t invoke_result = ebpf_program_invoke(program.get(), &ctx_header.context, &result, &state);
+    ebpf_epoch_exit(&epoch_state);
+    REQUIRE(invoke_result == EBPF_SUCCESS);
+    return result;
+}
+
+TEST_CASE("map_lookup_batch_helper", "[execution_context]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+
+    for (auto map_type : {BPF_MAP_TYPE_HASH, BPF_MAP_TYPE_ARRAY}) {
+        ebpf_map_definition_in_memory_t map_definition{map_type, sizeof(uint32_t), sizeof(uint64_t), 10};
+        map_ptr map;
+        {
+            ebpf_map_t* local_map;
+            cxplat_utf8_string_t map_name = {0};
+            REQUIRE(
+                ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) ==
+                EBPF_SUCCESS);
+            map.reset(local_map);
+        }
+        uint32_t key = 1;
+        uint64_t value = 42;
+        REQUIRE(
+            ebpf_map_update_entry(
+                map.get(), sizeof(key), (uint8_t*)&key, sizeof(value), (uint8_t*)&value, EBPF_ANY, 0) ==
+            EBPF_SUCCESS);
+
+        // Look up keys 1 and 70 into a stack buffer that holds garbage, and return
+        // found | value[0] << 8 | value[1] << 16.
+        std::vector<ebpf_instruction_t> byte_code = {
+            {0x62, 10, 0, -8, 1},     // stw [r10-8], 1
+            {0x62, 10, 0, -4, 70},    // stw [r10-4], 70
+            {0x7a, 10, 0, -16, 0xff}, // stdw [r10-16], 0xff
+        };
+        _append_load_imm64(byte_code, 1, reinterpret_cast<uintptr_t>(map.get()));
+        byte_code.insert(
+            byte_code.end(),
+            {
+                {0xbf, 2, 10, 0, 0},   // mov64 r2, r10
+                {0x07, 2, 0, 0, -8},   // add64 r2, -8
+                {0xb7, 3, 0, 0, 8},    // mov64 r3, 8
+                {0xbf, 4, 10, 0, 0},   // mov64 r4, r10
+                {0x07, 4, 0, 0, -24},  // add64 r4, -24
+                {0xb7, 5, 0, 0, 16},   // mov64 r5, 16
+                {0x85, 0, 0, 0, 0},    // call bpf_map_lookup_batch
+                {0x79, 1, 10, -24, 0}, // ldxdw r1, [r10-24]
+                {0x67, 1, 0, 0, 8},    // lsh64 r1, 8
+                {0x4f, 0, 1, 0, 0},    // or64 r0, r1
+                {0x79, 1, 10, -16, 0}, // ldxdw r1, [r10-16]
+                {0x67, 1, 0, 0, 16},   // lsh64 r1, 16
+                {0x4f, 0, 1, 0, 0},    // or64 r0, r1
+                {0x95, 0, 0, 0, 0},    // exit
+            });
+
+        REQUIRE(_run_byte_code(byte_code, {BPF_FUNC_map_lookup_batch}, {map.get()}) == (1u | (42u << 8)));
+    }
+}
+#endif // !defined(CONFIG_BPF_INTERPRETER_DISABLED)
+
 TEST_CASE("name size", "[execution_context]")
 {
     _ebpf_core_initializer core;
@@ -1437,6 +1863,318 @@ TEST_CASE("ring_buffer_sync_query", "[execution_context][ring_buffer]")
         EBPF_SUCCESS);
 }
 
+TEST_CASE("ring_buffer_reserve_submit_discard", "[execution_context][ring_buffer]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+    ebpf_map_definition_in_memory_t map_definition{BPF_MAP_TYPE_RINGBUF, 0, sizeof(uint64_t), 64 * 1024};
+    map_ptr map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) == EBPF_SUCCESS);
+        map.reset(local_map);
+    }
+
+    // Build one record in place and submit it, then reserve and discard a second one.
+    uint8_t* reserved_data = nullptr;
+    REQUIRE(ebpf_ring_buffer_map_reserve(map.get(), &reserved_data, sizeof(uint64_t)) == EBPF_SUCCESS);
+    *reinterpret_cast<uint64_t*>(reserved_data) = 42;
+    REQUIRE(ebpf_ring_buffer_map_submit(map.get(), reserved_data, 0) == EBPF_SUCCESS);
+    REQUIRE(ebpf_ring_buffer_map_reserve(map.get(), &reserved_data, sizeof(uint64_t)) == EBPF_SUCCESS);
+    REQUIRE(ebpf_ring_buffer_map_discard(map.get(), reserved_data, 0) == EBPF_SUCCESS);
+
+    volatile size_t* consumer = nullptr;
+    volatile size_t* producer = nullptr;
+    uint8_t* data = nullptr;
+    size_t data_size = 0;
+    REQUIRE(
+        ebpf_ring_buffer_map_map_user(
+            map.get(), (void**)&consumer, (void**)&producer, (const uint8_t**)&data, &data_size) == EBPF_SUCCESS);
+
+    auto record = ebpf_ring_buffer_next_record(data, 64 * 1024, *consumer, *producer);
+    REQUIRE(record != nullptr);
+    REQUIRE(!ebpf_ring_buffer_record_is_locked(record));
+    REQUIRE(!ebpf_ring_buffer_record_is_discarded(record));
+    REQUIRE(*(uint64_t*)(record->data) == 42);
+
+    size_t consumer_offset = *consumer + ebpf_ring_buffer_record_total_size(record);
+    record = ebpf_ring_buffer_next_record(data, 64 * 1024, consumer_offset, *producer);
+    REQUIRE(record != nullptr);
+    REQUIRE(ebpf_ring_buffer_record_is_discarded(record));
+
+    REQUIRE(
+        ebpf_ring_buffer_map_unmap_user(map.get(), (const void*)consumer, (const void*)producer, (const void*)data) ==
+        EBPF_SUCCESS);
+
+    // Only ring buffer maps support reservations.
+    ebpf_map_definition_in_memory_t array_definition{BPF_MAP_TYPE_ARRAY, sizeof(uint32_t), sizeof(uint64_t), 1};
+    map_ptr array_map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &array_definition, (uintptr_t)ebpf_handle_invalid, &local_map) ==
+            EBPF_SUCCESS);
+        array_map.reset(local_map);
+    }
+    REQUIRE(ebpf_ring_buffer_map_reserve(array_map.get(), &reserved_data, sizeof(uint64_t)) == EBPF_INVALID_ARGUMENT);
+}
+
+#if !defined(CONFIG_BPF_INTERPRETER_DISABLED)
+/**
+ * @brief Append byte code that calls bpf_ringbuf_reserve(map, size, flags), which is helper index 0.
+ */
+static void
+_append_ring_buffer_reserve(std::vector<ebpf_instruction_t>& byte_code, ebpf_map_t* map, int32_t size, int32_t flags)
+{
+    _append_load_imm64(byte_code, 1, reinterpret_cast<uintptr_t>(map));
+    byte_code.insert(
+        byte_code.end(),
+        {
+            {0xb7, 2, 0, 0, size},  // mov64 r2, size
+            {0xb7, 3, 0, 0, flags}, // mov64 r3, flags
+            {0x85, 0, 0, 0, 0},     // call bpf_ringbuf_reserve
+        });
+}
+
+TEST_CASE("ring_buffer_reserve_helpers", "[execution_context][ring_buffer]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+    const uint32_t ring_size = 64 * 1024;
+    // Records reserved by a program must be exactly the value size of the map.
+    ebpf_map_definition_in_memory_t map_definition{BPF_MAP_TYPE_RINGBUF, 0, sizeof(uint64_t), ring_size};
+    map_ptr map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) == EBPF_SUCCESS);
+        map.reset(local_map);
+    }
+    const std::vector<uint32_t> helper_function_ids = {
+        BPF_FUNC_ringbuf_reserve, BPF_FUNC_ringbuf_submit, BPF_FUNC_ringbuf_discard};
+
+    volatile size_t* consumer = nullptr;
+    volatile size_t* producer = nullptr;
+    uint8_t* data = nullptr;
+    size_t data_size = 0;
+    REQUIRE(
+        ebpf_ring_buffer_map_map_user(
+            map.get(), (void**)&consumer, (void**)&producer, (const uint8_t**)&data, &data_size) == EBPF_SUCCESS);
+    size_t consumer_offset = *consumer;
+
+    // Reserve a record and write 42 to it, check that a second reservation fails while the first is outstanding,
+    // then submit the first one. Returns 1 if the second reservation failed.
+    std::vector<ebpf_instruction_t> byte_code;
+    _append_ring_buffer_reserve(byte_code, map.get(), static_cast<int32_t>(sizeof(uint64_t)), 0);
+    byte_code.insert(
+        byte_code.end(),
+        {
+            {0xbf, 6, 0, 0, 0},  // mov64 r6, r0
+            {0x55, 6, 0, 2, 0},  // jne r6, 0, +2
+            {0xb7, 0, 0, 0, 0},  // mov64 r0, 0
+            {0x95, 0, 0, 0, 0},  // exit
+            {0x7a, 6, 0, 0, 42}, // stdw [r6], 42
+        });
+    _append_ring_buffer_reserve(byte_code, map.get(), static_cast<int32_t>(sizeof(uint64_t)), 0);
+    byte_code.insert(
+        byte_code.end(),
+        {
+            {0xbf, 7, 0, 0, 0}, // mov64 r7, r0
+            {0xbf, 1, 6, 0, 0}, // mov64 r1, r6
+            {0xb7, 2, 0, 0, 0}, // mov64 r2, 0
+            {0x85, 0, 0, 0, 1}, // call bpf_ringbuf_submit
+            {0xb7, 0, 0, 0, 1}, // mov64 r0, 1
+            {0x15, 7, 0, 1, 0}, // jeq r7, 0, +1
+            {0xb7, 0, 0, 0, 2}, // mov64 r0, 2
+            {0x95, 0, 0, 0, 0}, // exit
+        });
+    REQUIRE(_run_byte_code(byte_code, helper_function_ids, {map.get()}) == 1);
+
+    auto record = ebpf_ring_buffer_next_record(data, ring_size, consumer_offset, *producer);
+    REQUIRE(record != nullptr);
+    REQUIRE(!ebpf_ring_buffer_record_is_locked(record));
+    REQUIRE(!ebpf_ring_buffer_record_is_discarded(record));
+    REQUIRE(*(uint64_t*)(record->data) == 42);
+    consumer_offset += ebpf_ring_buffer_record_total_size(record);
+    REQUIRE(ebpf_ring_buffer_next_record(data, ring_size, consumer_offset, *producer) == nullptr);
+
+    // Reserve a record, then submit and discard pointers the helper did not return, which must be ignored, and
+    // return without releasing the record. The invoke discards the record on the way out.
+    byte_code.clear();
+    _append_ring_buffer_reserve(byte_code, map.get(), static_cast<int32_t>(sizeof(uint64_t)), 0);
+    byte_code.insert(
+        byte_code.end(),
+        {
+            {0xbf, 6, 0, 0, 0},  // mov64 r6, r0
+            {0x55, 6, 0, 2, 0},  // jne r6, 0, +2
+            {0xb7, 0, 0, 0, 0},  // mov64 r0, 0
+            {0x95, 0, 0, 0, 0},  // exit
+            {0x7a, 6, 0, 0, 7},  // stdw [r6], 7
+            {0xbf, 1, 10, 0, 0}, // mov64 r1, r10
+            {0x07, 1, 0, 0, -8}, // add64 r1, -8
+            {0xb7, 2, 0, 0, 0},  // mov64 r2, 0
+            {0x85, 0, 0, 0, 1},  // call bpf_ringbuf_submit
+            {0xbf, 1, 6, 0, 0},  // mov64 r1, r6
+            {0x07, 1, 0, 0, 4},  // add64 r1, 4
+            {0xb7, 2, 0, 0, 0},  // mov64 r2, 0
+            {0x85, 0, 0, 0, 2},  // call bpf_ringbuf_discard
+            {0xb7, 0, 0, 0, 1},  // mov64 r0, 1
+            {0x95, 0, 0, 0, 0},  // exit
+        });
+    REQUIRE(_run_byte_code(byte_code, helper_function_ids, {map.get()}) == 1);
+
+    record = ebpf_ring_buffer_next_record(data, ring_size, consumer_offset, *producer);
+    REQUIRE(record != nullptr);
+    REQUIRE(!ebpf_ring_buffer_record_is_locked(record));
+    REQUIRE(ebpf_ring_buffer_record_is_discarded(record));
+    consumer_offset += ebpf_ring_buffer_record_total_size(record);
+
+    // The discarded reservation no longer counts as outstanding, so the same program can reserve again.
+    REQUIRE(_run_byte_code(byte_code, helper_function_ids, {map.get()}) == 1);
+    record = ebpf_ring_buffer_next_record(data, ring_size, consumer_offset, *producer);
+    REQUIRE(record != nullptr);
+    REQUIRE(ebpf_ring_buffer_record_is_discarded(record));
+
+    // Empty records, records smaller or larger than the value size and unknown flags are rejected.
+    byte_code.clear();
+    _append_ring_buffer_reserve(byte_code, map.get(), 0, 0);
+    byte_code.push_back({0xbf, 6, 0, 0, 0}); // mov64 r6, r0
+    _append_ring_buffer_reserve(byte_code, map.get(), static_cast<int32_t>(sizeof(uint32_t)), 0);
+    byte_code.push_back({0x4f, 6, 0, 0, 0}); // or64 r6, r0
+    _append_ring_buffer_reserve(byte_code, map.get(), static_cast<int32_t>(2 * sizeof(uint64_t)), 0);
+    byte_code.push_back({0x4f, 6, 0, 0, 0}); // or64 r6, r0
+    _append_ring_buffer_reserve(byte_code, map.get(), static_cast<int32_t>(sizeof(uint64_t)), 1);
+    byte_code.insert(
+        byte_code.end(),
+        {
+            {0x4f, 6, 0, 0, 0}, // or64 r6, r0
+            {0xb7, 0, 0, 0, 1}, // mov64 r0, 1
+            {0x15, 6, 0, 1, 0}, // jeq r6, 0, +1
+            {0xb7, 0, 0, 0, 0}, // mov64 r0, 0
+            {0x95, 0, 0, 0, 0}, // exit
+        });
+    REQUIRE(_run_byte_code(byte_code, helper_function_ids, {map.get()}) == 1);
+
+    REQUIRE(
+        ebpf_ring_buffer_map_unmap_user(map.get(), (const void*)consumer, (const void*)producer, (const void*)data) ==
+        EBPF_SUCCESS);
+}
+#endif // !defined(CONFIG_BPF_INTERPRETER_DISABLED)
+
+TEST_CASE("ring_buffer_per_cpu", "[execution_context][ring_buffer]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+    ebpf_map_definition_in_memory_t map_definition{
+        BPF_MAP_TYPE_RINGBUF, 0, sizeof(uint64_t), 64 * 1024, 0, LIBBPF_PIN_NONE, EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU};
+    map_ptr map;
+    {
+        ebpf_map_t* local_map;
+        cxplat_utf8_string_t map_name = {0};
+        REQUIRE(
+            ebpf_map_create(&map_name, &map_definition, (uintptr_t)ebpf_handle_invalid, &local_map) == EBPF_SUCCESS);
+        map.reset(local_map);
+    }
+    uint32_t cpu_id = 0;
+    scoped_cpu_affinity cpu_affinity(cpu_id);
+
+    // Output one record, build a second one in place, and discard a third one. All land in the sub-ring of this CPU.
+    uint64_t value = 1;
+    REQUIRE(ebpf_ring_buffer_map_output(map.get(), reinterpret_cast<uint8_t*>(&value), sizeof(value)) == EBPF_SUCCESS);
+    uint8_t* reserved_data = nullptr;
+    REQUIRE(ebpf_ring_buffer_map_reserve(map.get(), &reserved_data, sizeof(uint64_t)) == EBPF_SUCCESS);
+    *reinterpret_cast<uint64_t*>(reserved_data) = 2;
+    REQUIRE(ebpf_ring_buffer_map_submit(map.get(), reserved_data, 0) == EBPF_SUCCESS);
+    REQUIRE(ebpf_ring_buffer_map_reserve(map.get(), &reserved_data, sizeof(uint64_t)) == EBPF_SUCCESS);
+    REQUIRE(ebpf_ring_buffer_map_discard(map.get(), reserved_data, 0) == EBPF_SUCCESS);
+
+    struct _completion
+    {
+        uint8_t* buffer = nullptr;
+        uint32_t buffer_size = 64 * 1024;
+        size_t consumer_offset = 0;
+        ebpf_map_async_query_result_t async_query_result = {};
+        std::vector<uint64_t> values;
+        std::vector<uint64_t> timestamps;
+        size_t discard_count = 0;
+    } completion;
+
+    REQUIRE(
+        ebpf_map_query_buffer(map.get(), cpu_id, &completion.buffer, &completion.consumer_offset) == EBPF_SUCCESS);
+    completion.async_query_result.consumer = completion.consumer_offset;
+
+    REQUIRE(
+        ebpf_async_set_completion_callback(
+            &completion, [](_Inout_ void* context, size_t output_buffer_length, ebpf_result_t result) {
+                UNREFERENCED_PARAMETER(output_buffer_length);
+                REQUIRE(result == EBPF_SUCCESS);
+                auto completion = reinterpret_cast<_completion*>(context);
+                size_t consumer = completion->async_query_result.consumer;
+                while (auto record = ebpf_ring_buffer_next_record(
+                           completion->buffer,
+                           completion->buffer_size,
+                           consumer,
+                           completion->async_query_result.producer)) {
+                    REQUIRE(!ebpf_ring_buffer_record_is_locked(record));
+                    if (ebpf_ring_buffer_record_is_discarded(record)) {
+                        completion->discard_count++;
+                    } else {
+                        // Each record starts with the timestamp prefix, followed by the data.
+                        REQUIRE(
+                            ebpf_ring_buffer_record_length(record) ==
+                            sizeof(ebpf_ring_buffer_per_cpu_record_prefix_t) + sizeof(uint64_t));
+                        auto prefix = reinterpret_cast<const ebpf_ring_buffer_per_cpu_record_prefix_t*>(record->data);
+                        completion->timestamps.push_back(prefix->timestamp);
+                        completion->values.push_back(*(uint64_t*)(record->data + sizeof(*prefix)));
+                    }
+                    consumer += ebpf_ring_buffer_record_total_size(record);
+                }
+            }) == EBPF_SUCCESS);
+
+    // Data is already available, so the query completes right away.
+    ebpf_result_t result = ebpf_map_async_query(map.get(), cpu_id, &completion.async_query_result, &completion);
+    if (result != EBPF_PENDING) {
+        REQUIRE(ebpf_async_reset_completion_callback(&completion) == EBPF_SUCCESS);
+    }
+    REQUIRE(result == EBPF_PENDING);
+
+    REQUIRE(completion.values == std::vector<uint64_t>{1, 2});
+    REQUIRE(completion.discard_count == 1);
+    REQUIRE(completion.timestamps[0] != 0);
+    REQUIRE(completion.timestamps[0] <= completion.timestamps[1]);
+    REQUIRE(completion.async_query_result.lost_count == 0);
+
+    // The sub-rings can only be consumed through async queries.
+    void* consumer = nullptr;
+    void* producer = nullptr;
+    const uint8_t* data = nullptr;
+    size_t data_size = 0;
+    REQUIRE(
+        ebpf_ring_buffer_map_map_user(map.get(), &consumer, &producer, &data, &data_size) ==
+        EBPF_OPERATION_NOT_SUPPORTED);
+    _wait_event event;
+    REQUIRE(ebpf_map_set_wait_handle_internal(map.get(), 0, event.handle(), 0) == EBPF_OPERATION_NOT_SUPPORTED);
+
+    // Only sub-rings that exist can be queried.
+    uint8_t* buffer = nullptr;
+    size_t consumer_offset = 0;
+    REQUIRE(
+        ebpf_map_query_buffer(map.get(), ebpf_get_cpu_count(), &buffer, &consumer_offset) == EBPF_INVALID_ARGUMENT);
+
+    // Only ring buffer maps can be backed by per-CPU sub-rings.
+    ebpf_map_definition_in_memory_t array_definition{BPF_MAP_TYPE_ARRAY, sizeof(uint32_t), sizeof(uint64_t), 1};
+    array_definition.map_flags = EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU;
+    ebpf_map_t* array_map = nullptr;
+    cxplat_utf8_string_t map_name = {0};
+    REQUIRE(
+        ebpf_map_create(&map_name, &array_definition, (uintptr_t)ebpf_handle_invalid, &array_map) ==
+        EBPF_INVALID_ARGUMENT);
+}
+
 TEST_CASE("perf_event_array_unsupported_ops", "[execution_context][perf_event_array][negative]")
 {
     _ebpf_core_initializer core;
@@ -2536,6 +3274,22 @@ TEST_CASE("EBPF_OPERATION_LOAD_NATIVE_MODULE", "[execution_context][negative]")
     REQUIRE(invoke_protocol(EBPF_OPERATION_LOAD_NATIVE_MODULE, request, reply) == EBPF_INVALID_ARGUMENT);
 }
 
+TEST_CASE("EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE", "[execution_context][negative]")
+{
+    NEGATIVE_TEST_PROLOG();
+    std::vector<uint8_t> request(EBPF_OFFSET_OF(ebpf_operation_instantiate_native_module_request_t, data) + 2);
+    std::vector<uint8_t> reply(EBPF_OFFSET_OF(ebpf_operation_instantiate_native_module_reply_t, data));
+    auto instantiate_native_module_request =
+        reinterpret_cast<ebpf_operation_instantiate_native_module_request_t*>(request.data());
+    instantiate_native_module_request->module_id = {};
+
+    // Invalid module id.
+    REQUIRE(invoke_protocol(EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE, request, reply) == EBPF_OBJECT_NOT_FOUND);
+
+    request.resize(request.size() + 1);
+    REQUIRE(invoke_protocol(EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE, request, reply) == EBPF_INVALID_ARGUMENT);
+}
+
 TEST_CASE("EBPF_OPERATION_MAP_FIND_ELEMENT", "[execution_context][negative]")
 {
     NEGATIVE_TEST_PROLOG();
@@ -3088,6 +3842,196 @@ TEST_CASE("INVALID_PROGRAM_DATA", "[execution_context][negative]")
     test_register_provider(&provider_characteristics);
 }
 
+/**
+ * @brief Program information provider of type EBPF_PROGRAM_TYPE_TEST implementing a set of program type specific
+ * helpers. The helpers are never invoked, so each one is given a distinct fake address derived from its ID.
+ */
+typedef class _test_helper_provider
+{
+  public:
+    _test_helper_provider(const std::vector<uint32_t>& helper_ids) : nmr_provider_handle(INVALID_HANDLE_VALUE)
+    {
+        for (uint32_t helper_id : helper_ids) {
+            prototypes.push_back(
+                {EBPF_HELPER_FUNCTION_PROTOTYPE_HEADER,
+                 helper_id,
+                 "test_helper_function",
+                 EBPF_RETURN_TYPE_INTEGER,
+                 {EBPF_ARGUMENT_TYPE_DONTCARE}});
+            addresses.push_back(address(helper_id));
+        }
+        program_info.count_of_program_type_specific_helpers = static_cast<uint32_t>(prototypes.size());
+        program_info.program_type_specific_helper_prototype = prototypes.data();
+        helper_function_addresses.helper_function_count = static_cast<uint32_t>(addresses.size());
+        helper_function_addresses.helper_function_address = addresses.data();
+    }
+
+    ~_test_helper_provider()
+    {
+        if (nmr_provider_handle != INVALID_HANDLE_VALUE) {
+            NTSTATUS status = NmrDeregisterProvider(nmr_provider_handle);
+            if (status == STATUS_PENDING) {
+                NmrWaitForProviderDeregisterComplete(nmr_provider_handle);
+            }
+        }
+    }
+
+    ebpf_result_t
+    initialize()
+    {
+        NTSTATUS status = NmrRegisterProvider(&provider_characteristics, this, &nmr_provider_handle);
+        return NT_SUCCESS(status) ? EBPF_SUCCESS : EBPF_FAILED;
+    }
+
+    static uint64_t
+    address(uint32_t helper_id)
+    {
+        return 0x10000 + helper_id;
+    }
+
+  private:
+    static NTSTATUS
+    provider_attach_client_callback(
+        HANDLE, void*, const NPI_REGISTRATION_INSTANCE*, void*, const void*, void**, const void**)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    static NTSTATUS
+    provider_detach_client_callback(void*)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    std::vector<ebpf_helper_function_prototype_t> prototypes;
+    std::vector<uint64_t> addresses;
+    ebpf_context_descriptor_t context_descriptor = {sizeof(ebpf_context_descriptor_t), -1, -1, -1};
+    ebpf_program_type_descriptor_t program_type_descriptor = {
+        EBPF_PROGRAM_TYPE_DESCRIPTOR_HEADER,
+        "test_program_type",
+        &context_descriptor,
+        EBPF_PROGRAM_TYPE_TEST_GUID,
+        1000,
+        0};
+    ebpf_program_info_t program_info = {EBPF_PROGRAM_INFORMATION_HEADER, &program_type_descriptor, 0, nullptr};
+    ebpf_helper_function_addresses_t helper_function_addresses = {EBPF_HELPER_FUNCTION_ADDRESSES_HEADER, 0, nullptr};
+    ebpf_program_data_t program_data = {
+        EBPF_PROGRAM_DATA_HEADER, &program_info, &helper_function_addresses, nullptr, nullptr, nullptr, 0, {0}};
+    NPI_MODULEID module_id = {sizeof(NPI_MODULEID), MIT_GUID, EBPF_PROGRAM_TYPE_TEST_GUID};
+    NPI_PROVIDER_CHARACTERISTICS provider_characteristics{
+        0,
+        sizeof(NPI_PROVIDER_CHARACTERISTICS),
+        (NPI_PROVIDER_ATTACH_CLIENT_FN*)provider_attach_client_callback,
+        (NPI_PROVIDER_DETACH_CLIENT_FN*)provider_detach_client_callback,
+        nullptr,
+        {
+            0,
+            sizeof(NPI_REGISTRATION_INSTANCE),
+            &EBPF_PROGRAM_INFO_EXTENSION_IID,
+            &module_id,
+            0,
+            &program_data,
+        },
+    };
+    HANDLE nmr_provider_handle;
+} test_helper_provider_t;
+
+static program_ptr
+_create_test_helper_program()
+{
+    ebpf_program_type_t program_type = EBPF_PROGRAM_TYPE_TEST_GUID;
+    const cxplat_utf8_string_t program_name{(uint8_t*)("foo"), 3};
+    const cxplat_utf8_string_t section_name{(uint8_t*)("bar"), 3};
+    const ebpf_program_parameters_t program_parameters{
+        program_type, EBPF_ATTACH_TYPE_SAMPLE, program_name, section_name};
+    ebpf_program_t* local_program = nullptr;
+    REQUIRE(ebpf_program_create(&program_parameters, &local_program) == EBPF_SUCCESS);
+    return program_ptr(local_program);
+}
+
+/**
+ * @brief Resolve a set of helper IDs for a program, replacing any IDs set previously.
+ */
+static ebpf_result_t
+_resolve_helper_ids(
+    _Inout_ ebpf_program_t* program,
+    const std::vector<uint32_t>& helper_ids,
+    std::vector<helper_function_address_t>& addresses)
+{
+    ebpf_program_clear_helper_function_ids(program);
+    REQUIRE(ebpf_program_set_helper_function_ids(program, helper_ids.size(), helper_ids.data()) == EBPF_SUCCESS);
+    addresses.assign(helper_ids.size(), {});
+    return ebpf_program_get_helper_function_addresses(program, addresses.size(), addresses.data());
+}
+
+TEST_CASE("helper_dispatch_table", "[execution_context]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+
+    const uint32_t first_helper_id = EBPF_MAX_GENERAL_HELPER_FUNCTION + 1;
+    test_helper_provider_t provider({first_helper_id, first_helper_id + 1, first_helper_id + 3});
+    REQUIRE(provider.initialize() == EBPF_SUCCESS);
+
+    // Both programs are bound to the same provider, so they resolve helpers through the same dispatch table.
+    program_ptr program = _create_test_helper_program();
+    program_ptr second_program = _create_test_helper_program();
+
+    const std::vector<uint32_t> helper_ids = {
+        BPF_FUNC_map_lookup_elem, first_helper_id, first_helper_id + 1, first_helper_id + 3};
+    std::vector<helper_function_address_t> addresses;
+    std::vector<helper_function_address_t> second_addresses;
+    REQUIRE(_resolve_helper_ids(program.get(), helper_ids, addresses) == EBPF_SUCCESS);
+    REQUIRE(_resolve_helper_ids(second_program.get(), helper_ids, second_addresses) == EBPF_SUCCESS);
+    REQUIRE(addresses[0].address != 0);
+    for (size_t index = 1; index < helper_ids.size(); index++) {
+        REQUIRE(addresses[index].address == test_helper_provider_t::address(helper_ids[index]));
+    }
+    for (size_t index = 0; index < helper_ids.size(); index++) {
+        REQUIRE(second_addresses[index].address == addresses[index].address);
+    }
+
+    // The table outlives the first program, as long as another program is bound to the provider.
+    program.reset();
+    REQUIRE(_resolve_helper_ids(second_program.get(), helper_ids, second_addresses) == EBPF_SUCCESS);
+    for (size_t index = 0; index < helper_ids.size(); index++) {
+        REQUIRE(second_addresses[index].address == addresses[index].address);
+    }
+
+    // Helper IDs that fall in a hole of the table, beyond its end, or that are unknown general helpers are unresolved.
+    const std::vector<uint32_t> unresolved_helper_ids = {
+        first_helper_id + 2, first_helper_id + 4, first_helper_id + 100000, EBPF_MAX_GENERAL_HELPER_FUNCTION - 1};
+    for (uint32_t unresolved_helper_id : unresolved_helper_ids) {
+        REQUIRE(_resolve_helper_ids(second_program.get(), {unresolved_helper_id}, second_addresses) != EBPF_SUCCESS);
+    }
+}
+
+TEST_CASE("helper_dispatch_table_sparse", "[execution_context]")
+{
+    _ebpf_core_initializer core;
+    core.initialize();
+
+    // Helper IDs spanning more than 1024 entries are too sparse for a dense table, so they are resolved by scanning the
+    // program data.
+    const uint32_t first_helper_id = EBPF_MAX_GENERAL_HELPER_FUNCTION + 1;
+    const uint32_t last_helper_id = first_helper_id + 4096;
+    test_helper_provider_t provider({first_helper_id, last_helper_id});
+    REQUIRE(provider.initialize() == EBPF_SUCCESS);
+
+    program_ptr program = _create_test_helper_program();
+
+    const std::vector<uint32_t> helper_ids = {BPF_FUNC_map_lookup_elem, first_helper_id, last_helper_id};
+    std::vector<helper_function_address_t> addresses;
+    REQUIRE(_resolve_helper_ids(program.get(), helper_ids, addresses) == EBPF_SUCCESS);
+    REQUIRE(addresses[0].address != 0);
+    REQUIRE(addresses[1].address == test_helper_provider_t::address(first_helper_id));
+    REQUIRE(addresses[2].address == test_helper_provider_t::address(last_helper_id));
+
+    for (uint32_t unresolved_helper_id : std::vector<uint32_t>{first_helper_id + 1, last_helper_id + 1}) {
+        REQUIRE(_resolve_helper_ids(program.get(), {unresolved_helper_id}, addresses) != EBPF_SUCCESS);
+    }
+}
+
 // TODO: Add more native module loading IOCTL negative tests.
 // https://github.com/microsoft/ebpf-for-windows/issues/1139
 // EBPF_OPERATION_LOAD_NATIVE_MODULE
@@ -18,6 +18,12 @@
  * 2) The minimum epoch is committed as the release epoch and any memory that is older than the release epoch is
  * released.
  * 3) The epoch_computation_in_progress flag is cleared which allows the epoch computation to be initiated  again.
+ *
+ * Phases 1 and 2 are performed as a reduction over a tree of CPUs rooted at CPU 0, where CPU n is the parent of CPUs
+ * n * fanout + 1 through n * fanout + fanout, and fanout is EBPF_EPOCH_TREE_FANOUT unless a test overrides it with
+ * ebpf_epoch_set_tree_fanout. Each CPU forwards the proposal to its children in parallel and reports the minimum epoch
+ * of its subtree to its parent, so the number of sequential inter-CPU messages in a round grows with the logarithm of
+ * the CPU count rather than linearly.
  */
 
 /**
@@ -25,6 +31,11 @@
  */
 #define EBPF_EPOCH_FLUSH_DELAY_IN_NANOSECONDS 1000000
 
+/**
+ * @brief Default number of children of each CPU in the release epoch computation tree.
+ */
+#define EBPF_EPOCH_TREE_FANOUT 4
+
 
 
 #define EBPF_EPOCH_FAIL_FAST(REASON, ASSERTION) \
@@ -49,6 +60,10 @@ typedef __declspec(align(EBPF_CACHE_LINE_SIZE)) struct _ebpf_epoch_cpu_entry
     int rundown_in_progress : 1;           ///< Set if rundown is in progress.
     int epoch_computation_in_progress : 1; ///< Set if epoch computation is in progress.
     ebpf_timed_work_queue_t* work_queue;   ///< Work queue used to schedule work items.
+    uint64_t tree_minimum_epoch;           ///< Minimum epoch of this CPU's subtree in the current round.
+    uint32_t tree_pending_children;        ///< Number of children that have not yet replied in the current phase.
+    int64_t free_list_depth;               ///< Number of items in the free list.
+    int64_t maximum_free_list_depth;       ///< Largest number of items observed in the free list.
 } ebpf_epoch_cpu_entry_t;
 
 /**
@@ -61,35 +76,44 @@ static _Writable_elements_(_ebpf_epoch_cpu_count) ebpf_epoch_cpu_entry_t* _ebpf_
  */
 static uint32_t _ebpf_epoch_cpu_count = 0;
 
+/**
+ * @brief Number of children of each CPU in the release epoch computation tree. Set when epoch tracking is initiated.
+ */
+static uint32_t _ebpf_epoch_tree_fanout = EBPF_EPOCH_TREE_FANOUT;
+
+/**
+ * @brief Fan-out requested by ebpf_epoch_set_tree_fanout for the next ebpf_epoch_initiate, or 0 for the default.
+ */
+static uint32_t _ebpf_epoch_requested_tree_fanout = 0;
+
 /**
  * @brief Enum of messages sent between CPUs.
  */
 typedef enum _ebpf_epoch_cpu_message_type
 {
-    EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_RELEASE_EPOCH, ///< This message is sent to CPU 0 to propose a new release
-                                                       ///< epoch.
-                                                       ///< CPU 0 declares the new current epoch and proposes it as the
-                                                       ///< release epoch. Each CPU then queries the epoch for each
-                                                       ///< thread linked to this CPU and sets the proposed release
-                                                       ///< epoch in the message to the minimum of the local minima and
-                                                       ///< the minima in the message. The message is then forwarded to
-                                                       ///< the next CPU. The last CPU then sends an epoch commit
-                                                       ///< message to CPU 0 with the final proposed release epoch.
-
-    EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_RELEASE_EPOCH, ///< This message is sent to CPU 0 to commit the proposed release
-                                                      ///< epoch.
+    EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_RELEASE_EPOCH, ///< This message is sent to CPU 0 to request a new release
+                                                       ///< epoch computation. CPU 0 declares the new current epoch and
+                                                       ///< sends this message to each of its children in the CPU tree.
+                                                       ///< Each CPU then adopts the new current epoch, forwards the
+                                                       ///< message to its children and queries the epoch for each
+                                                       ///< thread linked to this CPU. Once all children have reported,
+                                                       ///< the CPU reports the minimum epoch of its subtree to its
+                                                       ///< parent.
+
+    EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_RELEASE_EPOCH, ///< This message is sent from a CPU to its children in the CPU
+                                                      ///< tree to commit the proposed release epoch.
                                                       ///< Each CPU then:
                                                       ///< 1. Clears the timer-armed flag.
                                                       ///< 2. Sets the released epoch to the proposed release epoch
                                                       ///< minus 1.
-                                                      ///< 3. Releases any items in the free list that are eligible for
+                                                      ///< 3. Forwards the message to its children.
+                                                      ///< 4. Releases any items in the free list that are eligible for
                                                       ///< reclamation.
-                                                      ///< 4. Rearms the timer if need.
-                                                      ///< 5. Forwards the message to the next CPU.
-                                                      ///< The last CPU then sends an epoch computation complete message
-                                                      ///< to CPU 0.
-    EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_EPOCH_COMPLETE, ///< This message is sent only to CPU 0 to signal that epoch
-                                                        ///< computation is complete.
+                                                      ///< 5. Rearms the timer if need.
+                                                      ///< Once all children have acknowledged, the CPU acknowledges the
+                                                      ///< commit to its parent.
+    EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_EPOCH_COMPLETE, ///< This message is completed only on CPU 0 to signal that
+                                                        ///< epoch computation is complete.
     EBPF_EPOCH_CPU_MESSAGE_TYPE_EXIT_EPOCH, ///< This message is used when a thread running with IRQL < DISPATCH calls
                                             ///< ebpf_epoch_exit on a different CPU than ebpf_epoch_enter. It is sent
                                             ///< from the CPU where the thread called ebpf_epoch_exit to the CPU where
@@ -99,6 +123,10 @@ typedef enum _ebpf_epoch_cpu_message_type
                                                      ///< future messages should be ignored.
     EBPF_EPOCH_CPU_MESSAGE_TYPE_IS_FREE_LIST_EMPTY,  ///< This message is sent to each CPU to query if its local free
                                                      ///< list is empty.
+    EBPF_EPOCH_CPU_MESSAGE_TYPE_REPORT_RELEASE_EPOCH, ///< This message is sent from a CPU to its parent in the CPU tree
+                                                      ///< with the minimum epoch of the CPU's subtree.
+    EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_COMPLETE, ///< This message is sent from a CPU to its parent in the CPU tree once
+                                                 ///< the CPU's subtree has committed the release epoch.
 } ebpf_epoch_cpu_message_type_t;
 
 /**
@@ -136,6 +164,45 @@ typedef struct _ebpf_epoch_cpu_message
     KEVENT completion_event; ///< Event to signal when the operation is complete.
 } ebpf_epoch_cpu_message_t;
 
+/**
+ * @brief Per-CPU messages used to pass the release epoch computation along the edges of the CPU tree.
+ * A message is only reused once the CPU it was sent to has processed it, so one pair of messages per CPU is sufficient.
+ */
+typedef __declspec(align(EBPF_CACHE_LINE_SIZE)) struct _ebpf_epoch_tree_node
+{
+    ebpf_epoch_cpu_message_t parent_message; ///< Message sent to this CPU by its parent.
+    ebpf_epoch_cpu_message_t child_message;  ///< Message sent by this CPU to its parent.
+} ebpf_epoch_tree_node_t;
+
+/**
+ * @brief Table of per-CPU tree messages.
+ */
+static _Writable_elements_(_ebpf_epoch_cpu_count) ebpf_epoch_tree_node_t* _ebpf_epoch_tree_table = NULL;
+
+/**
+ * @brief State of the release epoch computation. Only accessed by CPU 0 at IRQL DISPATCH_LEVEL.
+ */
+static struct
+{
+    LIST_ENTRY waiters;                              ///< Requests that will be completed by the current round.
+    LIST_ENTRY pending_waiters;                      ///< Requests that arrived while a round was in progress.
+    bool in_progress;                                ///< Set if a round is in progress.
+    ebpf_work_queue_wakeup_behavior_t wake_behavior; ///< Wake behavior of the messages sent in the current round.
+    uint64_t start_time;                             ///< Time since boot (in 100ns units) when the round started.
+} _ebpf_epoch_round;
+
+/**
+ * @brief Statistics about completed release epoch computations. Only written by CPU 0.
+ */
+static struct
+{
+    volatile int64_t round_count;            ///< Number of completed rounds.
+    volatile int64_t last_round_duration;    ///< Duration of the most recent round in 100ns units.
+    volatile int64_t maximum_round_duration; ///< Duration of the slowest round in 100ns units.
+    volatile int64_t total_round_duration;   ///< Sum of the duration of all rounds in 100ns units.
+    volatile int64_t last_released_epoch;    ///< Newest epoch released by the most recent round.
+} _ebpf_epoch_round_statistics;
+
 /**
  * @brief Timer used to schedule epoch computation.
  */
@@ -225,6 +292,21 @@ static _IRQL_requires_(DISPATCH_LEVEL) void _ebpf_epoch_arm_timer_if_needed(ebpf
 static void
 _ebpf_epoch_work_item_callback(_In_ cxplat_preemptible_work_item_t* preemptible_work_item, void* context);
 
+_IRQL_requires_(DISPATCH_LEVEL) static void _ebpf_epoch_compute_release_epoch_complete(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry);
+
+void
+_ebpf_epoch_messenger_report_release_epoch(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_opt_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu);
+
+void
+_ebpf_epoch_messenger_commit_release_epoch(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu);
+
+void
+_ebpf_epoch_messenger_commit_complete(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_opt_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu);
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_epoch_initiate()
 {
@@ -237,6 +319,8 @@ ebpf_epoch_initiate()
     cpu_count = ebpf_get_cpu_count();
 
     _ebpf_epoch_cpu_count = cpu_count;
+    _ebpf_epoch_tree_fanout =
+        _ebpf_epoch_requested_tree_fanout ? _ebpf_epoch_requested_tree_fanout : EBPF_EPOCH_TREE_FANOUT;
 
     _ebpf_epoch_cpu_table = cxplat_allocate(
         CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED,
@@ -249,6 +333,20 @@ ebpf_epoch_initiate()
 
     ebpf_assert(EBPF_CACHE_ALIGN_POINTER(_ebpf_epoch_cpu_table) == _ebpf_epoch_cpu_table);
 
+    _ebpf_epoch_tree_table = cxplat_allocate(
+        CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED,
+        sizeof(ebpf_epoch_tree_node_t) * _ebpf_epoch_cpu_count,
+        EBPF_POOL_TAG_EPOCH);
+    if (!_ebpf_epoch_tree_table) {
+        return_value = EBPF_NO_MEMORY;
+        goto Error;
+    }
+
+    ebpf_list_initialize(&_ebpf_epoch_round.waiters);
+    ebpf_list_initialize(&_ebpf_epoch_round.pending_waiters);
+    _ebpf_epoch_round.in_progress = false;
+    memset(&_ebpf_epoch_round_statistics, 0, sizeof(_ebpf_epoch_round_statistics));
+
     // Initialize the per-CPU state.
     for (uint32_t cpu_id = 0; cpu_id < _ebpf_epoch_cpu_count; cpu_id++) {
         ebpf_epoch_cpu_entry_t* cpu_entry = &_ebpf_epoch_cpu_table[cpu_id];
@@ -285,6 +383,9 @@ Error:
         cxplat_free(
             _ebpf_epoch_cpu_table, CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED, EBPF_POOL_TAG_EPOCH);
         _ebpf_epoch_cpu_table = NULL;
+        cxplat_free(
+            _ebpf_epoch_tree_table, CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED, EBPF_POOL_TAG_EPOCH);
+        _ebpf_epoch_tree_table = NULL;
     }
 
     EBPF_RETURN_RESULT(return_value);
@@ -323,10 +424,14 @@ ebpf_epoch_terminate()
     cxplat_wait_for_rundown_protection_release(&_ebpf_epoch_work_item_rundown_ref);
 
     _ebpf_epoch_cpu_count = 0;
+    _ebpf_epoch_requested_tree_fanout = 0;
 
     cxplat_free(
         _ebpf_epoch_cpu_table, CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED, EBPF_POOL_TAG_EPOCH);
     _ebpf_epoch_cpu_table = NULL;
+    cxplat_free(
+        _ebpf_epoch_tree_table, CXPLAT_POOL_FLAG_NON_PAGED | CXPLAT_POOL_FLAG_CACHE_ALIGNED, EBPF_POOL_TAG_EPOCH);
+    _ebpf_epoch_tree_table = NULL;
     EBPF_RETURN_VOID();
 }
 
@@ -539,13 +644,28 @@ _IRQL_requires_max_(PASSIVE_LEVEL) void ebpf_epoch_synchronize()
     KeInitializeEvent(&synchronization.event, NotificationEvent, false);
     _ebpf_epoch_insert_in_free_list(&synchronization.header);
 
+    ebpf_epoch_flush();
+
+    KeWaitForSingleObject(&synchronization.event, Executive, KernelMode, false, NULL);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL) void ebpf_epoch_flush()
+{
+    if (!_ebpf_epoch_cpu_table) {
+        return;
+    }
+
     // Trigger epoch computation.
     ebpf_epoch_cpu_message_t message = {0};
     message.message_type = EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_RELEASE_EPOCH;
     message.wake_behavior = EBPF_WORK_QUEUE_WAKEUP_ON_INSERT;
     _ebpf_epoch_send_message_and_wait(&message, 0);
+}
 
-    KeWaitForSingleObject(&synchronization.event, Executive, KernelMode, false, NULL);
+void
+ebpf_epoch_set_tree_fanout(uint32_t fanout)
+{
+    _ebpf_epoch_requested_tree_fanout = fanout;
 }
 
 bool
@@ -561,6 +681,32 @@ ebpf_epoch_is_free_list_empty(uint32_t cpu_id)
     return message.message.is_free_list_empty.is_empty;
 }
 
+void
+ebpf_epoch_get_statistics(_Out_ ebpf_epoch_statistics_t* statistics)
+{
+    memset(statistics, 0, sizeof(*statistics));
+
+    if (!_ebpf_epoch_cpu_table) {
+        return;
+    }
+
+    statistics->round_count = (uint64_t)ReadNoFence64(&_ebpf_epoch_round_statistics.round_count);
+    statistics->last_round_duration = (uint64_t)ReadNoFence64(&_ebpf_epoch_round_statistics.last_round_duration);
+    statistics->maximum_round_duration = (uint64_t)ReadNoFence64(&_ebpf_epoch_round_statistics.maximum_round_duration);
+    statistics->total_round_duration = (uint64_t)ReadNoFence64(&_ebpf_epoch_round_statistics.total_round_duration);
+    statistics->last_released_epoch = (uint64_t)ReadNoFence64(&_ebpf_epoch_round_statistics.last_released_epoch);
+
+    // The per-CPU counters are owned by their CPU, so the totals are a best-effort snapshot.
+    for (uint32_t cpu_id = 0; cpu_id < _ebpf_epoch_cpu_count; cpu_id++) {
+        ebpf_epoch_cpu_entry_t* cpu_entry = &_ebpf_epoch_cpu_table[cpu_id];
+        uint64_t maximum_free_list_depth = (uint64_t)ReadNoFence64(&cpu_entry->maximum_free_list_depth);
+        statistics->free_list_depth += (uint64_t)ReadNoFence64(&cpu_entry->free_list_depth);
+        if (maximum_free_list_depth > statistics->maximum_free_list_depth) {
+            statistics->maximum_free_list_depth = maximum_free_list_depth;
+        }
+    }
+}
+
 /**
  * @brief Release any memory that is associated with expired epochs.
  * @param[in] cpu_entry CPU entry to release memory for.
@@ -578,6 +724,7 @@ _ebpf_epoch_release_free_list(_Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, int64_t
         header = CONTAINING_RECORD(entry, ebpf_epoch_allocation_header_t, list_entry);
         if (header->freed_epoch <= released_epoch) {
             ebpf_list_remove_entry(entry);
+            WriteNoFence64(&cpu_entry->free_list_depth, cpu_entry->free_list_depth - 1);
             PrefetchForWrite(entry->Flink->Flink);
             switch (header->entry_type) {
             case EBPF_EPOCH_ALLOCATION_MEMORY:
@@ -682,6 +829,10 @@ _ebpf_epoch_insert_in_free_list(_In_ ebpf_epoch_allocation_header_t* header)
     header->freed_epoch = cpu_entry->current_epoch;
 
     ebpf_list_insert_tail(&cpu_entry->free_list, &header->list_entry);
+    WriteNoFence64(&cpu_entry->free_list_depth, cpu_entry->free_list_depth + 1);
+    if (cpu_entry->free_list_depth > cpu_entry->maximum_free_list_depth) {
+        WriteNoFence64(&cpu_entry->maximum_free_list_depth, cpu_entry->free_list_depth);
+    }
 
     _ebpf_epoch_arm_timer_if_needed(cpu_entry);
 
@@ -736,44 +887,90 @@ typedef void (*ebpf_epoch_messenger_worker_t)(
     _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu);
 
 /**
- * @brief Compute the next proposed release epoch and send it to the next CPU.
- * Message first is sent to CPU 0.
- * CPU == 0 declares the new current epoch and proposes it as the release epoch.
- * CPU != 0 sets current epoch to the new current epoch.
- * Each CPU then queries the epoch for each thread queued on that CPU and sets the proposed release epoch in the message
- * to the minimum of the local minima and the minima in the message. The message is then forwarded to the next CPU. Non
- * last CPU forwards the message to the next CPU. The last CPU then sends an
- * EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_RELEASE_EPOCH message to CPU 0 with the final proposed release epoch.
+ * @brief Get the parent of a CPU in the release epoch computation tree.
+ *
+ * @param[in] cpu_id CPU to get the parent of. Must not be CPU 0.
+ * @return Parent CPU.
+ */
+static uint32_t
+_ebpf_epoch_tree_parent(uint32_t cpu_id)
+{
+    ebpf_assert(cpu_id != 0);
+    return (cpu_id - 1) / _ebpf_epoch_tree_fanout;
+}
+
+/**
+ * @brief Send a message to each child of a CPU in the release epoch computation tree.
+ * The message sent to each child is the child's parent_message, initialized from the template.
+ *
+ * @param[in] cpu_id CPU whose children receive the message.
+ * @param[in] template_message Message to copy the type, wake behavior, and payload from.
+ * @return Number of children the message was sent to.
+ */
+static uint32_t
+_ebpf_epoch_tree_send_to_children(uint32_t cpu_id, _In_ const ebpf_epoch_cpu_message_t* template_message)
+{
+    uint32_t child_count = 0;
+    uint64_t first_child = (uint64_t)cpu_id * _ebpf_epoch_tree_fanout + 1;
+    uint64_t last_child = min(first_child + _ebpf_epoch_tree_fanout, (uint64_t)_ebpf_epoch_cpu_count);
+
+    for (uint64_t child = first_child; child < last_child; child++) {
+        ebpf_epoch_cpu_message_t* message = &_ebpf_epoch_tree_table[child].parent_message;
+        message->message_type = template_message->message_type;
+        message->wake_behavior = template_message->wake_behavior;
+        message->message = template_message->message;
+        child_count++;
+        _ebpf_epoch_send_message_async(message, (uint32_t)child);
+    }
+
+    return child_count;
+}
+
+/**
+ * @brief Send a message from a CPU to its parent in the release epoch computation tree.
+ *
+ * @param[in] cpu_id CPU sending the message. Must not be CPU 0.
+ * @param[in] message_type Type of message to send.
+ * @param[in] wake_behavior Wake behavior of the current round.
+ * @param[in] minimum_epoch Minimum epoch of the CPU's subtree.
+ */
+static void
+_ebpf_epoch_tree_send_to_parent(
+    uint32_t cpu_id,
+    ebpf_epoch_cpu_message_type_t message_type,
+    ebpf_work_queue_wakeup_behavior_t wake_behavior,
+    uint64_t minimum_epoch)
+{
+    ebpf_epoch_cpu_message_t* message = &_ebpf_epoch_tree_table[cpu_id].child_message;
+    message->message_type = message_type;
+    message->wake_behavior = wake_behavior;
+    message->message.propose_epoch.proposed_release_epoch = minimum_epoch;
+    _ebpf_epoch_send_message_async(message, _ebpf_epoch_tree_parent(cpu_id));
+}
+
+/**
+ * @brief Propose the new current epoch to this CPU's subtree and compute the local minimum epoch.
+ * The proposal is forwarded to the children before the local thread list is walked so the subtrees proceed in
+ * parallel. If the CPU has no children, its minimum epoch is reported immediately.
  *
  * @param[in] cpu_entry CPU entry to compute the epoch for.
- * @param[in] message Message to process.
  * @param[in] current_cpu Current CPU.
+ * @param[in] message Proposal containing the new current epoch.
  */
-void
-_ebpf_epoch_messenger_propose_release_epoch(
-    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu)
+static void
+_ebpf_epoch_tree_propose(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, uint32_t current_cpu, _In_ const ebpf_epoch_cpu_message_t* message)
 {
-    // Walk over each thread_entry in the epoch_state_list and compute the minimum epoch.
     ebpf_list_entry_t* entry = cpu_entry->epoch_state_list.Flink;
     ebpf_epoch_state_t* epoch_state;
-    uint32_t next_cpu;
+    uint64_t minimum_epoch = message->message.propose_epoch.current_epoch;
 
-    // First CPU updates the current epoch and proposes the release epoch.
-    if (current_cpu == 0) {
-        cpu_entry->current_epoch++;
-        message->message.propose_epoch.current_epoch = cpu_entry->current_epoch;
-        message->message.propose_epoch.proposed_release_epoch = cpu_entry->current_epoch;
-    }
-    // Other CPUs update the current epoch.
-    else {
-        cpu_entry->current_epoch = message->message.propose_epoch.current_epoch;
-    }
+    cpu_entry->current_epoch = message->message.propose_epoch.current_epoch;
 
     // Put a memory barrier here to ensure that the write is not re-ordered.
     MemoryBarrier();
 
-    // Previous CPU's minimum epoch.
-    uint64_t minimum_epoch = message->message.propose_epoch.proposed_release_epoch;
+    cpu_entry->tree_pending_children = _ebpf_epoch_tree_send_to_children(current_cpu, message);
 
     while (entry != &cpu_entry->epoch_state_list) {
         epoch_state = CONTAINING_RECORD(entry, ebpf_epoch_state_t, epoch_list_entry);
@@ -781,33 +978,124 @@ _ebpf_epoch_messenger_propose_release_epoch(
         entry = entry->Flink;
     }
 
-    // Set the proposed release epoch to the minimum epoch seen so far.
-    message->message.propose_epoch.proposed_release_epoch = minimum_epoch;
+    // Children reply through this CPU's work queue, so none of them can have reported yet.
+    cpu_entry->tree_minimum_epoch = minimum_epoch;
 
-    // If this is the last CPU, then send a message to the first CPU to commit the release epoch.
-    if (current_cpu == _ebpf_epoch_cpu_count - 1) {
-        message->message.commit_epoch.released_epoch = minimum_epoch;
-        message->message_type = EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_RELEASE_EPOCH;
-        next_cpu = 0;
-    } else {
-        // Send the message to the next CPU.
-        next_cpu = current_cpu + 1;
+    if (cpu_entry->tree_pending_children == 0) {
+        _ebpf_epoch_messenger_report_release_epoch(cpu_entry, NULL, current_cpu);
     }
+}
 
-    _ebpf_epoch_send_message_async(message, next_cpu);
+/**
+ * @brief Start a new round of release epoch computation on CPU 0.
+ * All pending requests are attached to the round. If any request is waiting synchronously, the round's messages wake
+ * the target CPU on insert rather than waiting for the work queue timer.
+ *
+ * @param[in] cpu_entry CPU entry for CPU 0.
+ */
+_IRQL_requires_(DISPATCH_LEVEL) static void _ebpf_epoch_start_release_epoch_computation(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry)
+{
+    ebpf_epoch_cpu_message_t proposal = {0};
+    proposal.message_type = EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_RELEASE_EPOCH;
+
+    _ebpf_epoch_round.wake_behavior = EBPF_WORK_QUEUE_WAKEUP_ON_TIMER;
+    while (!ebpf_list_is_empty(&_ebpf_epoch_round.pending_waiters)) {
+        ebpf_list_entry_t* entry = _ebpf_epoch_round.pending_waiters.Flink;
+        ebpf_epoch_cpu_message_t* waiter = CONTAINING_RECORD(entry, ebpf_epoch_cpu_message_t, list_entry);
+        ebpf_list_remove_entry(entry);
+        if (waiter->wake_behavior == EBPF_WORK_QUEUE_WAKEUP_ON_INSERT) {
+            _ebpf_epoch_round.wake_behavior = EBPF_WORK_QUEUE_WAKEUP_ON_INSERT;
+        }
+        ebpf_list_insert_tail(&_ebpf_epoch_round.waiters, entry);
+    }
+
+    proposal.wake_behavior = _ebpf_epoch_round.wake_behavior;
+    _ebpf_epoch_round.in_progress = true;
+    _ebpf_epoch_round.start_time = cxplat_query_time_since_boot_precise(false);
+
+    // CPU 0 declares the new current epoch and proposes it as the release epoch.
+    proposal.message.propose_epoch.current_epoch = cpu_entry->current_epoch + 1;
+    _ebpf_epoch_tree_propose(cpu_entry, 0, &proposal);
+}
+
+/**
+ * @brief Propose a new release epoch.
+ * On CPU 0 the message is a request for a new round of release epoch computation from either the timer or
+ * ebpf_epoch_synchronize. The request is attached to the next round, which starts immediately unless a round is already
+ * in progress.
+ * On other CPUs the message was sent by the CPU's parent in the CPU tree. The CPU sets its current epoch to the new
+ * current epoch, forwards the proposal to its children, and computes the minimum epoch of the threads queued on it.
+ *
+ * @param[in] cpu_entry CPU entry to compute the epoch for.
+ * @param[in] message Message to process.
+ * @param[in] current_cpu Current CPU.
+ */
+void
+_ebpf_epoch_messenger_propose_release_epoch(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu)
+{
+    if (current_cpu == 0) {
+        ebpf_list_insert_tail(&_ebpf_epoch_round.pending_waiters, &message->list_entry);
+        if (!_ebpf_epoch_round.in_progress) {
+            _ebpf_epoch_start_release_epoch_computation(cpu_entry);
+        }
+        return;
+    }
+
+    _ebpf_epoch_tree_propose(cpu_entry, current_cpu, message);
+}
+
+/**
+ * @brief Merge a child's minimum epoch into this CPU's subtree minimum.
+ * EBPF_EPOCH_CPU_MESSAGE_TYPE_REPORT_RELEASE_EPOCH message:
+ * Message is sent from a CPU to its parent once the minimum epoch of the CPU's subtree is known.
+ * Once every child has reported, a CPU other than CPU 0 reports its subtree minimum to its parent. CPU 0 instead
+ * commits the minimum as the release epoch.
+ *
+ * @param[in] cpu_entry CPU entry to merge the minimum into.
+ * @param[in] message Message to process, or NULL if the CPU has no children.
+ * @param[in] current_cpu Current CPU.
+ */
+void
+_ebpf_epoch_messenger_report_release_epoch(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_opt_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu)
+{
+    if (message) {
+        cpu_entry->tree_minimum_epoch =
+            min(cpu_entry->tree_minimum_epoch, message->message.propose_epoch.proposed_release_epoch);
+        ebpf_assert(cpu_entry->tree_pending_children > 0);
+        if (--cpu_entry->tree_pending_children != 0) {
+            return;
+        }
+    }
+
+    if (current_cpu != 0) {
+        _ebpf_epoch_tree_send_to_parent(
+            current_cpu,
+            EBPF_EPOCH_CPU_MESSAGE_TYPE_REPORT_RELEASE_EPOCH,
+            _ebpf_epoch_tree_table[current_cpu].parent_message.wake_behavior,
+            cpu_entry->tree_minimum_epoch);
+        return;
+    }
+
+    ebpf_epoch_cpu_message_t commit = {0};
+    commit.message_type = EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_RELEASE_EPOCH;
+    commit.wake_behavior = _ebpf_epoch_round.wake_behavior;
+    commit.message.commit_epoch.released_epoch = cpu_entry->tree_minimum_epoch;
+    _ebpf_epoch_messenger_commit_release_epoch(cpu_entry, &commit, current_cpu);
 }
 
 /**
- * @brief Commit the release epoch and send it to the next CPU.
- * Message is sent to CPU 0.
- * Each CPU sets its released epoch to the proposed release epoch minus 1.
+ * @brief Commit the release epoch and send it to this CPU's children.
+ * Message is sent from a CPU to each of its children in the CPU tree, starting at CPU 0.
  * Each CPU then:
  * 1. Clears the timer-armed flag.
  * 2. Sets the released epoch to the proposed release epoch minus 1.
- * 3. Releases any items in the free list that are eligible for reclamation.
- * 4. Rearms the timer if need.
- * 5. Forwards the message to the next CPU.
- * The last CPU then sends a EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_EPOCH_COMPLETE message to CPU 0.
+ * 3. Forwards the message to its children.
+ * 4. Releases any items in the free list that are eligible for reclamation.
+ * 5. Rearms the timer if need.
+ * A CPU with no children acknowledges the commit to its parent immediately.
  *
  * @param[in] cpu_entry CPU entry to rearm the timer for.
  * @param[in] message Message to process.
@@ -817,30 +1105,57 @@ void
 _ebpf_epoch_messenger_commit_release_epoch(
     _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu)
 {
-    uint32_t next_cpu;
-
     cpu_entry->timer_armed = false;
     // Set the released_epoch to the value computed by the EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_RELEASE_EPOCH message.
     cpu_entry->released_epoch = message->message.commit_epoch.released_epoch - 1;
 
-    // If this is the last CPU, send the message to the first CPU to complete the cycle.
-    if (current_cpu != _ebpf_epoch_cpu_count - 1) {
-        // Send the message to the next CPU.
-        next_cpu = current_cpu + 1;
-    } else {
-        message->message_type = EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_EPOCH_COMPLETE;
-        next_cpu = 0;
+    cpu_entry->tree_pending_children = _ebpf_epoch_tree_send_to_children(current_cpu, message);
+
+    _ebpf_epoch_release_free_list(cpu_entry, cpu_entry->released_epoch);
+
+    if (cpu_entry->tree_pending_children == 0) {
+        _ebpf_epoch_messenger_commit_complete(cpu_entry, NULL, current_cpu);
     }
+}
 
-    _ebpf_epoch_send_message_async(message, next_cpu);
+/**
+ * @brief Record that a child's subtree has committed the release epoch.
+ * EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_COMPLETE message:
+ * Message is sent from a CPU to its parent once the CPU's subtree has committed the release epoch.
+ * Once every child has acknowledged, a CPU other than CPU 0 acknowledges the commit to its parent. CPU 0 instead
+ * completes the round.
+ *
+ * @param[in] cpu_entry CPU entry to record the acknowledgement for.
+ * @param[in] message Message to process, or NULL if the CPU has no children.
+ * @param[in] current_cpu Current CPU.
+ */
+void
+_ebpf_epoch_messenger_commit_complete(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry, _Inout_opt_ ebpf_epoch_cpu_message_t* message, uint32_t current_cpu)
+{
+    if (message) {
+        ebpf_assert(cpu_entry->tree_pending_children > 0);
+        if (--cpu_entry->tree_pending_children != 0) {
+            return;
+        }
+    }
 
-    _ebpf_epoch_release_free_list(cpu_entry, cpu_entry->released_epoch);
+    if (current_cpu != 0) {
+        _ebpf_epoch_tree_send_to_parent(
+            current_cpu,
+            EBPF_EPOCH_CPU_MESSAGE_TYPE_COMMIT_COMPLETE,
+            _ebpf_epoch_tree_table[current_cpu].parent_message.wake_behavior,
+            cpu_entry->tree_minimum_epoch);
+        return;
+    }
+
+    _ebpf_epoch_compute_release_epoch_complete(cpu_entry);
 }
 
 /**
  * @brief Complete the release epoch computation and allow the next epoch computation to start.
  * EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_EPOCH_COMPLETE message:
- * Message is sent only to CPU 0.
+ * Message is completed only on CPU 0, once for each request attached to the round.
  * CPU 0 clears the epoch computation in progress flag and signals the KEVENT associated with the message to signal any
  * waiting threads that the operation is completed.
  *
@@ -862,6 +1177,42 @@ _ebpf_epoch_messenger_compute_epoch_complete(
     }
 }
 
+/**
+ * @brief Finish the current round on CPU 0.
+ * Records the round duration, completes every request attached to the round, and starts a new round if requests
+ * arrived while this one was in progress.
+ *
+ * @param[in] cpu_entry CPU entry for CPU 0.
+ */
+_IRQL_requires_(DISPATCH_LEVEL) static void _ebpf_epoch_compute_release_epoch_complete(
+    _Inout_ ebpf_epoch_cpu_entry_t* cpu_entry)
+{
+    int64_t duration = (int64_t)(cxplat_query_time_since_boot_precise(false) - _ebpf_epoch_round.start_time);
+
+    WriteNoFence64(&_ebpf_epoch_round_statistics.last_round_duration, duration);
+    if (duration > _ebpf_epoch_round_statistics.maximum_round_duration) {
+        WriteNoFence64(&_ebpf_epoch_round_statistics.maximum_round_duration, duration);
+    }
+    WriteNoFence64(
+        &_ebpf_epoch_round_statistics.total_round_duration,
+        _ebpf_epoch_round_statistics.total_round_duration + duration);
+    WriteNoFence64(&_ebpf_epoch_round_statistics.last_released_epoch, cpu_entry->released_epoch);
+    WriteNoFence64(&_ebpf_epoch_round_statistics.round_count, _ebpf_epoch_round_statistics.round_count + 1);
+
+    _ebpf_epoch_round.in_progress = false;
+
+    while (!ebpf_list_is_empty(&_ebpf_epoch_round.waiters)) {
+        ebpf_list_entry_t* entry = _ebpf_epoch_round.waiters.Flink;
+        ebpf_epoch_cpu_message_t* waiter = CONTAINING_RECORD(entry, ebpf_epoch_cpu_message_t, list_entry);
+        ebpf_list_remove_entry(entry);
+        waiter->message_type = EBPF_EPOCH_CPU_MESSAGE_TYPE_PROPOSE_EPOCH_COMPLETE;
+        _ebpf_epoch_messenger_compute_epoch_complete(cpu_entry, waiter, 0);
+    }
+
+    if (!ebpf_list_is_empty(&_ebpf_epoch_round.pending_waiters)) {
+        _ebpf_epoch_start_release_epoch_computation(cpu_entry);
+    }
+}
 /**
  * @brief Remove the provided thread from this CPU's thread list and signal the completion event.
  * EBPF_EPOCH_CPU_MESSAGE_TYPE_EXIT_EPOCH message:
@@ -942,7 +1293,9 @@ static ebpf_epoch_messenger_worker_t _ebpf_epoch_messenger_workers[] = {
     _ebpf_epoch_messenger_compute_epoch_complete,
     _ebpf_epoch_messenger_exit_epoch,
     _ebpf_epoch_messenger_rundown_in_progress,
-    _ebpf_epoch_messenger_is_free_list_empty};
+    _ebpf_epoch_messenger_is_free_list_empty,
+    _ebpf_epoch_messenger_report_release_epoch,
+    _ebpf_epoch_messenger_commit_complete};
 
 /**
  * @brief Worker for the ebpf epoch inter-CPU messaging system.
@@ -19,6 +19,17 @@ extern "C"
         KIRQL irql_at_enter;         /// The IRQL when this entry was added to the list.
     } ebpf_epoch_state_t;
 
+    typedef struct _ebpf_epoch_statistics
+    {
+        uint64_t round_count;             /// Number of completed release epoch computations.
+        uint64_t last_round_duration;     /// Duration of the most recent computation in 100ns units.
+        uint64_t maximum_round_duration;  /// Duration of the slowest computation in 100ns units.
+        uint64_t total_round_duration;    /// Sum of the duration of all computations in 100ns units.
+        uint64_t last_released_epoch;     /// Newest epoch released by the most recent computation.
+        uint64_t free_list_depth;         /// Number of items waiting to be released across all CPUs.
+        uint64_t maximum_free_list_depth; /// Largest number of items observed in any single CPU's free list.
+    } ebpf_epoch_statistics_t;
+
     /**
      * @brief Initialize the eBPF epoch tracking module.
      *
@@ -94,6 +105,12 @@ extern "C"
      */
     _IRQL_requires_max_(PASSIVE_LEVEL) void ebpf_epoch_synchronize();
 
+    /**
+     * @brief Run a release epoch computation and wait for it to complete. Unlike ebpf_epoch_synchronize, this doesn't
+     * wait for memory freed by the caller to be released.
+     */
+    _IRQL_requires_max_(PASSIVE_LEVEL) void ebpf_epoch_flush();
+
     /**
      * @brief Allocate an epoch work item; a work item that can be scheduled to
      * run when the current epoch ends. Allocated work items must either be
@@ -135,6 +152,25 @@ extern "C"
     bool
     ebpf_epoch_is_free_list_empty(uint32_t cpu_id);
 
+    /**
+     * @brief Get statistics about release epoch computation and the per-CPU free lists.
+     * The values are read without synchronizing with the CPUs that update them.
+     *
+     * @param[out] statistics Statistics about epoch based memory reclamation.
+     */
+    void
+    ebpf_epoch_get_statistics(_Out_ ebpf_epoch_statistics_t* statistics);
+
+    /**
+     * @brief Override the number of children of each CPU in the release epoch computation tree. Used by tests to build
+     * a deeper tree than the CPU count would otherwise produce. Takes effect at the next ebpf_epoch_initiate and is
+     * reset by ebpf_epoch_terminate.
+     *
+     * @param[in] fanout Number of children of each CPU, or 0 for the default.
+     */
+    void
+    ebpf_epoch_set_tree_fanout(uint32_t fanout);
+
 #ifdef __cplusplus
 }
 #endif
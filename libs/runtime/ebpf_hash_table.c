@@ -48,13 +48,47 @@ typedef struct _ebpf_hash_bucket_header_and_lock
 } ebpf_hash_bucket_header_and_lock_t;
 
 /**
- * @brief The ebpf_hash_table_t structure represents a hash table. It contains an array of pointers to buckets and a
- * a per bucket lock.
+ * @brief An array of buckets. A hash table normally has a single bucket array. While the table is being resized, the
+ * current bucket array points to the array its entries are being migrated to. Buckets that have been migrated are
+ * replaced with EBPF_HASH_BUCKET_MIGRATED and readers and writers follow the next pointer to find the entry.
+ */
+typedef struct _ebpf_hash_bucket_array
+{
+    size_t bucket_count;                   // Count of buckets.
+    size_t bucket_count_mask;              // Mask to use to get bucket index from hash.
+    struct _ebpf_hash_bucket_array* next;  // Bucket array being migrated to or NULL if no resize is in progress.
+    _Field_size_(bucket_count) ebpf_hash_bucket_header_and_lock_t buckets[1]; // Array of buckets.
+} ebpf_hash_bucket_array_t;
+
+/**
+ * @brief Placeholder stored in a bucket once its entries have been moved to the next bucket array. It has no entries,
+ * so code that doesn't follow migrated buckets sees it as empty.
+ */
+static ebpf_hash_bucket_header_t _ebpf_hash_bucket_migrated = {0};
+#define EBPF_HASH_BUCKET_MIGRATED (&_ebpf_hash_bucket_migrated)
+
+/**
+ * @brief Number of buckets moved to the new bucket array by each insert or delete while a resize is in progress.
+ */
+#define EBPF_HASH_TABLE_RESIZE_BUCKETS_PER_STEP 16
+
+/**
+ * @brief Number of keys ebpf_hash_table_find_batch hashes and prefetches before it starts searching buckets.
+ */
+#define EBPF_HASH_TABLE_FIND_BATCH_SIZE 16
+
+/**
+ * @brief Largest bucket array a resize will create. Bucket indexes are derived from a 32-bit hash.
+ */
+#define EBPF_HASH_TABLE_MAXIMUM_BUCKET_COUNT ((size_t)1 << 31)
+
+/**
+ * @brief The ebpf_hash_table_t structure represents a hash table. It contains a pointer to the current bucket array
+ * and the state needed to resize it.
  */
 struct _ebpf_hash_table
 {
-    size_t bucket_count;      // Count of buckets.
-    size_t bucket_count_mask; // Mask to use to get bucket index from hash.
+    ebpf_hash_bucket_array_t* buckets; // Current bucket array.
     volatile size_t
         entry_count; // Count of entries in the hash table. Only valid if max_entry_count != EBPF_HASH_TABLE_NO_LIMIT.
     size_t max_entry_count;            // Maximum number of entries allowed or EBPF_HASH_TABLE_NO_LIMIT if no maximum.
@@ -69,7 +103,14 @@ struct _ebpf_hash_table
 
     void* notification_context; //< Context to pass to notification functions.
     ebpf_hash_table_notification_function notification_callback;
-    _Field_size_(bucket_count) ebpf_hash_bucket_header_and_lock_t buckets[1]; // Pointer to array of buckets.
+
+    size_t minimum_bucket_count;       // The bucket array is never shrunk below this size.
+    size_t grow_load_factor_percent;   // Grow when entries exceed this percentage of buckets. 0 disables resizing.
+    size_t shrink_load_factor_percent; // Shrink when entries fall below this percentage of buckets. 0 never shrinks.
+    ebpf_lock_t resize_lock;           // Serializes starting, advancing, and completing a resize.
+    size_t migration_index;            // Next bucket of the current array to migrate. Protected by resize_lock.
+
+    bool update_in_place; // Overwrite the values of existing keys in place, guarded by a per-value sequence number.
 };
 
 typedef enum _ebpf_hash_bucket_operation
@@ -299,30 +340,31 @@ _ebpf_hash_table_compare(_In_ const ebpf_hash_table_t* hash_table, _In_ const ui
 
 /**
  * @brief Given a potentially non-comparable key value, extract the key and
- * compute the hash and convert it to a bucket index.
+ * compute the hash. The bucket index is the hash masked with the bucket
+ * array's bucket_count_mask.
  *
  * @param[in] hash_table Hash table the keys belong to.
  * @param[in] key Key to hash.
- * @return Bucket index.
+ * @return Hash of the key.
  */
 static uint32_t
-_ebpf_hash_table_compute_bucket_index(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* key)
+_ebpf_hash_table_compute_hash(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* key)
 {
     if (!hash_table->extract) {
 #if defined(_M_X64)
         if (ebpf_processor_supports_sse42) {
-            return _ebpf_compute_crc32(key, hash_table->key_size, hash_table->seed) & hash_table->bucket_count_mask;
+            return _ebpf_compute_crc32(key, hash_table->key_size, hash_table->seed);
         } else {
-            return _ebpf_murmur3_32(key, hash_table->key_size * 8, hash_table->seed) & hash_table->bucket_count_mask;
+            return _ebpf_murmur3_32(key, hash_table->key_size * 8, hash_table->seed);
         }
 #else
-        return _ebpf_murmur3_32(key, hash_table->key_size * 8, hash_table->seed) & hash_table->bucket_count_mask;
+        return _ebpf_murmur3_32(key, hash_table->key_size * 8, hash_table->seed);
 #endif
     } else {
         uint8_t* data;
         size_t length;
         hash_table->extract(key, &data, &length);
-        return _ebpf_murmur3_32(data, length, hash_table->seed) & hash_table->bucket_count_mask;
+        return _ebpf_murmur3_32(data, length, hash_table->seed);
     }
 }
 
@@ -344,30 +386,157 @@ _ebpf_hash_table_bucket_entry(size_t key_size, _In_ const ebpf_hash_bucket_heade
 }
 
 /**
- * @brief Helper function to ensure correct memory ordering when reading a bucket from the hash table.
+ * @brief Helper function to ensure correct memory ordering when reading a bucket from a bucket array.
  *
- * @param[in] hash_table Pointer to the hash table.
+ * @param[in] bucket_array Pointer to the bucket array.
  * @param[in] bucket_index Index of the bucket to read.
- * @return Pointer to the bucket or NULL if the bucket is empty.
+ * @return Pointer to the bucket, NULL if the bucket is empty, or EBPF_HASH_BUCKET_MIGRATED.
  */
 static inline ebpf_hash_bucket_header_t*
-_ebpf_hash_table_get_bucket(_In_ const ebpf_hash_table_t* hash_table, size_t bucket_index)
+_ebpf_hash_table_get_bucket(_In_ const ebpf_hash_bucket_array_t* bucket_array, size_t bucket_index)
 {
-    return (ebpf_hash_bucket_header_t*)ReadSizeTAcquire((ULONG_PTR*)&(hash_table->buckets[bucket_index].header));
+    return (ebpf_hash_bucket_header_t*)ReadSizeTAcquire((ULONG_PTR*)&(bucket_array->buckets[bucket_index].header));
 }
 
 /**
- * @brief Helper function to ensure correct memory ordering when writing a bucket to the hash table.
+ * @brief Helper function to ensure correct memory ordering when writing a bucket to a bucket array.
  *
- * @param[in] hash_table Pointer to the hash table.
+ * @param[in] bucket_array Pointer to the bucket array.
  * @param[in] bucket_index Index of the bucket to write.
  * @param[in] bucket Bucket pointer to write.
  */
 static inline void
 _ebpf_hash_table_set_bucket(
-    _In_ ebpf_hash_table_t* hash_table, size_t bucket_index, _In_opt_ ebpf_hash_bucket_header_t* bucket)
+    _Inout_ ebpf_hash_bucket_array_t* bucket_array, size_t bucket_index, _In_opt_ ebpf_hash_bucket_header_t* bucket)
+{
+    WriteSizeTRelease((ULONG_PTR*)&(bucket_array->buckets[bucket_index].header), (ULONG_PTR)bucket);
+}
+
+/**
+ * @brief Read the current bucket array of the hash table.
+ *
+ * @param[in] hash_table Pointer to the hash table.
+ * @return Pointer to the current bucket array.
+ */
+static inline ebpf_hash_bucket_array_t*
+_ebpf_hash_table_get_bucket_array(_In_ const ebpf_hash_table_t* hash_table)
+{
+    return (ebpf_hash_bucket_array_t*)ReadSizeTAcquire((ULONG_PTR*)&hash_table->buckets);
+}
+
+/**
+ * @brief Read the bucket array that a bucket array is being migrated to.
+ *
+ * @param[in] bucket_array Pointer to the bucket array.
+ * @return Pointer to the next bucket array or NULL if no resize is in progress.
+ */
+static inline ebpf_hash_bucket_array_t*
+_ebpf_hash_table_get_next_bucket_array(_In_ const ebpf_hash_bucket_array_t* bucket_array)
+{
+    return (ebpf_hash_bucket_array_t*)ReadSizeTAcquire((ULONG_PTR*)&bucket_array->next);
+}
+
+/**
+ * @brief Find the bucket that currently holds entries with the given hash, following migrated buckets.
+ *
+ * @param[in] hash_table Pointer to the hash table.
+ * @param[in] hash Hash of the key.
+ * @return Pointer to the bucket or NULL if the bucket is empty.
+ */
+static inline ebpf_hash_bucket_header_t*
+_ebpf_hash_table_find_bucket(_In_ const ebpf_hash_table_t* hash_table, uint32_t hash)
+{
+    const ebpf_hash_bucket_array_t* bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+    ebpf_hash_bucket_header_t* bucket =
+        _ebpf_hash_table_get_bucket(bucket_array, hash & bucket_array->bucket_count_mask);
+    while (bucket == EBPF_HASH_BUCKET_MIGRATED) {
+        bucket_array = _ebpf_hash_table_get_next_bucket_array(bucket_array);
+        bucket = _ebpf_hash_table_get_bucket(bucket_array, hash & bucket_array->bucket_count_mask);
+    }
+    return bucket;
+}
+
+/**
+ * @brief Allocate an empty bucket array.
+ *
+ * @param[in] hash_table Pointer to the hash table.
+ * @param[in] bucket_count Number of buckets, must be a power of 2.
+ * @return Pointer to the bucket array or NULL if memory allocation failed.
+ */
+static ebpf_hash_bucket_array_t*
+_ebpf_hash_table_allocate_bucket_array(_In_ const ebpf_hash_table_t* hash_table, size_t bucket_count)
+{
+    size_t array_size;
+    if (ebpf_safe_size_t_multiply(sizeof(ebpf_hash_bucket_header_and_lock_t), bucket_count, &array_size) !=
+            EBPF_SUCCESS ||
+        ebpf_safe_size_t_add(array_size, EBPF_OFFSET_OF(ebpf_hash_bucket_array_t, buckets), &array_size) !=
+            EBPF_SUCCESS) {
+        return NULL;
+    }
+
+    ebpf_hash_bucket_array_t* bucket_array = hash_table->allocate(array_size, hash_table->allocation_tag);
+    if (!bucket_array) {
+        return NULL;
+    }
+
+    bucket_array->bucket_count = bucket_count;
+    bucket_array->bucket_count_mask = bucket_count - 1;
+    bucket_array->next = NULL;
+    return bucket_array;
+}
+
+/**
+ * @brief Get the size of the allocation that holds a value. Values that are updated in place are followed by the
+ * sequence number that guards them.
+ *
+ * @param[in] hash_table Hash table.
+ * @return Size of a value allocation in bytes.
+ */
+static inline size_t
+_ebpf_hash_table_value_allocation_size(_In_ const ebpf_hash_table_t* hash_table)
 {
-    WriteSizeTRelease((ULONG_PTR*)&(hash_table->buckets[bucket_index].header), (ULONG_PTR)bucket);
+    if (hash_table->update_in_place) {
+        return EBPF_PAD_8(hash_table->value_size) + sizeof(int64_t);
+    }
+    return hash_table->value_size + hash_table->supplemental_value_size;
+}
+
+/**
+ * @brief Get the sequence number that guards a value that is updated in place. The sequence number is odd while an
+ * update is in progress.
+ *
+ * @param[in] hash_table Hash table.
+ * @param[in] data Value to get the sequence number of.
+ * @return Pointer to the sequence number.
+ */
+static inline volatile int64_t*
+_ebpf_hash_table_value_sequence(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* data)
+{
+    return (volatile int64_t*)(data + EBPF_PAD_8(hash_table->value_size));
+}
+
+/**
+ * @brief Overwrite an existing value without replacing its bucket. The caller must hold the lock of the bucket that
+ * contains the value, which serializes writers.
+ *
+ * @param[in] hash_table Hash table.
+ * @param[in, out] data Value to overwrite.
+ * @param[in] value New value or NULL to zero the value.
+ */
+static void
+_ebpf_hash_table_update_value_in_place(
+    _In_ const ebpf_hash_table_t* hash_table, _Inout_ uint8_t* data, _In_opt_ const uint8_t* value)
+{
+    volatile int64_t* sequence = _ebpf_hash_table_value_sequence(hash_table, data);
+
+    // Interlocked operations are full barriers, so the copy can't be reordered outside of the odd sequence number.
+    ebpf_interlocked_increment_int64(sequence);
+    if (value) {
+        memcpy(data, value, hash_table->value_size);
+    } else {
+        memset(data, 0, hash_table->value_size);
+    }
+    ebpf_interlocked_increment_int64(sequence);
 }
 
 /**
@@ -574,6 +743,294 @@ Done:
     return result;
 }
 
+/**
+ * @brief Free a bucket that has been replaced by a bucket with its own backup buckets. The values are owned by the
+ * replacement bucket and are not freed.
+ *
+ * @param[in] hash_table The hash table.
+ * @param[in] bucket The bucket to free.
+ */
+static void
+_ebpf_hash_table_free_bucket_and_backups(
+    _In_ const ebpf_hash_table_t* hash_table, _In_opt_ _Post_invalid_ ebpf_hash_bucket_header_t* bucket)
+{
+    if (!bucket) {
+        return;
+    }
+    for (size_t index = 0; index < bucket->count; index++) {
+        hash_table->free(_ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, index)->backup_bucket);
+    }
+    hash_table->free(bucket);
+}
+
+/**
+ * @brief Build a bucket containing every entry of existing_bucket plus the entries of source_bucket that hash to
+ * bucket_index in a bucket array with the given mask. Backup buckets are allocated for the new bucket so that later
+ * deletes can't fail.
+ * Caller must free the existing bucket and source bucket using _ebpf_hash_table_free_bucket_and_backups.
+ *
+ * @param[in] hash_table The hash table.
+ * @param[in] existing_bucket The immutable bucket already at bucket_index, if any.
+ * @param[in] source_bucket The immutable bucket being migrated.
+ * @param[in] bucket_count_mask Mask of the bucket array being migrated to.
+ * @param[in] bucket_index Index of the bucket in the bucket array being migrated to.
+ * @param[out] new_bucket The new bucket or NULL if it has no entries. On success the caller owns this memory.
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Unable to allocate resources for this operation.
+ */
+static ebpf_result_t
+_ebpf_hash_table_bucket_merge(
+    _In_ const ebpf_hash_table_t* hash_table,
+    _In_opt_ const ebpf_hash_bucket_header_t* existing_bucket,
+    _In_ const ebpf_hash_bucket_header_t* source_bucket,
+    size_t bucket_count_mask,
+    size_t bucket_index,
+    _Outptr_result_maybenull_ ebpf_hash_bucket_header_t** new_bucket)
+{
+    ebpf_result_t result;
+    size_t entry_size = EBPF_OFFSET_OF(ebpf_hash_bucket_entry_t, key) + hash_table->key_size;
+    size_t existing_count = existing_bucket ? existing_bucket->count : 0;
+    size_t count = existing_count;
+    ebpf_hash_bucket_header_t* local_new_bucket = NULL;
+
+    *new_bucket = NULL;
+
+    for (size_t index = 0; index < source_bucket->count; index++) {
+        const ebpf_hash_bucket_entry_t* entry =
+            _ebpf_hash_table_bucket_entry(hash_table->key_size, source_bucket, index);
+        if ((_ebpf_hash_table_compute_hash(hash_table, entry->key) & bucket_count_mask) == bucket_index) {
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        result = EBPF_SUCCESS;
+        goto Done;
+    }
+
+    local_new_bucket =
+        hash_table->allocate(entry_size * count + sizeof(ebpf_hash_bucket_header_t), hash_table->allocation_tag);
+    if (!local_new_bucket) {
+        result = EBPF_NO_MEMORY;
+        goto Done;
+    }
+
+    // Copy the existing entries followed by the entries that move to this bucket.
+    for (size_t index = 0; index < existing_count; index++) {
+        const ebpf_hash_bucket_entry_t* old_entry =
+            _ebpf_hash_table_bucket_entry(hash_table->key_size, existing_bucket, index);
+        ebpf_hash_bucket_entry_t* new_entry =
+            _ebpf_hash_table_bucket_entry(hash_table->key_size, local_new_bucket, local_new_bucket->count++);
+        new_entry->data = old_entry->data;
+        memcpy(new_entry->key, old_entry->key, hash_table->key_size);
+    }
+    for (size_t index = 0; index < source_bucket->count; index++) {
+        const ebpf_hash_bucket_entry_t* old_entry =
+            _ebpf_hash_table_bucket_entry(hash_table->key_size, source_bucket, index);
+        if ((_ebpf_hash_table_compute_hash(hash_table, old_entry->key) & bucket_count_mask) != bucket_index) {
+            continue;
+        }
+        ebpf_hash_bucket_entry_t* new_entry =
+            _ebpf_hash_table_bucket_entry(hash_table->key_size, local_new_bucket, local_new_bucket->count++);
+        new_entry->data = old_entry->data;
+        memcpy(new_entry->key, old_entry->key, hash_table->key_size);
+    }
+
+    // Bucket at index N > 0 should have a backup bucket of size N.
+    for (size_t index = 1; index < count; index++) {
+        ebpf_hash_bucket_header_t* backup_bucket =
+            hash_table->allocate(entry_size * index + sizeof(ebpf_hash_bucket_header_t), hash_table->allocation_tag);
+        if (!backup_bucket) {
+            result = EBPF_NO_MEMORY;
+            goto Done;
+        }
+        backup_bucket->count = index;
+        _ebpf_hash_table_bucket_entry(hash_table->key_size, local_new_bucket, index)->backup_bucket = backup_bucket;
+    }
+
+    *new_bucket = local_new_bucket;
+    local_new_bucket = NULL;
+    result = EBPF_SUCCESS;
+
+Done:
+    _ebpf_hash_table_free_bucket_and_backups(hash_table, local_new_bucket);
+    return result;
+}
+
+/**
+ * @brief Move the entries of one bucket to the bucket array the table is being resized to. Once the entries have been
+ * published in the new bucket array, the old bucket is replaced with EBPF_HASH_BUCKET_MIGRATED.
+ * Caller must hold the resize lock.
+ *
+ * @param[in] hash_table The hash table.
+ * @param[in, out] bucket_array The bucket array being migrated.
+ * @param[in] bucket_index Index of the bucket to migrate.
+ * @retval EBPF_SUCCESS The operation was successful.
+ * @retval EBPF_NO_MEMORY Unable to allocate resources for this operation. The bucket is left unmigrated.
+ */
+static ebpf_result_t
+_ebpf_hash_table_migrate_bucket(
+    _In_ const ebpf_hash_table_t* hash_table, _Inout_ ebpf_hash_bucket_array_t* bucket_array, size_t bucket_index)
+{
+    ebpf_result_t result = EBPF_SUCCESS;
+    ebpf_hash_bucket_array_t* next_array = bucket_array->next;
+    // Arrays are only ever doubled or halved, so a bucket migrates to at most two buckets.
+    size_t target_indexes[2];
+    ebpf_lock_state_t target_states[2];
+    ebpf_hash_bucket_header_t* existing_buckets[2] = {NULL, NULL};
+    ebpf_hash_bucket_header_t* new_buckets[2] = {NULL, NULL};
+    size_t target_count;
+    size_t target;
+
+    if (next_array->bucket_count > bucket_array->bucket_count) {
+        ebpf_assert(next_array->bucket_count == bucket_array->bucket_count * 2);
+        target_indexes[0] = bucket_index;
+        target_indexes[1] = bucket_index + bucket_array->bucket_count;
+        target_count = 2;
+    } else {
+        ebpf_assert(next_array->bucket_count * 2 == bucket_array->bucket_count);
+        target_indexes[0] = bucket_index & next_array->bucket_count_mask;
+        target_count = 1;
+    }
+
+    ebpf_lock_state_t state = ebpf_lock_lock(&bucket_array->buckets[bucket_index].lock);
+    ebpf_hash_bucket_header_t* old_bucket = _ebpf_hash_table_get_bucket(bucket_array, bucket_index);
+    ebpf_assert(old_bucket != EBPF_HASH_BUCKET_MIGRATED);
+
+    if (!old_bucket) {
+        _ebpf_hash_table_set_bucket(bucket_array, bucket_index, EBPF_HASH_BUCKET_MIGRATED);
+        ebpf_lock_unlock(&bucket_array->buckets[bucket_index].lock, state);
+        return EBPF_SUCCESS;
+    }
+
+    // Lock the target buckets. When shrinking, writers may be updating the target through a bucket that has already
+    // been migrated.
+    for (target = 0; target < target_count; target++) {
+        target_states[target] = ebpf_lock_lock(&next_array->buckets[target_indexes[target]].lock);
+    }
+
+    // Build every target bucket before publishing any of them, so a failed allocation leaves no copies of the entries
+    // in the new bucket array.
+    for (target = 0; target < target_count; target++) {
+        existing_buckets[target] = _ebpf_hash_table_get_bucket(next_array, target_indexes[target]);
+        result = _ebpf_hash_table_bucket_merge(
+            hash_table,
+            existing_buckets[target],
+            old_bucket,
+            next_array->bucket_count_mask,
+            target_indexes[target],
+            &new_buckets[target]);
+        if (result != EBPF_SUCCESS) {
+            break;
+        }
+    }
+
+    if (result == EBPF_SUCCESS) {
+        for (target = 0; target < target_count; target++) {
+            _ebpf_hash_table_set_bucket(next_array, target_indexes[target], new_buckets[target]);
+        }
+        // Readers that see the migrated marker will find the entries in the new bucket array.
+        _ebpf_hash_table_set_bucket(bucket_array, bucket_index, EBPF_HASH_BUCKET_MIGRATED);
+    }
+
+    for (target = target_count; target > 0; target--) {
+        ebpf_lock_unlock(&next_array->buckets[target_indexes[target - 1]].lock, target_states[target - 1]);
+    }
+    ebpf_lock_unlock(&bucket_array->buckets[bucket_index].lock, state);
+
+    for (target = 0; target < target_count; target++) {
+        if (result == EBPF_SUCCESS) {
+            _ebpf_hash_table_free_bucket_and_backups(hash_table, existing_buckets[target]);
+        } else {
+            _ebpf_hash_table_free_bucket_and_backups(hash_table, new_buckets[target]);
+        }
+    }
+    if (result == EBPF_SUCCESS) {
+        _ebpf_hash_table_free_bucket_and_backups(hash_table, old_bucket);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Compute the bucket count the load factor policy calls for.
+ *
+ * @param[in] hash_table The hash table.
+ * @param[in] bucket_count The current bucket count.
+ * @return The desired bucket count, which is bucket_count if no resize is needed.
+ */
+static inline size_t
+_ebpf_hash_table_target_bucket_count(_In_ const ebpf_hash_table_t* hash_table, size_t bucket_count)
+{
+    size_t entry_count = hash_table->entry_count;
+    if (entry_count * 100 > bucket_count * hash_table->grow_load_factor_percent &&
+        bucket_count < EBPF_HASH_TABLE_MAXIMUM_BUCKET_COUNT) {
+        return bucket_count * 2;
+    }
+    if (entry_count * 100 < bucket_count * hash_table->shrink_load_factor_percent &&
+        bucket_count > hash_table->minimum_bucket_count) {
+        return bucket_count / 2;
+    }
+    return bucket_count;
+}
+
+/**
+ * @brief Advance the resize state machine after an insert or delete. Starts a resize when the load factor policy calls
+ * for one, migrates up to EBPF_HASH_TABLE_RESIZE_BUCKETS_PER_STEP buckets of a resize in progress, and publishes the
+ * new bucket array once every bucket has been migrated. Readers are never blocked and allocation failures only delay
+ * the resize.
+ *
+ * @param[in, out] hash_table The hash table.
+ */
+static void
+_ebpf_hash_table_resize_step(_Inout_ ebpf_hash_table_t* hash_table)
+{
+    ebpf_hash_bucket_array_t* bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+
+    // Avoid the resize lock unless there is work to do.
+    if (!_ebpf_hash_table_get_next_bucket_array(bucket_array) &&
+        _ebpf_hash_table_target_bucket_count(hash_table, bucket_array->bucket_count) == bucket_array->bucket_count) {
+        return;
+    }
+
+    ebpf_lock_state_t state = ebpf_lock_lock(&hash_table->resize_lock);
+
+    // The current bucket array only changes while holding the resize lock.
+    bucket_array = hash_table->buckets;
+    if (!bucket_array->next) {
+        size_t bucket_count = _ebpf_hash_table_target_bucket_count(hash_table, bucket_array->bucket_count);
+        if (bucket_count == bucket_array->bucket_count) {
+            goto Done;
+        }
+        ebpf_hash_bucket_array_t* next_array = _ebpf_hash_table_allocate_bucket_array(hash_table, bucket_count);
+        if (!next_array) {
+            goto Done;
+        }
+        hash_table->migration_index = 0;
+        WriteSizeTRelease((ULONG_PTR*)&bucket_array->next, (ULONG_PTR)next_array);
+    }
+
+    for (size_t step = 0; step < EBPF_HASH_TABLE_RESIZE_BUCKETS_PER_STEP; step++) {
+        if (hash_table->migration_index == bucket_array->bucket_count) {
+            break;
+        }
+        if (_ebpf_hash_table_migrate_bucket(hash_table, bucket_array, hash_table->migration_index) != EBPF_SUCCESS) {
+            break;
+        }
+        hash_table->migration_index++;
+    }
+
+    if (hash_table->migration_index == bucket_array->bucket_count) {
+        // Every bucket has been migrated. Readers still holding the old bucket array follow the migrated markers until
+        // the epoch releases it.
+        WriteSizeTRelease((ULONG_PTR*)&hash_table->buckets, (ULONG_PTR)bucket_array->next);
+        hash_table->free(bucket_array);
+    }
+
+Done:
+    ebpf_lock_unlock(&hash_table->resize_lock, state);
+}
+
 /**
  * @brief Perform an atomic replacement of a bucket in the hash table.
  * Operations include insert, update and delete of elements.
@@ -582,6 +1039,7 @@ Done:
  * @param[in] key Key to operate on.
  * @param[in] value Value to be inserted or NULL.
  * @param[in] operation Operation to perform.
+ * @param[out] inserted Optionally set to true if the operation inserted a new key, false otherwise.
  * @retval EBPF_SUCCESS The operation succeeded.
  * @retval EBPF_KEY_NOT_FOUND The specified key is not present in the bucket.
  * @retval EBPF_NO_MEMORY Insufficient memory to construct new bucket or value.
@@ -592,27 +1050,68 @@ _ebpf_hash_table_replace_bucket(
     _Inout_ ebpf_hash_table_t* hash_table,
     _In_ const uint8_t* key,
     _In_opt_ const uint8_t* value,
-    ebpf_hash_bucket_operation_t operation)
+    ebpf_hash_bucket_operation_t operation,
+    _Out_opt_ bool* inserted)
 {
     ebpf_result_t result = EBPF_SUCCESS;
     size_t index;
-    uint32_t bucket_index;
+    size_t bucket_index;
     uint8_t* old_data = NULL;
     uint8_t* new_data = NULL;
     ebpf_hash_bucket_header_t* old_bucket = NULL;
     ebpf_hash_bucket_header_t* new_bucket = NULL;
+    ebpf_hash_bucket_array_t* bucket_array;
+    ebpf_lock_state_t state;
+    bool updated_in_place = false;
 
-    bucket_index = _ebpf_hash_table_compute_bucket_index(hash_table, key);
+    if (inserted) {
+        *inserted = false;
+    }
 
-    // Lock the bucket.
-    ebpf_lock_state_t state = ebpf_lock_lock(&hash_table->buckets[bucket_index].lock);
+    uint32_t hash = _ebpf_hash_table_compute_hash(hash_table, key);
+
+    // Lock the bucket that holds the key, following buckets that have been migrated by a resize. A bucket that has
+    // been migrated never changes again, so the lock only needs to be held on the bucket that holds the key.
+    bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+    for (;;) {
+        bucket_index = hash & bucket_array->bucket_count_mask;
+        state = ebpf_lock_lock(&bucket_array->buckets[bucket_index].lock);
+        old_bucket = _ebpf_hash_table_get_bucket(bucket_array, bucket_index);
+        if (old_bucket != EBPF_HASH_BUCKET_MIGRATED) {
+            break;
+        }
+        ebpf_lock_unlock(&bucket_array->buckets[bucket_index].lock, state);
+        bucket_array = _ebpf_hash_table_get_next_bucket_array(bucket_array);
+    }
+
+    size_t old_bucket_count = old_bucket ? old_bucket->count : 0;
+
+    // Find the entry in the bucket, if any.
+    for (index = 0; index < old_bucket_count; index++) {
+        ebpf_hash_bucket_entry_t* entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, old_bucket, index);
+        if (_ebpf_hash_table_compare(hash_table, key, entry->key) == 0) {
+            old_data = entry->data;
+            break;
+        }
+    }
+
+    // Updating an existing key in place leaves the bucket, and so the hash table, unchanged.
+    if (hash_table->update_in_place && old_data &&
+        (operation == EBPF_HASH_BUCKET_OPERATION_INSERT_OR_UPDATE || operation == EBPF_HASH_BUCKET_OPERATION_UPDATE)) {
+        _ebpf_hash_table_update_value_in_place(hash_table, old_data, value);
+        updated_in_place = true;
+        old_bucket = NULL;
+        old_data = NULL;
+        goto Done;
+    }
 
     // Make a copy of the value to insert.
     if (operation != EBPF_HASH_BUCKET_OPERATION_DELETE) {
-        new_data = hash_table->allocate(
-            hash_table->value_size + hash_table->supplemental_value_size, hash_table->allocation_tag);
+        new_data = hash_table->allocate(_ebpf_hash_table_value_allocation_size(hash_table), hash_table->allocation_tag);
         if (!new_data) {
             result = EBPF_NO_MEMORY;
+            old_bucket = NULL;
+            old_data = NULL;
             goto Done;
         }
         // If the value is NULL, then the caller wants to insert a zeroed value.
@@ -627,19 +1126,6 @@ _ebpf_hash_table_replace_bucket(
         }
     }
 
-    // Find the old bucket.
-    old_bucket = _ebpf_hash_table_get_bucket(hash_table, bucket_index);
-    size_t old_bucket_count = old_bucket ? old_bucket->count : 0;
-
-    // Find the entry in the bucket, if any.
-    for (index = 0; index < old_bucket_count; index++) {
-        ebpf_hash_bucket_entry_t* entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, old_bucket, index);
-        if (_ebpf_hash_table_compare(hash_table, key, entry->key) == 0) {
-            old_data = entry->data;
-            break;
-        }
-    }
-
     switch (operation) {
     case EBPF_HASH_BUCKET_OPERATION_INSERT_OR_UPDATE:
         if (index == old_bucket_count) {
@@ -680,16 +1166,20 @@ _ebpf_hash_table_replace_bucket(
         goto Done;
     }
 
+    if (inserted) {
+        *inserted = (operation != EBPF_HASH_BUCKET_OPERATION_DELETE) && (index == old_bucket_count);
+    }
+
     // If a value was inserted and deleted, the count of values in the hash table did not change.
 
     // Update the bucket in the hash table.
     // From this point on the new bucket is immutable.
-    _ebpf_hash_table_set_bucket(hash_table, bucket_index, new_bucket);
+    _ebpf_hash_table_set_bucket(bucket_array, bucket_index, new_bucket);
     new_data = NULL;
     new_bucket = NULL;
 
 Done:
-    ebpf_lock_unlock(&hash_table->buckets[bucket_index].lock, state);
+    ebpf_lock_unlock(&bucket_array->buckets[bucket_index].lock, state);
 
     if (hash_table->notification_callback) {
         if (new_data) {
@@ -710,6 +1200,12 @@ Done:
     ebpf_assert(new_bucket == NULL);
     // Free the old bucket if any. This occurs if a insert, delete, or update succeeded.
     hash_table->free(old_bucket);
+
+    // Inserts and deletes change the load factor, so give the resize policy a chance to run.
+    if (result == EBPF_SUCCESS && hash_table->grow_load_factor_percent && !updated_in_place &&
+        (operation != EBPF_HASH_BUCKET_OPERATION_UPDATE)) {
+        _ebpf_hash_table_resize_step(hash_table);
+    }
     return result;
 }
 
@@ -718,7 +1214,6 @@ ebpf_hash_table_create(_Out_ ebpf_hash_table_t** hash_table, _In_ const ebpf_has
 {
     ebpf_result_t retval;
     ebpf_hash_table_t* table = NULL;
-    size_t table_size = 0;
     // Select default values for the hash table.
     size_t bucket_count =
         options->minimum_bucket_count ? options->minimum_bucket_count : EBPF_HASH_TABLE_DEFAULT_BUCKET_COUNT;
@@ -726,6 +1221,15 @@ ebpf_hash_table_create(_Out_ ebpf_hash_table_t** hash_table, _In_ const ebpf_has
     ebpf_hash_table_free free = options->free ? options->free : ebpf_epoch_free;
     uint32_t allocation_tag = options->allocation_tag ? options->allocation_tag : EBPF_POOL_TAG_EPOCH;
 
+    if (options->grow_load_factor_percent) {
+        // Readers may still be using a bucket array after a resize replaces it, so it must be freed via the epoch.
+        // Shrinking must leave the table below the grow threshold to avoid resizing back and forth.
+        if (free != ebpf_epoch_free || options->shrink_load_factor_percent * 2 >= options->grow_load_factor_percent) {
+            retval = EBPF_INVALID_ARGUMENT;
+            goto Done;
+        }
+    }
+
     // Increase bucket_count to next power of 2.
     unsigned long msb_index;
     _BitScanReverse64(&msb_index, bucket_count);
@@ -734,16 +1238,7 @@ ebpf_hash_table_create(_Out_ ebpf_hash_table_t** hash_table, _In_ const ebpf_has
         bucket_count = 1ull << (msb_index + 1ull);
     }
 
-    retval = ebpf_safe_size_t_multiply(sizeof(ebpf_hash_bucket_header_and_lock_t), bucket_count, &table_size);
-    if (retval != EBPF_SUCCESS) {
-        goto Done;
-    }
-    retval = ebpf_safe_size_t_add(table_size, EBPF_OFFSET_OF(ebpf_hash_table_t, buckets), &table_size);
-    if (retval != EBPF_SUCCESS) {
-        goto Done;
-    }
-
-    table = allocate(table_size, allocation_tag);
+    table = allocate(sizeof(ebpf_hash_table_t), allocation_tag);
     if (table == NULL) {
         retval = EBPF_NO_MEMORY;
         goto Done;
@@ -754,8 +1249,6 @@ ebpf_hash_table_create(_Out_ ebpf_hash_table_t** hash_table, _In_ const ebpf_has
     table->allocate = allocate;
     table->free = free;
     table->allocation_tag = allocation_tag;
-    table->bucket_count = bucket_count;
-    table->bucket_count_mask = bucket_count - 1;
     table->entry_count = 0;
     table->seed = ebpf_random_uint32();
     table->extract = options->extract_function;
@@ -765,14 +1258,35 @@ ebpf_hash_table_create(_Out_ ebpf_hash_table_t** hash_table, _In_ const ebpf_has
     // If debug mode, treat EBPF_HASH_TABLE_NO_LIMIT as -1 to ensure that entries are counted.
     table->max_entry_count = options->max_entries == EBPF_HASH_TABLE_NO_LIMIT ? -1 : options->max_entries;
 #endif
+    // The resize policy is driven by the entry count, so entries must be counted.
+    if (options->grow_load_factor_percent && table->max_entry_count == EBPF_HASH_TABLE_NO_LIMIT) {
+        table->max_entry_count = (size_t)-1;
+    }
 
     table->supplemental_value_size = options->supplemental_value_size;
     table->notification_context = options->notification_context;
     table->notification_callback = options->notification_callback;
 
+    table->minimum_bucket_count = bucket_count;
+    table->grow_load_factor_percent = options->grow_load_factor_percent;
+    table->shrink_load_factor_percent = options->shrink_load_factor_percent;
+    table->update_in_place = options->update_in_place && (options->value_size <= EBPF_CACHE_LINE_SIZE) &&
+                             (options->supplemental_value_size == 0) && (options->notification_callback == NULL);
+    ebpf_lock_create(&table->resize_lock);
+
+    table->buckets = _ebpf_hash_table_allocate_bucket_array(table, bucket_count);
+    if (table->buckets == NULL) {
+        retval = EBPF_NO_MEMORY;
+        goto Done;
+    }
+
     *hash_table = table;
+    table = NULL;
     retval = EBPF_SUCCESS;
 Done:
+    if (table) {
+        free(table);
+    }
     return retval;
 }
 
@@ -784,20 +1298,29 @@ ebpf_hash_table_destroy(_In_opt_ _Post_ptr_invalid_ ebpf_hash_table_t* hash_tabl
         return;
     }
 
-    for (index = 0; index < hash_table->bucket_count; index++) {
-        ebpf_hash_bucket_header_t* bucket = (ebpf_hash_bucket_header_t*)hash_table->buckets[index].header;
-        if (bucket) {
-            size_t inner_index;
-            for (inner_index = 0; inner_index < bucket->count; inner_index++) {
-                ebpf_hash_bucket_entry_t* entry =
-                    _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, inner_index);
-                hash_table->free(entry->data);
-                hash_table->free(entry->backup_bucket);
+    // Each entry is owned by exactly one bucket, either in the current bucket array or, for buckets that have been
+    // migrated, in the bucket array being resized to.
+    ebpf_hash_bucket_array_t* bucket_array = hash_table->buckets;
+    while (bucket_array) {
+        for (index = 0; index < bucket_array->bucket_count; index++) {
+            ebpf_hash_bucket_header_t* bucket = bucket_array->buckets[index].header;
+            if (bucket && bucket != EBPF_HASH_BUCKET_MIGRATED) {
+                size_t inner_index;
+                for (inner_index = 0; inner_index < bucket->count; inner_index++) {
+                    ebpf_hash_bucket_entry_t* entry =
+                        _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, inner_index);
+                    hash_table->free(entry->data);
+                    hash_table->free(entry->backup_bucket);
+                }
+                hash_table->free(bucket);
             }
-            hash_table->free(bucket);
-            hash_table->buckets[index].header = NULL;
+            bucket_array->buckets[index].header = NULL;
         }
+        ebpf_hash_bucket_array_t* next_array = bucket_array->next;
+        hash_table->free(bucket_array);
+        bucket_array = next_array;
     }
+    ebpf_lock_destroy(&hash_table->resize_lock);
     hash_table->free(hash_table);
 }
 
@@ -805,7 +1328,6 @@ _Must_inspect_result_ ebpf_result_t
 ebpf_hash_table_find(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* key, _Outptr_ uint8_t** value)
 {
     ebpf_result_t retval;
-    uint32_t bucket_index;
     uint8_t* data = NULL;
     size_t index;
     ebpf_hash_bucket_header_t* bucket;
@@ -815,8 +1337,7 @@ ebpf_hash_table_find(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_
         goto Done;
     }
 
-    bucket_index = _ebpf_hash_table_compute_bucket_index(hash_table, key);
-    bucket = _ebpf_hash_table_get_bucket(hash_table, bucket_index);
+    bucket = _ebpf_hash_table_find_bucket(hash_table, _ebpf_hash_table_compute_hash(hash_table, key));
     if (!bucket) {
         retval = EBPF_KEY_NOT_FOUND;
         goto Done;
@@ -847,12 +1368,111 @@ Done:
     return retval;
 }
 
+_Must_inspect_result_ ebpf_result_t
+ebpf_hash_table_find_batch(
+    _In_ const ebpf_hash_table_t* hash_table,
+    size_t key_count,
+    _In_ const uint8_t* keys,
+    _Out_writes_(key_count) uint8_t** values)
+{
+    uint32_t hashes[EBPF_HASH_TABLE_FIND_BATCH_SIZE];
+    ebpf_hash_bucket_header_t* buckets[EBPF_HASH_TABLE_FIND_BATCH_SIZE];
+
+    if (!hash_table || !keys || !values) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    for (size_t batch_start = 0; batch_start < key_count; batch_start += EBPF_HASH_TABLE_FIND_BATCH_SIZE) {
+        size_t batch_count = min(key_count - batch_start, EBPF_HASH_TABLE_FIND_BATCH_SIZE);
+        const uint8_t* batch_keys = keys + batch_start * hash_table->key_size;
+        const ebpf_hash_bucket_array_t* bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+        size_t index;
+
+        // Hash every key and start loading the bucket slots.
+        for (index = 0; index < batch_count; index++) {
+            hashes[index] = _ebpf_hash_table_compute_hash(hash_table, batch_keys + index * hash_table->key_size);
+            PreFetchCacheLine(
+                PF_TEMPORAL_LEVEL_1, &bucket_array->buckets[hashes[index] & bucket_array->bucket_count_mask]);
+        }
+
+        // Read the bucket pointers and start loading the bucket entries.
+        for (index = 0; index < batch_count; index++) {
+            buckets[index] = _ebpf_hash_table_find_bucket(hash_table, hashes[index]);
+            if (buckets[index]) {
+                PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, buckets[index]);
+            }
+        }
+
+        // Search the buckets, which should now be in the cache.
+        for (index = 0; index < batch_count; index++) {
+            const uint8_t* key = batch_keys + index * hash_table->key_size;
+            ebpf_hash_bucket_header_t* bucket = buckets[index];
+            uint8_t* data = NULL;
+            size_t bucket_count = bucket ? bucket->count : 0;
+            for (size_t entry_index = 0; entry_index < bucket_count; entry_index++) {
+                ebpf_hash_bucket_entry_t* entry =
+                    _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, entry_index);
+                if (_ebpf_hash_table_compare(hash_table, key, entry->key) == 0) {
+                    data = entry->data;
+                    break;
+                }
+            }
+
+            if (data) {
+                PrefetchForWrite(data);
+                if (hash_table->notification_callback) {
+                    hash_table->notification_callback(
+                        hash_table->notification_context, EBPF_HASH_TABLE_NOTIFICATION_TYPE_USE, key, data);
+                }
+            }
+            values[batch_start + index] = data;
+        }
+    }
+
+    return EBPF_SUCCESS;
+}
+
+void
+ebpf_hash_table_copy_value(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* value, _Out_ uint8_t* buffer)
+{
+    if (!hash_table->update_in_place) {
+        memcpy(buffer, value, hash_table->value_size);
+        return;
+    }
+
+    volatile int64_t* sequence = _ebpf_hash_table_value_sequence(hash_table, value);
+    for (;;) {
+        uint64_t start = ReadULong64Acquire((volatile uint64_t*)sequence);
+        if (start & 1) {
+            YieldProcessor();
+            continue;
+        }
+        memcpy(buffer, value, hash_table->value_size);
+        // Order the copy before the second read of the sequence number.
+        MemoryBarrier();
+        if (ReadULong64NoFence((volatile uint64_t*)sequence) == start) {
+            break;
+        }
+    }
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_hash_table_update(
     _Inout_ ebpf_hash_table_t* hash_table,
     _In_ const uint8_t* key,
     _In_opt_ const uint8_t* value,
     ebpf_hash_table_operations_t operation)
+{
+    return ebpf_hash_table_update_and_report_insert(hash_table, key, value, operation, NULL);
+}
+
+_Must_inspect_result_ ebpf_result_t
+ebpf_hash_table_update_and_report_insert(
+    _Inout_ ebpf_hash_table_t* hash_table,
+    _In_ const uint8_t* key,
+    _In_opt_ const uint8_t* value,
+    ebpf_hash_table_operations_t operation,
+    _Out_opt_ bool* inserted)
 {
     ebpf_result_t retval;
     ebpf_hash_bucket_operation_t bucket_operation;
@@ -877,7 +1497,7 @@ ebpf_hash_table_update(
         goto Done;
     }
 
-    retval = _ebpf_hash_table_replace_bucket(hash_table, key, value, bucket_operation);
+    retval = _ebpf_hash_table_replace_bucket(hash_table, key, value, bucket_operation, inserted);
 Done:
     return retval;
 }
@@ -892,12 +1512,186 @@ ebpf_hash_table_delete(_Inout_ ebpf_hash_table_t* hash_table, _In_ const uint8_t
         goto Done;
     }
 
-    retval = _ebpf_hash_table_replace_bucket(hash_table, key, NULL, EBPF_HASH_BUCKET_OPERATION_DELETE);
+    retval = _ebpf_hash_table_replace_bucket(hash_table, key, NULL, EBPF_HASH_BUCKET_OPERATION_DELETE, NULL);
 
 Done:
     return retval;
 }
 
+/**
+ * @brief Callback invoked for each entry visited by _ebpf_hash_table_visit_bucket.
+ *
+ * @param[in, out] context Caller supplied context.
+ * @param[in] entry The entry being visited.
+ * @retval true Stop visiting entries.
+ * @retval false Continue visiting entries.
+ */
+typedef bool (*ebpf_hash_table_entry_visitor_t)(_Inout_ void* context, _In_ ebpf_hash_bucket_entry_t* entry);
+
+/**
+ * @brief Visit the entries whose hash selects bucket filter_index in a bucket array with bucket_count_mask equal to
+ * filter_mask. While a resize is in progress these entries can be split between the bucket array and the bucket array
+ * it is being migrated to, so migrated buckets are followed into the next bucket array. The recursion depth is bounded
+ * by the number of bucket arrays chained by resizes.
+ *
+ * @param[in] hash_table The hash table.
+ * @param[in] bucket_array The bucket array to search.
+ * @param[in] filter_mask Bucket count mask of the logical bucket being visited.
+ * @param[in] filter_index Index of the logical bucket being visited.
+ * @param[in] visitor Function to invoke for each entry.
+ * @param[in, out] context Context to pass to the visitor.
+ * @retval true The visitor stopped the walk.
+ * @retval false All entries were visited.
+ */
+static bool
+_ebpf_hash_table_visit_bucket(
+    _In_ const ebpf_hash_table_t* hash_table,
+    _In_ const ebpf_hash_bucket_array_t* bucket_array,
+    size_t filter_mask,
+    size_t filter_index,
+    _In_ ebpf_hash_table_entry_visitor_t visitor,
+    _Inout_ void* context)
+{
+    ebpf_hash_bucket_header_t* bucket;
+
+    if (bucket_array->bucket_count_mask >= filter_mask) {
+        // Every bucket whose index selects filter_index only holds entries of the logical bucket.
+        for (size_t bucket_index = filter_index; bucket_index < bucket_array->bucket_count;
+             bucket_index += filter_mask + 1) {
+            bucket = _ebpf_hash_table_get_bucket(bucket_array, bucket_index);
+            if (bucket == EBPF_HASH_BUCKET_MIGRATED) {
+                if (_ebpf_hash_table_visit_bucket(
+                        hash_table,
+                        _ebpf_hash_table_get_next_bucket_array(bucket_array),
+                        bucket_array->bucket_count_mask,
+                        bucket_index,
+                        visitor,
+                        context)) {
+                    return true;
+                }
+                continue;
+            }
+            if (!bucket) {
+                continue;
+            }
+            for (size_t index = 0; index < bucket->count; index++) {
+                if (visitor(context, _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, index))) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // The bucket array is smaller than the logical bucket array, so its bucket also holds entries of other logical
+    // buckets.
+    bucket = _ebpf_hash_table_get_bucket(bucket_array, filter_index & bucket_array->bucket_count_mask);
+    if (bucket == EBPF_HASH_BUCKET_MIGRATED) {
+        return _ebpf_hash_table_visit_bucket(
+            hash_table,
+            _ebpf_hash_table_get_next_bucket_array(bucket_array),
+            filter_mask,
+            filter_index,
+            visitor,
+            context);
+    }
+    if (!bucket) {
+        return false;
+    }
+    for (size_t index = 0; index < bucket->count; index++) {
+        ebpf_hash_bucket_entry_t* entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, index);
+        if ((_ebpf_hash_table_compute_hash(hash_table, entry->key) & filter_mask) != filter_index) {
+            continue;
+        }
+        if (visitor(context, entry)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Reverse the order of the bits of a hash. get-next-key walks the keys in order of their bit-reversed hash: the
+ * entries of the bucket at index i of an array of 2^n buckets are exactly those whose bit-reversed hash has the top n
+ * bits equal to the n-bit reversal of i. Walking the buckets in bit-reversed index order therefore visits the keys in
+ * one order that doesn't depend on the bucket count, so the walk can resume after the table has been resized.
+ *
+ * @param[in] value Value to reverse.
+ * @return Value with its bits reversed.
+ */
+static inline uint32_t
+_ebpf_hash_table_reverse_bits(uint32_t value)
+{
+    value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+    value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F) | ((value & 0x0F0F0F0F) << 4);
+    value = ((value >> 8) & 0x00FF00FF) | ((value & 0x00FF00FF) << 8);
+    return (value >> 16) | (value << 16);
+}
+
+typedef struct _ebpf_hash_table_next_key_context
+{
+    const ebpf_hash_table_t* hash_table;
+    const uint8_t* previous_key;
+    uint32_t previous_order; // Bit-reversed hash of previous_key.
+    bool found_entry;
+    ebpf_hash_bucket_entry_t* next_entry;
+    uint32_t next_order; // Bit-reversed hash of next_entry's key.
+} ebpf_hash_table_next_key_context_t;
+
+/**
+ * @brief Compare two keys in get-next-key order: by bit-reversed hash, then by key for keys whose hashes collide.
+ *
+ * @param[in] hash_table The hash table.
+ * @param[in] order_a Bit-reversed hash of key_a.
+ * @param[in] key_a First key.
+ * @param[in] order_b Bit-reversed hash of key_b.
+ * @param[in] key_b Second key.
+ * @return Negative if key_a comes first, 0 if the keys are equal, positive if key_b comes first.
+ */
+static int
+_ebpf_hash_table_compare_walk_order(
+    _In_ const ebpf_hash_table_t* hash_table,
+    uint32_t order_a,
+    _In_ const uint8_t* key_a,
+    uint32_t order_b,
+    _In_ const uint8_t* key_b)
+{
+    if (order_a != order_b) {
+        return (order_a < order_b) ? -1 : 1;
+    }
+    return _ebpf_hash_table_compare(hash_table, key_a, key_b);
+}
+
+static bool
+_ebpf_hash_table_next_key_visitor(_Inout_ void* context, _In_ ebpf_hash_bucket_entry_t* entry)
+{
+    ebpf_hash_table_next_key_context_t* next_key_context = (ebpf_hash_table_next_key_context_t*)context;
+    const ebpf_hash_table_t* hash_table = next_key_context->hash_table;
+    uint32_t order = _ebpf_hash_table_reverse_bits(_ebpf_hash_table_compute_hash(hash_table, entry->key));
+
+    // Skip the previous key and every key that comes before it.
+    if (next_key_context->previous_key) {
+        int comparison = _ebpf_hash_table_compare_walk_order(
+            hash_table, order, entry->key, next_key_context->previous_order, next_key_context->previous_key);
+        if (comparison == 0) {
+            next_key_context->found_entry = true;
+        }
+        if (comparison <= 0) {
+            return false;
+        }
+    }
+
+    // Keep the first of the remaining keys. Entries within a bucket are not ordered, so visit all of them.
+    if (!next_key_context->next_entry ||
+        _ebpf_hash_table_compare_walk_order(
+            hash_table, order, entry->key, next_key_context->next_order, next_key_context->next_entry->key) < 0) {
+        next_key_context->next_entry = entry;
+        next_key_context->next_order = order;
+    }
+    return false;
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_hash_table_next_key_pointer_and_value(
     _In_ const ebpf_hash_table_t* hash_table,
@@ -906,54 +1700,41 @@ ebpf_hash_table_next_key_pointer_and_value(
     _Outptr_opt_ uint8_t** value)
 {
     ebpf_result_t result = EBPF_SUCCESS;
-    uint32_t starting_bucket_index;
-    ebpf_hash_bucket_entry_t* next_entry = NULL;
-    size_t bucket_index;
-    size_t data_index;
-    bool found_entry = false;
+    size_t position = 0;
+    unsigned long bucket_count_log2;
+    const ebpf_hash_bucket_array_t* bucket_array;
+    ebpf_hash_table_next_key_context_t context = {hash_table, previous_key, 0, false, NULL, 0};
 
     if (!hash_table || !next_key_pointer) {
         result = EBPF_INVALID_ARGUMENT;
         goto Done;
     }
 
-    starting_bucket_index =
-        (previous_key != NULL) ? _ebpf_hash_table_compute_bucket_index(hash_table, previous_key) : 0;
-
-    for (bucket_index = starting_bucket_index; bucket_index < hash_table->bucket_count; bucket_index++) {
-        ebpf_hash_bucket_header_t* bucket = _ebpf_hash_table_get_bucket(hash_table, bucket_index);
-        // Skip empty buckets.
-        if (!bucket) {
-            continue;
-        }
-
-        // Pick first entry if no previous key.
-        if (!previous_key) {
-            next_entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, 0);
-            break;
-        }
-
-        for (data_index = 0; data_index < bucket->count; data_index++) {
-            ebpf_hash_bucket_entry_t* entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket, data_index);
-            if (!entry) {
-                result = EBPF_INVALID_ARGUMENT;
-                goto Done;
-            }
-            // Do we have the previous key?
-            if (found_entry) {
-                // Yes, then this is the next key.
-                next_entry = entry;
-                break;
-            }
+    // Bucket counts are powers of 2 no larger than 2^31, so each bucket index is the low bucket_count_log2 bits of
+    // the hash and the position of the bucket in the walk is the reversal of those bits.
+    bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+    _BitScanReverse64(&bucket_count_log2, bucket_array->bucket_count);
 
-            // Is this the previous key?
-            if (_ebpf_hash_table_compare(hash_table, previous_key, entry->key) == 0) {
-                // Yes, record its location.
-                found_entry = true;
-            }
-        }
+    if (previous_key != NULL) {
+        // Resume at the bucket that holds the previous key in the current bucket array. Its position is the same
+        // whether or not the table was resized since the previous key was returned.
+        context.previous_order = _ebpf_hash_table_reverse_bits(_ebpf_hash_table_compute_hash(hash_table, previous_key));
+        position = (bucket_count_log2 != 0) ? (context.previous_order >> (32 - bucket_count_log2)) : 0;
+    }
 
-        if (next_entry) {
+    for (; position < bucket_array->bucket_count; position++) {
+        size_t bucket_index =
+            (bucket_count_log2 != 0) ? (_ebpf_hash_table_reverse_bits((uint32_t)position) >> (32 - bucket_count_log2))
+                                     : 0;
+        (void)_ebpf_hash_table_visit_bucket(
+            hash_table,
+            bucket_array,
+            bucket_array->bucket_count_mask,
+            bucket_index,
+            _ebpf_hash_table_next_key_visitor,
+            &context);
+        // Every key in a later bucket comes after every key in this one.
+        if (context.next_entry) {
             break;
         }
     }
@@ -961,12 +1742,12 @@ ebpf_hash_table_next_key_pointer_and_value(
     // If we were given a previous key, and the searched key was not found in the hash table, we return
     // EBPF_KEY_NOT_FOUND, so that the caller can detect that the key is missing, and return the first key (as per
     // 'bpf_map_get_next_key' specs).
-    if (!found_entry && previous_key != NULL) {
+    if (!context.found_entry && previous_key != NULL) {
         result = EBPF_KEY_NOT_FOUND;
         goto Done;
     }
 
-    if (!next_entry) {
+    if (!context.next_entry) {
         result = EBPF_NO_MORE_KEYS;
         goto Done;
     }
@@ -974,10 +1755,10 @@ ebpf_hash_table_next_key_pointer_and_value(
     result = EBPF_SUCCESS;
 
     if (value) {
-        *value = next_entry->data;
+        *value = context.next_entry->data;
     }
 
-    *next_key_pointer = next_entry->key;
+    *next_key_pointer = context.next_entry->key;
 
 Done:
 
@@ -1014,10 +1795,12 @@ ebpf_hash_table_key_count(_In_ const ebpf_hash_table_t* hash_table)
     if (hash_table->max_entry_count != EBPF_HASH_TABLE_NO_LIMIT) {
         return hash_table->entry_count;
     } else {
-        // Otherwise, count the keys in the hash table.
+        // Otherwise, count the keys in the hash table. Tables that resize always count entries, so there is only one
+        // bucket array.
+        const ebpf_hash_bucket_array_t* bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
         size_t count = 0;
-        for (size_t i = 0; i < hash_table->bucket_count; i++) {
-            ebpf_hash_bucket_header_t* bucket = hash_table->buckets[i].header;
+        for (size_t i = 0; i < bucket_array->bucket_count; i++) {
+            ebpf_hash_bucket_header_t* bucket = bucket_array->buckets[i].header;
             if (bucket) {
                 count += bucket->count;
             }
@@ -1026,6 +1809,49 @@ ebpf_hash_table_key_count(_In_ const ebpf_hash_table_t* hash_table)
     }
 }
 
+typedef struct _ebpf_hash_table_iterate_context
+{
+    size_t count;
+    size_t capacity;
+    const uint8_t** keys;
+    const uint8_t** values;
+} ebpf_hash_table_iterate_context_t;
+
+static bool
+_ebpf_hash_table_count_visitor(_Inout_ void* context, _In_ ebpf_hash_bucket_entry_t* entry)
+{
+    UNREFERENCED_PARAMETER(entry);
+    ((ebpf_hash_table_iterate_context_t*)context)->count++;
+    return false;
+}
+
+static bool
+_ebpf_hash_table_copy_visitor(_Inout_ void* context, _In_ ebpf_hash_bucket_entry_t* entry)
+{
+    ebpf_hash_table_iterate_context_t* iterate_context = (ebpf_hash_table_iterate_context_t*)context;
+    if (iterate_context->count == iterate_context->capacity) {
+        return true;
+    }
+    iterate_context->keys[iterate_context->count] = entry->key;
+    iterate_context->values[iterate_context->count] = entry->data;
+    iterate_context->count++;
+    return false;
+}
+
+/**
+ * @brief The iteration cookie pins the logical buckets to the bucket count the iteration started with, so resizing
+ * the table between calls neither skips nor repeats keys. The low 32 bits hold the logical bucket index and the bits
+ * above EBPF_HASH_TABLE_ITERATE_COOKIE_SHIFT hold log2 of the logical bucket count plus one. A cookie of 0 starts a
+ * new iteration using the current bucket count.
+ */
+#define EBPF_HASH_TABLE_ITERATE_COOKIE_SHIFT 32
+#define EBPF_HASH_TABLE_ITERATE_COOKIE_INDEX_MASK (((size_t)1 << EBPF_HASH_TABLE_ITERATE_COOKIE_SHIFT) - 1)
+
+static_assert(sizeof(size_t) == sizeof(uint64_t), "The iteration cookie requires a 64-bit size_t");
+static_assert(
+    EBPF_HASH_TABLE_MAXIMUM_BUCKET_COUNT <= EBPF_HASH_TABLE_ITERATE_COOKIE_INDEX_MASK,
+    "Bucket indexes must fit in the iteration cookie");
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_hash_table_iterate(
     _In_ const ebpf_hash_table_t* hash_table,
@@ -1034,54 +1860,96 @@ ebpf_hash_table_iterate(
     _Out_writes_(*count) const uint8_t** keys,
     _Out_writes_(*count) const uint8_t** values)
 {
-    size_t bucket_index = *bucket;
+    const ebpf_hash_bucket_array_t* bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+    size_t bucket_count_log2_plus_one = *bucket >> EBPF_HASH_TABLE_ITERATE_COOKIE_SHIFT;
+    size_t starting_bucket_index = *bucket & EBPF_HASH_TABLE_ITERATE_COOKIE_INDEX_MASK;
+    size_t bucket_index = starting_bucket_index;
     size_t index = 0;
     size_t remaining_space = *count;
     size_t next_bucket_count = 0;
-    if (bucket_index >= hash_table->bucket_count) {
+
+    if (bucket_count_log2_plus_one == 0) {
+        // New iteration: define the logical buckets by the current bucket count, which is a power of 2.
+        unsigned long msb_index;
+        _BitScanReverse64(&msb_index, bucket_array->bucket_count);
+        bucket_count_log2_plus_one = (size_t)msb_index + 1;
+    }
+    if (bucket_count_log2_plus_one > EBPF_HASH_TABLE_ITERATE_COOKIE_SHIFT) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    // The bucket arrays reached from the current array may be larger or smaller than the logical bucket array;
+    // _ebpf_hash_table_visit_bucket finds the entries of a logical bucket in either case.
+    size_t logical_bucket_count = (size_t)1 << (bucket_count_log2_plus_one - 1);
+    size_t filter_mask = logical_bucket_count - 1;
+    if (bucket_index >= logical_bucket_count) {
         return EBPF_NO_MORE_KEYS;
     }
 
     while (remaining_space > 0) {
-        if (bucket_index >= hash_table->bucket_count) {
+        if (bucket_index >= logical_bucket_count) {
             break;
         }
-        ebpf_hash_bucket_header_t* bucket_header = _ebpf_hash_table_get_bucket(hash_table, bucket_index);
+        ebpf_hash_table_iterate_context_t context = {0, remaining_space, keys + index, values + index};
+        (void)_ebpf_hash_table_visit_bucket(
+            hash_table, bucket_array, filter_mask, bucket_index, _ebpf_hash_table_count_visitor, &context);
         // Check if the bucket is empty.
-        if (!bucket_header) {
+        next_bucket_count = context.count;
+        if (next_bucket_count == 0) {
             bucket_index++;
             continue;
         }
         // Check if the next bucket will fit in the remaining space.
-        next_bucket_count = bucket_header->count;
         if (remaining_space < next_bucket_count) {
             break;
         }
         // Copy the keys and values.
-        for (size_t i = 0; i < next_bucket_count; i++) {
-            ebpf_hash_bucket_entry_t* entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket_header, i);
-            if (!entry) {
-                return EBPF_INVALID_ARGUMENT;
-            }
-            keys[index] = entry->key;
-            values[index] = entry->data;
-            index++;
-            remaining_space--;
-        }
+        context.count = 0;
+        (void)_ebpf_hash_table_visit_bucket(
+            hash_table, bucket_array, filter_mask, bucket_index, _ebpf_hash_table_copy_visitor, &context);
+        index += context.count;
+        remaining_space -= context.count;
         bucket_index++;
     }
 
+    *bucket = (bucket_count_log2_plus_one << EBPF_HASH_TABLE_ITERATE_COOKIE_SHIFT) | bucket_index;
+
     // If the bucket_index did not change, then there wasn't enough space to copy the next bucket.
-    if (*bucket == bucket_index) {
+    if (starting_bucket_index == bucket_index) {
         *count = next_bucket_count;
         return EBPF_INSUFFICIENT_BUFFER;
     }
 
-    *bucket = bucket_index;
     *count = index;
     return EBPF_SUCCESS;
 }
 
+typedef struct _ebpf_hash_table_sorted_context
+{
+    const uint8_t* previous_key;
+    int (*compare)(_In_ const uint8_t* key1, _In_ const uint8_t* key2);
+    void* filter_context;
+    bool (*filter)(_In_opt_ void* filter_context, _In_ const uint8_t* key, _In_ const uint8_t* value);
+    uint8_t* next_key_pointer;
+    uint8_t* next_value_pointer;
+} ebpf_hash_table_sorted_context_t;
+
+static bool
+_ebpf_hash_table_sorted_visitor(_Inout_ void* context, _In_ ebpf_hash_bucket_entry_t* entry)
+{
+    ebpf_hash_table_sorted_context_t* sorted_context = (ebpf_hash_table_sorted_context_t*)context;
+    if (sorted_context->previous_key == NULL || sorted_context->compare(sorted_context->previous_key, entry->key) < 0) {
+        if (sorted_context->next_key_pointer == NULL ||
+            sorted_context->compare(sorted_context->next_key_pointer, entry->key) > 0) {
+            if (sorted_context->filter(sorted_context->filter_context, entry->key, entry->data)) {
+                sorted_context->next_key_pointer = entry->key;
+                sorted_context->next_value_pointer = entry->data;
+            }
+        }
+    }
+    return false;
+}
+
 _Must_inspect_result_ ebpf_result_t
 ebpf_hash_table_next_key_and_value_sorted(
     _In_ const ebpf_hash_table_t* hash_table,
@@ -1092,35 +1960,24 @@ ebpf_hash_table_next_key_and_value_sorted(
     _Out_ uint8_t* next_key,
     _Inout_opt_ uint8_t** next_value)
 {
-    uint8_t* next_key_pointer = NULL;
-    uint8_t* next_value_pointer = NULL;
-    for (size_t bucket_index = 0; bucket_index < hash_table->bucket_count; bucket_index++) {
-        ebpf_hash_bucket_header_t* bucket_header = _ebpf_hash_table_get_bucket(hash_table, bucket_index);
-        if (!bucket_header) {
-            continue;
-        }
-        for (size_t i = 0; i < bucket_header->count; i++) {
-            ebpf_hash_bucket_entry_t* entry = _ebpf_hash_table_bucket_entry(hash_table->key_size, bucket_header, i);
-            if (!entry) {
-                return EBPF_INVALID_ARGUMENT;
-            }
-            if (previous_key == NULL || compare(previous_key, entry->key) < 0) {
-                if (next_key_pointer == NULL || compare(next_key_pointer, entry->key) > 0) {
-                    if (filter(filter_context, entry->key, entry->data)) {
-                        next_key_pointer = entry->key;
-                        next_value_pointer = entry->data;
-                    }
-                }
-            }
-        }
+    const ebpf_hash_bucket_array_t* bucket_array = _ebpf_hash_table_get_bucket_array(hash_table);
+    ebpf_hash_table_sorted_context_t context = {previous_key, compare, filter_context, filter, NULL, NULL};
+    for (size_t bucket_index = 0; bucket_index < bucket_array->bucket_count; bucket_index++) {
+        (void)_ebpf_hash_table_visit_bucket(
+            hash_table,
+            bucket_array,
+            bucket_array->bucket_count_mask,
+            bucket_index,
+            _ebpf_hash_table_sorted_visitor,
+            &context);
     }
-    if (next_key_pointer == NULL) {
+    if (context.next_key_pointer == NULL) {
         return EBPF_NO_MORE_KEYS;
     }
 
-    memcpy(next_key, next_key_pointer, hash_table->key_size);
+    memcpy(next_key, context.next_key_pointer, hash_table->key_size);
     if (next_value) {
-        *next_value = next_value_pointer;
+        *next_value = context.next_value_pointer;
     }
 
     return EBPF_SUCCESS;
@@ -11,6 +11,8 @@ extern "C"
 
 #define EBPF_HASH_TABLE_NO_LIMIT 0
 #define EBPF_HASH_TABLE_DEFAULT_BUCKET_COUNT 64
+#define EBPF_HASH_TABLE_DEFAULT_GROW_LOAD_FACTOR_PERCENT 100
+#define EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT 25
 
     typedef enum _ebpf_hash_table_operations
     {
@@ -70,6 +72,15 @@ extern "C"
         void* notification_context;     //< Context to pass to notification functions.
         ebpf_hash_table_notification_function
             notification_callback; //< Function to call when value storage is allocated or freed.
+        size_t grow_load_factor_percent; //< Double the bucket count once the number of entries exceeds this percentage
+                                         // of the bucket count - defaults to 0, which disables resizing. Resizing
+                                         // requires the default free function.
+        size_t shrink_load_factor_percent; //< Halve the bucket count, down to minimum_bucket_count, once the number of
+                                           // entries drops below this percentage of the bucket count - defaults to 0,
+                                           // which never shrinks. Must be less than half of grow_load_factor_percent.
+        bool update_in_place; //< Overwrite the value of an existing key in place rather than replacing the value and
+                              // its bucket - defaults to false. Only honored for values of at most EBPF_CACHE_LINE_SIZE
+                              // bytes in tables without supplemental values or a notification callback.
     } ebpf_hash_table_creation_options_t;
 
     /**
@@ -81,6 +92,7 @@ extern "C"
      * @retval EBPF_SUCCESS The operation was successful.
      * @retval EBPF_NO_MEMORY Unable to allocate resources for this
      *  hash table.
+     * @retval EBPF_INVALID_ARGUMENT The resize policy is invalid.
      */
     _Must_inspect_result_ ebpf_result_t
     ebpf_hash_table_create(
@@ -106,6 +118,36 @@ extern "C"
     _Must_inspect_result_ ebpf_result_t
     ebpf_hash_table_find(_In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* key, _Outptr_ uint8_t** value);
 
+    /**
+     * @brief Find several elements in the hash table. All keys are hashed and their buckets prefetched before any
+     * bucket is searched, so the cache misses of the individual lookups overlap.
+     *
+     * @param[in] hash_table Hash-table to search.
+     * @param[in] key_count Number of keys to find.
+     * @param[in] keys Buffer of key_count keys, each key_size bytes long.
+     * @param[out] values Pointer to the value of each key, or NULL if the key is not in the hash table.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_INVALID_ARGUMENT An invalid argument was passed to this function.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_hash_table_find_batch(
+        _In_ const ebpf_hash_table_t* hash_table,
+        size_t key_count,
+        _In_ const uint8_t* keys,
+        _Out_writes_(key_count) uint8_t** values);
+
+    /**
+     * @brief Copy a value returned by this hash table into a buffer. If the table updates values in place, the copy is
+     * retried until it doesn't overlap a concurrent update, so the buffer never holds a partially written value.
+     *
+     * @param[in] hash_table Hash-table that owns the value.
+     * @param[in] value Pointer to the value, as returned by a find or iteration function.
+     * @param[out] buffer Buffer of value_size bytes to copy the value into.
+     */
+    void
+    ebpf_hash_table_copy_value(
+        _In_ const ebpf_hash_table_t* hash_table, _In_ const uint8_t* value, _Out_ uint8_t* buffer);
+
     /**
      * @brief Insert or update an entry in the hash table.
      *
@@ -125,6 +167,28 @@ extern "C"
         _In_opt_ const uint8_t* value,
         ebpf_hash_table_operations_t operation);
 
+    /**
+     * @brief Insert or update an entry in the hash table, reporting whether a new key was inserted.
+     *
+     * @param[in, out] hash_table Hash-table to update.
+     * @param[in] key Key to find and insert or update.
+     * @param[in] value Value to insert into hash table or NULL to insert zero entry.
+     * @param[in] operation One of ebpf_hash_table_operations_t operations.
+     * @param[out] inserted Optionally set to true if the key was not present and has been inserted, or false if
+     *  the value of an existing key was replaced or the operation failed.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_NO_MEMORY Unable to allocate memory for this
+     *  entry in the hash table.
+     * @retval EBPF_OUT_OF_SPACE Unable to insert this entry in the hash table.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_hash_table_update_and_report_insert(
+        _Inout_ ebpf_hash_table_t* hash_table,
+        _In_ const uint8_t* key,
+        _In_opt_ const uint8_t* value,
+        ebpf_hash_table_operations_t operation,
+        _Out_opt_ bool* inserted);
+
     /**
      * @brief Remove an entry from the hash table.
      *
@@ -140,9 +204,11 @@ extern "C"
      * @brief Fetch pointers to keys and values from one or more buckets in the hash table. Whole buckets worth of keys
      * and values are returned at a time, with *count being the number of keys and values returned. If *count is too
      * small to hold all the keys and values in the next bucket, EBPF_INSUFFICIENT_BUFFER is returned.
+     * The cookie fixes the bucket layout the iteration started with, so a resize between calls does not cause keys
+     * to be skipped or returned twice.
      *
      * @param[in] hash_table Hash-table to iterate.
-     * @param[in,out] cookie Cookie to pass to the iterator or NULL to restart. Updated on return.
+     * @param[in,out] cookie Cookie to pass to the iterator or 0 to restart. Updated on return.
      * @param[in,out] count On input, the number of keys and values that can be stored in the buffers. On output, the
      * number of keys and values returned.
      * @param[out] keys An array of pointers to keys in the hash table.
@@ -196,7 +262,8 @@ extern "C"
     /**
      * @brief Returns the next (key, value) pair in the hash table in an unspecified order.
      * This function is faster than ebpf_hash_table_next_key_and_value_sorted but the order of keys is unspecified.
-     * The keys are not sorted and no filter is applied.
+     * The keys are not sorted and no filter is applied. The order doesn't change when the table is resized, so a walk
+     * returns each key that stays in the table exactly once.
      *
      * @param[in] hash_table Hash-table to query.
      * @param[in] previous_key Previous key or NULL to restart.
@@ -87,6 +87,12 @@ ebpf_interlocked_decrement_int64_no_fence(_Inout_ volatile int64_t* addend)
     return InterlockedDecrementNoFence64(addend);
 }
 
+int64_t
+ebpf_interlocked_add_int64_no_fence(_Inout_ volatile int64_t* addend, int64_t value)
+{
+    return InterlockedAddNoFence64(addend, value);
+}
+
 int32_t
 ebpf_interlocked_compare_exchange_int32(_Inout_ volatile int32_t* destination, int32_t exchange, int32_t comparand)
 {
@@ -58,6 +58,24 @@ typedef struct _ebpf_id_entry
 static ebpf_hash_table_t* _ebpf_id_table = NULL; ///< Table of object IDs to object pointers.
 static volatile ebpf_id_t _ebpf_next_id = 1;     ///< Next ID to assign to an object.
 
+/**
+ * @brief The IDs of the entries of one object type in the ID table, in ascending order, so that the next ID can be
+ * found with a binary search rather than by scanning and sorting the whole ID table. IDs are assigned in increasing
+ * order, so new IDs are almost always appended.
+ */
+typedef struct _ebpf_id_index
+{
+    ebpf_id_t* ids;
+    size_t count;
+    size_t capacity;
+} ebpf_id_index_t;
+
+#define EBPF_ID_INDEX_COUNT (EBPF_OBJECT_PROGRAM + 1)
+#define EBPF_ID_INDEX_MINIMUM_CAPACITY 64
+
+static ebpf_lock_t _ebpf_id_index_lock = {0};
+static _Guarded_by_(_ebpf_id_index_lock) ebpf_id_index_t _ebpf_id_index[EBPF_ID_INDEX_COUNT];
+
 /**
  * @brief An enum of operations that can be performed on an object reference.
  */
@@ -131,6 +149,83 @@ ebpf_object_update_reference_history(void* object, bool acquire, uint32_t file_i
     _update_reference_history(object, acquire ? EBPF_OBJECT_ACQUIRE : EBPF_OBJECT_RELEASE, file_id, line);
 }
 
+/**
+ * @brief Find the position of the first ID in an ID index that is greater than or equal to the given ID.
+ *
+ * @param[in] index ID index to search.
+ * @param[in] id ID to search for.
+ * @return Position of the first ID not less than id, or index->count if there is none.
+ */
+static size_t
+_ebpf_id_index_lower_bound(_In_ const ebpf_id_index_t* index, ebpf_id_t id)
+{
+    size_t low = 0;
+    size_t high = index->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (index->ids[middle] < id) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static _Must_inspect_result_ ebpf_result_t
+_ebpf_id_index_insert(ebpf_id_t id, ebpf_object_type_t object_type)
+{
+    ebpf_result_t result = EBPF_SUCCESS;
+    ebpf_lock_state_t state = ebpf_lock_lock(&_ebpf_id_index_lock);
+    ebpf_id_index_t* index = &_ebpf_id_index[object_type];
+
+    if (index->count == index->capacity) {
+        size_t new_capacity = index->capacity ? index->capacity * 2 : EBPF_ID_INDEX_MINIMUM_CAPACITY;
+        ebpf_id_t* new_ids;
+        if (index->ids) {
+            new_ids = (ebpf_id_t*)ebpf_reallocate(
+                index->ids,
+                CXPLAT_POOL_FLAG_NON_PAGED,
+                index->capacity * sizeof(ebpf_id_t),
+                new_capacity * sizeof(ebpf_id_t),
+                EBPF_POOL_TAG_DEFAULT);
+        } else {
+            new_ids = (ebpf_id_t*)ebpf_allocate_with_tag(new_capacity * sizeof(ebpf_id_t), EBPF_POOL_TAG_DEFAULT);
+        }
+        if (!new_ids) {
+            result = EBPF_NO_MEMORY;
+            goto Done;
+        }
+        index->ids = new_ids;
+        index->capacity = new_capacity;
+    }
+
+    size_t position = _ebpf_id_index_lower_bound(index, id);
+    ebpf_assert(position == index->count || index->ids[position] != id);
+    memmove(&index->ids[position + 1], &index->ids[position], (index->count - position) * sizeof(ebpf_id_t));
+    index->ids[position] = id;
+    index->count++;
+
+Done:
+    ebpf_lock_unlock(&_ebpf_id_index_lock, state);
+    return result;
+}
+
+static void
+_ebpf_id_index_delete(ebpf_id_t id, ebpf_object_type_t object_type)
+{
+    ebpf_lock_state_t state = ebpf_lock_lock(&_ebpf_id_index_lock);
+    ebpf_id_index_t* index = &_ebpf_id_index[object_type];
+
+    size_t position = _ebpf_id_index_lower_bound(index, id);
+    if (position < index->count && index->ids[position] == id) {
+        index->count--;
+        memmove(&index->ids[position], &index->ids[position + 1], (index->count - position) * sizeof(ebpf_id_t));
+    }
+
+    ebpf_lock_unlock(&_ebpf_id_index_lock, state);
+}
+
 static void
 _ebpf_object_tracking_list_remove(_In_ const ebpf_core_object_t* object, ebpf_file_id_t file_id, uint32_t line)
 {
@@ -152,7 +247,8 @@ ebpf_object_tracking_initiate()
         .key_size = sizeof(ebpf_id_t),
         .value_size = sizeof(ebpf_id_entry_t),
         .max_entries = EBPF_HASH_TABLE_NO_LIMIT,
-        .minimum_bucket_count = 1024,
+        .grow_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_GROW_LOAD_FACTOR_PERCENT,
+        .shrink_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT,
     };
 
     memset(_ebpf_object_reference_history, 0, sizeof(_ebpf_object_reference_history));
@@ -160,6 +256,8 @@ ebpf_object_tracking_initiate()
 
     cxplat_initialize_rundown_protection(&_ebpf_object_rundown_ref);
 
+    memset(_ebpf_id_index, 0, sizeof(_ebpf_id_index));
+
     return ebpf_hash_table_create(&_ebpf_id_table, &options);
 }
 
@@ -174,6 +272,11 @@ ebpf_object_tracking_terminate()
 
     ebpf_hash_table_destroy(_ebpf_id_table);
     _ebpf_id_table = NULL;
+
+    for (size_t index = 0; index < EBPF_ID_INDEX_COUNT; index++) {
+        ebpf_free(_ebpf_id_index[index].ids);
+    }
+    memset(_ebpf_id_index, 0, sizeof(_ebpf_id_index));
 }
 
 static void
@@ -241,6 +344,12 @@ ebpf_object_initialize(
         goto Done;
     }
 
+    result = _ebpf_id_index_insert(object->id, object_type);
+    if (result != EBPF_SUCCESS) {
+        (void)ebpf_hash_table_delete(_ebpf_id_table, (const uint8_t*)&object->id);
+        goto Done;
+    }
+
 #if !defined(NDEBUG)
     ebpf_id_entry_t* new_entry = NULL;
     result = ebpf_hash_table_find(_ebpf_id_table, (const uint8_t*)&object->id, (uint8_t**)&new_entry);
@@ -306,6 +415,12 @@ _ebpf_object_try_acquire_reference(_Inout_ ebpf_base_object_t* object, uint32_t
     }
 }
 
+bool
+ebpf_object_try_acquire_reference(_Inout_ ebpf_core_object_t* object, uint32_t file_id, uint32_t line)
+{
+    return _ebpf_object_try_acquire_reference(&object->base, file_id, line);
+}
+
 void
 ebpf_object_release_reference(_Inout_opt_ ebpf_core_object_t* object, uint32_t file_id, uint32_t line)
 {
@@ -350,48 +465,54 @@ ebpf_duplicate_utf8_string(_Out_ cxplat_utf8_string_t* destination, _In_ const c
     return ebpf_result_from_cxplat_status(status);
 }
 
-static bool
-_ebpf_object_match_object_type(_In_ void* filter_context, _In_ const uint8_t* key, _In_ const uint8_t* value)
-{
-    ebpf_object_type_t* object_type = (ebpf_object_type_t*)filter_context;
-    ebpf_id_entry_t* entry = (ebpf_id_entry_t*)value;
-    UNREFERENCED_PARAMETER(key);
-    return (entry->type == *object_type);
-}
-
-static int
-_ebpf_object_id_sort(_In_ const uint8_t* key1, _In_ const uint8_t* key2)
+_Must_inspect_result_ ebpf_result_t
+ebpf_object_get_next_id(ebpf_id_t start_id, ebpf_object_type_t object_type, _Out_ ebpf_id_t* next_id)
 {
-    ebpf_id_t id1 = *(ebpf_id_t*)key1;
-    ebpf_id_t id2 = *(ebpf_id_t*)key2;
-    if (id1 < id2) {
-        return -1;
-    } else if (id1 > id2) {
-        return 1;
-    } else {
-        return 0;
+    uint32_t id_count;
+    ebpf_result_t result = ebpf_object_get_next_ids(start_id, object_type, 1, next_id, &id_count);
+    if (result != EBPF_SUCCESS) {
+        *next_id = EBPF_ID_NONE;
     }
+    return result;
 }
 
 _Must_inspect_result_ ebpf_result_t
-ebpf_object_get_next_id(ebpf_id_t start_id, ebpf_object_type_t object_type, _Out_ ebpf_id_t* next_id)
+ebpf_object_get_next_ids(
+    ebpf_id_t start_id,
+    ebpf_object_type_t object_type,
+    uint32_t id_capacity,
+    _Out_writes_to_(id_capacity, *id_count) ebpf_id_t* ids,
+    _Out_ uint32_t* id_count)
 {
-    // TODO: https://github.com/microsoft/ebpf-for-windows/issues/2985
-    // Switch this to a data structure that supports sorted iteration.
-    ebpf_id_entry_t* entry = NULL;
-    ebpf_result_t result = ebpf_hash_table_next_key_and_value_sorted(
-        _ebpf_id_table,
-        start_id ? (const uint8_t*)&start_id : NULL,
-        _ebpf_object_id_sort,
-        &object_type,
-        _ebpf_object_match_object_type,
-        (uint8_t*)next_id,
-        (uint8_t**)&entry);
-    if (result != EBPF_SUCCESS) {
-        return EBPF_NO_MORE_KEYS;
-    } else {
-        return EBPF_SUCCESS;
+    ebpf_result_t result = EBPF_SUCCESS;
+    *id_count = 0;
+
+    if (object_type <= EBPF_OBJECT_UNKNOWN || object_type >= EBPF_ID_INDEX_COUNT) {
+        return EBPF_INVALID_ARGUMENT;
+    }
+
+    ebpf_lock_state_t state = ebpf_lock_lock(&_ebpf_id_index_lock);
+    const ebpf_id_index_t* index = &_ebpf_id_index[object_type];
+
+    // Only IDs greater than start_id are returned. No object has ID 0, so a start_id of 0 starts from the first ID.
+    size_t position = _ebpf_id_index_lower_bound(index, start_id);
+    if (position < index->count && index->ids[position] == start_id) {
+        position++;
+    }
+
+    size_t count = index->count - position;
+    if (count > id_capacity) {
+        count = id_capacity;
+    }
+    memcpy(ids, &index->ids[position], count * sizeof(ebpf_id_t));
+    *id_count = (uint32_t)count;
+
+    ebpf_lock_unlock(&_ebpf_id_index_lock, state);
+
+    if (*id_count == 0) {
+        result = EBPF_NO_MORE_KEYS;
     }
+    return result;
 }
 
 void
@@ -410,16 +531,18 @@ ebpf_object_reference_next_object(
     *next_object = NULL;
 
     for (;;) {
-        result = ebpf_hash_table_next_key_and_value(
-            _ebpf_id_table,
-            previous_key ? (const uint8_t*)&previous_key : NULL,
-            (uint8_t*)&next_key,
-            (uint8_t**)&entry);
+        result = ebpf_object_get_next_id(previous_key, object_type, &next_key);
         if (result != EBPF_SUCCESS) {
             break;
         }
         previous_key = next_key;
 
+        // Skip entries that were deleted after the ID was found.
+        result = ebpf_hash_table_find(_ebpf_id_table, (const uint8_t*)&next_key, (uint8_t**)&entry);
+        if (result != EBPF_SUCCESS) {
+            continue;
+        }
+
         object = entry->object;
 
         // Skip entries that have been deleted.
@@ -427,11 +550,6 @@ ebpf_object_reference_next_object(
             continue;
         }
 
-        // Skip entries that are not of the requested type.
-        if (entry->type != object_type) {
-            continue;
-        }
-
         // Try to acquire a reference on the object.
         if (!_ebpf_object_try_acquire_reference(&object->base, file_id, line)) {
             continue;
@@ -608,6 +726,7 @@ ebpf_object_release_id_reference(ebpf_id_t id, ebpf_object_type_t object_type, u
     ebpf_object_update_reference_history(entry, EBPF_OBJECT_RELEASE, file_id, line);
 
     if (new_refcount == 0) {
+        _ebpf_id_index_delete(id, object_type);
         result = ebpf_hash_table_delete(_ebpf_id_table, (const uint8_t*)&id);
         if (result != EBPF_SUCCESS) {
             __fastfail(FAST_FAIL_INVALID_REFERENCE_COUNT);
@@ -41,6 +41,12 @@ extern "C"
  */
 #define EBPF_OBJECT_RELEASE_REFERENCE(object) ebpf_object_release_reference(object, EBPF_FILE_ID, __LINE__)
 
+/**
+ * @brief Macro to acquire a reference on an object unless it is being freed and record the file and line number of
+ * the reference.
+ */
+#define EBPF_OBJECT_TRY_ACQUIRE_REFERENCE(object) ebpf_object_try_acquire_reference(object, EBPF_FILE_ID, __LINE__)
+
 /**
  * @brief Macro to locate the next object in the object list and acquire a reference on it and record the file and
  * line number of the reference.
@@ -206,6 +212,19 @@ extern "C"
     void
     ebpf_object_release_reference(_Inout_opt_ ebpf_core_object_t* object, ebpf_file_id_t file_id, uint32_t line);
 
+    /**
+     * @brief Acquire a reference to this object unless its reference count has already reached zero. Callers that
+     *  found the object without holding a reference must be in an epoch so the object memory stays valid.
+     *
+     * @param[in,out] object Object on which to acquire a reference.
+     * @param[in] file_id The file ID of the caller.
+     * @param[in] line The line number of the caller.
+     * @retval true Reference was acquired.
+     * @retval false The object is being freed and no reference was acquired.
+     */
+    bool
+    ebpf_object_try_acquire_reference(_Inout_ ebpf_core_object_t* object, ebpf_file_id_t file_id, uint32_t line);
+
     /**
      * @brief Query the stored type of the object.
      *
@@ -279,6 +298,26 @@ extern "C"
     _Must_inspect_result_ ebpf_result_t
     ebpf_object_get_next_id(ebpf_id_t start_id, ebpf_object_type_t object_type, _Out_ ebpf_id_t* next_id);
 
+    /**
+     * @brief Find the IDs of objects of a given type that are greater than a given ID, in ascending order.
+     *
+     * @param[in] start_id ID to look for IDs after, or 0 to start from the first ID. The start_id need not exist.
+     * @param[in] object_type Type of object to find the IDs of.
+     * @param[in] id_capacity Maximum number of IDs to return.
+     * @param[out] ids Array that receives the IDs.
+     * @param[out] id_count Number of IDs written to ids.
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_INVALID_ARGUMENT The object type is not valid.
+     * @retval EBPF_NO_MORE_KEYS No such IDs found.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_object_get_next_ids(
+        ebpf_id_t start_id,
+        ebpf_object_type_t object_type,
+        uint32_t id_capacity,
+        _Out_writes_to_(id_capacity, *id_count) ebpf_id_t* ids,
+        _Out_ uint32_t* id_count);
+
     /**
      * @brief Find the corresponding handle in the handle table, verify the type matches,
      *  acquire a reference to the object and return it.
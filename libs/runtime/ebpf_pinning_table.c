@@ -13,20 +13,30 @@
 // Find returns a pointer to the ebpf_pinning_entry_t object. Comparison is done based on the value pointed to by the
 // key. Delete erases the entry from the ebpf_hash_table_t, but doesn't free the memory associated with the
 // ebpf_pinning_entry_t.
+// Find is on the program load path and doesn't take the table lock. The hash table uses epoch allocations and
+// entries are freed via the epoch, so a reader in an epoch can safely look up a path while it is being unpinned.
+// Ordered operations (get next path, enumeration, listing by prefix) use a sorted array of entry pointers that is
+// maintained under the table lock alongside the hash table, so each lookup is a binary search instead of a scan of
+// the whole hash table.
 
 #define EBPF_FILE_ID EBPF_FILE_ID_PINNING_TABLE
 
 #include "ebpf_core_structs.h"
+#include "ebpf_epoch.h"
 #include "ebpf_hash_table.h"
 #include "ebpf_object.h"
 #include "ebpf_pinning_table.h"
 #include "ebpf_tracelog.h"
 
 #define EBPF_PINNING_TABLE_BUCKET_COUNT 64
+#define EBPF_PINNING_TABLE_MINIMUM_SORTED_CAPACITY 16
 
 typedef struct _ebpf_pinning_table
 {
     _Guarded_by_(lock) ebpf_hash_table_t* hash_table;
+    _Guarded_by_(lock) _Field_size_(sorted_entry_capacity) ebpf_pinning_entry_t** sorted_entries; ///< Sorted by path.
+    _Guarded_by_(lock) size_t sorted_entry_count;
+    _Guarded_by_(lock) size_t sorted_entry_capacity;
     ebpf_lock_t lock;
 } ebpf_pinning_table_t;
 
@@ -45,8 +55,117 @@ _ebpf_pinning_entry_free(_Frees_ptr_opt_ ebpf_pinning_entry_t* pinning_entry)
         return;
     }
     EBPF_OBJECT_RELEASE_REFERENCE(pinning_entry->object);
-    ebpf_free(pinning_entry->path.value);
-    ebpf_free(pinning_entry);
+    // The path is stored inline. Lock-free readers may still be looking at the entry, so free it via the epoch.
+    ebpf_epoch_free(pinning_entry);
+}
+
+static int
+_ebpf_pinning_table_compare_path(_In_ const cxplat_utf8_string_t* str1, _In_ const cxplat_utf8_string_t* str2)
+{
+    size_t min_length = (str1->length < str2->length) ? str1->length : str2->length;
+
+    int result = memcmp(str1->value, str2->value, min_length);
+    if (result != 0) {
+        return result;
+    }
+
+    if (str1->length < str2->length) {
+        return -1;
+    }
+
+    if (str1->length > str2->length) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static bool
+_ebpf_pinning_entry_has_prefix(_In_ const ebpf_pinning_entry_t* entry, _In_ const cxplat_utf8_string_t* prefix)
+{
+    return (entry->path.length >= prefix->length) &&
+           (memcmp(entry->path.value, prefix->value, prefix->length) == 0);
+}
+
+static bool
+_ebpf_pinning_entry_matches_type(_In_ const ebpf_pinning_entry_t* entry, ebpf_object_type_t object_type)
+{
+    return (object_type == EBPF_OBJECT_UNKNOWN) || (ebpf_object_get_type(entry->object) == object_type);
+}
+
+/**
+ * @brief Find the position of a path in the sorted entry array.
+ *
+ * @param[in] pinning_table Pinning table to search. The table lock must be held.
+ * @param[in] path Path to search for.
+ * @param[in] after If true, skip an entry that matches path exactly.
+ * @return Index of the first entry whose path is greater than (or equal to, if after is false) path.
+ */
+_Requires_lock_held_(pinning_table->lock) static size_t _ebpf_pinning_table_sorted_position(
+    _In_ const ebpf_pinning_table_t* pinning_table, _In_ const cxplat_utf8_string_t* path, bool after)
+{
+    size_t low = 0;
+    size_t high = pinning_table->sorted_entry_count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        int result = _ebpf_pinning_table_compare_path(&pinning_table->sorted_entries[middle]->path, path);
+        if (result < 0 || (after && result == 0)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+_Requires_lock_held_(pinning_table->lock) static ebpf_result_t _ebpf_pinning_table_sorted_insert(
+    _Inout_ ebpf_pinning_table_t* pinning_table, _In_ ebpf_pinning_entry_t* entry)
+{
+    if (pinning_table->sorted_entry_count == pinning_table->sorted_entry_capacity) {
+        size_t new_capacity = pinning_table->sorted_entry_capacity * 2;
+        if (new_capacity < EBPF_PINNING_TABLE_MINIMUM_SORTED_CAPACITY) {
+            new_capacity = EBPF_PINNING_TABLE_MINIMUM_SORTED_CAPACITY;
+        }
+        ebpf_pinning_entry_t** new_entries =
+            ebpf_allocate_with_tag(new_capacity * sizeof(ebpf_pinning_entry_t*), EBPF_POOL_TAG_PINNING);
+        if (new_entries == NULL) {
+            return EBPF_NO_MEMORY;
+        }
+        if (pinning_table->sorted_entry_count > 0) {
+            memcpy(
+                new_entries,
+                pinning_table->sorted_entries,
+                pinning_table->sorted_entry_count * sizeof(ebpf_pinning_entry_t*));
+        }
+        ebpf_free(pinning_table->sorted_entries);
+        pinning_table->sorted_entries = new_entries;
+        pinning_table->sorted_entry_capacity = new_capacity;
+    }
+
+    size_t position = _ebpf_pinning_table_sorted_position(pinning_table, &entry->path, false);
+    memmove(
+        &pinning_table->sorted_entries[position + 1],
+        &pinning_table->sorted_entries[position],
+        (pinning_table->sorted_entry_count - position) * sizeof(ebpf_pinning_entry_t*));
+    pinning_table->sorted_entries[position] = entry;
+    pinning_table->sorted_entry_count++;
+    return EBPF_SUCCESS;
+}
+
+_Requires_lock_held_(pinning_table->lock) static void _ebpf_pinning_table_sorted_delete(
+    _Inout_ ebpf_pinning_table_t* pinning_table, _In_ const ebpf_pinning_entry_t* entry)
+{
+    size_t position = _ebpf_pinning_table_sorted_position(pinning_table, &entry->path, false);
+    ebpf_assert(position < pinning_table->sorted_entry_count);
+    ebpf_assert(pinning_table->sorted_entries[position] == entry);
+    if (position >= pinning_table->sorted_entry_count || pinning_table->sorted_entries[position] != entry) {
+        return;
+    }
+    pinning_table->sorted_entry_count--;
+    memmove(
+        &pinning_table->sorted_entries[position],
+        &pinning_table->sorted_entries[position + 1],
+        (pinning_table->sorted_entry_count - position) * sizeof(ebpf_pinning_entry_t*));
 }
 
 _Must_inspect_result_ ebpf_result_t
@@ -68,9 +187,7 @@ ebpf_pinning_table_allocate(ebpf_pinning_table_t** pinning_table)
         .key_size = sizeof(cxplat_utf8_string_t*),
         .value_size = sizeof(ebpf_pinning_entry_t*),
         .extract_function = _ebpf_pinning_table_extract,
-        .allocate = ebpf_allocate_with_tag,
         .allocation_tag = EBPF_POOL_TAG_PINNING,
-        .free = ebpf_free,
     };
 
     return_value = ebpf_hash_table_create(&(*pinning_table)->hash_table, &options);
@@ -110,6 +227,9 @@ ebpf_pinning_table_free(ebpf_pinning_table_t* pinning_table)
         ebpf_hash_table_destroy(pinning_table->hash_table);
     }
 
+    if (pinning_table) {
+        ebpf_free(pinning_table->sorted_entries);
+    }
     ebpf_free(pinning_table);
     pinning_table = NULL;
     EBPF_RETURN_VOID();
@@ -136,17 +256,16 @@ ebpf_pinning_table_insert(
         }
     }
 
-    new_pinning_entry = ebpf_allocate_with_tag(sizeof(ebpf_pinning_entry_t), EBPF_POOL_TAG_PINNING);
+    // Store the path inline so the entry can be freed via the epoch as a single allocation.
+    new_pinning_entry =
+        ebpf_epoch_allocate_with_tag(sizeof(ebpf_pinning_entry_t) + path->length, EBPF_POOL_TAG_PINNING);
     if (!new_pinning_entry) {
-        return_value = EBPF_NO_MEMORY;
-        goto Done;
-    }
-
-    return_value = ebpf_duplicate_utf8_string(&new_pinning_entry->path, path);
-    if (return_value != EBPF_SUCCESS) {
-        goto Done;
+        EBPF_RETURN_RESULT(EBPF_NO_MEMORY);
     }
 
+    new_pinning_entry->path.value = (uint8_t*)(new_pinning_entry + 1);
+    new_pinning_entry->path.length = path->length;
+    memcpy(new_pinning_entry->path.value, path->value, path->length);
     new_pinning_entry->object = object;
     EBPF_OBJECT_ACQUIRE_REFERENCE(object);
     new_key = &new_pinning_entry->path;
@@ -161,13 +280,17 @@ ebpf_pinning_table_insert(
     if (return_value == EBPF_KEY_ALREADY_EXISTS) {
         return_value = EBPF_OBJECT_ALREADY_EXISTS;
     } else if (return_value == EBPF_SUCCESS) {
-        new_pinning_entry = NULL;
-        ebpf_interlocked_increment_int32(&object->pinned_path_count);
+        return_value = _ebpf_pinning_table_sorted_insert(pinning_table, new_pinning_entry);
+        if (return_value != EBPF_SUCCESS) {
+            ebpf_assert_success(ebpf_hash_table_delete(pinning_table->hash_table, (const uint8_t*)&new_key));
+        } else {
+            new_pinning_entry = NULL;
+            ebpf_interlocked_increment_int32(&object->pinned_path_count);
+        }
     }
 
     ebpf_lock_unlock(&pinning_table->lock, state);
 
-Done:
     _ebpf_pinning_entry_free(new_pinning_entry);
     if (return_value == EBPF_SUCCESS) {
         EBPF_LOG_MESSAGE_UTF8_STRING(EBPF_TRACELOG_LEVEL_VERBOSE, EBPF_TRACELOG_KEYWORD_BASE, "Pinned object", path);
@@ -181,21 +304,28 @@ ebpf_pinning_table_find(
     ebpf_pinning_table_t* pinning_table, const cxplat_utf8_string_t* path, ebpf_core_object_t** object)
 {
     EBPF_LOG_ENTRY();
-    ebpf_lock_state_t state;
+    ebpf_epoch_state_t epoch_state;
     ebpf_result_t return_value;
     const cxplat_utf8_string_t* existing_key = path;
     ebpf_pinning_entry_t** existing_pinning_entry;
 
-    state = ebpf_lock_lock(&pinning_table->lock);
+    // Lookups don't take the table lock, so they never wait behind an insert, delete or enumeration. The epoch keeps
+    // the entry valid if it is unpinned concurrently.
+    ebpf_epoch_enter(&epoch_state);
     return_value = ebpf_hash_table_find(
         pinning_table->hash_table, (const uint8_t*)&existing_key, (uint8_t**)&existing_pinning_entry);
 
     if (return_value == EBPF_SUCCESS) {
-        *object = (*existing_pinning_entry)->object;
-        EBPF_OBJECT_ACQUIRE_REFERENCE(*object);
+        ebpf_core_object_t* found_object = (*existing_pinning_entry)->object;
+        // The entry may have been unpinned and its reference on the object released after the lookup.
+        if (EBPF_OBJECT_TRY_ACQUIRE_REFERENCE(found_object)) {
+            *object = found_object;
+        } else {
+            return_value = EBPF_KEY_NOT_FOUND;
+        }
     }
 
-    ebpf_lock_unlock(&pinning_table->lock, state);
+    ebpf_epoch_exit(&epoch_state);
 
     EBPF_RETURN_FUNCTION_RESULT(return_value);
 }
@@ -219,6 +349,8 @@ ebpf_pinning_table_delete(ebpf_pinning_table_t* pinning_table, const cxplat_utf8
         // If unable to remove the entry from the table, don't delete it.
         if (return_value != EBPF_SUCCESS) {
             entry = NULL;
+        } else {
+            _ebpf_pinning_table_sorted_delete(pinning_table, entry);
         }
     }
     ebpf_lock_unlock(&pinning_table->lock, state);
@@ -242,15 +374,38 @@ ebpf_pinning_table_enumerate_entries(
     ebpf_object_type_t object_type,
     _Out_ uint16_t* entry_count,
     _Outptr_result_buffer_maybenull_(*entry_count) ebpf_pinning_entry_t** pinning_entries)
+{
+    EBPF_LOG_ENTRY();
+    const cxplat_utf8_string_t empty_path = {0};
+
+    // EBPF_OBJECT_UNKNOWN matches every entry when listing by prefix, but no entry here.
+    if (object_type == EBPF_OBJECT_UNKNOWN) {
+        *entry_count = 0;
+        *pinning_entries = NULL;
+        EBPF_RETURN_RESULT(EBPF_SUCCESS);
+    }
+
+    EBPF_RETURN_RESULT(ebpf_pinning_table_enumerate_entries_with_prefix(
+        pinning_table, object_type, &empty_path, &empty_path, UINT16_MAX, entry_count, pinning_entries));
+}
+
+_Must_inspect_result_ ebpf_result_t
+ebpf_pinning_table_enumerate_entries_with_prefix(
+    _Inout_ ebpf_pinning_table_t* pinning_table,
+    ebpf_object_type_t object_type,
+    _In_ const cxplat_utf8_string_t* prefix,
+    _In_ const cxplat_utf8_string_t* start_path,
+    uint16_t max_entry_count,
+    _Out_ uint16_t* entry_count,
+    _Outptr_result_buffer_maybenull_(*entry_count) ebpf_pinning_entry_t** pinning_entries)
 {
     EBPF_LOG_ENTRY();
     ebpf_result_t result = EBPF_SUCCESS;
     ebpf_lock_state_t state = 0;
     bool lock_held = FALSE;
     uint16_t local_entry_count = 0;
-    uint16_t entries_array_length = 0;
+    size_t entries_array_length = 0;
     ebpf_pinning_entry_t* local_pinning_entries = NULL;
-    cxplat_utf8_string_t* next_object_path;
     ebpf_pinning_entry_t* new_entry = NULL;
 
     ebpf_assert(entry_count);
@@ -259,8 +414,20 @@ ebpf_pinning_table_enumerate_entries(
     state = ebpf_lock_lock(&pinning_table->lock);
     lock_held = TRUE;
 
-    // Get output array length by finding how many entries are there in the pinning table.
-    entries_array_length = (uint16_t)ebpf_hash_table_key_count(pinning_table->hash_table);
+    // Start at the first path under the prefix, or after start_path if that is further along.
+    size_t position = _ebpf_pinning_table_sorted_position(pinning_table, prefix, false);
+    if (start_path->length > 0) {
+        size_t start_position = _ebpf_pinning_table_sorted_position(pinning_table, start_path, true);
+        if (start_position > position) {
+            position = start_position;
+        }
+    }
+
+    // Size the output array by the number of entries that remain in the table.
+    entries_array_length = pinning_table->sorted_entry_count - position;
+    if (entries_array_length > max_entry_count) {
+        entries_array_length = max_entry_count;
+    }
 
     // Exit if there are no entries.
     if (entries_array_length == 0) {
@@ -274,45 +441,29 @@ ebpf_pinning_table_enumerate_entries(
         goto Exit;
     }
 
-    // Loop through the entries in the hashtable.
-    next_object_path = NULL;
-    for (;;) {
-        ebpf_pinning_entry_t** next_pinning_entry = NULL;
-
-        // Find next pinning entry, if any.
-        result = ebpf_hash_table_next_key_and_value(
-            pinning_table->hash_table,
-            (const uint8_t*)((next_object_path == NULL) ? NULL : &next_object_path),
-            (uint8_t*)&next_object_path,
-            (uint8_t**)&next_pinning_entry);
-
-        if (result == EBPF_NO_MORE_KEYS) {
-            // Reached end of hashtable.
-            result = EBPF_SUCCESS;
+    // Entries under the prefix are contiguous in the sorted array.
+    for (; position < pinning_table->sorted_entry_count && local_entry_count < entries_array_length; position++) {
+        ebpf_pinning_entry_t* next_pinning_entry = pinning_table->sorted_entries[position];
+        if (!_ebpf_pinning_entry_has_prefix(next_pinning_entry, prefix)) {
             break;
         }
 
-        if (result != EBPF_SUCCESS) {
-            goto Exit;
-        }
-
         // Skip entries that don't match the input object type.
-        if (object_type != ebpf_object_get_type((*next_pinning_entry)->object)) {
+        if (!_ebpf_pinning_entry_matches_type(next_pinning_entry, object_type)) {
             continue;
         }
 
         local_entry_count++;
-        ebpf_assert(local_entry_count <= entries_array_length);
 
         // Copy the next pinning entry to a new entry in the output array.
         new_entry = &local_pinning_entries[local_entry_count - 1];
-        new_entry->object = (*next_pinning_entry)->object;
+        new_entry->object = next_pinning_entry->object;
 
         // Take reference on underlying ebpf_object.
         EBPF_OBJECT_ACQUIRE_REFERENCE(new_entry->object);
 
         // Duplicate pinning object path.
-        result = ebpf_duplicate_utf8_string(&new_entry->path, &(*next_pinning_entry)->path);
+        result = ebpf_duplicate_utf8_string(&new_entry->path, &next_pinning_entry->path);
         if (result != EBPF_SUCCESS) {
             goto Exit;
         }
@@ -328,6 +479,9 @@ Exit:
         ebpf_pinning_entries_release(local_entry_count, local_pinning_entries);
         local_entry_count = 0;
         local_pinning_entries = NULL;
+    } else if (local_entry_count == 0) {
+        ebpf_free(local_pinning_entries);
+        local_pinning_entries = NULL;
     }
 
     // Set output parameters.
@@ -337,43 +491,6 @@ Exit:
     EBPF_RETURN_RESULT(result);
 }
 
-static bool
-_ebpf_pinning_table_match_object_type(_In_ void* filter_context, _In_ const uint8_t* key, _In_ const uint8_t* value)
-{
-    ebpf_object_type_t object_type = *(ebpf_object_type_t*)filter_context;
-    ebpf_pinning_entry_t* entry = *(ebpf_pinning_entry_t**)value;
-    UNREFERENCED_PARAMETER(key);
-
-    if (object_type == EBPF_OBJECT_UNKNOWN) {
-        return true;
-    }
-
-    return ebpf_object_get_type(entry->object) == object_type;
-}
-
-static int
-_ebpf_pinning_table_compare(_In_ const uint8_t* key1, _In_ const uint8_t* key2)
-{
-    const cxplat_utf8_string_t* str1 = *(const cxplat_utf8_string_t**)key1;
-    const cxplat_utf8_string_t* str2 = *(const cxplat_utf8_string_t**)key2;
-    size_t min_length = (str1->length < str2->length) ? str1->length : str2->length;
-
-    int result = memcmp(str1->value, str2->value, min_length);
-    if (result != 0) {
-        return result;
-    }
-
-    if (str1->length < str2->length) {
-        return -1;
-    }
-
-    if (str1->length > str2->length) {
-        return 1;
-    }
-
-    return 0;
-}
-
 _Must_inspect_result_ ebpf_result_t
 ebpf_pinning_table_get_next_path(
     _Inout_ ebpf_pinning_table_t* pinning_table,
@@ -386,35 +503,31 @@ ebpf_pinning_table_get_next_path(
         EBPF_RETURN_RESULT(EBPF_INVALID_ARGUMENT);
     }
 
-    const uint8_t* previous_key = (start_path->length == 0) ? NULL : (const uint8_t*)&start_path;
-
     ebpf_lock_state_t state = ebpf_lock_lock(&pinning_table->lock);
 
-    ebpf_result_t result;
-    ebpf_pinning_entry_t** next_pinning_entry = NULL;
+    ebpf_result_t result = EBPF_NO_MORE_KEYS;
+    ebpf_pinning_entry_t* next_pinning_entry = NULL;
 
     // Get the next entry in the table.
-    cxplat_utf8_string_t* next_object_path;
-    result = ebpf_hash_table_next_key_and_value_sorted(
-        pinning_table->hash_table,
-        previous_key,
-        _ebpf_pinning_table_compare,
-        object_type,
-        _ebpf_pinning_table_match_object_type,
-        (uint8_t*)&next_object_path,
-        (uint8_t**)&next_pinning_entry);
-    if (result != EBPF_SUCCESS) {
+    size_t position = _ebpf_pinning_table_sorted_position(pinning_table, start_path, true);
+    for (; position < pinning_table->sorted_entry_count; position++) {
+        if (_ebpf_pinning_entry_matches_type(pinning_table->sorted_entries[position], *object_type)) {
+            next_pinning_entry = pinning_table->sorted_entries[position];
+            break;
+        }
+    }
+    if (next_pinning_entry == NULL) {
         goto Exit;
     }
 
-    if (next_path->length < (*next_pinning_entry)->path.length) {
+    if (next_path->length < next_pinning_entry->path.length) {
         result = EBPF_INSUFFICIENT_BUFFER;
         goto Exit;
     }
 
-    next_path->length = (*next_pinning_entry)->path.length;
-    memcpy(next_path->value, (*next_pinning_entry)->path.value, next_path->length);
-    *object_type = ebpf_object_get_type((*next_pinning_entry)->object);
+    next_path->length = next_pinning_entry->path.length;
+    memcpy(next_path->value, next_pinning_entry->path.value, next_path->length);
+    *object_type = ebpf_object_get_type(next_pinning_entry->object);
     result = EBPF_SUCCESS;
 
 Exit:
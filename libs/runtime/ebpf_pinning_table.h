@@ -57,7 +57,8 @@ extern "C"
 
     /**
      * @brief Find an entry in the pinning table and acquire a reference on the
-     *  object associate with it.
+     *  object associate with it. This doesn't take the pinning table lock, so it
+     *  doesn't wait for concurrent updates or enumerations.
      *
      * @param[in] pinning_table Pinning table to search.
      * @param[in] path Path to find in the pinning table.
@@ -101,6 +102,31 @@ extern "C"
         _Out_ uint16_t* entry_count,
         _Outptr_result_buffer_maybenull_(*entry_count) ebpf_pinning_entry_t** pinning_entries);
 
+    /**
+     * @brief Returns entries in the pinning table whose path starts with a prefix, in path order, after acquiring a
+     * reference.
+     *
+     * @param[in, out] pinning_table Pinning table to enumerate.
+     * @param[in] object_type eBPF object type that will be used to filter pinning entries, may be EBPF_OBJECT_UNKNOWN.
+     * @param[in] prefix Prefix that returned paths start with. An empty prefix matches every path.
+     * @param[in] start_path Only paths greater than this are returned. An empty path starts at the first entry.
+     * @param[in] max_entry_count Maximum number of entries to return.
+     * @param[out] entry_count Number of pinning entries being returned.
+     * @param[out] pinning_entries Array of pinning entries being returned. Must be freed by caller
+     * using ebpf_pinning_entries_release().
+     * @retval EBPF_SUCCESS The operation was successful.
+     * @retval EBPF_NO_MEMORY Output array of entries could not be allocated.
+     */
+    _Must_inspect_result_ ebpf_result_t
+    ebpf_pinning_table_enumerate_entries_with_prefix(
+        _Inout_ ebpf_pinning_table_t* pinning_table,
+        ebpf_object_type_t object_type,
+        _In_ const cxplat_utf8_string_t* prefix,
+        _In_ const cxplat_utf8_string_t* start_path,
+        uint16_t max_entry_count,
+        _Out_ uint16_t* entry_count,
+        _Outptr_result_buffer_maybenull_(*entry_count) ebpf_pinning_entry_t** pinning_entries);
+
     /**
      * @brief Gets the next path in the pinning table after a given path.
      *
@@ -119,7 +145,8 @@ extern "C"
         _Inout_ cxplat_utf8_string_t* next_path);
 
     /**
-     * @brief Releases entries returned by ebpf_pinning_table_enumerate_entries.
+     * @brief Releases entries returned by ebpf_pinning_table_enumerate_entries or
+     * ebpf_pinning_table_enumerate_entries_with_prefix.
      * @param[in] entry_count Length of input array of entries.
      * @param[in] pinning_entries Array of entries to be released.
      */
@@ -36,6 +36,7 @@ extern "C"
 #define EBPF_UTF8_STRING_FROM_CONST_STRING(x) {((uint8_t*)(x)), sizeof((x)) - 1}
 
 #define EBPF_NS_PER_FILETIME 100
+#define EBPF_NS_PER_SECOND 1000000000
 #define EBPF_FILETIME_PER_MS 10000
 
     typedef struct _ebpf_timer_work_item ebpf_timer_work_item_t;
@@ -447,6 +448,16 @@ extern "C"
     int64_t
     ebpf_interlocked_decrement_int64_no_fence(_Inout_ volatile int64_t* addend);
 
+    /**
+     * @brief Atomically add value to addend and return the new value.
+     *
+     * @param[in, out] addend Value to add to.
+     * @param[in] value Value to add.
+     * @return The new value.
+     */
+    int64_t
+    ebpf_interlocked_add_int64_no_fence(_Inout_ volatile int64_t* addend, int64_t value);
+
     /**
      * @brief Performs an atomic operation that compares the input value pointed
      *  to by destination with the value of comparand and replaces it with
@@ -24,6 +24,7 @@
 #include <winsock2.h>
 #include <Windows.h>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <complex>
@@ -449,6 +450,367 @@ TEST_CASE("hash_table_stress_test", "[platform]")
     ebpf_hash_table_destroy(table);
 }
 
+TEST_CASE("hash_table_resize_test", "[platform]")
+{
+    _test_helper test_helper;
+    test_helper.initialize();
+
+    ebpf_hash_table_t* raw_ptr = nullptr;
+    const uint32_t key_count = 4096;
+    ebpf_hash_table_creation_options_t options = {
+        .key_size = sizeof(uint32_t),
+        .value_size = sizeof(uint64_t),
+        .minimum_bucket_count = 1,
+        .grow_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_GROW_LOAD_FACTOR_PERCENT,
+        .shrink_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT,
+    };
+
+    // Resizing requires epoch based free and a shrink threshold well below the grow threshold.
+    options.free = ebpf_free;
+    REQUIRE(ebpf_hash_table_create(&raw_ptr, &options) == EBPF_INVALID_ARGUMENT);
+    options.free = nullptr;
+    options.shrink_load_factor_percent = options.grow_load_factor_percent;
+    REQUIRE(ebpf_hash_table_create(&raw_ptr, &options) == EBPF_INVALID_ARGUMENT);
+    options.shrink_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT;
+
+    REQUIRE(ebpf_hash_table_create(&raw_ptr, &options) == EBPF_SUCCESS);
+    ebpf_hash_table_ptr table(raw_ptr);
+
+    // Grow the table from a single bucket, checking that every key stays reachable while buckets migrate.
+    for (uint32_t key = 0; key < key_count; key++) {
+        uint64_t value = static_cast<uint64_t>(key) * 3;
+        run_in_epoch([&]() {
+            REQUIRE(
+                ebpf_hash_table_update(
+                    table.get(),
+                    reinterpret_cast<const uint8_t*>(&key),
+                    reinterpret_cast<const uint8_t*>(&value),
+                    EBPF_HASH_TABLE_OPERATION_INSERT) == EBPF_SUCCESS);
+        });
+        if ((key % 512) == 0) {
+            run_in_epoch([&]() {
+                for (uint32_t existing_key = 0; existing_key <= key; existing_key++) {
+                    uint64_t* returned_value = nullptr;
+                    REQUIRE(
+                        ebpf_hash_table_find(
+                            table.get(),
+                            reinterpret_cast<const uint8_t*>(&existing_key),
+                            reinterpret_cast<uint8_t**>(&returned_value)) == EBPF_SUCCESS);
+                    REQUIRE(*returned_value == static_cast<uint64_t>(existing_key) * 3);
+                }
+            });
+        }
+    }
+    REQUIRE(ebpf_hash_table_key_count(table.get()) == key_count);
+
+    // Walk the table with next_key and verify each key is visited exactly once.
+    std::vector<bool> visited(key_count);
+    run_in_epoch([&]() {
+        uint32_t previous_key = 0;
+        uint32_t next_key = 0;
+        uint32_t* previous = nullptr;
+        while (ebpf_hash_table_next_key(
+                   table.get(), reinterpret_cast<const uint8_t*>(previous), reinterpret_cast<uint8_t*>(&next_key)) ==
+               EBPF_SUCCESS) {
+            REQUIRE(next_key < key_count);
+            REQUIRE(!visited[next_key]);
+            visited[next_key] = true;
+            previous_key = next_key;
+            previous = &previous_key;
+        }
+    });
+    REQUIRE(std::find(visited.begin(), visited.end(), false) == visited.end());
+
+    // Shrink the table back down, checking that the remaining keys stay reachable.
+    for (uint32_t key = 0; key < key_count; key++) {
+        run_in_epoch([&]() {
+            REQUIRE(ebpf_hash_table_delete(table.get(), reinterpret_cast<const uint8_t*>(&key)) == EBPF_SUCCESS);
+        });
+        if ((key % 512) == 0) {
+            run_in_epoch([&]() {
+                for (uint32_t existing_key = key + 1; existing_key < key_count; existing_key++) {
+                    uint64_t* returned_value = nullptr;
+                    REQUIRE(
+                        ebpf_hash_table_find(
+                            table.get(),
+                            reinterpret_cast<const uint8_t*>(&existing_key),
+                            reinterpret_cast<uint8_t**>(&returned_value)) == EBPF_SUCCESS);
+                }
+            });
+        }
+    }
+    REQUIRE(ebpf_hash_table_key_count(table.get()) == 0);
+}
+
+TEST_CASE("hash_table_next_key_resize_test", "[platform]")
+{
+    _test_helper test_helper;
+    test_helper.initialize();
+
+    ebpf_hash_table_t* raw_ptr = nullptr;
+    const uint32_t stable_key_count = 256;
+    const uint32_t extra_key_count = 4096;
+    const uint32_t keys_per_resize = 16;
+    ebpf_hash_table_creation_options_t options = {
+        .key_size = sizeof(uint32_t),
+        .value_size = sizeof(uint64_t),
+        .minimum_bucket_count = 1,
+        .grow_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_GROW_LOAD_FACTOR_PERCENT,
+        .shrink_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT,
+    };
+    REQUIRE(ebpf_hash_table_create(&raw_ptr, &options) == EBPF_SUCCESS);
+    ebpf_hash_table_ptr table(raw_ptr);
+
+    auto insert_keys = [&](uint32_t first_key, uint32_t last_key) {
+        for (uint32_t key = first_key; key < last_key; key++) {
+            uint64_t value = key;
+            run_in_epoch([&]() {
+                REQUIRE(
+                    ebpf_hash_table_update(
+                        table.get(),
+                        reinterpret_cast<const uint8_t*>(&key),
+                        reinterpret_cast<const uint8_t*>(&value),
+                        EBPF_HASH_TABLE_OPERATION_INSERT) == EBPF_SUCCESS);
+            });
+        }
+    };
+    auto delete_keys = [&](uint32_t first_key, uint32_t last_key) {
+        for (uint32_t key = first_key; key < last_key; key++) {
+            run_in_epoch([&]() {
+                REQUIRE(ebpf_hash_table_delete(table.get(), reinterpret_cast<const uint8_t*>(&key)) == EBPF_SUCCESS);
+            });
+        }
+    };
+
+    insert_keys(0, stable_key_count);
+
+    // Walk the stable keys with next_key, alternately growing the table well past its size and shrinking it back
+    // between calls. Every stable key must be returned exactly once, and no key may be returned twice.
+    std::vector<uint32_t> stable_visits(stable_key_count);
+    std::vector<uint32_t> extra_visits(extra_key_count);
+    bool extra_keys_present = false;
+    uint32_t returned_count = 0;
+    uint32_t previous_key = 0;
+    uint32_t* previous = nullptr;
+    for (;;) {
+        uint32_t next_key;
+        ebpf_result_t result = EBPF_SUCCESS;
+        run_in_epoch([&]() {
+            result = ebpf_hash_table_next_key(
+                table.get(), reinterpret_cast<const uint8_t*>(previous), reinterpret_cast<uint8_t*>(&next_key));
+        });
+        if (result == EBPF_NO_MORE_KEYS) {
+            break;
+        }
+        REQUIRE(result == EBPF_SUCCESS);
+        REQUIRE(next_key < stable_key_count + extra_key_count);
+        if (next_key < stable_key_count) {
+            stable_visits[next_key]++;
+        } else {
+            extra_visits[next_key - stable_key_count]++;
+        }
+        previous_key = next_key;
+        previous = &previous_key;
+
+        // Never resize away the previous key, so that the walk can resume from it.
+        if ((++returned_count % keys_per_resize) == 0 && next_key < stable_key_count) {
+            if (extra_keys_present) {
+                delete_keys(stable_key_count, stable_key_count + extra_key_count);
+            } else {
+                insert_keys(stable_key_count, stable_key_count + extra_key_count);
+            }
+            extra_keys_present = !extra_keys_present;
+        }
+    }
+
+    REQUIRE(std::all_of(stable_visits.begin(), stable_visits.end(), [](uint32_t count) { return count == 1; }));
+    REQUIRE(std::all_of(extra_visits.begin(), extra_visits.end(), [](uint32_t count) { return count <= 1; }));
+}
+
+TEST_CASE("hash_table_resize_concurrent_test", "[platform]")
+{
+    _test_helper test_helper;
+    test_helper.initialize();
+
+    ebpf_hash_table_t* raw_ptr = nullptr;
+    const uint32_t stable_key_count = 256;
+    const uint32_t churn_key_count = 4096;
+    const size_t iteration_passes = 50;
+    ebpf_hash_table_creation_options_t options = {
+        .key_size = sizeof(uint32_t),
+        .value_size = sizeof(uint64_t),
+        .minimum_bucket_count = 1,
+        .grow_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_GROW_LOAD_FACTOR_PERCENT,
+        .shrink_load_factor_percent = EBPF_HASH_TABLE_DEFAULT_SHRINK_LOAD_FACTOR_PERCENT,
+    };
+    REQUIRE(ebpf_hash_table_create(&raw_ptr, &options) == EBPF_SUCCESS);
+    ebpf_hash_table_ptr table(raw_ptr);
+
+    // Keys below stable_key_count are never removed. The writer repeatedly inserts and deletes the churn keys above
+    // them, so the table keeps growing and shrinking while the reader and the iterator run.
+    for (uint32_t key = 0; key < stable_key_count; key++) {
+        uint64_t value = key;
+        run_in_epoch([&]() {
+            REQUIRE(
+                ebpf_hash_table_update(
+                    table.get(),
+                    reinterpret_cast<const uint8_t*>(&key),
+                    reinterpret_cast<const uint8_t*>(&value),
+                    EBPF_HASH_TABLE_OPERATION_INSERT) == EBPF_SUCCESS);
+        });
+    }
+
+    std::atomic<bool> stop = false;
+    std::atomic<size_t> writer_errors = 0;
+    std::atomic<size_t> lookup_errors = 0;
+
+    auto writer = [&]() {
+        while (!stop) {
+            for (uint32_t key = stable_key_count; key < stable_key_count + churn_key_count; key++) {
+                uint64_t value = key;
+                run_in_epoch([&]() {
+                    if (ebpf_hash_table_update(
+                            table.get(),
+                            reinterpret_cast<const uint8_t*>(&key),
+                            reinterpret_cast<const uint8_t*>(&value),
+                            EBPF_HASH_TABLE_OPERATION_ANY) != EBPF_SUCCESS) {
+                        writer_errors++;
+                    }
+                });
+            }
+            for (uint32_t key = stable_key_count; key < stable_key_count + churn_key_count; key++) {
+                run_in_epoch([&]() {
+                    if (ebpf_hash_table_delete(table.get(), reinterpret_cast<const uint8_t*>(&key)) != EBPF_SUCCESS) {
+                        writer_errors++;
+                    }
+                });
+            }
+        }
+    };
+
+    auto reader = [&]() {
+        while (!stop) {
+            for (uint32_t key = 0; key < stable_key_count; key++) {
+                run_in_epoch([&]() {
+                    uint64_t* value = nullptr;
+                    if (ebpf_hash_table_find(
+                            table.get(),
+                            reinterpret_cast<const uint8_t*>(&key),
+                            reinterpret_cast<uint8_t**>(&value)) != EBPF_SUCCESS ||
+                        *value != key) {
+                        lookup_errors++;
+                    }
+                });
+            }
+        }
+    };
+
+    std::thread writer_thread(writer);
+    std::thread reader_thread(reader);
+
+    // Iterate in small batches, each in its own epoch, so that bucket arrays are swapped between calls. Every stable
+    // key must be returned exactly once per pass.
+    std::vector<uint32_t> visits(stable_key_count);
+    size_t iteration_errors = 0;
+    std::vector<const uint8_t*> keys(8);
+    std::vector<const uint8_t*> values(8);
+    for (size_t pass = 0; pass < iteration_passes; pass++) {
+        std::fill(visits.begin(), visits.end(), 0);
+        size_t cookie = 0;
+        ebpf_result_t result = EBPF_SUCCESS;
+        while (result == EBPF_SUCCESS || result == EBPF_INSUFFICIENT_BUFFER) {
+            size_t count = keys.size();
+            run_in_epoch([&]() {
+                result = ebpf_hash_table_iterate(table.get(), &cookie, &count, keys.data(), values.data());
+                if (result == EBPF_SUCCESS) {
+                    for (size_t index = 0; index < count; index++) {
+                        uint32_t key = *reinterpret_cast<const uint32_t*>(keys[index]);
+                        if (key < stable_key_count) {
+                            visits[key]++;
+                        }
+                    }
+                }
+            });
+            if (result == EBPF_INSUFFICIENT_BUFFER) {
+                keys.resize(count);
+                values.resize(count);
+            }
+        }
+        if (result != EBPF_NO_MORE_KEYS) {
+            iteration_errors++;
+        }
+        iteration_errors += static_cast<size_t>(
+            std::count_if(visits.begin(), visits.end(), [](uint32_t count) { return count != 1; }));
+    }
+
+    stop = true;
+    writer_thread.join();
+    reader_thread.join();
+
+    REQUIRE(iteration_errors == 0);
+    REQUIRE(writer_errors == 0);
+    REQUIRE(lookup_errors == 0);
+}
+
+TEST_CASE("hash_table_update_in_place_test", "[platform]")
+{
+    _test_helper test_helper;
+    test_helper.initialize();
+
+    ebpf_epoch_scope_t epoch_scope;
+    ebpf_hash_table_t* raw_ptr = nullptr;
+    const ebpf_hash_table_creation_options_t options = {
+        .key_size = sizeof(uint32_t),
+        .value_size = sizeof(uint64_t),
+        .update_in_place = true,
+    };
+    REQUIRE(ebpf_hash_table_create(&raw_ptr, &options) == EBPF_SUCCESS);
+    ebpf_hash_table_ptr table(raw_ptr);
+
+    uint32_t key = 1;
+    uint64_t value = 10;
+    uint64_t copied_value = 0;
+    uint8_t* first_value = nullptr;
+    uint8_t* returned_value = nullptr;
+    REQUIRE(
+        ebpf_hash_table_update(
+            table.get(),
+            reinterpret_cast<const uint8_t*>(&key),
+            reinterpret_cast<const uint8_t*>(&value),
+            EBPF_HASH_TABLE_OPERATION_INSERT) == EBPF_SUCCESS);
+    REQUIRE(ebpf_hash_table_find(table.get(), reinterpret_cast<const uint8_t*>(&key), &first_value) == EBPF_SUCCESS);
+
+    // Updating an existing key overwrites the value without moving it.
+    value = 20;
+    REQUIRE(
+        ebpf_hash_table_update(
+            table.get(),
+            reinterpret_cast<const uint8_t*>(&key),
+            reinterpret_cast<const uint8_t*>(&value),
+            EBPF_HASH_TABLE_OPERATION_REPLACE) == EBPF_SUCCESS);
+    REQUIRE(ebpf_hash_table_find(table.get(), reinterpret_cast<const uint8_t*>(&key), &returned_value) == EBPF_SUCCESS);
+    REQUIRE(returned_value == first_value);
+    ebpf_hash_table_copy_value(table.get(), returned_value, reinterpret_cast<uint8_t*>(&copied_value));
+    REQUIRE(copied_value == 20);
+
+    // A NULL value zeroes the existing value.
+    REQUIRE(
+        ebpf_hash_table_update(
+            table.get(), reinterpret_cast<const uint8_t*>(&key), nullptr, EBPF_HASH_TABLE_OPERATION_ANY) ==
+        EBPF_SUCCESS);
+    ebpf_hash_table_copy_value(table.get(), returned_value, reinterpret_cast<uint8_t*>(&copied_value));
+    REQUIRE(copied_value == 0);
+
+    // Inserting an existing key still fails.
+    REQUIRE(
+        ebpf_hash_table_update(
+            table.get(),
+            reinterpret_cast<const uint8_t*>(&key),
+            reinterpret_cast<const uint8_t*>(&value),
+            EBPF_HASH_TABLE_OPERATION_INSERT) == EBPF_OBJECT_ALREADY_EXISTS);
+    REQUIRE(ebpf_hash_table_key_count(table.get()) == 1);
+}
+
 TEST_CASE("pinning_test", "[platform]")
 {
     _test_helper test_helper;
@@ -528,6 +890,113 @@ TEST_CASE("pinning_test", "[platform]")
     another_object.signal.wait();
 }
 
+TEST_CASE("pinning_table_ordered_test", "[platform]")
+{
+    _test_helper test_helper;
+    test_helper.initialize();
+
+    struct _some_object
+    {
+        ebpf_core_object_t object{};
+        signal_t signal;
+    } an_object;
+    REQUIRE(
+        EBPF_OBJECT_INITIALIZE(
+            &an_object.object,
+            EBPF_OBJECT_MAP,
+            [](ebpf_core_object_t* object) { reinterpret_cast<_some_object*>(object)->signal.signal(); },
+            NULL,
+            NULL) == EBPF_SUCCESS);
+
+    ebpf_pinning_table_ptr pinning_table;
+    {
+        ebpf_pinning_table_t* local_pinning_table = nullptr;
+        REQUIRE(ebpf_pinning_table_allocate(&local_pinning_table) == EBPF_SUCCESS);
+        pinning_table.reset(local_pinning_table);
+    }
+
+    // Insert out of order, with enough paths to grow the sorted index.
+    std::vector<std::string> paths;
+    for (int i = 0; i < 40; i++) {
+        paths.push_back("app/" + std::to_string(i));
+        paths.push_back("app2/" + std::to_string(i));
+    }
+    paths.push_back("app");
+    paths.push_back("other");
+    for (auto it = paths.rbegin(); it != paths.rend(); it++) {
+        cxplat_utf8_string_t path = {(uint8_t*)it->data(), it->size()};
+        REQUIRE(ebpf_pinning_table_insert(pinning_table.get(), &path, &an_object.object) == EBPF_SUCCESS);
+    }
+    std::sort(paths.begin(), paths.end());
+
+    // Walk the table one path at a time.
+    std::vector<std::string> walked_paths;
+    std::string start_path;
+    for (;;) {
+        char buffer[EBPF_MAX_PIN_PATH_LENGTH];
+        cxplat_utf8_string_t start = {(uint8_t*)start_path.data(), start_path.size()};
+        cxplat_utf8_string_t next = {(uint8_t*)buffer, sizeof(buffer)};
+        ebpf_object_type_t object_type = EBPF_OBJECT_UNKNOWN;
+        ebpf_result_t result = ebpf_pinning_table_get_next_path(pinning_table.get(), &object_type, &start, &next);
+        if (result == EBPF_NO_MORE_KEYS) {
+            break;
+        }
+        REQUIRE(result == EBPF_SUCCESS);
+        REQUIRE(object_type == EBPF_OBJECT_MAP);
+        start_path.assign(buffer, next.length);
+        walked_paths.push_back(start_path);
+    }
+    REQUIRE(walked_paths == paths);
+
+    // List the paths under "app/" a page at a time. "app" and "app2/..." are not under it.
+    std::vector<std::string> expected_paths;
+    std::copy_if(paths.begin(), paths.end(), std::back_inserter(expected_paths), [](const std::string& path) {
+        return path.starts_with("app/");
+    });
+    REQUIRE(expected_paths.size() == 40);
+    std::vector<std::string> listed_paths;
+    cxplat_utf8_string_t prefix = CXPLAT_UTF8_STRING_FROM_CONST_STRING("app/");
+    start_path.clear();
+    for (;;) {
+        uint16_t entry_count = 0;
+        ebpf_pinning_entry_t* entries = nullptr;
+        cxplat_utf8_string_t start = {(uint8_t*)start_path.data(), start_path.size()};
+        REQUIRE(
+            ebpf_pinning_table_enumerate_entries_with_prefix(
+                pinning_table.get(), EBPF_OBJECT_UNKNOWN, &prefix, &start, 7, &entry_count, &entries) ==
+            EBPF_SUCCESS);
+        if (entry_count == 0) {
+            REQUIRE(entries == nullptr);
+            break;
+        }
+        REQUIRE(entry_count <= 7);
+        for (uint16_t i = 0; i < entry_count; i++) {
+            REQUIRE(entries[i].object == &an_object.object);
+            listed_paths.emplace_back((const char*)entries[i].path.value, entries[i].path.length);
+        }
+        start_path = listed_paths.back();
+        ebpf_pinning_entries_release(entry_count, entries);
+    }
+    REQUIRE(listed_paths == expected_paths);
+
+    // Removing a path removes it from the ordered index as well.
+    cxplat_utf8_string_t app = CXPLAT_UTF8_STRING_FROM_CONST_STRING("app");
+    REQUIRE(ebpf_pinning_table_delete(pinning_table.get(), &app) == EBPF_SUCCESS);
+    {
+        char buffer[EBPF_MAX_PIN_PATH_LENGTH];
+        cxplat_utf8_string_t start = {nullptr, 0};
+        cxplat_utf8_string_t next = {(uint8_t*)buffer, sizeof(buffer)};
+        ebpf_object_type_t object_type = EBPF_OBJECT_UNKNOWN;
+        REQUIRE(ebpf_pinning_table_get_next_path(pinning_table.get(), &object_type, &start, &next) == EBPF_SUCCESS);
+        REQUIRE(std::string(buffer, next.length) == "app/0");
+    }
+
+    ebpf_pinning_table_free(pinning_table.release());
+    REQUIRE(an_object.object.base.reference_count == 1);
+    EBPF_OBJECT_RELEASE_REFERENCE(&an_object.object);
+    an_object.signal.wait();
+}
+
 TEST_CASE("epoch_test_single_epoch", "[platform]")
 {
     _test_helper test_helper;
@@ -557,6 +1026,93 @@ TEST_CASE("epoch_test_single_epoch_cache_aligned", "[platform]")
     ebpf_epoch_synchronize();
 }
 
+TEST_CASE("epoch_test_statistics", "[platform]")
+{
+    _test_helper test_helper;
+    test_helper.initialize();
+    ebpf_epoch_statistics_t before;
+    ebpf_epoch_statistics_t after;
+
+    ebpf_epoch_get_statistics(&before);
+
+    ebpf_epoch_scope_t epoch_scope;
+    void* memory = ebpf_epoch_allocate(10);
+    ebpf_epoch_free(memory);
+
+    // The item can't be released while this thread is still in the epoch it was freed in.
+    ebpf_epoch_get_statistics(&after);
+    REQUIRE(after.free_list_depth >= 1);
+    REQUIRE(after.maximum_free_list_depth >= 1);
+
+    epoch_scope.exit();
+    ebpf_epoch_synchronize();
+
+    ebpf_epoch_get_statistics(&after);
+    REQUIRE(after.round_count > before.round_count);
+    REQUIRE(after.maximum_round_duration >= after.last_round_duration);
+    REQUIRE(after.total_round_duration >= after.maximum_round_duration);
+}
+
+TEST_CASE("epoch_test_tree_release_epoch", "[platform]")
+{
+    // A fan-out of 1 makes the release epoch computation tree a chain, so CPU n is n levels below CPU 0.
+    ebpf_epoch_set_tree_fanout(1);
+    _test_helper test_helper;
+    test_helper.initialize();
+    _signal entered;
+    _signal release;
+
+    uint32_t cpu_count = ebpf_get_cpu_count();
+    if (cpu_count < 3) {
+        return;
+    }
+
+    // Hold an epoch on the deepest CPU, at least two levels below CPU 0.
+    uint32_t deepest_cpu = cpu_count - 1;
+    uint64_t held_epoch = 0;
+    std::thread holder([&]() {
+        GROUP_AFFINITY old_thread_affinity;
+        ebpf_assert_success(ebpf_set_current_thread_cpu_affinity(deepest_cpu, &old_thread_affinity));
+        ebpf_epoch_state_t epoch_state = {0};
+        ebpf_epoch_enter(&epoch_state);
+        held_epoch = epoch_state.epoch;
+        entered.signal();
+        release.wait();
+        ebpf_epoch_exit(&epoch_state);
+        ebpf_restore_current_thread_cpu_affinity(&old_thread_affinity);
+    });
+    entered.wait();
+
+    // Free memory on CPU 0 while the deepest CPU is still in its epoch.
+    {
+        GROUP_AFFINITY old_thread_affinity;
+        ebpf_assert_success(ebpf_set_current_thread_cpu_affinity(0, &old_thread_affinity));
+        ebpf_epoch_scope_t epoch_scope;
+        void* memory = ebpf_epoch_allocate(10);
+        ebpf_epoch_free(memory);
+        epoch_scope.exit();
+        ebpf_restore_current_thread_cpu_affinity(&old_thread_affinity);
+    }
+
+    // The deepest CPU's epoch must propagate up the whole chain, holding the release epoch below it. Check the
+    // results after the holder has exited, so that a failure doesn't leave it waiting.
+    ebpf_epoch_statistics_t statistics;
+    ebpf_epoch_flush();
+    ebpf_epoch_get_statistics(&statistics);
+    uint64_t held_released_epoch = statistics.last_released_epoch;
+    bool held_free_list_empty = ebpf_epoch_is_free_list_empty(0);
+
+    release.signal();
+    holder.join();
+    REQUIRE(held_released_epoch < held_epoch);
+    REQUIRE(!held_free_list_empty);
+
+    ebpf_epoch_synchronize();
+    ebpf_epoch_get_statistics(&statistics);
+    REQUIRE(statistics.last_released_epoch >= held_epoch);
+    REQUIRE(ebpf_epoch_is_free_list_empty(0));
+}
+
 TEST_CASE("epoch_test_two_threads", "[platform]")
 {
     _test_helper test_helper;
@@ -882,5 +882,6 @@ ebpf_service_initialize() noexcept
 void
 ebpf_service_cleanup() noexcept
 {
+    ebpf_verification_cache_invalidate(nullptr);
     clean_up_async_device_handle();
 }
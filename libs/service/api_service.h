@@ -67,6 +67,22 @@ ebpf_verify_sys_file_signature(
     size_t eku_count,
     _In_reads_(eku_count) const char** eku_list);
 
+/**
+ * @brief Drop cached verification results. Programs loaded afterwards are verified again.
+ *
+ * @param[in] program_type Program type whose results are dropped, or nullptr to drop all results.
+ */
+void
+ebpf_verification_cache_invalidate(_In_opt_ const GUID* program_type) noexcept;
+
+/**
+ * @brief Get the number of programs whose successful verification is cached.
+ *
+ * @returns Number of cached verification results.
+ */
+size_t
+ebpf_verification_cache_get_count() noexcept;
+
 uint32_t
 ebpf_service_initialize() noexcept;
 
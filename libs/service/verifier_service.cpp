@@ -3,19 +3,230 @@
 
 #include "Verifier.h"
 #include "api_common.hpp"
+#include "api_service.h"
 #include "ebpf_api.h"
 #include "ebpf_shared_framework.h"
 #include "ebpf_verifier_wrapper.hpp"
+#include "hash.h"
 #include "platform.hpp"
 #include "windows_platform_service.hpp"
 
+#include <algorithm>
+#include <deque>
 #include <filesystem>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <sys/stat.h>
 
 bool g_ebpf_fuzzing_enabled = false;
 
+// Maximum number of successful verification results kept in the verification cache.
+#define EBPF_VERIFICATION_CACHE_MAX_ENTRIES 1024
+
+struct guid_compare
+{
+    bool
+    operator()(_In_ const GUID& a, _In_ const GUID& b) const
+    {
+        return (memcmp(&a, &b, sizeof(GUID)) < 0);
+    }
+};
+
+// Programs that passed verification, keyed by a SHA256 hash of everything the verifier consumes: the program type
+// information, the byte code and the map descriptors. Map file descriptors differ from one load to the next, so they
+// are replaced by the index of the map descriptor before hashing.
+static std::mutex _verification_cache_lock;
+static std::map<std::vector<uint8_t>, GUID> _verification_cache;
+static std::deque<std::vector<uint8_t>> _verification_cache_insertion_order;
+
+// Hash of the program information last seen for each program type. When an extension changes the information for
+// a program type, all results cached for that program type are dropped.
+static std::map<GUID, std::vector<uint8_t>, guid_compare> _verification_cache_program_info_hashes;
+
+template <typename T>
+static void
+_append_to_cache_key(_Inout_ std::vector<uint8_t>& key, const T& value)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    key.insert(key.end(), bytes, bytes + sizeof(value));
+}
+
+static void
+_append_string_to_cache_key(_Inout_ std::vector<uint8_t>& key, _In_opt_z_ const char* value)
+{
+    if (value != nullptr) {
+        key.insert(key.end(), value, value + strlen(value));
+    }
+    key.push_back(0);
+}
+
+static void
+_append_helper_prototypes_to_cache_key(
+    _Inout_ std::vector<uint8_t>& key,
+    uint32_t count,
+    _In_reads_opt_(count) const ebpf_helper_function_prototype_t* prototypes)
+{
+    _append_to_cache_key(key, count);
+    for (uint32_t index = 0; index < count; index++) {
+        const ebpf_helper_function_prototype_t& prototype = prototypes[index];
+        _append_to_cache_key(key, prototype.helper_id);
+        _append_string_to_cache_key(key, prototype.name);
+        _append_to_cache_key(key, prototype.return_type);
+        _append_to_cache_key(key, prototype.arguments);
+        _append_to_cache_key(key, static_cast<bool>(prototype.flags.reallocate_packet));
+        _append_to_cache_key(key, prototype.implicit_context);
+    }
+}
+
+/**
+ * @brief Compute the hash of the program information, covering the same fields as the program information hash
+ * computed by the execution context, but for all helpers rather than only the ones used by a program.
+ */
+static std::vector<uint8_t>
+_compute_program_info_hash(_In_ const ebpf_program_info_t* program_info)
+{
+    std::vector<uint8_t> data;
+    const ebpf_program_type_descriptor_t* descriptor = program_info->program_type_descriptor;
+    if (descriptor != nullptr) {
+        _append_string_to_cache_key(data, descriptor->name);
+        if (descriptor->context_descriptor != nullptr) {
+            _append_to_cache_key(data, *descriptor->context_descriptor);
+        }
+        _append_to_cache_key(data, descriptor->program_type);
+        _append_to_cache_key(data, descriptor->bpf_prog_type);
+        _append_to_cache_key(data, descriptor->is_privileged);
+    }
+    _append_helper_prototypes_to_cache_key(
+        data,
+        program_info->count_of_program_type_specific_helpers,
+        program_info->program_type_specific_helper_prototype);
+    _append_helper_prototypes_to_cache_key(
+        data, program_info->count_of_global_helpers, program_info->global_helper_prototype);
+
+    hash_t hash("SHA256");
+    return hash.hash_byte_ranges({{data.data(), data.size()}});
+}
+
+static std::vector<uint8_t>
+_compute_verification_cache_key(
+    _In_ const std::vector<uint8_t>& program_info_hash, _In_ const std::vector<ebpf_inst>& instructions)
+{
+    std::vector<map_cache_t>& map_descriptors = get_all_map_descriptors();
+    auto map_index = [&](int original_fd) {
+        for (size_t index = 0; index < map_descriptors.size(); index++) {
+            if (map_descriptors[index].verifier_map_descriptor.original_fd == original_fd) {
+                return static_cast<int32_t>(index);
+            }
+        }
+        return -1;
+    };
+
+    std::vector<uint8_t> data(program_info_hash);
+    _append_to_cache_key(data, map_descriptors.size());
+    for (const auto& map_descriptor : map_descriptors) {
+        const prevail::EbpfMapDescriptor& descriptor = map_descriptor.verifier_map_descriptor;
+        _append_to_cache_key(data, descriptor.type);
+        _append_to_cache_key(data, descriptor.key_size);
+        _append_to_cache_key(data, descriptor.value_size);
+        _append_to_cache_key(data, descriptor.max_entries);
+        _append_to_cache_key(data, map_index(descriptor.inner_map_fd));
+    }
+
+    _append_to_cache_key(data, instructions.size());
+    for (size_t index = 0; index < instructions.size(); index++) {
+        ebpf_inst instruction = instructions[index];
+        // Replace the map file descriptor in LDDW instructions that reference a map.
+        if (instruction.opcode == prevail::INST_OP_LDDW_IMM && (instruction.src == 1 || instruction.src == 2)) {
+            int32_t mapped_index = map_index(instruction.imm);
+            if (mapped_index >= 0) {
+                instruction.imm = mapped_index;
+            }
+        }
+        _append_to_cache_key(data, instruction);
+    }
+
+    hash_t hash("SHA256");
+    return hash.hash_byte_ranges({{data.data(), data.size()}});
+}
+
+// Erase the cached results of a program type, keeping the insertion order in step with the cache so that eviction
+// never drops an entry ahead of its time. Must be called with _verification_cache_lock held.
+static void
+_verification_cache_erase_program_type(const GUID& program_type)
+{
+    for (auto entry = _verification_cache.begin(); entry != _verification_cache.end();) {
+        if (IsEqualGUID(entry->second, program_type)) {
+            entry = _verification_cache.erase(entry);
+        } else {
+            entry++;
+        }
+    }
+
+    auto end = std::remove_if(
+        _verification_cache_insertion_order.begin(),
+        _verification_cache_insertion_order.end(),
+        [](const std::vector<uint8_t>& key) { return _verification_cache.find(key) == _verification_cache.end(); });
+    _verification_cache_insertion_order.erase(end, _verification_cache_insertion_order.end());
+}
+
+static bool
+_verification_cache_find(
+    const GUID& program_type, _In_ const std::vector<uint8_t>& program_info_hash, _In_ const std::vector<uint8_t>& key)
+{
+    std::unique_lock lock(_verification_cache_lock);
+
+    auto it = _verification_cache_program_info_hashes.find(program_type);
+    if (it != _verification_cache_program_info_hashes.end() && it->second != program_info_hash) {
+        // The program information changed since the cached results were computed.
+        _verification_cache_erase_program_type(program_type);
+    }
+    _verification_cache_program_info_hashes[program_type] = program_info_hash;
+
+    return _verification_cache.find(key) != _verification_cache.end();
+}
+
+static void
+_verification_cache_insert(const GUID& program_type, _In_ const std::vector<uint8_t>& key)
+{
+    std::unique_lock lock(_verification_cache_lock);
+
+    if (!_verification_cache.emplace(key, program_type).second) {
+        return;
+    }
+    _verification_cache_insertion_order.push_back(key);
+
+    // Evict the oldest results. The insertion order holds exactly the keys in the cache.
+    while (_verification_cache.size() > EBPF_VERIFICATION_CACHE_MAX_ENTRIES) {
+        _verification_cache.erase(_verification_cache_insertion_order.front());
+        _verification_cache_insertion_order.pop_front();
+    }
+}
+
+void
+ebpf_verification_cache_invalidate(_In_opt_ const GUID* program_type) noexcept
+{
+    std::unique_lock lock(_verification_cache_lock);
+
+    if (program_type == nullptr) {
+        _verification_cache.clear();
+        _verification_cache_insertion_order.clear();
+        _verification_cache_program_info_hashes.clear();
+        return;
+    }
+
+    _verification_cache_erase_program_type(*program_type);
+    _verification_cache_program_info_hashes.erase(*program_type);
+}
+
+size_t
+ebpf_verification_cache_get_count() noexcept
+{
+    std::unique_lock lock(_verification_cache_lock);
+    return _verification_cache.size();
+}
+
 static ebpf_result_t
 _analyze(prevail::RawProgram& raw_prog, const char** error_message, uint32_t* error_message_size = nullptr)
 {
@@ -72,5 +283,33 @@ verify_byte_code(
 
     prevail::RawProgram raw_prog{file, section, 0, {}, instructions, info};
 
-    return _analyze(raw_prog, error_message, error_message_size);
+    // The cache is bypassed when fuzzing, as the verifier options differ.
+    std::vector<uint8_t> program_info_hash;
+    std::vector<uint8_t> cache_key;
+    if (!g_ebpf_fuzzing_enabled) {
+        const ebpf_program_info_t* program_info;
+        if (get_program_info_from_tls(*program_type, &program_info) == EBPF_SUCCESS) {
+            try {
+                program_info_hash = _compute_program_info_hash(program_info);
+                cache_key = _compute_verification_cache_key(program_info_hash, instructions);
+                if (_verification_cache_find(*program_type, program_info_hash, cache_key)) {
+                    return EBPF_SUCCESS;
+                }
+            } catch (const std::exception&) {
+                // Failing to use the cache is not fatal, fall back to verifying the program.
+                cache_key.clear();
+            }
+        }
+    }
+
+    ebpf_result_t result = _analyze(raw_prog, error_message, error_message_size);
+    if (result == EBPF_SUCCESS && !cache_key.empty()) {
+        try {
+            _verification_cache_insert(*program_type, cache_key);
+        } catch (const std::bad_alloc&) {
+            // The program is verified even if its result could not be cached.
+        }
+    }
+
+    return result;
 }
@@ -24,6 +24,15 @@ typedef struct _ebpf_ring_buffer_record
     uint8_t data[1];
 } ebpf_ring_buffer_record_t;
 
+/**
+ * @brief Prefix stored ahead of the data of each record in a sub-ring of a per-CPU ring buffer map
+ * (EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU). Consumers strip it before indicating the record.
+ */
+typedef struct _ebpf_ring_buffer_per_cpu_record_prefix
+{
+    uint64_t timestamp; ///< Time since boot (in 100ns units) at which the record was reserved.
+} ebpf_ring_buffer_per_cpu_record_prefix_t;
+
 /**
  * @brief Determine if the record is locked.
  *
@@ -100,7 +100,9 @@ size_t _ebpf_native_program_entry_supported_size[] = {EBPF_NATIVE_PROGRAM_ENTRY_
 
 #define EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_SIZE_0 \
     EBPF_SIZE_INCLUDING_FIELD(program_runtime_context_t, global_variable_section_data)
-size_t _ebpf_native_program_runtime_context_supported_size[] = {EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_SIZE_0};
+#define EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_SIZE_1 EBPF_SIZE_INCLUDING_FIELD(program_runtime_context_t, map_value_data)
+size_t _ebpf_native_program_runtime_context_supported_size[] = {
+    EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_SIZE_0, EBPF_NATIVE_PROGRAM_RUNTIME_CONTEXT_SIZE_1};
 
 #define EBPF_NATIVE_MAP_INITIAL_VALUES_SIZE_0 EBPF_SIZE_INCLUDING_FIELD(map_initial_values_t, values)
 size_t _ebpf_native_map_initial_values_supported_size[] = {EBPF_NATIVE_MAP_INITIAL_VALUES_SIZE_0};
@@ -246,6 +246,7 @@ net_ebpf_extension_wfp_filter_context_create(
     ebpf_result_t result = EBPF_SUCCESS;
     net_ebpf_extension_wfp_filter_context_t* local_filter_context = NULL;
     uint32_t client_context_count_max = NET_EBPF_EXT_MAX_CLIENTS_PER_HOOK_SINGLE_ATTACH;
+    KIRQL old_irql;
 
     NET_EBPF_EXT_LOG_ENTRY();
 
@@ -300,6 +301,13 @@ net_ebpf_extension_wfp_filter_context_create(
         goto Exit;
     }
 
+    // Publish the dispatch array for the first client before the caller adds any WFP filters, so that classify never
+    // runs on a live filter without the client's program.
+    old_irql = ExAcquireSpinLockExclusive(&local_filter_context->lock);
+    net_ebpf_extension_hook_publish_dispatch_array(
+        local_filter_context, &((net_ebpf_extension_hook_client_t*)client_context)->attach_dispatch_array);
+    ExReleaseSpinLockExclusive(&local_filter_context->lock, old_irql);
+
     *filter_context = local_filter_context;
     local_filter_context = NULL;
 
@@ -1093,6 +1101,10 @@ net_ebpf_ext_add_client_context(
     net_ebpf_extension_hook_client_set_provider_data(
         (struct _net_ebpf_extension_hook_client*)hook_client, (void*)filter_context);
 
+    // Publish the new set of programs.
+    net_ebpf_extension_hook_publish_dispatch_array(
+        filter_context, &((struct _net_ebpf_extension_hook_client*)hook_client)->attach_dispatch_array);
+
 Exit:
     ExReleaseSpinLockExclusive(&filter_context->lock, old_irql);
     NET_EBPF_EXT_RETURN_RESULT(result);
@@ -1127,6 +1139,11 @@ net_ebpf_ext_remove_client_context(
         filter_context->client_contexts[filter_context->client_context_count] = NULL;
     }
 
+    // Publish the remaining programs. The previous dispatch array keeps the client under rundown protection until
+    // no invocation can still be using it.
+    net_ebpf_extension_hook_publish_dispatch_array(
+        filter_context, &((struct _net_ebpf_extension_hook_client*)hook_client)->detach_dispatch_array);
+
     ExReleaseSpinLockExclusive(&filter_context->lock, old_irql);
 }
 
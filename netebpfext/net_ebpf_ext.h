@@ -135,6 +135,8 @@ typedef struct _net_ebpf_extension_wfp_filter_context
     _Guarded_by_(lock) uint32_t client_context_count;                   ///< Current number of hook NPI clients.
     const struct _net_ebpf_extension_hook_provider* provider_context;   ///< Pointer to provider binding context.
 
+    struct _net_ebpf_extension_hook_dispatch_array* volatile dispatch_array; ///< Published dispatch array.
+
     net_ebpf_ext_wfp_filter_id_t* filter_ids; ///< Array of WFP filter Ids.
     uint32_t filter_ids_count;                ///< Number of WFP filter Ids.
 
@@ -144,6 +146,42 @@ typedef struct _net_ebpf_extension_wfp_filter_context
     HANDLE wfp_engine_handle;  ///< WFP engine handle.
 } net_ebpf_extension_wfp_filter_context_t;
 
+typedef struct _net_ebpf_extension_hook_dispatch_entry
+{
+    ebpf_program_invoke_function_t invoke_program; ///< Pointer to function to invoke eBPF program.
+    const void* client_binding_context;            ///< Client supplied context to be passed to invoke_program.
+} net_ebpf_extension_hook_dispatch_entry_t;
+
+/**
+ * Immutable snapshot of the programs attached to a filter context. A new dispatch array is built and published each
+ * time a client attaches to or detaches from the filter context, so the classify path only has to load the published
+ * pointer. The array holds rundown protection on each of its clients until it is retired. For hooks whose programs
+ * run at DISPATCH_LEVEL, that happens once every processor has run a DPC queued after the array was unpublished. For
+ * hooks whose programs run at PASSIVE_LEVEL, invocations hold a reference on the array instead, and it is retired
+ * when the last reference is released.
+ */
+typedef struct _net_ebpf_extension_hook_dispatch_array
+{
+    uint32_t count;                                          ///< Number of programs in the array.
+    net_ebpf_extension_hook_process_verdict process_verdict; ///< Callback to decide whether to continue.
+    net_ebpf_extension_hook_dispatch_entry_t
+        entries[NET_EBPF_EXT_MAX_CLIENTS_PER_HOOK_MULTI_ATTACH]; ///< Programs to invoke, in attach order.
+    struct _net_ebpf_extension_hook_client*
+        clients[NET_EBPF_EXT_MAX_CLIENTS_PER_HOOK_MULTI_ATTACH]; ///< Hook NPI clients under rundown protection.
+    bool reference_counted;                                      ///< True if retired by reference count.
+    volatile long reference_count;                               ///< References, if reference_counted.
+    volatile long retire_pending_count;                          ///< Number of retire DPCs yet to run.
+    uint32_t processor_count;                                    ///< Number of entries in retire_dpcs.
+    _Field_size_(processor_count) KDPC retire_dpcs[1];           ///< One retire DPC per processor.
+} net_ebpf_extension_hook_dispatch_array_t;
+
+typedef struct _net_ebpf_extension_hook_client_set
+{
+    const net_ebpf_extension_hook_dispatch_array_t* dispatch_array; ///< Dispatch array, or NULL if no clients.
+    KIRQL old_irql;                                                 ///< IRQL to restore when the set is released.
+    bool irql_raised;                                               ///< True if the IRQL was raised on acquire.
+} net_ebpf_extension_hook_client_set_t;
+
 /**
  * @brief Structure that holds objects related to WFP that require cleanup.
  */
@@ -176,6 +214,7 @@ typedef struct _net_ebpf_extension_wfp_cleanup_state
         ExFreePool((filter_context)->client_contexts);                      \
     }                                                                       \
     PRAGMA_WARNING_POP                                                      \
+    net_ebpf_extension_hook_unpublish_dispatch_array((filter_context));     \
     if ((filter_context)->wfp_engine_handle != NULL) {                      \
         FwpmEngineClose((filter_context)->wfp_engine_handle);               \
     }                                                                       \
@@ -197,7 +236,8 @@ typedef struct _net_ebpf_extension_wfp_cleanup_state
 
 /**
  * @brief This function allocates and initializes a net ebpf extension WFP filter context. This should be invoked when
- * the hook client is being attached.
+ * the hook client is being attached. On success, the dispatch array of the client has been published, so the caller
+ * can add WFP filters right away.
  *
  * @param[in] filter_context_size Size in bytes of the filter context.
  * @param[in] client_context Pointer to hook client being attached.
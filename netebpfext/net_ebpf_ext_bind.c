@@ -176,7 +176,9 @@ net_ebpf_ext_bind_register_providers()
     const net_ebpf_extension_program_info_provider_parameters_t program_info_provider_parameters = {
         &_ebpf_bind_program_info_provider_moduleid, &_ebpf_bind_program_data};
     const net_ebpf_extension_hook_provider_parameters_t hook_provider_parameters = {
-        &_ebpf_bind_hook_provider_moduleid, &_net_ebpf_bind_hook_provider_data};
+        &_ebpf_bind_hook_provider_moduleid,
+        &_net_ebpf_bind_hook_provider_data,
+        _ebpf_bind_program_data.required_irql};
     const net_ebpf_extension_hook_provider_dispatch_table_t dispatch_table = {
         .create_filter_context = _net_ebpf_ext_bind_create_filter_context,
         .delete_filter_context = _net_ebpf_ext_bind_delete_filter_context,
@@ -107,6 +107,10 @@ _net_ebpf_extension_detach_client_completion(_In_ DEVICE_OBJECT* device_object,
     // Wait for any in progress callbacks to complete.
     _ebpf_ext_wait_for_rundown(&hook_client->rundown);
 
+    // The rundown on the client is released from a retire DPC, which may still be running. Wait for it to return
+    // before the client, and possibly the driver, go away.
+    KeFlushQueuedDpcs();
+
     IoFreeWorkItem(work_item);
 
     // Note: This frees the provider binding context (hook_client).
@@ -185,10 +189,10 @@ net_ebpf_extension_hook_provider_get_attach_capability(_In_ const net_ebpf_exten
 
 __forceinline _Must_inspect_result_ static ebpf_result_t
 _net_ebpf_extension_hook_invoke_single_program(
-    _In_ const net_ebpf_extension_hook_client_t* client, _Inout_ void* context, _Out_ uint32_t* result)
+    _In_ const net_ebpf_extension_hook_dispatch_entry_t* entry, _Inout_ void* context, _Out_ uint32_t* result)
 {
-    ebpf_program_invoke_function_t invoke_program = client->invoke_program;
-    const void* client_binding_context = client->client_binding_context;
+    ebpf_program_invoke_function_t invoke_program = entry->invoke_program;
+    const void* client_binding_context = entry->client_binding_context;
 
     return invoke_program(client_binding_context, context, result);
 }
@@ -206,72 +210,291 @@ _net_ebpf_extension_release_rundown_for_clients(
     }
 }
 
-ebpf_result_t
-net_ebpf_extension_hook_invoke_programs(
-    _Inout_ void* program_context, _In_ net_ebpf_extension_wfp_filter_context_t* filter_context, _Out_ uint32_t* result)
+/**
+ * @brief Allocate an empty dispatch array, with one retire DPC per processor.
+ *
+ * @returns Pointer to the dispatch array, or NULL if the allocation failed.
+ */
+static net_ebpf_extension_hook_dispatch_array_t*
+_net_ebpf_extension_hook_allocate_dispatch_array()
 {
-    ebpf_result_t program_result = EBPF_SUCCESS;
-    KIRQL old_irql = PASSIVE_LEVEL;
-    bool lock_acquired = FALSE;
-    uint32_t client_count = 0;
-    net_ebpf_extension_hook_client_t* clients[NET_EBPF_EXT_MAX_CLIENTS_PER_HOOK_MULTI_ATTACH] = {0};
-    const net_ebpf_extension_hook_process_verdict process_verdict =
-        filter_context->provider_context->dispatch.process_verdict;
+    uint32_t processor_count = KeQueryMaximumProcessorCountEx(ALL_PROCESSOR_GROUPS);
+    size_t size = FIELD_OFFSET(net_ebpf_extension_hook_dispatch_array_t, retire_dpcs) + processor_count * sizeof(KDPC);
+    net_ebpf_extension_hook_dispatch_array_t* dispatch_array =
+        (net_ebpf_extension_hook_dispatch_array_t*)ExAllocatePoolUninitialized(
+            NonPagedPoolNx, size, NET_EBPF_EXTENSION_POOL_TAG);
+    if (dispatch_array != NULL) {
+        memset(dispatch_array, 0, size);
+        dispatch_array->processor_count = processor_count;
+    }
 
-    *result = 0;
+    return dispatch_array;
+}
+
+/**
+ * @brief Release rundown on the clients of a dispatch array and free it.
+ *
+ * @param[in] dispatch_array Dispatch array to free.
+ */
+static void
+_net_ebpf_extension_hook_free_dispatch_array(
+    _In_opt_ _Frees_ptr_opt_ net_ebpf_extension_hook_dispatch_array_t* dispatch_array)
+{
+    if (dispatch_array != NULL) {
+        _net_ebpf_extension_release_rundown_for_clients(dispatch_array->clients, dispatch_array->count);
+        ExFreePool(dispatch_array);
+    }
+}
 
-    // Acquire shared filter context lock.
-    old_irql = ExAcquireSpinLockShared(&filter_context->lock);
-    lock_acquired = TRUE;
+/**
+ * @brief Release a reference on a reference counted dispatch array, freeing it when the last reference is released.
+ *
+ * @param[in] dispatch_array Dispatch array to release the reference on.
+ */
+static void
+_net_ebpf_extension_hook_dereference_dispatch_array(_In_ net_ebpf_extension_hook_dispatch_array_t* dispatch_array)
+{
+    ASSERT(dispatch_array->reference_counted);
+    if (InterlockedDecrement(&dispatch_array->reference_count) == 0) {
+        _net_ebpf_extension_hook_free_dispatch_array(dispatch_array);
+    }
+}
 
-    // Create a local copy of the client contexts.
-    client_count = filter_context->client_context_count;
-    for (uint32_t i = 0; i < client_count; i++) {
-        // Acquire rundown protection for the client. Rundown for a client only starts once the client has been removed
-        // from the list of clients in the filter context. So we should not expect any failure in acquiring rundown
-        // here. If acquiring rundown fails, bail.
-        if (!net_ebpf_extension_hook_client_enter_rundown(filter_context->client_contexts[i])) {
+KDEFERRED_ROUTINE _net_ebpf_extension_hook_retire_dispatch_array_callback;
+
+/**
+ * @brief DPC routine queued on every processor when a dispatch array is unpublished. A DPC can only run on a
+ * processor once that processor has left DISPATCH_LEVEL (or finished the DPC it was running), so once the DPC has run
+ * on every processor no invocation can still be using the dispatch array, and the last DPC frees it.
+ *
+ * @param[in] dpc Pointer to the DPC object.
+ * @param[in] context Pointer to the dispatch array being retired.
+ * @param[in] system_argument1 Unused.
+ * @param[in] system_argument2 Unused.
+ */
+void
+_net_ebpf_extension_hook_retire_dispatch_array_callback(
+    _In_ KDPC* dpc, _In_opt_ void* context, _In_opt_ void* system_argument1, _In_opt_ void* system_argument2)
+{
+    net_ebpf_extension_hook_dispatch_array_t* dispatch_array = (net_ebpf_extension_hook_dispatch_array_t*)context;
+
+    UNREFERENCED_PARAMETER(dpc);
+    UNREFERENCED_PARAMETER(system_argument1);
+    UNREFERENCED_PARAMETER(system_argument2);
+
+    ASSERT(dispatch_array != NULL);
+    _Analysis_assume_(dispatch_array != NULL);
+
+    if (InterlockedDecrement(&dispatch_array->retire_pending_count) == 0) {
+        // Releasing rundown on the clients lets any pending detach of those clients complete.
+        _net_ebpf_extension_hook_free_dispatch_array(dispatch_array);
+    }
+}
+
+/**
+ * @brief Free a dispatch array once no invocation can still be using it: either once every processor has passed
+ * through a DPC, or, for a reference counted array, once the last invocation has released it.
+ *
+ * @param[in] dispatch_array Dispatch array that is no longer published.
+ */
+static void
+_net_ebpf_extension_hook_retire_dispatch_array(
+    _In_opt_ _Frees_ptr_opt_ net_ebpf_extension_hook_dispatch_array_t* dispatch_array)
+{
+    if (dispatch_array == NULL) {
+        return;
+    }
+
+    if (dispatch_array->reference_counted) {
+        // Release the reference held by the filter context while the array was published.
+        _net_ebpf_extension_hook_dereference_dispatch_array(dispatch_array);
+        return;
+    }
+
+    // Processors that are not active cannot be running an invocation, so only the active ones need a DPC.
+    uint32_t active_processor_count =
+        min(KeQueryActiveProcessorCountEx(ALL_PROCESSOR_GROUPS), dispatch_array->processor_count);
+    dispatch_array->retire_pending_count = (long)active_processor_count;
+    for (uint32_t i = 0; i < active_processor_count; i++) {
+        PROCESSOR_NUMBER processor_number;
+        KDPC* dpc = &dispatch_array->retire_dpcs[i];
+
+        KeInitializeDpc(dpc, _net_ebpf_extension_hook_retire_dispatch_array_callback, dispatch_array);
+        NTSTATUS status = KeGetProcessorNumberFromIndex(i, &processor_number);
+        if (NT_SUCCESS(status)) {
+            status = KeSetTargetProcessorDpcEx(dpc, &processor_number);
+        }
+        ASSERT(NT_SUCCESS(status));
+        KeInsertQueueDpc(dpc, NULL, NULL);
+    }
+}
+
+void
+net_ebpf_extension_hook_publish_dispatch_array(
+    _Inout_ net_ebpf_extension_wfp_filter_context_t* filter_context,
+    _Inout_ net_ebpf_extension_hook_dispatch_array_t** dispatch_array)
+{
+    net_ebpf_extension_hook_dispatch_array_t* new_dispatch_array = *dispatch_array;
+    net_ebpf_extension_hook_dispatch_array_t* old_dispatch_array;
+
+    *dispatch_array = NULL;
+    ASSERT(new_dispatch_array != NULL);
+    _Analysis_assume_(new_dispatch_array != NULL);
+
+    new_dispatch_array->count = 0;
+    new_dispatch_array->process_verdict = filter_context->provider_context->dispatch.process_verdict;
+    // A DPC cannot be used to wait for invocations that run at PASSIVE_LEVEL, so those pin the array by reference.
+    new_dispatch_array->reference_counted = (filter_context->provider_context->required_irql < DISPATCH_LEVEL);
+    new_dispatch_array->reference_count = 1;
+    for (uint32_t i = 0; i < filter_context->client_context_count; i++) {
+        net_ebpf_extension_hook_client_t* client = filter_context->client_contexts[i];
+
+        // Rundown for a client only starts once the client has been removed from the list of clients in the filter
+        // context, so acquiring rundown here is not expected to fail. If it does, leave the client out.
+        if (!net_ebpf_extension_hook_client_enter_rundown(client)) {
             NET_EBPF_EXT_LOG_MESSAGE(
                 NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
                 NET_EBPF_EXT_TRACELOG_KEYWORD_EXTENSION,
-                "net_ebpf_extension_hook_invoke_programs: Rundown failed for client");
-            goto Exit;
+                "net_ebpf_extension_hook_publish_dispatch_array: Rundown failed for client");
+            continue;
         }
-        clients[i] = filter_context->client_contexts[i];
+        new_dispatch_array->entries[new_dispatch_array->count].invoke_program = client->invoke_program;
+        new_dispatch_array->entries[new_dispatch_array->count].client_binding_context = client->client_binding_context;
+        new_dispatch_array->clients[new_dispatch_array->count] = client;
+        new_dispatch_array->count++;
     }
 
-    // Release the shared filter context lock.
-    ExReleaseSpinLockShared(&filter_context->lock, old_irql);
-    lock_acquired = FALSE;
-    filter_context = NULL;
+    if (new_dispatch_array->count == 0) {
+        // Publish NULL rather than an empty array, so the classify path needs no further checks.
+        _net_ebpf_extension_hook_free_dispatch_array(new_dispatch_array);
+        new_dispatch_array = NULL;
+    }
 
-    program_result = EBPF_OBJECT_NOT_FOUND;
+    old_dispatch_array = (net_ebpf_extension_hook_dispatch_array_t*)InterlockedExchangePointer(
+        (void* volatile*)&filter_context->dispatch_array, new_dispatch_array);
 
-    // Iterate over all the programs in the array.
-    for (uint32_t i = 0; i < client_count; i++) {
-        ASSERT(clients[i] != NULL);
+    _net_ebpf_extension_hook_retire_dispatch_array(old_dispatch_array);
+}
 
-        program_result = _net_ebpf_extension_hook_invoke_single_program(clients[i], program_context, result);
+void
+net_ebpf_extension_hook_unpublish_dispatch_array(_Inout_ net_ebpf_extension_wfp_filter_context_t* filter_context)
+{
+    net_ebpf_extension_hook_dispatch_array_t* old_dispatch_array =
+        (net_ebpf_extension_hook_dispatch_array_t*)InterlockedExchangePointer(
+            (void* volatile*)&filter_context->dispatch_array, NULL);
+
+    _net_ebpf_extension_hook_retire_dispatch_array(old_dispatch_array);
+}
+
+#pragma warning(push)
+#pragma warning(disable : 28167) // The IRQL raised here is restored by net_ebpf_extension_hook_release_clients.
+ebpf_result_t
+net_ebpf_extension_hook_acquire_clients(
+    _In_ net_ebpf_extension_wfp_filter_context_t* filter_context,
+    _Out_ net_ebpf_extension_hook_client_set_t* client_set)
+{
+    net_ebpf_extension_hook_dispatch_array_t* dispatch_array;
+
+    client_set->old_irql = KeGetCurrentIrql();
+    client_set->irql_raised = FALSE;
+
+    if (filter_context->provider_context->required_irql < DISPATCH_LEVEL) {
+        // The programs of this hook must run at the caller's IRQL, so take a reference on the dispatch array. The
+        // lock is only held while the reference is taken, and publishing a new array takes it exclusively.
+        KIRQL old_irql = ExAcquireSpinLockShared(&filter_context->lock);
+        dispatch_array = (net_ebpf_extension_hook_dispatch_array_t*)ReadPointerNoFence(
+            (void* const volatile*)&filter_context->dispatch_array);
+        if (dispatch_array != NULL) {
+            InterlockedIncrement(&dispatch_array->reference_count);
+        }
+        ExReleaseSpinLockShared(&filter_context->lock, old_irql);
+    } else {
+        // The dispatch array is only freed after every processor has run a DPC, so it cannot go away while this
+        // processor stays at DISPATCH_LEVEL, which is where the programs of this hook run anyway.
+        if (client_set->old_irql < DISPATCH_LEVEL) {
+            client_set->old_irql = KeRaiseIrqlToDpcLevel();
+            client_set->irql_raised = TRUE;
+        }
+        dispatch_array = (net_ebpf_extension_hook_dispatch_array_t*)ReadPointerAcquire(
+            (void* const volatile*)&filter_context->dispatch_array);
+    }
+
+    client_set->dispatch_array = dispatch_array;
+
+    return EBPF_SUCCESS;
+}
+
+void
+net_ebpf_extension_hook_release_clients(_Inout_ net_ebpf_extension_hook_client_set_t* client_set)
+{
+    net_ebpf_extension_hook_dispatch_array_t* dispatch_array =
+        (net_ebpf_extension_hook_dispatch_array_t*)client_set->dispatch_array;
+
+    client_set->dispatch_array = NULL;
+    if (dispatch_array != NULL && dispatch_array->reference_counted) {
+        _net_ebpf_extension_hook_dereference_dispatch_array(dispatch_array);
+    }
+    if (client_set->irql_raised) {
+        client_set->irql_raised = FALSE;
+        KeLowerIrql(client_set->old_irql);
+    }
+}
+#pragma warning(pop)
+
+ebpf_result_t
+net_ebpf_extension_hook_invoke_client_set(
+    _In_ const net_ebpf_extension_hook_client_set_t* client_set,
+    _Inout_ void* program_context,
+    _Out_ uint32_t* result)
+{
+    ebpf_result_t program_result = EBPF_OBJECT_NOT_FOUND;
+    const net_ebpf_extension_hook_dispatch_array_t* dispatch_array = client_set->dispatch_array;
+
+    *result = 0;
+
+    if (dispatch_array == NULL) {
+        return program_result;
+    }
+
+    ASSERT(dispatch_array->count != 0);
+
+    // Fast path for the common case of a single attached program: there is no need to ask whether to continue.
+    if (dispatch_array->count == 1) {
+        return _net_ebpf_extension_hook_invoke_single_program(&dispatch_array->entries[0], program_context, result);
+    }
+
+    // Iterate over all the programs in the array.
+    for (uint32_t i = 0; i < dispatch_array->count; i++) {
+        program_result =
+            _net_ebpf_extension_hook_invoke_single_program(&dispatch_array->entries[i], program_context, result);
         if (program_result != EBPF_SUCCESS) {
             // If we failed to invoke an eBPF program, stop processing and return the error code.
-            goto Exit;
+            break;
         }
 
         // Invoke callback to see if we should continue processing.
-        if (process_verdict != NULL) {
-            if (!process_verdict(program_context, *result)) {
-                program_result = EBPF_SUCCESS;
-                goto Exit;
+        if (dispatch_array->process_verdict != NULL) {
+            if (!dispatch_array->process_verdict(program_context, *result)) {
+                break;
             }
         }
     }
 
-Exit:
-    if (lock_acquired) {
-        ExReleaseSpinLockShared(&filter_context->lock, old_irql);
-    }
+    return program_result;
+}
+
+ebpf_result_t
+net_ebpf_extension_hook_invoke_programs(
+    _Inout_ void* program_context, _In_ net_ebpf_extension_wfp_filter_context_t* filter_context, _Out_ uint32_t* result)
+{
+    ebpf_result_t program_result;
+    net_ebpf_extension_hook_client_set_t client_set;
+
+    (void)net_ebpf_extension_hook_acquire_clients(filter_context, &client_set);
 
-    _net_ebpf_extension_release_rundown_for_clients(clients, client_count);
+    program_result = net_ebpf_extension_hook_invoke_client_set(&client_set, program_context, result);
+
+    net_ebpf_extension_hook_release_clients(&client_set);
     return program_result;
 }
 
@@ -363,6 +586,8 @@ _net_ebpf_extension_hook_client_cleanup(_In_opt_ _Frees_ptr_opt_ net_ebpf_extens
         if (hook_client->detach_work_item != NULL) {
             IoFreeWorkItem(hook_client->detach_work_item);
         }
+        _net_ebpf_extension_hook_free_dispatch_array(hook_client->attach_dispatch_array);
+        _net_ebpf_extension_hook_free_dispatch_array(hook_client->detach_dispatch_array);
         ExFreePool(hook_client);
     }
 }
@@ -402,6 +627,7 @@ _net_ebpf_extension_hook_provider_attach_client(
     bool is_wild_card_attach_parameter = FALSE;
     net_ebpf_extension_wfp_filter_context_t* new_filter_context = NULL;
     bool rundown_acquired = FALSE;
+    bool filter_context_create_attempted = FALSE;
 
     NET_EBPF_EXT_LOG_ENTRY();
 
@@ -463,6 +689,21 @@ _net_ebpf_extension_hook_provider_attach_client(
         goto Exit;
     }
 
+    // Allocate the dispatch arrays published when this client attaches and detaches up front, so that detach
+    // cannot fail for lack of memory.
+    hook_client->attach_dispatch_array = _net_ebpf_extension_hook_allocate_dispatch_array();
+    NET_EBPF_EXT_BAIL_ON_ALLOC_FAILURE_STATUS(
+        NET_EBPF_EXT_TRACELOG_KEYWORD_EXTENSION,
+        hook_client->attach_dispatch_array,
+        "hook_client - attach_dispatch_array",
+        status);
+    hook_client->detach_dispatch_array = _net_ebpf_extension_hook_allocate_dispatch_array();
+    NET_EBPF_EXT_BAIL_ON_ALLOC_FAILURE_STATUS(
+        NET_EBPF_EXT_TRACELOG_KEYWORD_EXTENSION,
+        hook_client->detach_dispatch_array,
+        "hook_client - detach_dispatch_array",
+        status);
+
     // Acquire passive lock to serialize attach / detach operations.
     ACQUIRE_PUSH_LOCK_EXCLUSIVE(&local_provider_context->lock);
     provider_lock_acquired = TRUE;
@@ -540,6 +781,7 @@ _net_ebpf_extension_hook_provider_attach_client(
         goto Exit;
     }
 
+    filter_context_create_attempted = TRUE;
     result = local_provider_context->dispatch.create_filter_context(
         hook_client, local_provider_context, &new_filter_context);
     if (result != EBPF_SUCCESS) {
@@ -579,6 +821,13 @@ Exit:
         local_provider_context->dispatch.delete_filter_context(new_filter_context);
     }
 
+    if (filter_context_create_attempted && hook_client != NULL && hook_client->attach_dispatch_array == NULL) {
+        // The failed filter context had already published the dispatch array of the client. Wait for the retired
+        // array to release rundown on the client before the client is freed.
+        _ebpf_ext_wait_for_rundown(&hook_client->rundown);
+        KeFlushQueuedDpcs();
+    }
+
     _net_ebpf_extension_hook_client_cleanup(hook_client);
 
     if (status != STATUS_SUCCESS) {
@@ -694,6 +943,9 @@ net_ebpf_extension_hook_provider_unregister(
             }
         }
 
+        // Make sure no retire DPC queued for a dispatch array of this provider is still running.
+        KeFlushQueuedDpcs();
+
         net_ebpf_ext_add_provider_context_to_cleanup_list(provider_context);
     }
     NET_EBPF_EXT_LOG_EXIT();
@@ -740,6 +992,7 @@ net_ebpf_extension_hook_provider_register(
     local_provider_context->dispatch = *dispatch;
     local_provider_context->custom_data = custom_data;
     local_provider_context->attach_capability = attach_capability;
+    local_provider_context->required_irql = parameters->required_irql;
 
     status = NmrRegisterProvider(characteristics, local_provider_context, &local_provider_context->nmr_provider_handle);
     if (!NT_SUCCESS(status)) {
@@ -79,6 +79,70 @@ net_ebpf_extension_hook_provider_register(
     _In_opt_ const void* custom_data,
     _Outptr_ net_ebpf_extension_hook_provider_t** provider_context);
 
+/**
+ * @brief Build a dispatch array from the clients currently in the filter context, publish it, and retire the
+ * previously published dispatch array. Must be called with the filter context lock held exclusively.
+ *
+ * @param[in, out] filter_context Filter context to publish the dispatch array for.
+ * @param[in, out] dispatch_array Pre-allocated dispatch array to fill in. Ownership is taken and the pointer is set
+ * to NULL.
+ */
+void
+net_ebpf_extension_hook_publish_dispatch_array(
+    _Inout_ net_ebpf_extension_wfp_filter_context_t* filter_context,
+    _Inout_ net_ebpf_extension_hook_dispatch_array_t** dispatch_array);
+
+/**
+ * @brief Unpublish the dispatch array of a filter context that is being freed, and retire it. This is a no-op if no
+ * dispatch array is published.
+ *
+ * @param[in, out] filter_context Filter context to unpublish the dispatch array for.
+ */
+void
+net_ebpf_extension_hook_unpublish_dispatch_array(_Inout_ net_ebpf_extension_wfp_filter_context_t* filter_context);
+
+/**
+ * @brief Pin the dispatch array published for the specified filter context, so that its programs can be invoked
+ * repeatedly (e.g. once per packet in a batch). This takes no per-client rundown protection. For hooks whose programs
+ * run at DISPATCH_LEVEL, it takes no lock and raises the IRQL to DISPATCH_LEVEL until
+ * net_ebpf_extension_hook_release_clients is called. For hooks whose programs run at PASSIVE_LEVEL, it leaves the IRQL
+ * unchanged and takes a reference on the dispatch array instead.
+ *
+ * @param[in] filter_context Filter context to acquire the clients from.
+ * @param[out] client_set Set of clients to invoke.
+ *
+ * @retval EBPF_SUCCESS The operation was successful.
+ */
+ebpf_result_t
+net_ebpf_extension_hook_acquire_clients(
+    _In_ net_ebpf_extension_wfp_filter_context_t* filter_context,
+    _Out_ net_ebpf_extension_hook_client_set_t* client_set);
+
+/**
+ * @brief Release the dispatch array pinned by net_ebpf_extension_hook_acquire_clients and restore the IRQL if it was
+ * raised.
+ *
+ * @param[in, out] client_set Set of clients to release.
+ */
+void
+net_ebpf_extension_hook_release_clients(_Inout_ net_ebpf_extension_hook_client_set_t* client_set);
+
+/**
+ * @brief Invoke the eBPF programs of a set of clients acquired by net_ebpf_extension_hook_acquire_clients.
+ *
+ * @param[in] client_set Set of clients to invoke the programs of.
+ * @param[in, out] program_context Context to pass to eBPF program.
+ * @param[out] result Return value from the eBPF programs.
+ *
+ * @retval EBPF_OBJECT_NOT_FOUND The set contains no clients.
+ * @retval ebpf_result_t Status of the program invocation.
+ */
+ebpf_result_t
+net_ebpf_extension_hook_invoke_client_set(
+    _In_ const net_ebpf_extension_hook_client_set_t* client_set,
+    _Inout_ void* program_context,
+    _Out_ uint32_t* result);
+
 /**
  * @brief Invoke all the eBPF programs attached to the specified filter context.
  *
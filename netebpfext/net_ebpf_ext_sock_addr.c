@@ -15,6 +15,18 @@
 #define CONVERT_100NS_UNITS_TO_MS(x) ((x) / 10000)
 #define LOW_MEMORY_CONNECTION_CONTEXT_COUNT 1000
 
+// Blocked connection contexts are sharded by transport endpoint handle, with one shard per processor (rounded up to a
+// power of two) so that connect storms spread across independent locks.
+#define BLOCKED_CONTEXT_MAXIMUM_SHARD_COUNT 64
+#define BLOCKED_CONTEXT_SHARD_BUCKET_COUNT 32
+// Each shard expires its contexts with a timer wheel: a context is linked into the slot of the tick it was created in,
+// and whole slots are freed once they are older than EXPIRY_TIME. The wheel must have more slots than the ticks in
+// EXPIRY_TIME, so that a slot only ever holds contexts from a single tick.
+#define BLOCKED_CONTEXT_TIMER_WHEEL_TICK 1000 // 1 second in ms.
+#define BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT 64
+#define BLOCKED_CONTEXT_EXPIRY_TICKS (EXPIRY_TIME / BLOCKED_CONTEXT_TIMER_WHEEL_TICK)
+static_assert(BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT > BLOCKED_CONTEXT_EXPIRY_TICKS + 1, "Timer wheel is too small.");
+
 #define CLEAN_UP_SOCK_ADDR_FILTER_CONTEXT(filter_context)                 \
     if ((filter_context) != NULL) {                                       \
         if ((filter_context)->redirect_handle != NULL) {                  \
@@ -252,7 +264,8 @@ typedef struct _net_ebpf_extension_connection_context
     uint32_t compartment_id;
     uint16_t protocol;
     uint64_t timestamp;
-    LIST_ENTRY list_entry;
+    LIST_ENTRY list_entry;        ///< Entry in the shard bucket, or in a low memory list.
+    LIST_ENTRY timer_wheel_entry; ///< Entry in the shard timer wheel slot.
 } net_ebpf_extension_connection_context_t;
 
 typedef struct _net_ebpf_ext_sock_addr_statistics
@@ -266,21 +279,30 @@ typedef struct _net_ebpf_ext_sock_addr_statistics
 
 static net_ebpf_ext_sock_addr_statistics_t _net_ebpf_ext_statistics;
 
-typedef struct _net_ebpf_ext_sock_addr_connection_contexts
+typedef struct _net_ebpf_ext_sock_addr_connection_context_shard
 {
     EX_SPIN_LOCK lock;
-    // This list is used to ensure that contexts are never leaked and are freed after some time.
-    _Guarded_by_(lock) LIST_ENTRY blocked_context_lru_list;
-    // This list stores blocked connection contexts at the connect_redirect, to be retrieved and removed at the connect
-    // layer.
-    _Guarded_by_(lock) RTL_AVL_TABLE blocked_context_table;
+    // These buckets store blocked connection contexts at the connect_redirect, to be retrieved and removed at the
+    // connect layer.
+    _Guarded_by_(lock) LIST_ENTRY buckets[BLOCKED_CONTEXT_SHARD_BUCKET_COUNT];
+    // This timer wheel is used to ensure that contexts are never leaked and are freed after some time.
+    _Guarded_by_(lock) LIST_ENTRY timer_wheel[BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT];
+    // Most recent tick whose timer wheel slot has been freed.
+    _Guarded_by_(lock) int64_t expired_tick;
     uint32_t blocked_context_count;
+} net_ebpf_ext_sock_addr_connection_context_shard_t;
+
+typedef struct _net_ebpf_ext_sock_addr_connection_contexts
+{
+    net_ebpf_ext_sock_addr_connection_context_shard_t* shards;
+    uint32_t shard_count; ///< Power of two.
 
+    EX_SPIN_LOCK low_memory_lock;
     // This list stores pre-allocated contexts, to be used under low memory conditions.
-    _Guarded_by_(lock) LIST_ENTRY low_memory_free_context_list;
-    // This list is used in place of the table under low memory conditions, when we fail to allocate entries.
-    _Guarded_by_(lock) LIST_ENTRY low_memory_blocked_context_list;
-    uint32_t low_memory_blocked_context_count;
+    _Guarded_by_(low_memory_lock) LIST_ENTRY low_memory_free_context_list;
+    // This list is used in place of the shards under low memory conditions, when we fail to allocate entries.
+    _Guarded_by_(low_memory_lock) LIST_ENTRY low_memory_blocked_context_list;
+    volatile long low_memory_blocked_context_count;
 } net_ebpf_ext_sock_addr_connection_contexts_t;
 
 static net_ebpf_ext_sock_addr_connection_contexts_t _net_ebpf_ext_sock_addr_blocked_contexts = {0};
@@ -541,8 +563,11 @@ _ebpf_sock_addr_context_destroy(
     _Out_writes_bytes_to_(*context_size_out, *context_size_out) uint8_t* context_out,
     _Inout_ size_t* context_size_out);
 
-_Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts
-                                   .lock) static void _net_ebpf_ext_purge_blocked_connect_contexts(bool delete_all);
+_Requires_exclusive_lock_held_(shard->lock) static void _net_ebpf_ext_purge_blocked_connect_contexts(
+    _Inout_ net_ebpf_ext_sock_addr_connection_context_shard_t* shard, bool delete_all);
+
+_Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock) static void
+    _net_ebpf_ext_purge_low_memory_blocked_connect_contexts(bool delete_all);
 
 //
 // SOCK_ADDR Program Information NPI Provider.
@@ -849,10 +874,27 @@ _net_ebpf_sock_addr_clean_up_security_descriptor()
 void
 _net_ebpf_ext_uninitialize_blocked_connection_contexts()
 {
-    KIRQL old_irql = ExAcquireSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.lock);
+    KIRQL old_irql;
 
-    // Clean up all in use connect contexts.
-    _net_ebpf_ext_purge_blocked_connect_contexts(true);
+    if (_net_ebpf_ext_sock_addr_blocked_contexts.shards != NULL) {
+        for (uint32_t i = 0; i < _net_ebpf_ext_sock_addr_blocked_contexts.shard_count; i++) {
+            net_ebpf_ext_sock_addr_connection_context_shard_t* shard =
+                &_net_ebpf_ext_sock_addr_blocked_contexts.shards[i];
+
+            // Clean up all in use connect contexts.
+            old_irql = ExAcquireSpinLockExclusive(&shard->lock);
+            _net_ebpf_ext_purge_blocked_connect_contexts(shard, true);
+            ExReleaseSpinLockExclusive(&shard->lock, old_irql);
+        }
+        ExFreePool(_net_ebpf_ext_sock_addr_blocked_contexts.shards);
+        _net_ebpf_ext_sock_addr_blocked_contexts.shards = NULL;
+        _net_ebpf_ext_sock_addr_blocked_contexts.shard_count = 0;
+    }
+
+    old_irql = ExAcquireSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock);
+
+    // Clean up in use low memory connect contexts.
+    _net_ebpf_ext_purge_low_memory_blocked_connect_contexts(true);
 
     // Clean up pre-allocated connect contexts.
     while (!IsListEmpty(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_free_context_list)) {
@@ -862,61 +904,55 @@ _net_ebpf_ext_uninitialize_blocked_connection_contexts()
         ExFreePool(context);
     }
 
-    ExReleaseSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.lock, old_irql);
+    ExReleaseSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock, old_irql);
 }
 
-_Function_class_(RTL_AVL_COMPARE_ROUTINE) static RTL_GENERIC_COMPARE_RESULTS
-    _net_ebpf_sock_addr_blocked_context_avl_compare_routine(
-        _In_ RTL_AVL_TABLE* table, _In_ PVOID first, _In_ PVOID second)
+static int64_t
+_net_ebpf_ext_get_blocked_context_tick(uint64_t timestamp)
 {
-    UNREFERENCED_PARAMETER(table);
-
-    int result = memcmp(first, second, EBPF_OFFSET_OF(net_ebpf_extension_connection_context_t, timestamp));
-    if (result < 0) {
-        return GenericLessThan;
-    } else if (result > 0) {
-        return GenericGreaterThan;
-    } else {
-        return GenericEqual;
-    }
-}
-
-_Function_class_(RTL_AVL_ALLOCATE_ROUTINE) static PVOID
-    _net_ebpf_sock_addr_blocked_context_avl_allocate_routine(_In_ RTL_AVL_TABLE* table, _In_ CLONG buffer_size)
-{
-    UNREFERENCED_PARAMETER(table);
-
-    PVOID buffer = ExAllocatePoolUninitialized(NonPagedPoolNx, buffer_size, NET_EBPF_EXTENSION_POOL_TAG);
-    if (buffer) {
-        memset(buffer, 0, buffer_size);
-    }
-    return buffer;
-}
-
-_Function_class_(RTL_AVL_FREE_ROUTINE) static VOID
-    _net_ebpf_sock_addr_blocked_context_avl_free_routine(_In_ RTL_AVL_TABLE* table, _In_ PVOID buffer)
-{
-    UNREFERENCED_PARAMETER(table);
-
-    ExFreePool(buffer);
+    return (int64_t)(timestamp / BLOCKED_CONTEXT_TIMER_WHEEL_TICK);
 }
 
 static NTSTATUS
 _net_ebpf_sock_addr_initialize_blocked_connection_contexts()
 {
     NTSTATUS status = STATUS_SUCCESS;
+    uint32_t processor_count = KeQueryMaximumProcessorCountEx(ALL_PROCESSOR_GROUPS);
+    uint32_t shard_count = 1;
+    net_ebpf_ext_sock_addr_connection_context_shard_t* shards = NULL;
+    int64_t expired_tick =
+        _net_ebpf_ext_get_blocked_context_tick(CONVERT_100NS_UNITS_TO_MS(KeQueryInterruptTime())) -
+        BLOCKED_CONTEXT_EXPIRY_TICKS - 1;
 
-    RtlInitializeGenericTableAvl(
-        &_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_table,
-        _net_ebpf_sock_addr_blocked_context_avl_compare_routine,
-        _net_ebpf_sock_addr_blocked_context_avl_allocate_routine,
-        _net_ebpf_sock_addr_blocked_context_avl_free_routine,
-        NULL);
-
-    InitializeListHead(&_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_lru_list);
     InitializeListHead(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_free_context_list);
     InitializeListHead(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list);
 
+    while (shard_count < processor_count && shard_count < BLOCKED_CONTEXT_MAXIMUM_SHARD_COUNT) {
+        shard_count <<= 1;
+    }
+
+    shards = (net_ebpf_ext_sock_addr_connection_context_shard_t*)ExAllocatePoolUninitialized(
+        NonPagedPoolNx,
+        sizeof(net_ebpf_ext_sock_addr_connection_context_shard_t) * shard_count,
+        NET_EBPF_EXTENSION_POOL_TAG);
+    if (!shards) {
+        status = STATUS_NO_MEMORY;
+        goto Exit;
+    }
+    memset(shards, 0, sizeof(net_ebpf_ext_sock_addr_connection_context_shard_t) * shard_count);
+
+    for (uint32_t i = 0; i < shard_count; i++) {
+        for (uint32_t j = 0; j < BLOCKED_CONTEXT_SHARD_BUCKET_COUNT; j++) {
+            InitializeListHead(&shards[i].buckets[j]);
+        }
+        for (uint32_t j = 0; j < BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT; j++) {
+            InitializeListHead(&shards[i].timer_wheel[j]);
+        }
+        shards[i].expired_tick = expired_tick;
+    }
+    _net_ebpf_ext_sock_addr_blocked_contexts.shards = shards;
+    _net_ebpf_ext_sock_addr_blocked_contexts.shard_count = shard_count;
+
     // Pre-allocate entries for use under low memory conditions.
     for (int32_t i = 0; i < LOW_MEMORY_CONNECTION_CONTEXT_COUNT; i++) {
         net_ebpf_extension_connection_context_t* context =
@@ -982,52 +1018,88 @@ _net_ebpf_extension_connection_context_initialize(
     }
 }
 
-_Requires_exclusive_lock_held_(
-    _net_ebpf_ext_sock_addr_blocked_contexts
-        .lock) static bool _net_ebpf_ext_find_and_remove_connection_context_locked(_In_ net_ebpf_extension_connection_context_t*
-                                                                                       context)
+static uint64_t
+_net_ebpf_ext_get_blocked_context_hash(uint64_t transport_endpoint_handle)
+{
+    // Mix the bits of the handle, as the low bits of a pointer-sized handle carry little entropy.
+    uint64_t hash = transport_endpoint_handle;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static net_ebpf_ext_sock_addr_connection_context_shard_t*
+_net_ebpf_ext_get_blocked_context_shard(uint64_t hash)
+{
+    return &_net_ebpf_ext_sock_addr_blocked_contexts
+                .shards[hash & (_net_ebpf_ext_sock_addr_blocked_contexts.shard_count - 1)];
+}
+
+static LIST_ENTRY*
+_net_ebpf_ext_get_blocked_context_bucket(_In_ net_ebpf_ext_sock_addr_connection_context_shard_t* shard, uint64_t hash)
+{
+    return &shard->buckets[(hash >> 32) % BLOCKED_CONTEXT_SHARD_BUCKET_COUNT];
+}
+
+_Requires_exclusive_lock_held_(shard->lock) static bool _net_ebpf_ext_find_and_remove_connection_context_locked(
+    _Inout_ net_ebpf_ext_sock_addr_connection_context_shard_t* shard,
+    _Inout_ LIST_ENTRY* bucket,
+    _In_ const net_ebpf_extension_connection_context_t* context)
 {
+    // Check the shard bucket for the entry.
+    for (LIST_ENTRY* entry = bucket->Flink; entry != bucket; entry = entry->Flink) {
+        net_ebpf_extension_connection_context_t* found_context =
+            CONTAINING_RECORD(entry, net_ebpf_extension_connection_context_t, list_entry);
+        if (memcmp(context, found_context, EBPF_OFFSET_OF(net_ebpf_extension_connection_context_t, timestamp)) == 0) {
+            RemoveEntryList(&found_context->list_entry);
+            RemoveEntryList(&found_context->timer_wheel_entry);
+            shard->blocked_context_count--;
+            NET_EBPF_EXT_LOG_MESSAGE_UINT64(
+                NET_EBPF_EXT_TRACELOG_LEVEL_VERBOSE,
+                NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
+                "_net_ebpf_ext_find_and_remove_connection_context_locked: Delete",
+                found_context->transport_endpoint_handle);
+            ExFreePool(found_context);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool
+_net_ebpf_ext_find_and_remove_low_memory_connection_context(
+    _In_ const net_ebpf_extension_connection_context_t* context)
+{
+    KIRQL old_irql;
     bool entry_found = false;
-    // Check the hash table for the entry.
-    net_ebpf_extension_connection_context_t* found_context =
-        (net_ebpf_extension_connection_context_t*)RtlLookupElementGenericTableAvl(
-            &_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_table, context);
-    if (found_context != NULL) {
-        entry_found = true;
-        RemoveEntryList(&found_context->list_entry);
-        uint64_t transport_endpoint_handle = found_context->transport_endpoint_handle;
-        // Delete should succeed as the entry was just found in the lookup.
-        BOOLEAN result =
-            RtlDeleteElementGenericTableAvl(&_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_table, context);
-        ebpf_assert(result);
-        _net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_count--;
-        NET_EBPF_EXT_LOG_MESSAGE_UINT64(
-            NET_EBPF_EXT_TRACELOG_LEVEL_VERBOSE,
-            NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
-            "_net_ebpf_ext_find_and_remove_connection_context_locked: Delete",
-            transport_endpoint_handle);
-    } else {
-        // The entry was not found in the hash table. Check the low-memory list to see if the entry is there.
-        LIST_ENTRY* entry = _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list.Flink;
-        while (entry != &_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list) {
-            net_ebpf_extension_connection_context_t* connection_context =
-                CONTAINING_RECORD(entry, net_ebpf_extension_connection_context_t, list_entry);
-            if (memcmp(
-                    context, connection_context, EBPF_OFFSET_OF(net_ebpf_extension_connection_context_t, timestamp)) ==
-                0) {
-                // Found matching entry. Remove it from the list and return it to the free list, and then return a block
-                // verdict.
-                RemoveEntryList(&connection_context->list_entry);
-                InsertHeadList(
-                    &_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_free_context_list,
-                    &connection_context->list_entry);
-                _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count--;
-                entry_found = true;
-                break;
-            }
-            entry = entry->Flink;
+
+    // The low-memory list is empty unless an allocation failed, so skip taking its lock in the common case.
+    if (_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count == 0) {
+        return false;
+    }
+
+    old_irql = ExAcquireSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock);
+    LIST_ENTRY* entry = _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list.Flink;
+    while (entry != &_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list) {
+        net_ebpf_extension_connection_context_t* connection_context =
+            CONTAINING_RECORD(entry, net_ebpf_extension_connection_context_t, list_entry);
+        if (memcmp(context, connection_context, EBPF_OFFSET_OF(net_ebpf_extension_connection_context_t, timestamp)) ==
+            0) {
+            // Found matching entry. Remove it from the list and return it to the free list, and then return a block
+            // verdict.
+            RemoveEntryList(&connection_context->list_entry);
+            InsertHeadList(
+                &_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_free_context_list,
+                &connection_context->list_entry);
+            InterlockedDecrement(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count);
+            entry_found = true;
+            break;
         }
+        entry = entry->Flink;
     }
+    ExReleaseSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock, old_irql);
 
     return entry_found;
 }
@@ -1039,51 +1111,86 @@ _net_ebpf_ext_find_and_remove_connection_context(
     KIRQL old_irql;
     bool entry_found = false;
     net_ebpf_extension_connection_context_t local_connection_context = {0};
+    uint64_t hash = _net_ebpf_ext_get_blocked_context_hash(transport_endpoint_handle);
+    net_ebpf_ext_sock_addr_connection_context_shard_t* shard = _net_ebpf_ext_get_blocked_context_shard(hash);
 
     _net_ebpf_extension_connection_context_initialize(
         transport_endpoint_handle, sock_addr_ctx, 0, &local_connection_context);
 
-    old_irql = ExAcquireSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.lock);
-    entry_found = _net_ebpf_ext_find_and_remove_connection_context_locked(&local_connection_context);
-    ExReleaseSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.lock, old_irql);
+    old_irql = ExAcquireSpinLockExclusive(&shard->lock);
+    entry_found = _net_ebpf_ext_find_and_remove_connection_context_locked(
+        shard, _net_ebpf_ext_get_blocked_context_bucket(shard, hash), &local_connection_context);
+
+    // Purge stale entries here too, so that a shard that only sees lookups doesn't hold its expired entries until
+    // the next insert. This returns immediately unless the timer wheel has fallen behind the current tick.
+    _net_ebpf_ext_purge_blocked_connect_contexts(shard, false);
+    ExReleaseSpinLockExclusive(&shard->lock, old_irql);
+
+    if (!entry_found) {
+        // The entry was not found in the shard. Check the low-memory list to see if the entry is there.
+        entry_found = _net_ebpf_ext_find_and_remove_low_memory_connection_context(&local_connection_context);
+    }
 
     return entry_found;
 }
 
-_Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts
-                                   .lock) static void _net_ebpf_ext_purge_blocked_connect_contexts(bool delete_all)
+_Requires_exclusive_lock_held_(shard->lock) static void _net_ebpf_ext_purge_blocked_connect_contexts(
+    _Inout_ net_ebpf_ext_sock_addr_connection_context_shard_t* shard, bool delete_all)
 {
-    uint64_t expiry_time = CONVERT_100NS_UNITS_TO_MS(KeQueryInterruptTime()) - EXPIRY_TIME;
-
-    // Free entries from the LRU list. These entries should also be removed from the table.
-    LIST_ENTRY* list_entry = _net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_lru_list.Blink;
-    while (list_entry != &_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_lru_list) {
-        net_ebpf_extension_connection_context_t* entry =
-            CONTAINING_RECORD(list_entry, net_ebpf_extension_connection_context_t, list_entry);
-        // Move pointer to next entry prior to removing the entry.
-        list_entry = list_entry->Blink;
+    int64_t last_expired_tick =
+        _net_ebpf_ext_get_blocked_context_tick(CONVERT_100NS_UNITS_TO_MS(KeQueryInterruptTime())) -
+        BLOCKED_CONTEXT_EXPIRY_TICKS - 1;
+    uint32_t slot_count;
+    uint32_t purged_count = 0;
+
+    if (delete_all) {
+        slot_count = BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT;
+    } else if (last_expired_tick > shard->expired_tick) {
+        // If the shard has been idle for a full rotation of the wheel, every slot has expired.
+        slot_count = (uint32_t)min(last_expired_tick - shard->expired_tick, BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT);
+    } else {
+        return;
+    }
 
-        if (!delete_all && entry->timestamp > expiry_time) {
-            break;
+    // Free every entry of the expired slots. These entries should also be removed from their buckets.
+    for (uint32_t i = 1; i <= slot_count; i++) {
+        LIST_ENTRY* slot =
+            &shard->timer_wheel[(uint64_t)(shard->expired_tick + i) % BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT];
+        while (!IsListEmpty(slot)) {
+            net_ebpf_extension_connection_context_t* entry =
+                CONTAINING_RECORD(RemoveHeadList(slot), net_ebpf_extension_connection_context_t, timer_wheel_entry);
+            RemoveEntryList(&entry->list_entry);
+            NET_EBPF_EXT_LOG_MESSAGE_UINT64(
+                NET_EBPF_EXT_TRACELOG_LEVEL_VERBOSE,
+                NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
+                "_net_ebpf_ext_purge_block_connect_contexts: Delete",
+                entry->transport_endpoint_handle);
+            ExFreePool(entry);
+            shard->blocked_context_count--;
+            purged_count++;
         }
+    }
 
-#pragma warning(suppress : 6001) /* entry and list entry are non-null */
-        RemoveEntryList(&entry->list_entry);
-        uint64_t transport_endpoint_handle = entry->transport_endpoint_handle;
-        BOOLEAN result =
-            RtlDeleteElementGenericTableAvl(&_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_table, entry);
-        ebpf_assert(result);
-        entry = NULL;
-        _net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_count--;
+    if (!delete_all) {
+        shard->expired_tick = last_expired_tick;
+    }
+
+    if (purged_count > 0) {
         NET_EBPF_EXT_LOG_MESSAGE_UINT64(
-            NET_EBPF_EXT_TRACELOG_LEVEL_VERBOSE,
+            NET_EBPF_EXT_TRACELOG_LEVEL_INFO,
             NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
-            "_net_ebpf_ext_purge_block_connect_contexts: Delete",
-            transport_endpoint_handle);
+            "_net_ebpf_ext_purge_block_connect_contexts",
+            shard->blocked_context_count);
     }
+}
+
+_Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock) static void
+    _net_ebpf_ext_purge_low_memory_blocked_connect_contexts(bool delete_all)
+{
+    uint64_t expiry_time = CONVERT_100NS_UNITS_TO_MS(KeQueryInterruptTime()) - EXPIRY_TIME;
 
     // Free entries from low-memory list.
-    list_entry = _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list.Blink;
+    LIST_ENTRY* list_entry = _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list.Blink;
     while (list_entry != &_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list) {
         net_ebpf_extension_connection_context_t* entry =
             CONTAINING_RECORD(list_entry, net_ebpf_extension_connection_context_t, list_entry);
@@ -1102,26 +1209,27 @@ _Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts
             // Return the entry to the free list.
             InsertHeadList(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_free_context_list, &entry->list_entry);
         }
-        _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count--;
+        InterlockedDecrement(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count);
     }
-
-    NET_EBPF_EXT_LOG_MESSAGE_UINT64(
-        NET_EBPF_EXT_TRACELOG_LEVEL_INFO,
-        NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
-        "_net_ebpf_ext_purge_block_connect_contexts",
-        _net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_count);
 }
 
-_Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts.lock) static ebpf_result_t
-    _net_ebpf_ext_insert_connection_context_to_low_memory_list(
-        _In_ uint64_t transport_endpoint_handle, _In_ const bpf_sock_addr_t* sock_addr_ctx)
+static ebpf_result_t
+_net_ebpf_ext_insert_connection_context_to_low_memory_list(
+    _In_ uint64_t transport_endpoint_handle, _In_ const bpf_sock_addr_t* sock_addr_ctx)
 {
     ebpf_result_t result = EBPF_SUCCESS;
+    KIRQL old_irql = PASSIVE_LEVEL;
     PLIST_ENTRY entry = NULL;
     net_ebpf_extension_connection_context_t* blocked_connection_context = NULL;
 
+    old_irql = ExAcquireSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock);
+
+    // Purge stale entries from the list, returning them to the free list.
+    _net_ebpf_ext_purge_low_memory_blocked_connect_contexts(false);
+
     if (IsListEmpty(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_free_context_list)) {
-        NET_EBPF_EXT_BAIL_ON_ERROR_RESULT(EBPF_NO_MEMORY);
+        result = EBPF_NO_MEMORY;
+        NET_EBPF_EXT_BAIL_ON_ERROR_RESULT(result);
     }
 
     // Retrieve an entry from the pre-allocated list.
@@ -1139,10 +1247,11 @@ _Requires_exclusive_lock_held_(_net_ebpf_ext_sock_addr_blocked_contexts.lock) st
     InsertHeadList(
         &_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_list,
         &blocked_connection_context->list_entry);
-    _net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count++;
+    InterlockedIncrement(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_blocked_context_count);
     InterlockedIncrement(&_net_ebpf_ext_statistics.low_memory_context_count);
 
 Exit:
+    ExReleaseSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.low_memory_lock, old_irql);
     return result;
 }
 
@@ -1152,8 +1261,13 @@ _net_ebpf_ext_insert_connection_context_to_list(
 {
     ebpf_result_t result = EBPF_SUCCESS;
     KIRQL old_irql = PASSIVE_LEVEL;
+    bool entry_found;
     net_ebpf_extension_connection_context_t blocked_connection_context = {0};
     net_ebpf_extension_connection_context_t* new_context = NULL;
+    uint64_t slot;
+    uint64_t hash = _net_ebpf_ext_get_blocked_context_hash(transport_endpoint_handle);
+    net_ebpf_ext_sock_addr_connection_context_shard_t* shard = _net_ebpf_ext_get_blocked_context_shard(hash);
+    LIST_ENTRY* bucket = _net_ebpf_ext_get_blocked_context_bucket(shard, hash);
 
     _net_ebpf_extension_connection_context_initialize(
         transport_endpoint_handle,
@@ -1161,40 +1275,50 @@ _net_ebpf_ext_insert_connection_context_to_list(
         CONNECTION_CONTEXT_INITIALIZATION_SET_TIMESTAMP,
         &blocked_connection_context);
 
-    old_irql = ExAcquireSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.lock);
+    // Allocate the entry before taking the shard lock.
+    new_context = (net_ebpf_extension_connection_context_t*)ExAllocatePoolUninitialized(
+        NonPagedPoolNx, sizeof(net_ebpf_extension_connection_context_t), NET_EBPF_EXTENSION_POOL_TAG);
+
+    old_irql = ExAcquireSpinLockExclusive(&shard->lock);
 
     // Remove the context if it exists.
-    _net_ebpf_ext_find_and_remove_connection_context_locked(&blocked_connection_context);
-
-    // Insert into table.
-    new_context = (net_ebpf_extension_connection_context_t*)RtlInsertElementGenericTableAvl(
-        &_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_table,
-        &blocked_connection_context,
-        sizeof(blocked_connection_context),
-        NULL);
-    NET_EBPF_EXT_BAIL_ON_ALLOC_FAILURE_RESULT(
-        NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR, new_context, "blocked_connection", result);
-
-    // Successfully inserted into the table. Also insert into the LRU list to ensure
-    // entries are not leaked.
-    InsertHeadList(&_net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_lru_list, &new_context->list_entry);
-    _net_ebpf_ext_sock_addr_blocked_contexts.blocked_context_count++;
-    InterlockedIncrement(&_net_ebpf_ext_statistics.block_connection_count);
-    NET_EBPF_EXT_LOG_MESSAGE_UINT64(
-        NET_EBPF_EXT_TRACELOG_LEVEL_VERBOSE,
-        NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
-        "_net_ebpf_ext_insert_connection_context_to_list: Insert",
-        transport_endpoint_handle);
+    entry_found = _net_ebpf_ext_find_and_remove_connection_context_locked(shard, bucket, &blocked_connection_context);
+
+    // Purge stale entries from the shard. This must happen before the insert, so that the timer wheel has caught up
+    // with the current tick and the slot for the new entry holds no entries from an earlier rotation.
+    _net_ebpf_ext_purge_blocked_connect_contexts(shard, false);
+
+    if (new_context != NULL) {
+        // Insert into the shard. Also insert into the timer wheel to ensure entries are not leaked.
+        *new_context = blocked_connection_context;
+        slot = (uint64_t)_net_ebpf_ext_get_blocked_context_tick(new_context->timestamp) %
+               BLOCKED_CONTEXT_TIMER_WHEEL_SLOT_COUNT;
+        InsertHeadList(bucket, &new_context->list_entry);
+        InsertTailList(&shard->timer_wheel[slot], &new_context->timer_wheel_entry);
+        shard->blocked_context_count++;
+        InterlockedIncrement(&_net_ebpf_ext_statistics.block_connection_count);
+        NET_EBPF_EXT_LOG_MESSAGE_UINT64(
+            NET_EBPF_EXT_TRACELOG_LEVEL_VERBOSE,
+            NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
+            "_net_ebpf_ext_insert_connection_context_to_list: Insert",
+            transport_endpoint_handle);
+    }
 
-Exit:
-    if (result != EBPF_SUCCESS) {
-        // If any failure occurred, attempt to use low memory list instead.
-        result = _net_ebpf_ext_insert_connection_context_to_low_memory_list(transport_endpoint_handle, sock_addr_ctx);
+    ExReleaseSpinLockExclusive(&shard->lock, old_irql);
+
+    if (!entry_found) {
+        // Remove the context from the low-memory list if it exists there instead.
+        (void)_net_ebpf_ext_find_and_remove_low_memory_connection_context(&blocked_connection_context);
     }
 
-    // Purge stale entries from the list.
-    _net_ebpf_ext_purge_blocked_connect_contexts(false);
-    ExReleaseSpinLockExclusive(&_net_ebpf_ext_sock_addr_blocked_contexts.lock, old_irql);
+    if (new_context == NULL) {
+        NET_EBPF_EXT_LOG_MESSAGE(
+            NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+            NET_EBPF_EXT_TRACELOG_KEYWORD_SOCK_ADDR,
+            "Failed to allocate blocked_connection.");
+        // Attempt to use low memory list instead.
+        result = _net_ebpf_ext_insert_connection_context_to_low_memory_list(transport_endpoint_handle, sock_addr_ctx);
+    }
 
     NET_EBPF_EXT_RETURN_RESULT(result);
 }
@@ -1258,7 +1382,9 @@ net_ebpf_ext_sock_addr_register_providers()
 
     for (int i = 0; i < NET_EBPF_SOCK_ADDR_HOOK_PROVIDER_COUNT; i++) {
         const net_ebpf_extension_hook_provider_parameters_t hook_provider_parameters = {
-            &_ebpf_sock_addr_hook_provider_moduleid[i], &_net_ebpf_sock_addr_hook_provider_data[i]};
+            &_ebpf_sock_addr_hook_provider_moduleid[i],
+            &_net_ebpf_sock_addr_hook_provider_data[i],
+            _ebpf_sock_addr_program_data.required_irql};
 
         _net_ebpf_sock_addr_hook_provider_data[i].header.version = EBPF_ATTACH_PROVIDER_DATA_CURRENT_VERSION;
         _net_ebpf_sock_addr_hook_provider_data[i].header.size = EBPF_ATTACH_PROVIDER_DATA_CURRENT_VERSION_SIZE;
@@ -305,7 +305,9 @@ net_ebpf_ext_sock_ops_register_providers()
 {
     NTSTATUS status = STATUS_SUCCESS;
     const net_ebpf_extension_hook_provider_parameters_t hook_provider_parameters = {
-        &_ebpf_sock_ops_hook_provider_moduleid, &_net_ebpf_sock_ops_hook_provider_data};
+        &_ebpf_sock_ops_hook_provider_moduleid,
+        &_net_ebpf_sock_ops_hook_provider_data,
+        _ebpf_sock_ops_program_data.required_irql};
 
     const net_ebpf_extension_program_info_provider_parameters_t program_info_provider_parameters = {
         &_ebpf_sock_ops_program_info_provider_moduleid, &_ebpf_sock_ops_program_data};
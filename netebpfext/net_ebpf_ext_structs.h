@@ -34,6 +34,17 @@ typedef struct _net_ebpf_extension_wfp_filter_context net_ebpf_extension_wfp_fil
  */
 typedef struct _net_ebpf_extension_hook_provider net_ebpf_extension_hook_provider_t;
 
+/**
+ *  @brief This is the immutable array of programs attached to a filter context,
+ *         published on every attach and detach.
+ */
+typedef struct _net_ebpf_extension_hook_dispatch_array net_ebpf_extension_hook_dispatch_array_t;
+
+/**
+ *  @brief This is the dispatch array of a filter context, pinned while its programs are invoked.
+ */
+typedef struct _net_ebpf_extension_hook_client_set net_ebpf_extension_hook_client_set_t;
+
 /**
  * @brief Callback function to create hook specific filter context. This callback is invoked when a hook NPI client
           is attempting to attach to the hook NPI provider.
@@ -97,6 +108,7 @@ typedef struct _net_ebpf_extension_hook_provider_parameters
 {
     const NPI_MODULEID* provider_module_id;           ///< NPI provider module ID.
     const ebpf_attach_provider_data_t* provider_data; ///< Hook provider data (contains supported program types).
+    KIRQL required_irql;                              ///< IRQL at which the hook's programs must be invoked.
 } net_ebpf_extension_hook_provider_parameters_t;
 
 typedef struct _net_ebpf_ext_hook_client_rundown
@@ -122,6 +134,10 @@ typedef struct _net_ebpf_extension_hook_client
     void* provider_data;                 ///< Opaque pointer to hook specific data associated with this client.
     PIO_WORKITEM detach_work_item;       ///< Pointer to IO work item that is invoked to detach the client.
     net_ebpf_ext_hook_rundown_t rundown; ///< Pointer to rundown object used to synchronize detach operation.
+    net_ebpf_extension_hook_dispatch_array_t*
+        attach_dispatch_array; ///< Pre-allocated dispatch array to publish when this client attaches.
+    net_ebpf_extension_hook_dispatch_array_t*
+        detach_dispatch_array; ///< Pre-allocated dispatch array to publish when this client detaches.
 } net_ebpf_extension_hook_client_t;
 
 typedef struct _net_ebpf_extension_hook_provider
@@ -133,6 +149,7 @@ typedef struct _net_ebpf_extension_hook_provider
     net_ebpf_extension_hook_provider_dispatch_table_t dispatch;    ///< Hook specific dispatch table.
     net_ebpf_extension_hook_attach_capability_t attach_capability; ///< Attach capability for specific hook provider.
     const void* custom_data; ///< Opaque pointer to hook specific data associated for this provider.
+    KIRQL required_irql;     ///< IRQL at which the hook's programs must be invoked.
     _Guarded_by_(lock)
         LIST_ENTRY filter_context_list; ///< Linked list of filter contexts that are attached to this provider.
     LIST_ENTRY cleanup_list_entry;      ///< List entry for cleanup.
@@ -270,7 +270,9 @@ net_ebpf_ext_xdp_register_providers()
     const net_ebpf_extension_program_info_provider_parameters_t program_info_provider_parameters = {
         &_ebpf_xdp_test_program_info_provider_moduleid, &_ebpf_xdp_test_program_data};
     const net_ebpf_extension_hook_provider_parameters_t hook_provider_parameters = {
-        &_ebpf_xdp_test_hook_provider_moduleid, &_net_ebpf_xdp_test_hook_provider_data};
+        &_ebpf_xdp_test_hook_provider_moduleid,
+        &_net_ebpf_xdp_test_hook_provider_data,
+        _ebpf_xdp_test_program_data.required_irql};
 
     NET_EBPF_EXT_LOG_ENTRY();
 
@@ -333,6 +335,7 @@ typedef struct _net_ebpf_xdp_md
 {
     xdp_md_t base;
     NET_BUFFER_LIST* original_nbl;
+    NET_BUFFER* original_net_buffer; ///< Net buffer within original_nbl that the program is run on.
     NET_BUFFER_LIST* cloned_nbl;
 } net_ebpf_xdp_md_t;
 
@@ -342,6 +345,32 @@ typedef struct _net_ebpf_xdp_md_header
     net_ebpf_xdp_md_t context;
 } net_ebpf_xdp_md_header_t;
 
+/**
+ *  @brief A singly linked chain of NBLs, appended to at the tail.
+ */
+typedef struct _net_ebpf_xdp_nbl_chain
+{
+    NET_BUFFER_LIST* head;
+    NET_BUFFER_LIST** tail;
+} net_ebpf_xdp_nbl_chain_t;
+
+/**
+ *  @brief State for classifying every net buffer of an indicated NBL chain as one batch.
+ *
+ *  As long as every net buffer passes unmodified, the indication is permitted as-is. Once any net buffer needs
+ *  different handling, the batch is split: the original indication is absorbed and each net buffer is moved, as a
+ *  cloned NBL, to the PASS, TX or DROP sub-chain according to its verdict. Whole NBLs that passed before the split
+ *  are moved as reference clones rather than copies.
+ */
+typedef struct _net_ebpf_xdp_batch
+{
+    net_ebpf_xdp_nbl_chain_t pass_clones; ///< Reference clones of passed NBLs to inject in the receive path.
+    net_ebpf_xdp_nbl_chain_t pass;        ///< Cloned NBLs to inject in the receive path.
+    net_ebpf_xdp_nbl_chain_t tx;          ///< Cloned NBLs to inject in the send path.
+    net_ebpf_xdp_nbl_chain_t drop;        ///< Cloned NBLs to free.
+    bool split;                           ///< True once the original indication can no longer be permitted as-is.
+} net_ebpf_xdp_batch_t;
+
 //
 // NBL Clone Functions.
 //
@@ -349,12 +378,18 @@ typedef struct _net_ebpf_xdp_md_header
 static void
 _net_ebpf_ext_free_nbl(_Inout_ NET_BUFFER_LIST* nbl, BOOLEAN free_data);
 
+static NET_BUFFER*
+_net_ebpf_ext_get_net_buffer(_In_ const net_ebpf_xdp_md_t* net_xdp_ctx)
+{
+    return (net_xdp_ctx->cloned_nbl != NULL) ? NET_BUFFER_LIST_FIRST_NB(net_xdp_ctx->cloned_nbl)
+                                             : net_xdp_ctx->original_net_buffer;
+}
+
 static NTSTATUS
 _net_ebpf_ext_allocate_cloned_nbl(_Inout_ net_ebpf_xdp_md_t* net_xdp_ctx, uint32_t unused_header_length)
 {
     NTSTATUS status = STATUS_SUCCESS;
     uint8_t* old_data;
-    NET_BUFFER_LIST* old_nbl = NULL;
     NET_BUFFER* old_net_buffer = NULL;
     NET_BUFFER_LIST* new_nbl = NULL;
     uint32_t cloned_net_buffer_length = 0;
@@ -373,9 +408,8 @@ _net_ebpf_ext_allocate_cloned_nbl(_Inout_ net_ebpf_xdp_md_t* net_xdp_ctx, uint32
 
     old_data = (uint8_t*)net_xdp_ctx->base.data;
 
-    old_nbl = (net_xdp_ctx->cloned_nbl != NULL) ? net_xdp_ctx->cloned_nbl : net_xdp_ctx->original_nbl;
-    ASSERT(old_nbl != NULL);
-    old_net_buffer = NET_BUFFER_LIST_FIRST_NB(old_nbl);
+    old_net_buffer = _net_ebpf_ext_get_net_buffer(net_xdp_ctx);
+    ASSERT(old_net_buffer != NULL);
 
     // Allocate buffer for the cloned NBL, accounting for any unused header.
     status = RtlULongAdd(old_net_buffer->DataLength, unused_header_length, (unsigned long*)&cloned_net_buffer_length);
@@ -462,6 +496,17 @@ _net_ebpf_ext_free_nbl(_Inout_ NET_BUFFER_LIST* nbl, BOOLEAN free_data)
     FwpsFreeNetBufferList0(nbl);
 }
 
+static void
+_net_ebpf_ext_free_nbl_chain(_Inout_ NET_BUFFER_LIST* nbl_chain, BOOLEAN free_data)
+{
+    while (nbl_chain != NULL) {
+        NET_BUFFER_LIST* next_nbl = NET_BUFFER_LIST_NEXT_NBL(nbl_chain);
+        NET_BUFFER_LIST_NEXT_NBL(nbl_chain) = NULL;
+        _net_ebpf_ext_free_nbl(nbl_chain, free_data);
+        nbl_chain = next_nbl;
+    }
+}
+
 //
 // XDP Helper Functions.
 //
@@ -472,7 +517,6 @@ _net_ebpf_xdp_adjust_head(_Inout_ xdp_md_t* ctx, int delta)
     int return_value = 0;
     NDIS_STATUS ndis_status = NDIS_STATUS_SUCCESS;
     net_ebpf_xdp_md_t* net_xdp_ctx = (net_ebpf_xdp_md_t*)ctx;
-    NET_BUFFER_LIST* nbl = NULL;
     NET_BUFFER* net_buffer = NULL;
     uint8_t* packet_buffer = NULL;
 
@@ -482,9 +526,8 @@ _net_ebpf_xdp_adjust_head(_Inout_ xdp_md_t* ctx, int delta)
         goto Exit;
     }
 
-    nbl = (net_xdp_ctx->cloned_nbl != NULL) ? net_xdp_ctx->cloned_nbl : net_xdp_ctx->original_nbl;
-    ASSERT(nbl != NULL);
-    net_buffer = NET_BUFFER_LIST_FIRST_NB(nbl);
+    net_buffer = _net_ebpf_ext_get_net_buffer(net_xdp_ctx);
+    ASSERT(net_buffer != NULL);
 
     if (delta == 0) {
         // Nothing to do.
@@ -530,17 +573,30 @@ Exit:
 //
 
 static void
-_net_ebpf_ext_l2_receive_inject_complete(_In_ const void* context, _Inout_ NET_BUFFER_LIST* nbl, BOOLEAN dispatch_level)
+_net_ebpf_ext_l2_receive_inject_complete(
+    _In_opt_ const void* context, _Inout_ NET_BUFFER_LIST* nbl, BOOLEAN dispatch_level)
 {
-    UNREFERENCED_PARAMETER(context);
     UNREFERENCED_PARAMETER(dispatch_level);
-    // Free clone allocated using _net_ebpf_ext_allocate_cloned_nbl.
-    _net_ebpf_ext_free_nbl(nbl, TRUE);
+
+    if ((BOOLEAN)(uintptr_t)context == FALSE) {
+        // Free clones allocated using _net_ebpf_ext_allocate_cloned_nbl.
+        _net_ebpf_ext_free_nbl_chain(nbl, TRUE);
+    } else {
+        // Free clones allocated using FwpsAllocateCloneNetBufferList.
+        while (nbl != NULL) {
+            NET_BUFFER_LIST* next_nbl = NET_BUFFER_LIST_NEXT_NBL(nbl);
+            NET_BUFFER_LIST_NEXT_NBL(nbl) = NULL;
+            FwpsFreeCloneNetBufferList(nbl, 0);
+            nbl = next_nbl;
+        }
+    }
 }
 
 static NTSTATUS
 _net_ebpf_ext_receive_inject_cloned_nbl(
-    _In_ const NET_BUFFER_LIST* cloned_nbl, _In_ const FWPS_INCOMING_VALUES* incoming_fixed_values)
+    _In_ const NET_BUFFER_LIST* cloned_nbl,
+    BOOLEAN reference_clone,
+    _In_ const FWPS_INCOMING_VALUES* incoming_fixed_values)
 {
     uint32_t interface_index =
         incoming_fixed_values->incomingValue[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_INTERFACE_INDEX].value.uint32;
@@ -556,7 +612,7 @@ _net_ebpf_ext_receive_inject_cloned_nbl(
         ndis_port,
         (NET_BUFFER_LIST*)cloned_nbl,
         (FWPS_INJECT_COMPLETE)_net_ebpf_ext_l2_receive_inject_complete,
-        NULL);
+        (void*)(uintptr_t)reference_clone);
 
     if (!NT_SUCCESS(status)) {
         NET_EBPF_EXT_LOG_NTSTATUS_API_FAILURE(NET_EBPF_EXT_TRACELOG_KEYWORD_XDP, "FwpsInjectMacReceiveAsync", status);
@@ -574,8 +630,8 @@ _net_ebpf_ext_l2_inject_send_complete(
     UNREFERENCED_PARAMETER(dispatch_level);
 
     if ((BOOLEAN)(uintptr_t)context == FALSE) {
-        // Free clone allocated using _net_ebpf_ext_allocate_cloned_nbl.
-        _net_ebpf_ext_free_nbl(nbl, TRUE);
+        // Free clones allocated using _net_ebpf_ext_allocate_cloned_nbl.
+        _net_ebpf_ext_free_nbl_chain(nbl, TRUE);
     } else {
         // Free clone allocated using FwpsAllocateCloneNetBufferList.
         FwpsFreeCloneNetBufferList(nbl, 0);
@@ -644,6 +700,310 @@ _net_ebpf_extension_xdp_process_verdict(int program_verdict)
     return program_verdict != BPF_SOCK_ADDR_VERDICT_REJECT;
 }
 
+//
+// NBL Batch Functions.
+//
+
+static void
+_net_ebpf_ext_nbl_chain_append(_Inout_ net_ebpf_xdp_nbl_chain_t* chain, _Inout_ NET_BUFFER_LIST* nbl)
+{
+    NET_BUFFER_LIST_NEXT_NBL(nbl) = NULL;
+    *chain->tail = nbl;
+    chain->tail = &NET_BUFFER_LIST_NEXT_NBL(nbl);
+}
+
+static void
+_net_ebpf_ext_nbl_chain_initialize(_Out_ net_ebpf_xdp_nbl_chain_t* chain)
+{
+    chain->head = NULL;
+    chain->tail = &chain->head;
+}
+
+static void
+_net_ebpf_ext_xdp_batch_initialize(_Out_ net_ebpf_xdp_batch_t* batch)
+{
+    _net_ebpf_ext_nbl_chain_initialize(&batch->pass_clones);
+    _net_ebpf_ext_nbl_chain_initialize(&batch->pass);
+    _net_ebpf_ext_nbl_chain_initialize(&batch->tx);
+    _net_ebpf_ext_nbl_chain_initialize(&batch->drop);
+    batch->split = false;
+}
+
+/**
+ * @brief Copy a net buffer of the original indication into a newly allocated NBL.
+ *
+ * @param[in] nbl NBL that contains the net buffer.
+ * @param[in] net_buffer Net buffer to copy.
+ * @param[out] cloned_nbl Newly allocated NBL, to be freed with _net_ebpf_ext_free_nbl(cloned_nbl, TRUE).
+ *
+ * @retval STATUS_SUCCESS The operation was successful.
+ * @retval STATUS_INSUFFICIENT_RESOURCES Failed to allocate resources for this operation.
+ */
+static NTSTATUS
+_net_ebpf_ext_copy_net_buffer(
+    _In_ NET_BUFFER_LIST* nbl, _In_ NET_BUFFER* net_buffer, _Outptr_result_maybenull_ NET_BUFFER_LIST** cloned_nbl)
+{
+    NTSTATUS status;
+    net_ebpf_xdp_md_t net_xdp_ctx = {0};
+
+    net_xdp_ctx.original_nbl = nbl;
+    net_xdp_ctx.original_net_buffer = net_buffer;
+    // If the data is not contiguous, _net_ebpf_ext_allocate_cloned_nbl gathers it from the net buffer.
+    net_xdp_ctx.base.data = NdisGetDataBuffer(net_buffer, net_buffer->DataLength, NULL, 1, 0);
+
+    status = _net_ebpf_ext_allocate_cloned_nbl(&net_xdp_ctx, 0);
+    *cloned_nbl = net_xdp_ctx.cloned_nbl;
+    return status;
+}
+
+/**
+ * @brief Split the batch: move every net buffer before the current one, all of which passed unmodified while they
+ * were still part of the original indication, to the PASS sub-chains. The NBLs before the current NBL are passed as
+ * reference clones, so only the earlier net buffers of the current NBL are copied.
+ *
+ * @param[in, out] batch Batch to split.
+ * @param[in] nbl_chain Original indication.
+ * @param[in] current_nbl NBL that contains the current net buffer.
+ * @param[in] current_net_buffer Net buffer being classified when the split happened.
+ */
+static void
+_net_ebpf_ext_xdp_batch_split(
+    _Inout_ net_ebpf_xdp_batch_t* batch,
+    _In_ NET_BUFFER_LIST* nbl_chain,
+    _In_ NET_BUFFER_LIST* current_nbl,
+    _In_ const NET_BUFFER* current_net_buffer)
+{
+    NTSTATUS status;
+    NET_BUFFER_LIST* cloned_nbl;
+
+    batch->split = true;
+
+    for (NET_BUFFER_LIST* nbl = nbl_chain; nbl != current_nbl; nbl = NET_BUFFER_LIST_NEXT_NBL(nbl)) {
+        status = FwpsAllocateCloneNetBufferList(nbl, NULL, NULL, 0, &cloned_nbl);
+        if (!NT_SUCCESS(status)) {
+            // The net buffers of the NBL are dropped along with the original indication.
+            NET_EBPF_EXT_LOG_NTSTATUS_API_FAILURE(
+                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP, "FwpsAllocateCloneNetBufferList", status);
+            continue;
+        }
+        _net_ebpf_ext_nbl_chain_append(&batch->pass_clones, cloned_nbl);
+    }
+
+    for (NET_BUFFER* net_buffer = NET_BUFFER_LIST_FIRST_NB(current_nbl); net_buffer != current_net_buffer;
+         net_buffer = NET_BUFFER_NEXT_NB(net_buffer)) {
+        status = _net_ebpf_ext_copy_net_buffer(current_nbl, net_buffer, &cloned_nbl);
+        if (!NT_SUCCESS(status)) {
+            // The net buffer is dropped along with the original indication.
+            NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
+                NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
+                "_net_ebpf_ext_copy_net_buffer failed.",
+                status);
+            continue;
+        }
+        _net_ebpf_ext_nbl_chain_append(&batch->pass, cloned_nbl);
+    }
+}
+
+/**
+ * @brief Run the XDP programs on one net buffer of the indication and add it to the batch sub-chain for its verdict.
+ *
+ * @param[in] client_set Clients whose programs are run.
+ * @param[in] nbl_chain Original indication.
+ * @param[in] nbl NBL that contains the net buffer.
+ * @param[in] net_buffer Net buffer to classify.
+ * @param[in] incoming_fixed_values Incoming values of the classify call.
+ * @param[in, out] batch Batch the net buffer belongs to.
+ */
+static void
+_net_ebpf_ext_xdp_classify_net_buffer(
+    _In_ const net_ebpf_extension_hook_client_set_t* client_set,
+    _In_ NET_BUFFER_LIST* nbl_chain,
+    _In_ NET_BUFFER_LIST* nbl,
+    _In_ NET_BUFFER* net_buffer,
+    _In_ const FWPS_INCOMING_VALUES* incoming_fixed_values,
+    _Inout_ net_ebpf_xdp_batch_t* batch)
+{
+    NTSTATUS status = STATUS_SUCCESS;
+    uint8_t* packet_buffer;
+    uint32_t result = 0;
+    net_ebpf_xdp_md_header_t net_xdp_ctx_header = {0};
+    net_ebpf_xdp_md_t* net_xdp_ctx = &net_xdp_ctx_header.context;
+    xdp_md_t* xdp_ctx = &net_xdp_ctx->base;
+    ebpf_result_t program_result;
+
+    xdp_ctx->ingress_ifindex =
+        incoming_fixed_values->incomingValue[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_INTERFACE_INDEX].value.uint32;
+    net_xdp_ctx->original_nbl = nbl;
+    net_xdp_ctx->original_net_buffer = net_buffer;
+
+    packet_buffer = (uint8_t*)NdisGetDataBuffer(net_buffer, net_buffer->DataLength, NULL, sizeof(uint16_t), 0);
+    if (!packet_buffer) {
+        // Data in net_buffer not contiguous.
+        // Allocate a cloned NBL with contiguous data.
+        status = _net_ebpf_ext_allocate_cloned_nbl(net_xdp_ctx, 0);
+        if (!NT_SUCCESS(status)) {
+            NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
+                NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
+                "_net_ebpf_ext_allocate_cloned_nbl failed.",
+                status);
+        }
+    } else {
+        xdp_ctx->data = packet_buffer;
+        xdp_ctx->data_end = packet_buffer + net_buffer->DataLength;
+    }
+
+    if (!NT_SUCCESS(status)) {
+        // The programs can't run on the net buffer, so drop it explicitly. Leaving it in the original indication
+        // would lose it silently if the batch is split, and pass it unclassified if the batch is split later.
+        result = XDP_DROP;
+    } else {
+        program_result = net_ebpf_extension_hook_invoke_client_set(client_set, xdp_ctx, &result);
+        if (program_result != EBPF_SUCCESS) {
+            // Perform a default action if the program fails.
+            result = XDP_DROP;
+        }
+    }
+
+    if (result == XDP_PASS && net_xdp_ctx->cloned_nbl == NULL && !batch->split) {
+        // No special processing required. The net buffer is allowed to proceed in the ingress path as part of the
+        // original indication.
+        goto Exit;
+    }
+
+    if (!batch->split) {
+        _net_ebpf_ext_xdp_batch_split(batch, nbl_chain, nbl, net_buffer);
+    }
+
+    switch (result) {
+    case XDP_PASS:
+        if (net_xdp_ctx->cloned_nbl == NULL) {
+            // The original indication will be absorbed, so inject a copy of the net buffer in the receive path.
+            status = _net_ebpf_ext_allocate_cloned_nbl(net_xdp_ctx, 0);
+            if (!NT_SUCCESS(status)) {
+                NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
+                    NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+                    NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
+                    "_net_ebpf_ext_allocate_cloned_nbl failed.",
+                    status);
+                break;
+            }
+        }
+        _net_ebpf_ext_nbl_chain_append(&batch->pass, net_xdp_ctx->cloned_nbl);
+        break;
+    case XDP_TX:
+        if (net_xdp_ctx->cloned_nbl == NULL) {
+            if (NET_BUFFER_NEXT_NB(NET_BUFFER_LIST_FIRST_NB(nbl)) == NULL) {
+                // The NBL holds only this net buffer, so it can be sent with a reference clone instead of a copy.
+                _net_ebpf_ext_handle_xdp_tx(net_xdp_ctx, incoming_fixed_values);
+                break;
+            }
+            status = _net_ebpf_ext_allocate_cloned_nbl(net_xdp_ctx, 0);
+            if (!NT_SUCCESS(status)) {
+                NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
+                    NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+                    NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
+                    "_net_ebpf_ext_allocate_cloned_nbl failed.",
+                    status);
+                break;
+            }
+        }
+        _net_ebpf_ext_nbl_chain_append(&batch->tx, net_xdp_ctx->cloned_nbl);
+        break;
+    default:
+        ASSERT(FALSE);
+        __fallthrough;
+    case XDP_DROP:
+        // Free cloned NBL, if any.
+        if (net_xdp_ctx->cloned_nbl != NULL) {
+            _net_ebpf_ext_nbl_chain_append(&batch->drop, net_xdp_ctx->cloned_nbl);
+        }
+        break;
+    }
+
+Exit:
+    return;
+}
+
+/**
+ * @brief Dispose of the sub-chains of a split batch: inject the PASS sub-chains in the receive path, inject the TX
+ * sub-chain in the send path and free the DROP sub-chain.
+ *
+ * @param[in, out] batch Batch to complete.
+ * @param[in] incoming_fixed_values Incoming values of the classify call.
+ *
+ * @retval STATUS_SUCCESS The PASS sub-chains, if any, were injected.
+ * @retval Other A PASS sub-chain could not be injected and was freed.
+ */
+static NTSTATUS
+_net_ebpf_ext_xdp_batch_complete(
+    _Inout_ net_ebpf_xdp_batch_t* batch, _In_ const FWPS_INCOMING_VALUES* incoming_fixed_values)
+{
+    NTSTATUS status = STATUS_SUCCESS;
+    NTSTATUS tx_status;
+    NTSTATUS pass_status;
+    uint32_t interface_index =
+        incoming_fixed_values->incomingValue[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_INTERFACE_INDEX].value.uint32;
+    uint32_t ndis_port =
+        incoming_fixed_values->incomingValue[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_NDIS_PORT].value.uint32;
+
+    if (batch->drop.head != NULL) {
+        _net_ebpf_ext_free_nbl_chain(batch->drop.head, TRUE);
+        _net_ebpf_ext_nbl_chain_initialize(&batch->drop);
+    }
+
+    if (batch->tx.head != NULL) {
+        tx_status = FwpsInjectMacSendAsync(
+            _net_ebpf_ext_l2_injection_handle,
+            NULL,
+            0,
+            FWPS_LAYER_OUTBOUND_MAC_FRAME_NATIVE,
+            interface_index,
+            ndis_port,
+            batch->tx.head,
+            (FWPS_INJECT_COMPLETE)_net_ebpf_ext_l2_inject_send_complete,
+            (void*)(uintptr_t)FALSE);
+        if (tx_status != STATUS_SUCCESS) {
+            NET_EBPF_EXT_LOG_NTSTATUS_API_FAILURE(
+                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP, "FwpsInjectMacSendAsync", tx_status);
+            _net_ebpf_ext_free_nbl_chain(batch->tx.head, TRUE);
+        }
+        _net_ebpf_ext_nbl_chain_initialize(&batch->tx);
+    }
+
+    // The reference clones precede every copied net buffer in the original indication, so inject them first.
+    if (batch->pass_clones.head != NULL) {
+        status = _net_ebpf_ext_receive_inject_cloned_nbl(batch->pass_clones.head, TRUE, incoming_fixed_values);
+        if (!NT_SUCCESS(status)) {
+            NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
+                NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
+                "_net_ebpf_ext_receive_inject_cloned_nbl failed.",
+                status);
+            _net_ebpf_ext_l2_receive_inject_complete(
+                (void*)(uintptr_t)TRUE, batch->pass_clones.head, KeGetCurrentIrql() == DISPATCH_LEVEL);
+        }
+        _net_ebpf_ext_nbl_chain_initialize(&batch->pass_clones);
+    }
+
+    if (batch->pass.head != NULL) {
+        pass_status = _net_ebpf_ext_receive_inject_cloned_nbl(batch->pass.head, FALSE, incoming_fixed_values);
+        if (!NT_SUCCESS(pass_status)) {
+            NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
+                NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
+                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
+                "_net_ebpf_ext_receive_inject_cloned_nbl failed.",
+                pass_status);
+            _net_ebpf_ext_free_nbl_chain(batch->pass.head, TRUE);
+            status = pass_status;
+        }
+        _net_ebpf_ext_nbl_chain_initialize(&batch->pass);
+    }
+
+    return status;
+}
+
 //
 // WFP Classify callback.
 //
@@ -659,16 +1019,13 @@ net_ebpf_ext_layer_2_classify(
     _Inout_ FWPS_CLASSIFY_OUT* classify_output)
 {
     NTSTATUS status = STATUS_SUCCESS;
-    NET_BUFFER_LIST* nbl = (NET_BUFFER_LIST*)layer_data;
-    NET_BUFFER* net_buffer = NULL;
-    uint8_t* packet_buffer;
-    uint32_t result = 0;
-    net_ebpf_xdp_md_header_t net_xdp_ctx_header = {0};
-    net_ebpf_xdp_md_t* net_xdp_ctx = &net_xdp_ctx_header.context;
-    xdp_md_t* xdp_ctx = &net_xdp_ctx->base;
+    NET_BUFFER_LIST* nbl_chain = (NET_BUFFER_LIST*)layer_data;
     net_ebpf_extension_xdp_wfp_filter_context_t* filter_context = NULL;
+    net_ebpf_extension_hook_client_set_t client_set = {0};
+    bool clients_acquired = false;
+    net_ebpf_xdp_batch_t batch;
+    uint32_t ingress_ifindex;
     uint32_t client_if_index;
-    ebpf_result_t program_result;
 
     UNREFERENCED_PARAMETER(incoming_metadata_values);
     UNREFERENCED_PARAMETER(classify_context);
@@ -704,104 +1061,61 @@ net_ebpf_ext_layer_2_classify(
         goto Exit;
     }
 
-    if (nbl == NULL) {
+    if (nbl_chain == NULL) {
         NET_EBPF_EXT_LOG_MESSAGE(NET_EBPF_EXT_TRACELOG_LEVEL_ERROR, NET_EBPF_EXT_TRACELOG_KEYWORD_XDP, "Null NBL");
         goto Exit;
     }
 
-    xdp_ctx->ingress_ifindex =
+    ingress_ifindex =
         incoming_fixed_values->incomingValue[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_INTERFACE_INDEX].value.uint32;
 
     client_if_index = filter_context->if_index;
-    ASSERT((client_if_index == 0) || (client_if_index == xdp_ctx->ingress_ifindex));
-    if (client_if_index != 0 && client_if_index != xdp_ctx->ingress_ifindex) {
+    ASSERT((client_if_index == 0) || (client_if_index == ingress_ifindex));
+    if (client_if_index != 0 && client_if_index != ingress_ifindex) {
         // The client is not interested in this ingress ifindex.
         goto Exit;
     }
 
-    net_xdp_ctx->original_nbl = nbl;
+    // Acquire the attached clients once for the whole indication, rather than once per net buffer.
+    if (net_ebpf_extension_hook_acquire_clients(&filter_context->base, &client_set) != EBPF_SUCCESS) {
+        goto Exit;
+    }
+    clients_acquired = true;
 
-    net_buffer = NET_BUFFER_LIST_FIRST_NB(nbl);
-    if (net_buffer == NULL) {
-        NET_EBPF_EXT_LOG_MESSAGE(
-            NET_EBPF_EXT_TRACELOG_LEVEL_ERROR, NET_EBPF_EXT_TRACELOG_KEYWORD_XDP, "net_buffer not present");
+    if (client_set.dispatch_array == NULL) {
+        // No programs found.
         goto Exit;
     }
 
-    packet_buffer = (uint8_t*)NdisGetDataBuffer(net_buffer, net_buffer->DataLength, NULL, sizeof(uint16_t), 0);
-    if (!packet_buffer) {
-        // Data in net_buffer not contiguous.
-        // Allocate a cloned NBL with contiguous data.
-        status = _net_ebpf_ext_allocate_cloned_nbl(net_xdp_ctx, 0);
-        if (!NT_SUCCESS(status)) {
-            NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
-                NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
-                NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
-                "_net_ebpf_ext_allocate_cloned_nbl failed.",
-                status);
-            goto Exit;
+    _net_ebpf_ext_xdp_batch_initialize(&batch);
+    for (NET_BUFFER_LIST* nbl = nbl_chain; nbl != NULL; nbl = NET_BUFFER_LIST_NEXT_NBL(nbl)) {
+        for (NET_BUFFER* net_buffer = NET_BUFFER_LIST_FIRST_NB(nbl); net_buffer != NULL;
+             net_buffer = NET_BUFFER_NEXT_NB(net_buffer)) {
+            _net_ebpf_ext_xdp_classify_net_buffer(
+                &client_set, nbl_chain, nbl, net_buffer, incoming_fixed_values, &batch);
         }
-    } else {
-        xdp_ctx->data = packet_buffer;
-        xdp_ctx->data_end = packet_buffer + net_buffer->DataLength;
     }
 
-    program_result = net_ebpf_extension_hook_invoke_programs(xdp_ctx, &filter_context->base, &result);
-    if (program_result == EBPF_OBJECT_NOT_FOUND) {
-        // No programs found.
+    if (!batch.split) {
+        // Every net buffer passed unmodified. The original indication will be allowed to proceed in the ingress path.
         goto Exit;
-    } else if (program_result != EBPF_SUCCESS) {
-        // Perform a default action if the program fails.
-        result = XDP_DROP;
     }
 
-    switch (result) {
-    case XDP_PASS:
-        if (net_xdp_ctx->cloned_nbl != NULL) {
-            // Drop the original NBL.
-            classify_output->actionType = FWP_ACTION_BLOCK;
-            classify_output->rights &= ~FWPS_RIGHT_ACTION_WRITE;
-
-            // Inject the cloned NBL in receive path.
-            status = _net_ebpf_ext_receive_inject_cloned_nbl(net_xdp_ctx->cloned_nbl, incoming_fixed_values);
-            if (NT_SUCCESS(status)) {
-                // If cloned packet could be successfully injected, no need to audit for dropping the original.
-                // So absorb the original packet.
-                classify_output->flags |= FWPS_CLASSIFY_OUT_FLAG_ABSORB;
-            } else {
-                NET_EBPF_EXT_LOG_MESSAGE_NTSTATUS(
-                    NET_EBPF_EXT_TRACELOG_LEVEL_ERROR,
-                    NET_EBPF_EXT_TRACELOG_KEYWORD_XDP,
-                    "_net_ebpf_ext_receive_inject_cloned_nbl failed.",
-                    status);
-            }
-        }
-        // No special processing required in the non-clone case.
-        // The inbound original NBL will be allowed to proceed in the ingress path.
-        break;
-    case XDP_TX:
-        _net_ebpf_ext_handle_xdp_tx(net_xdp_ctx, incoming_fixed_values);
-        // Absorb the original NBL.
-        classify_output->actionType = FWP_ACTION_BLOCK;
-        classify_output->rights &= ~FWPS_RIGHT_ACTION_WRITE;
-        classify_output->flags |= FWPS_CLASSIFY_OUT_FLAG_ABSORB;
-        break;
-    default:
-        ASSERT(FALSE);
-        __fallthrough;
-    case XDP_DROP:
-        classify_output->actionType = FWP_ACTION_BLOCK;
-        classify_output->rights &= ~FWPS_RIGHT_ACTION_WRITE;
-        // Do not audit XDP drops.
+    // Drop the original indication. Its net buffers have been moved to the PASS, TX and DROP sub-chains.
+    classify_output->actionType = FWP_ACTION_BLOCK;
+    classify_output->rights &= ~FWPS_RIGHT_ACTION_WRITE;
+
+    status = _net_ebpf_ext_xdp_batch_complete(&batch, incoming_fixed_values);
+    if (NT_SUCCESS(status)) {
+        // If the passed packets could be successfully injected, no need to audit for dropping the original.
+        // XDP drops are not audited either. So absorb the original packet.
         classify_output->flags |= FWPS_CLASSIFY_OUT_FLAG_ABSORB;
-        // Free cloned NBL, if any.
-        if (net_xdp_ctx->cloned_nbl != NULL) {
-            _net_ebpf_ext_free_nbl(net_xdp_ctx->cloned_nbl, TRUE);
-        }
-        break;
     }
 
 Exit:
+    if (clients_acquired) {
+        net_ebpf_extension_hook_release_clients(&client_set);
+    }
     return;
 }
 
@@ -876,6 +1190,7 @@ _ebpf_xdp_context_create(
     mdl_chain = NULL;
 
     new_context->original_nbl = new_nbl;
+    new_context->original_net_buffer = NET_BUFFER_LIST_FIRST_NB(new_nbl);
     new_nbl = NULL;
 
     new_context->base.data = (void*)data_in;
@@ -590,6 +590,146 @@ TEST_CASE("ring_buffer_mmap_consumer", "[ring_buffer]")
     _close(map_fd);
 }
 
+typedef struct _ring_buffer_busy_poll_test_context
+{
+    std::atomic<uint32_t> event_count = 0;
+    uint32_t expected_event_count = 0;
+    uint32_t out_of_order_count = 0;
+    std::promise<void> promise;
+} ring_buffer_busy_poll_test_context_t;
+
+static int
+_ring_buffer_busy_poll_test_callback(void* ctx, void* data, size_t size)
+{
+    auto context = reinterpret_cast<ring_buffer_busy_poll_test_context_t*>(ctx);
+    // Records are consumed by a single thread, in the order they were written.
+    if ((size != sizeof(uint32_t)) || (*reinterpret_cast<uint32_t*>(data) != context->event_count)) {
+        context->out_of_order_count++;
+    }
+    if (++context->event_count == context->expected_event_count) {
+        context->promise.set_value();
+    }
+    return 0;
+}
+
+TEST_CASE("ring_buffer_busy_poll_consumer", "[ring_buffer]")
+{
+    const uint32_t max_entries = 64 * 1024;
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, "test_ringbuf", 0, 0, max_entries, nullptr);
+    REQUIRE(map_fd > 0);
+
+    ring_buffer_busy_poll_test_context_t context;
+    context.expected_event_count = 1000;
+    auto ring_buffer_event_callback = context.promise.get_future();
+
+    ebpf_ring_buffer_opts_t opts = {sizeof(opts)};
+    opts.busy_poll_budget_us = 100;
+    struct ring_buffer* ring = nullptr;
+    REQUIRE(
+        ebpf_ring_buffer_create(map_fd, _ring_buffer_busy_poll_test_callback, &context, &opts, &ring) ==
+        EBPF_SUCCESS);
+
+    // Write in bursts with pauses, so that the consumer both drains a busy ring and waits on an idle one.
+    for (uint32_t i = 0; i < context.expected_event_count; i++) {
+        REQUIRE(ebpf_ring_buffer_map_write(map_fd, &i, sizeof(i)) == EBPF_SUCCESS);
+        if ((i % 100) == 99) {
+            std::this_thread::sleep_for(10ms);
+        }
+    }
+
+    REQUIRE(ring_buffer_event_callback.wait_for(1s) == std::future_status::ready);
+    REQUIRE(context.out_of_order_count == 0);
+
+    // Records are consumed from the mapped ring without posting any async query IOCTLs.
+    ebpf_ring_buffer_statistics_t statistics;
+    REQUIRE(ebpf_ring_buffer_get_statistics(ring, &statistics) == EBPF_SUCCESS);
+    REQUIRE(statistics.records == context.expected_event_count);
+    REQUIRE(statistics.ioctls == 0);
+    REQUIRE(statistics.waits > 0);
+
+    ring_buffer__free(ring);
+    _close(map_fd);
+
+    // Sub-rings of a per-CPU ring buffer map cannot be mapped, so they cannot be busy-polled.
+    bpf_map_create_opts map_opts = {0};
+    map_opts.sz = sizeof(map_opts);
+    map_opts.map_flags = EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU;
+    map_fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, "per_cpu_ringbuf", 0, 0, max_entries, &map_opts);
+    REQUIRE(map_fd > 0);
+    REQUIRE(
+        ebpf_ring_buffer_create(map_fd, _ring_buffer_busy_poll_test_callback, &context, &opts, &ring) ==
+        EBPF_INVALID_ARGUMENT);
+    _close(map_fd);
+}
+
+/**
+ * @brief Measure the rate at which records written to a ring buffer map are consumed, and the rate of async query
+ * IOCTLs the consumer posts to do so, with and without busy-polling.
+ *
+ * @param[in] busy_poll_budget_us Busy-poll budget of the consumer, or 0 to consume records with async queries.
+ */
+static void
+_ring_buffer_consumer_throughput_test(uint32_t busy_poll_budget_us)
+{
+    const uint32_t max_entries = 1024 * 1024;
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, "test_ringbuf", 0, 0, max_entries, nullptr);
+    REQUIRE(map_fd > 0);
+
+    ring_buffer_busy_poll_test_context_t context;
+    context.expected_event_count = 200000;
+    auto ring_buffer_event_callback = context.promise.get_future();
+
+    ebpf_ring_buffer_opts_t opts = {sizeof(opts)};
+    opts.busy_poll_budget_us = busy_poll_budget_us;
+    struct ring_buffer* ring = nullptr;
+    REQUIRE(
+        ebpf_ring_buffer_create(map_fd, _ring_buffer_busy_poll_test_callback, &context, &opts, &ring) ==
+        EBPF_SUCCESS);
+
+    ebpf_ring_buffer_statistics_t start_statistics;
+    REQUIRE(ebpf_ring_buffer_get_statistics(ring, &start_statistics) == EBPF_SUCCESS);
+    auto start_time = std::chrono::steady_clock::now();
+
+    // Retry writes that fail because the consumer has fallen behind and the ring is full.
+    uint32_t write_failure_count = 0;
+    std::thread writer([&]() {
+        for (uint32_t i = 0; i < context.expected_event_count;) {
+            if (ebpf_ring_buffer_map_write(map_fd, &i, sizeof(i)) == EBPF_SUCCESS) {
+                i++;
+            } else if (++write_failure_count > context.expected_event_count) {
+                break;
+            }
+        }
+    });
+    writer.join();
+
+    REQUIRE(ring_buffer_event_callback.wait_for(10s) == std::future_status::ready);
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    ebpf_ring_buffer_statistics_t statistics;
+    REQUIRE(ebpf_ring_buffer_get_statistics(ring, &statistics) == EBPF_SUCCESS);
+    ring_buffer__free(ring);
+    _close(map_fd);
+
+    REQUIRE(context.out_of_order_count == 0);
+    printf(
+        "ring_buffer_consumer<%u>,%.0f events/sec,%.0f ioctls/sec,%.0f waits/sec\n",
+        busy_poll_budget_us,
+        (statistics.records - start_statistics.records) / elapsed,
+        (statistics.ioctls - start_statistics.ioctls) / elapsed,
+        (statistics.waits - start_statistics.waits) / elapsed);
+}
+
+TEST_CASE("ring_buffer_consumer_throughput_async_query", "[ring_buffer][performance]")
+{
+    _ring_buffer_consumer_throughput_test(0);
+}
+
+TEST_CASE("ring_buffer_consumer_throughput_busy_poll", "[ring_buffer][performance]")
+{
+    _ring_buffer_consumer_throughput_test(100);
+}
+
 void
 _test_nested_maps(bpf_map_type type)
 {
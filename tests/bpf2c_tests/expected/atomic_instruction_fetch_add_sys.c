@@ -236,12 +236,6 @@ func(void* context, const program_runtime_context_t* runtime_context)
     register uint64_t r1 = 0;
 #line 25 "sample/undocked/atomic_instruction_fetch_add.c"
     register uint64_t r2 = 0;
-#line 25 "sample/undocked/atomic_instruction_fetch_add.c"
-    register uint64_t r3 = 0;
-#line 25 "sample/undocked/atomic_instruction_fetch_add.c"
-    register uint64_t r4 = 0;
-#line 25 "sample/undocked/atomic_instruction_fetch_add.c"
-    register uint64_t r5 = 0;
 #line 25 "sample/undocked/atomic_instruction_fetch_add.c"
     register uint64_t r10 = 0;
 
@@ -267,11 +261,15 @@ func(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[0].address);
     // EBPF_OP_CALL pc=6 dst=r0 src=r0 offset=0 imm=1
 #line 28 "sample/undocked/atomic_instruction_fetch_add.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
+#line 28 "sample/undocked/atomic_instruction_fetch_add.c"
+    if (r0 < 1) {
+#line 28 "sample/undocked/atomic_instruction_fetch_add.c"
+        r0 = POINTER(runtime_context->map_value_data[0].address + r0 * 8);
 #line 28 "sample/undocked/atomic_instruction_fetch_add.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    } else {
 #line 28 "sample/undocked/atomic_instruction_fetch_add.c"
-        return 0;
+        r0 = 0;
 #line 28 "sample/undocked/atomic_instruction_fetch_add.c"
     }
     // EBPF_OP_JEQ_IMM pc=7 dst=r0 src=r0 offset=2 imm=0
@@ -113,12 +113,6 @@ lookup(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=6 dst=r0 src=r0 offset=0 imm=1
 #line 29 "sample/undocked/bad_map_name.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 29 "sample/undocked/bad_map_name.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 29 "sample/undocked/bad_map_name.c"
-        return 0;
-#line 29 "sample/undocked/bad_map_name.c"
-    }
     // EBPF_OP_MOV64_REG pc=7 dst=r1 src=r0 offset=0 imm=0
 #line 29 "sample/undocked/bad_map_name.c"
     r1 = r0;
@@ -172,12 +172,6 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -191,7 +185,7 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 53 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 53 "sample/bindmonitor_mt_tailcall.c"
@@ -245,12 +239,6 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 53 "sample/bindmonitor_mt_tailcall.c"
@@ -353,12 +341,6 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -372,7 +354,7 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 54 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 54 "sample/bindmonitor_mt_tailcall.c"
@@ -426,12 +408,6 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 54 "sample/bindmonitor_mt_tailcall.c"
@@ -534,12 +510,6 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -553,7 +523,7 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 63 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 63 "sample/bindmonitor_mt_tailcall.c"
@@ -607,12 +577,6 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 63 "sample/bindmonitor_mt_tailcall.c"
@@ -715,12 +679,6 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -734,7 +692,7 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 64 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 64 "sample/bindmonitor_mt_tailcall.c"
@@ -788,12 +746,6 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 64 "sample/bindmonitor_mt_tailcall.c"
@@ -896,12 +848,6 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -915,7 +861,7 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 65 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 65 "sample/bindmonitor_mt_tailcall.c"
@@ -969,12 +915,6 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 65 "sample/bindmonitor_mt_tailcall.c"
@@ -1077,12 +1017,6 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1096,7 +1030,7 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 66 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 66 "sample/bindmonitor_mt_tailcall.c"
@@ -1150,12 +1084,6 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 66 "sample/bindmonitor_mt_tailcall.c"
@@ -1258,12 +1186,6 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1277,7 +1199,7 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 67 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 67 "sample/bindmonitor_mt_tailcall.c"
@@ -1331,12 +1253,6 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 67 "sample/bindmonitor_mt_tailcall.c"
@@ -1439,12 +1355,6 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1458,7 +1368,7 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 68 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 68 "sample/bindmonitor_mt_tailcall.c"
@@ -1512,12 +1422,6 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 68 "sample/bindmonitor_mt_tailcall.c"
@@ -1620,12 +1524,6 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1639,7 +1537,7 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 69 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 69 "sample/bindmonitor_mt_tailcall.c"
@@ -1693,12 +1591,6 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 69 "sample/bindmonitor_mt_tailcall.c"
@@ -1801,12 +1693,6 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1820,7 +1706,7 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 70 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 70 "sample/bindmonitor_mt_tailcall.c"
@@ -1874,12 +1760,6 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 70 "sample/bindmonitor_mt_tailcall.c"
@@ -1982,12 +1862,6 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2001,7 +1875,7 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 71 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 71 "sample/bindmonitor_mt_tailcall.c"
@@ -2055,12 +1929,6 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 71 "sample/bindmonitor_mt_tailcall.c"
@@ -2163,12 +2031,6 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2182,7 +2044,7 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 72 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 72 "sample/bindmonitor_mt_tailcall.c"
@@ -2236,12 +2098,6 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 72 "sample/bindmonitor_mt_tailcall.c"
@@ -2344,12 +2200,6 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2363,7 +2213,7 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 55 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 55 "sample/bindmonitor_mt_tailcall.c"
@@ -2417,12 +2267,6 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 55 "sample/bindmonitor_mt_tailcall.c"
@@ -2525,12 +2369,6 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2544,7 +2382,7 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 73 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 73 "sample/bindmonitor_mt_tailcall.c"
@@ -2598,12 +2436,6 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 73 "sample/bindmonitor_mt_tailcall.c"
@@ -2706,12 +2538,6 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2725,7 +2551,7 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 74 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 74 "sample/bindmonitor_mt_tailcall.c"
@@ -2779,12 +2605,6 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 74 "sample/bindmonitor_mt_tailcall.c"
@@ -2887,12 +2707,6 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2906,7 +2720,7 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 75 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 75 "sample/bindmonitor_mt_tailcall.c"
@@ -2960,12 +2774,6 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 75 "sample/bindmonitor_mt_tailcall.c"
@@ -3068,12 +2876,6 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3087,7 +2889,7 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 76 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 76 "sample/bindmonitor_mt_tailcall.c"
@@ -3141,12 +2943,6 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/bindmonitor_mt_tailcall.c"
@@ -3249,12 +3045,6 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3268,7 +3058,7 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 77 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 77 "sample/bindmonitor_mt_tailcall.c"
@@ -3322,12 +3112,6 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 77 "sample/bindmonitor_mt_tailcall.c"
@@ -3430,12 +3214,6 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3449,7 +3227,7 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 78 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 78 "sample/bindmonitor_mt_tailcall.c"
@@ -3503,12 +3281,6 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 78 "sample/bindmonitor_mt_tailcall.c"
@@ -3611,12 +3383,6 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3630,7 +3396,7 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 79 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 79 "sample/bindmonitor_mt_tailcall.c"
@@ -3684,12 +3450,6 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 79 "sample/bindmonitor_mt_tailcall.c"
@@ -3792,12 +3552,6 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3811,7 +3565,7 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 80 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 80 "sample/bindmonitor_mt_tailcall.c"
@@ -3865,12 +3619,6 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/bindmonitor_mt_tailcall.c"
@@ -3973,12 +3721,6 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3992,7 +3734,7 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 81 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 81 "sample/bindmonitor_mt_tailcall.c"
@@ -4046,12 +3788,6 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 81 "sample/bindmonitor_mt_tailcall.c"
@@ -4154,12 +3890,6 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4173,7 +3903,7 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 82 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 82 "sample/bindmonitor_mt_tailcall.c"
@@ -4227,12 +3957,6 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 82 "sample/bindmonitor_mt_tailcall.c"
@@ -4335,12 +4059,6 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4354,7 +4072,7 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 56 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 56 "sample/bindmonitor_mt_tailcall.c"
@@ -4408,12 +4126,6 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 56 "sample/bindmonitor_mt_tailcall.c"
@@ -4516,12 +4228,6 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4535,7 +4241,7 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 83 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 83 "sample/bindmonitor_mt_tailcall.c"
@@ -4589,12 +4295,6 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 83 "sample/bindmonitor_mt_tailcall.c"
@@ -4697,12 +4397,6 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4716,7 +4410,7 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 84 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 84 "sample/bindmonitor_mt_tailcall.c"
@@ -4770,12 +4464,6 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 84 "sample/bindmonitor_mt_tailcall.c"
@@ -4916,12 +4604,6 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4935,7 +4617,7 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 57 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 57 "sample/bindmonitor_mt_tailcall.c"
@@ -4989,12 +4671,6 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 57 "sample/bindmonitor_mt_tailcall.c"
@@ -5097,12 +4773,6 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5116,7 +4786,7 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 58 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 58 "sample/bindmonitor_mt_tailcall.c"
@@ -5170,12 +4840,6 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 58 "sample/bindmonitor_mt_tailcall.c"
@@ -5278,12 +4942,6 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5297,7 +4955,7 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 59 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 59 "sample/bindmonitor_mt_tailcall.c"
@@ -5351,12 +5009,6 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 59 "sample/bindmonitor_mt_tailcall.c"
@@ -5459,12 +5111,6 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5478,7 +5124,7 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 60 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 60 "sample/bindmonitor_mt_tailcall.c"
@@ -5532,12 +5178,6 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/bindmonitor_mt_tailcall.c"
@@ -5640,12 +5280,6 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5659,7 +5293,7 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 61 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 61 "sample/bindmonitor_mt_tailcall.c"
@@ -5713,12 +5347,6 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 61 "sample/bindmonitor_mt_tailcall.c"
@@ -5826,12 +5454,6 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=13
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=15 dst=r1 src=r6 offset=0 imm=0
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5845,7 +5467,7 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 62 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 62 "sample/bindmonitor_mt_tailcall.c"
@@ -5896,12 +5518,6 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 62 "sample/bindmonitor_mt_tailcall.c"
@@ -6014,12 +5630,6 @@ BindMonitor_Caller(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=13
 #line 33 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=21 dst=r1 src=r6 offset=0 imm=0
 #line 34 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -6033,7 +5643,7 @@ BindMonitor_Caller(void* context, const program_runtime_context_t* runtime_conte
 #line 34 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 34 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 34 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 34 "sample/bindmonitor_mt_tailcall.c"
@@ -142,12 +142,6 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -161,7 +155,7 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 53 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 53 "sample/bindmonitor_mt_tailcall.c"
@@ -215,12 +209,6 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 53 "sample/bindmonitor_mt_tailcall.c"
@@ -323,12 +311,6 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -342,7 +324,7 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 54 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 54 "sample/bindmonitor_mt_tailcall.c"
@@ -396,12 +378,6 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 54 "sample/bindmonitor_mt_tailcall.c"
@@ -504,12 +480,6 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -523,7 +493,7 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 63 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 63 "sample/bindmonitor_mt_tailcall.c"
@@ -577,12 +547,6 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 63 "sample/bindmonitor_mt_tailcall.c"
@@ -685,12 +649,6 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -704,7 +662,7 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 64 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 64 "sample/bindmonitor_mt_tailcall.c"
@@ -758,12 +716,6 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 64 "sample/bindmonitor_mt_tailcall.c"
@@ -866,12 +818,6 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -885,7 +831,7 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 65 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 65 "sample/bindmonitor_mt_tailcall.c"
@@ -939,12 +885,6 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 65 "sample/bindmonitor_mt_tailcall.c"
@@ -1047,12 +987,6 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1066,7 +1000,7 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 66 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 66 "sample/bindmonitor_mt_tailcall.c"
@@ -1120,12 +1054,6 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 66 "sample/bindmonitor_mt_tailcall.c"
@@ -1228,12 +1156,6 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1247,7 +1169,7 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 67 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 67 "sample/bindmonitor_mt_tailcall.c"
@@ -1301,12 +1223,6 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 67 "sample/bindmonitor_mt_tailcall.c"
@@ -1409,12 +1325,6 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1428,7 +1338,7 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 68 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 68 "sample/bindmonitor_mt_tailcall.c"
@@ -1482,12 +1392,6 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 68 "sample/bindmonitor_mt_tailcall.c"
@@ -1590,12 +1494,6 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1609,7 +1507,7 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 69 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 69 "sample/bindmonitor_mt_tailcall.c"
@@ -1663,12 +1561,6 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 69 "sample/bindmonitor_mt_tailcall.c"
@@ -1771,12 +1663,6 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1790,7 +1676,7 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 70 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 70 "sample/bindmonitor_mt_tailcall.c"
@@ -1844,12 +1730,6 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 70 "sample/bindmonitor_mt_tailcall.c"
@@ -1952,12 +1832,6 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1971,7 +1845,7 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 71 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 71 "sample/bindmonitor_mt_tailcall.c"
@@ -2025,12 +1899,6 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 71 "sample/bindmonitor_mt_tailcall.c"
@@ -2133,12 +2001,6 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2152,7 +2014,7 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 72 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 72 "sample/bindmonitor_mt_tailcall.c"
@@ -2206,12 +2068,6 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 72 "sample/bindmonitor_mt_tailcall.c"
@@ -2314,12 +2170,6 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2333,7 +2183,7 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 55 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 55 "sample/bindmonitor_mt_tailcall.c"
@@ -2387,12 +2237,6 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 55 "sample/bindmonitor_mt_tailcall.c"
@@ -2495,12 +2339,6 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2514,7 +2352,7 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 73 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 73 "sample/bindmonitor_mt_tailcall.c"
@@ -2568,12 +2406,6 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 73 "sample/bindmonitor_mt_tailcall.c"
@@ -2676,12 +2508,6 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2695,7 +2521,7 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 74 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 74 "sample/bindmonitor_mt_tailcall.c"
@@ -2749,12 +2575,6 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 74 "sample/bindmonitor_mt_tailcall.c"
@@ -2857,12 +2677,6 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2876,7 +2690,7 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 75 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 75 "sample/bindmonitor_mt_tailcall.c"
@@ -2930,12 +2744,6 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 75 "sample/bindmonitor_mt_tailcall.c"
@@ -3038,12 +2846,6 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3057,7 +2859,7 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 76 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 76 "sample/bindmonitor_mt_tailcall.c"
@@ -3111,12 +2913,6 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/bindmonitor_mt_tailcall.c"
@@ -3219,12 +3015,6 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3238,7 +3028,7 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 77 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 77 "sample/bindmonitor_mt_tailcall.c"
@@ -3292,12 +3082,6 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 77 "sample/bindmonitor_mt_tailcall.c"
@@ -3400,12 +3184,6 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3419,7 +3197,7 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 78 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 78 "sample/bindmonitor_mt_tailcall.c"
@@ -3473,12 +3251,6 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 78 "sample/bindmonitor_mt_tailcall.c"
@@ -3581,12 +3353,6 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3600,7 +3366,7 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 79 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 79 "sample/bindmonitor_mt_tailcall.c"
@@ -3654,12 +3420,6 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 79 "sample/bindmonitor_mt_tailcall.c"
@@ -3762,12 +3522,6 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3781,7 +3535,7 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 80 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 80 "sample/bindmonitor_mt_tailcall.c"
@@ -3835,12 +3589,6 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/bindmonitor_mt_tailcall.c"
@@ -3943,12 +3691,6 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3962,7 +3704,7 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 81 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 81 "sample/bindmonitor_mt_tailcall.c"
@@ -4016,12 +3758,6 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 81 "sample/bindmonitor_mt_tailcall.c"
@@ -4124,12 +3860,6 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4143,7 +3873,7 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 82 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 82 "sample/bindmonitor_mt_tailcall.c"
@@ -4197,12 +3927,6 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 82 "sample/bindmonitor_mt_tailcall.c"
@@ -4305,12 +4029,6 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4324,7 +4042,7 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 56 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 56 "sample/bindmonitor_mt_tailcall.c"
@@ -4378,12 +4096,6 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 56 "sample/bindmonitor_mt_tailcall.c"
@@ -4486,12 +4198,6 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4505,7 +4211,7 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 83 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 83 "sample/bindmonitor_mt_tailcall.c"
@@ -4559,12 +4265,6 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 83 "sample/bindmonitor_mt_tailcall.c"
@@ -4667,12 +4367,6 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4686,7 +4380,7 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 84 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 84 "sample/bindmonitor_mt_tailcall.c"
@@ -4740,12 +4434,6 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 84 "sample/bindmonitor_mt_tailcall.c"
@@ -4886,12 +4574,6 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4905,7 +4587,7 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 57 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 57 "sample/bindmonitor_mt_tailcall.c"
@@ -4959,12 +4641,6 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 57 "sample/bindmonitor_mt_tailcall.c"
@@ -5067,12 +4743,6 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5086,7 +4756,7 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 58 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 58 "sample/bindmonitor_mt_tailcall.c"
@@ -5140,12 +4810,6 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 58 "sample/bindmonitor_mt_tailcall.c"
@@ -5248,12 +4912,6 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5267,7 +4925,7 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 59 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 59 "sample/bindmonitor_mt_tailcall.c"
@@ -5321,12 +4979,6 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 59 "sample/bindmonitor_mt_tailcall.c"
@@ -5429,12 +5081,6 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5448,7 +5094,7 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 60 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 60 "sample/bindmonitor_mt_tailcall.c"
@@ -5502,12 +5148,6 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/bindmonitor_mt_tailcall.c"
@@ -5610,12 +5250,6 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5629,7 +5263,7 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 61 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 61 "sample/bindmonitor_mt_tailcall.c"
@@ -5683,12 +5317,6 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 61 "sample/bindmonitor_mt_tailcall.c"
@@ -5796,12 +5424,6 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=13
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=15 dst=r1 src=r6 offset=0 imm=0
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5815,7 +5437,7 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 62 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 62 "sample/bindmonitor_mt_tailcall.c"
@@ -5866,12 +5488,6 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 62 "sample/bindmonitor_mt_tailcall.c"
@@ -5984,12 +5600,6 @@ BindMonitor_Caller(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=13
 #line 33 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=21 dst=r1 src=r6 offset=0 imm=0
 #line 34 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -6003,7 +5613,7 @@ BindMonitor_Caller(void* context, const program_runtime_context_t* runtime_conte
 #line 34 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 34 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 34 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 34 "sample/bindmonitor_mt_tailcall.c"
@@ -297,12 +297,6 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -316,7 +310,7 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 53 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 53 "sample/bindmonitor_mt_tailcall.c"
@@ -370,12 +364,6 @@ BindMonitor_Callee0(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 53 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 53 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 53 "sample/bindmonitor_mt_tailcall.c"
@@ -478,12 +466,6 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -497,7 +479,7 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 54 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 54 "sample/bindmonitor_mt_tailcall.c"
@@ -551,12 +533,6 @@ BindMonitor_Callee1(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 54 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 54 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 54 "sample/bindmonitor_mt_tailcall.c"
@@ -659,12 +635,6 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -678,7 +648,7 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 63 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 63 "sample/bindmonitor_mt_tailcall.c"
@@ -732,12 +702,6 @@ BindMonitor_Callee10(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 63 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 63 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 63 "sample/bindmonitor_mt_tailcall.c"
@@ -840,12 +804,6 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -859,7 +817,7 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 64 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 64 "sample/bindmonitor_mt_tailcall.c"
@@ -913,12 +871,6 @@ BindMonitor_Callee11(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 64 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 64 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 64 "sample/bindmonitor_mt_tailcall.c"
@@ -1021,12 +973,6 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1040,7 +986,7 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 65 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 65 "sample/bindmonitor_mt_tailcall.c"
@@ -1094,12 +1040,6 @@ BindMonitor_Callee12(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 65 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 65 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 65 "sample/bindmonitor_mt_tailcall.c"
@@ -1202,12 +1142,6 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1221,7 +1155,7 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 66 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 66 "sample/bindmonitor_mt_tailcall.c"
@@ -1275,12 +1209,6 @@ BindMonitor_Callee13(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 66 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 66 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 66 "sample/bindmonitor_mt_tailcall.c"
@@ -1383,12 +1311,6 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1402,7 +1324,7 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 67 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 67 "sample/bindmonitor_mt_tailcall.c"
@@ -1456,12 +1378,6 @@ BindMonitor_Callee14(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 67 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 67 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 67 "sample/bindmonitor_mt_tailcall.c"
@@ -1564,12 +1480,6 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1583,7 +1493,7 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 68 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 68 "sample/bindmonitor_mt_tailcall.c"
@@ -1637,12 +1547,6 @@ BindMonitor_Callee15(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 68 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 68 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 68 "sample/bindmonitor_mt_tailcall.c"
@@ -1745,12 +1649,6 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1764,7 +1662,7 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 69 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 69 "sample/bindmonitor_mt_tailcall.c"
@@ -1818,12 +1716,6 @@ BindMonitor_Callee16(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 69 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 69 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 69 "sample/bindmonitor_mt_tailcall.c"
@@ -1926,12 +1818,6 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -1945,7 +1831,7 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 70 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 70 "sample/bindmonitor_mt_tailcall.c"
@@ -1999,12 +1885,6 @@ BindMonitor_Callee17(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 70 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 70 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 70 "sample/bindmonitor_mt_tailcall.c"
@@ -2107,12 +1987,6 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2126,7 +2000,7 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 71 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 71 "sample/bindmonitor_mt_tailcall.c"
@@ -2180,12 +2054,6 @@ BindMonitor_Callee18(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 71 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 71 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 71 "sample/bindmonitor_mt_tailcall.c"
@@ -2288,12 +2156,6 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2307,7 +2169,7 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 72 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 72 "sample/bindmonitor_mt_tailcall.c"
@@ -2361,12 +2223,6 @@ BindMonitor_Callee19(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 72 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 72 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 72 "sample/bindmonitor_mt_tailcall.c"
@@ -2469,12 +2325,6 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2488,7 +2338,7 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 55 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 55 "sample/bindmonitor_mt_tailcall.c"
@@ -2542,12 +2392,6 @@ BindMonitor_Callee2(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 55 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 55 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 55 "sample/bindmonitor_mt_tailcall.c"
@@ -2650,12 +2494,6 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2669,7 +2507,7 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 73 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 73 "sample/bindmonitor_mt_tailcall.c"
@@ -2723,12 +2561,6 @@ BindMonitor_Callee20(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 73 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 73 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 73 "sample/bindmonitor_mt_tailcall.c"
@@ -2831,12 +2663,6 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -2850,7 +2676,7 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 74 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 74 "sample/bindmonitor_mt_tailcall.c"
@@ -2904,12 +2730,6 @@ BindMonitor_Callee21(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 74 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 74 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 74 "sample/bindmonitor_mt_tailcall.c"
@@ -3012,12 +2832,6 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3031,7 +2845,7 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 75 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 75 "sample/bindmonitor_mt_tailcall.c"
@@ -3085,12 +2899,6 @@ BindMonitor_Callee22(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 75 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 75 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 75 "sample/bindmonitor_mt_tailcall.c"
@@ -3193,12 +3001,6 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3212,7 +3014,7 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 76 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 76 "sample/bindmonitor_mt_tailcall.c"
@@ -3266,12 +3068,6 @@ BindMonitor_Callee23(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 76 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 76 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/bindmonitor_mt_tailcall.c"
@@ -3374,12 +3170,6 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3393,7 +3183,7 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 77 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 77 "sample/bindmonitor_mt_tailcall.c"
@@ -3447,12 +3237,6 @@ BindMonitor_Callee24(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 77 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 77 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 77 "sample/bindmonitor_mt_tailcall.c"
@@ -3555,12 +3339,6 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3574,7 +3352,7 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 78 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 78 "sample/bindmonitor_mt_tailcall.c"
@@ -3628,12 +3406,6 @@ BindMonitor_Callee25(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 78 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 78 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 78 "sample/bindmonitor_mt_tailcall.c"
@@ -3736,12 +3508,6 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3755,7 +3521,7 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 79 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 79 "sample/bindmonitor_mt_tailcall.c"
@@ -3809,12 +3575,6 @@ BindMonitor_Callee26(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 79 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 79 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 79 "sample/bindmonitor_mt_tailcall.c"
@@ -3917,12 +3677,6 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -3936,7 +3690,7 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 80 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 80 "sample/bindmonitor_mt_tailcall.c"
@@ -3990,12 +3744,6 @@ BindMonitor_Callee27(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 80 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 80 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/bindmonitor_mt_tailcall.c"
@@ -4098,12 +3846,6 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4117,7 +3859,7 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 81 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 81 "sample/bindmonitor_mt_tailcall.c"
@@ -4171,12 +3913,6 @@ BindMonitor_Callee28(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 81 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 81 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 81 "sample/bindmonitor_mt_tailcall.c"
@@ -4279,12 +4015,6 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4298,7 +4028,7 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 82 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 82 "sample/bindmonitor_mt_tailcall.c"
@@ -4352,12 +4082,6 @@ BindMonitor_Callee29(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 82 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 82 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 82 "sample/bindmonitor_mt_tailcall.c"
@@ -4460,12 +4184,6 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4479,7 +4197,7 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 56 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 56 "sample/bindmonitor_mt_tailcall.c"
@@ -4533,12 +4251,6 @@ BindMonitor_Callee3(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 56 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 56 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 56 "sample/bindmonitor_mt_tailcall.c"
@@ -4641,12 +4353,6 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4660,7 +4366,7 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 83 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 83 "sample/bindmonitor_mt_tailcall.c"
@@ -4714,12 +4420,6 @@ BindMonitor_Callee30(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 83 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 83 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 83 "sample/bindmonitor_mt_tailcall.c"
@@ -4822,12 +4522,6 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -4841,7 +4535,7 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 84 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 84 "sample/bindmonitor_mt_tailcall.c"
@@ -4895,12 +4589,6 @@ BindMonitor_Callee31(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 84 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 84 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 84 "sample/bindmonitor_mt_tailcall.c"
@@ -5041,12 +4729,6 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5060,7 +4742,7 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 57 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 57 "sample/bindmonitor_mt_tailcall.c"
@@ -5114,12 +4796,6 @@ BindMonitor_Callee4(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 57 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 57 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 57 "sample/bindmonitor_mt_tailcall.c"
@@ -5222,12 +4898,6 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5241,7 +4911,7 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 58 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 58 "sample/bindmonitor_mt_tailcall.c"
@@ -5295,12 +4965,6 @@ BindMonitor_Callee5(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 58 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 58 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 58 "sample/bindmonitor_mt_tailcall.c"
@@ -5403,12 +5067,6 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5422,7 +5080,7 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 59 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 59 "sample/bindmonitor_mt_tailcall.c"
@@ -5476,12 +5134,6 @@ BindMonitor_Callee6(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 59 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 59 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 59 "sample/bindmonitor_mt_tailcall.c"
@@ -5584,12 +5236,6 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5603,7 +5249,7 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 60 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 60 "sample/bindmonitor_mt_tailcall.c"
@@ -5657,12 +5303,6 @@ BindMonitor_Callee7(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 60 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 60 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/bindmonitor_mt_tailcall.c"
@@ -5765,12 +5405,6 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=13 dst=r0 src=r0 offset=0 imm=13
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=14 dst=r1 src=r6 offset=0 imm=0
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5784,7 +5418,7 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 61 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 61 "sample/bindmonitor_mt_tailcall.c"
@@ -5838,12 +5472,6 @@ BindMonitor_Callee8(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 61 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 61 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 61 "sample/bindmonitor_mt_tailcall.c"
@@ -5951,12 +5579,6 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=13
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=15 dst=r1 src=r6 offset=0 imm=0
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -5970,7 +5592,7 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 62 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 62 "sample/bindmonitor_mt_tailcall.c"
@@ -6021,12 +5643,6 @@ BindMonitor_Callee9(void* context, const program_runtime_context_t* runtime_cont
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=13
 #line 62 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 62 "sample/bindmonitor_mt_tailcall.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=36 dst=r0 src=r0 offset=0 imm=1
 #line 62 "sample/bindmonitor_mt_tailcall.c"
@@ -6139,12 +5755,6 @@ BindMonitor_Caller(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=13
 #line 33 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-        return 0;
-#line 33 "sample/bindmonitor_mt_tailcall.c"
-    }
     // EBPF_OP_MOV64_REG pc=21 dst=r1 src=r6 offset=0 imm=0
 #line 34 "sample/bindmonitor_mt_tailcall.c"
     r1 = r6;
@@ -6158,7 +5768,7 @@ BindMonitor_Caller(void* context, const program_runtime_context_t* runtime_conte
 #line 34 "sample/bindmonitor_mt_tailcall.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 34 "sample/bindmonitor_mt_tailcall.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 34 "sample/bindmonitor_mt_tailcall.c"
         return 0;
 #line 34 "sample/bindmonitor_mt_tailcall.c"
@@ -158,12 +158,6 @@ bind_monitor(void* context, const program_runtime_context_t* runtime_context)
     r2 = POINTER(runtime_context->map_data[0].address);
 #line 31 "sample/bindmonitor_perf_event_array.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 31 "sample/bindmonitor_perf_event_array.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 31 "sample/bindmonitor_perf_event_array.c"
-        return 0;
-#line 31 "sample/bindmonitor_perf_event_array.c"
-    }
 label_1:
 #line 39 "sample/bindmonitor_perf_event_array.c"
     r0 = IMMEDIATE(0);
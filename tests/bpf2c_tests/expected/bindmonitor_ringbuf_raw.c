@@ -132,12 +132,6 @@ bind_monitor(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=9 dst=r0 src=r0 offset=0 imm=11
 #line 29 "sample/bindmonitor_ringbuf.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 29 "sample/bindmonitor_ringbuf.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 29 "sample/bindmonitor_ringbuf.c"
-        return 0;
-#line 29 "sample/bindmonitor_ringbuf.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=10 dst=r0 src=r0 offset=0 imm=0
 #line 36 "sample/bindmonitor_ringbuf.c"
@@ -128,12 +128,6 @@ func(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=11 dst=r0 src=r0 offset=0 imm=2
 #line 29 "sample/undocked/bpf_call.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 29 "sample/undocked/bpf_call.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 29 "sample/undocked/bpf_call.c"
-        return 0;
-#line 29 "sample/undocked/bpf_call.c"
-    }
     // EBPF_OP_EXIT pc=12 dst=r0 src=r0 offset=0 imm=0
 #line 30 "sample/undocked/bpf_call.c"
     return r0;
@@ -257,12 +257,6 @@ label_1:
     // EBPF_OP_CALL pc=32 dst=r0 src=r0 offset=0 imm=1
 #line 70 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 70 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=33 dst=r7 src=r0 offset=0 imm=0
 #line 70 "sample/cgroup_sock_addr2.c"
     r7 = r0;
@@ -333,12 +327,6 @@ label_1:
     // EBPF_OP_CALL pc=58 dst=r0 src=r0 offset=0 imm=14
 #line 72 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 72 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 72 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 72 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=59 dst=r2 src=r10 offset=0 imm=0
 #line 72 "sample/cgroup_sock_addr2.c"
     r2 = r10;
@@ -354,12 +342,6 @@ label_1:
     // EBPF_OP_CALL pc=63 dst=r0 src=r0 offset=0 imm=65537
 #line 75 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 75 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 75 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 75 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=64 dst=r1 src=r0 offset=0 imm=0
 #line 75 "sample/cgroup_sock_addr2.c"
     r1 = r0;
@@ -404,12 +386,6 @@ label_2:
     // EBPF_OP_CALL pc=76 dst=r0 src=r0 offset=0 imm=19
 #line 44 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=77 dst=r7 src=r0 offset=0 imm=0
 #line 44 "sample/cgroup_sock_addr2.c"
     r7 = r0;
@@ -422,12 +398,6 @@ label_2:
     // EBPF_OP_CALL pc=80 dst=r0 src=r0 offset=0 imm=20
 #line 45 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_STXDW pc=81 dst=r10 src=r0 offset=-104 imm=0
 #line 45 "sample/cgroup_sock_addr2.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-104)) = (uint64_t)r0;
@@ -437,12 +407,6 @@ label_2:
     // EBPF_OP_CALL pc=83 dst=r0 src=r0 offset=0 imm=21
 #line 46 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 46 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 46 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 46 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_STXW pc=84 dst=r10 src=r0 offset=-88 imm=0
 #line 46 "sample/cgroup_sock_addr2.c"
     *(uint32_t*)(uintptr_t)(r10 + OFFSET(-88)) = (uint32_t)r0;
@@ -458,12 +422,6 @@ label_2:
     // EBPF_OP_CALL pc=88 dst=r0 src=r0 offset=0 imm=26
 #line 48 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 48 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 48 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 48 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_STXDW pc=89 dst=r10 src=r0 offset=-80 imm=0
 #line 48 "sample/cgroup_sock_addr2.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-80)) = (uint64_t)r0;
@@ -491,12 +449,6 @@ label_2:
     // EBPF_OP_CALL pc=98 dst=r0 src=r0 offset=0 imm=2
 #line 51 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 51 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 51 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 51 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=99 dst=r0 src=r8 offset=0 imm=0
 #line 51 "sample/cgroup_sock_addr2.c"
     r0 = r8;
@@ -711,12 +663,6 @@ label_1:
     // EBPF_OP_CALL pc=37 dst=r0 src=r0 offset=0 imm=1
 #line 109 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 109 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 109 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=38 dst=r7 src=r0 offset=0 imm=0
 #line 109 "sample/cgroup_sock_addr2.c"
     r7 = r0;
@@ -775,12 +721,6 @@ label_1:
     // EBPF_OP_CALL pc=58 dst=r0 src=r0 offset=0 imm=12
 #line 111 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 111 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 111 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=59 dst=r2 src=r10 offset=0 imm=0
 #line 111 "sample/cgroup_sock_addr2.c"
     r2 = r10;
@@ -796,12 +736,6 @@ label_1:
     // EBPF_OP_CALL pc=63 dst=r0 src=r0 offset=0 imm=65537
 #line 114 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 114 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 114 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=64 dst=r1 src=r0 offset=0 imm=0
 #line 114 "sample/cgroup_sock_addr2.c"
     r1 = r0;
@@ -870,12 +804,6 @@ label_2:
     // EBPF_OP_CALL pc=84 dst=r0 src=r0 offset=0 imm=19
 #line 44 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=85 dst=r7 src=r0 offset=0 imm=0
 #line 44 "sample/cgroup_sock_addr2.c"
     r7 = r0;
@@ -888,12 +816,6 @@ label_2:
     // EBPF_OP_CALL pc=88 dst=r0 src=r0 offset=0 imm=20
 #line 45 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_STXDW pc=89 dst=r10 src=r0 offset=-40 imm=0
 #line 45 "sample/cgroup_sock_addr2.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-40)) = (uint64_t)r0;
@@ -903,12 +825,6 @@ label_2:
     // EBPF_OP_CALL pc=91 dst=r0 src=r0 offset=0 imm=21
 #line 46 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 46 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 46 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 46 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_STXW pc=92 dst=r10 src=r0 offset=-24 imm=0
 #line 46 "sample/cgroup_sock_addr2.c"
     *(uint32_t*)(uintptr_t)(r10 + OFFSET(-24)) = (uint32_t)r0;
@@ -924,12 +840,6 @@ label_2:
     // EBPF_OP_CALL pc=96 dst=r0 src=r0 offset=0 imm=26
 #line 48 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 48 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 48 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 48 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_STXDW pc=97 dst=r10 src=r0 offset=-16 imm=0
 #line 48 "sample/cgroup_sock_addr2.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-16)) = (uint64_t)r0;
@@ -957,12 +867,6 @@ label_2:
     // EBPF_OP_CALL pc=106 dst=r0 src=r0 offset=0 imm=2
 #line 51 "sample/cgroup_sock_addr2.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 51 "sample/cgroup_sock_addr2.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 51 "sample/cgroup_sock_addr2.c"
-        return 0;
-#line 51 "sample/cgroup_sock_addr2.c"
-    }
     // EBPF_OP_MOV64_REG pc=107 dst=r0 src=r8 offset=0 imm=0
 #line 51 "sample/cgroup_sock_addr2.c"
     r0 = r8;
@@ -221,12 +221,6 @@ authorize_connect4(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=15 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -254,12 +248,6 @@ authorize_connect4(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=25 dst=r1 src=r1 offset=0 imm=1
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[0].address);
@@ -269,12 +257,6 @@ authorize_connect4(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=28 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 60 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 60 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=29 dst=r1 src=r0 offset=0 imm=0
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -421,12 +403,6 @@ authorize_connect6(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=21 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -454,12 +430,6 @@ authorize_connect6(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=30 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=31 dst=r1 src=r1 offset=0 imm=1
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[0].address);
@@ -469,12 +439,6 @@ authorize_connect6(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=34 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 76 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 76 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=35 dst=r1 src=r0 offset=0 imm=0
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -603,12 +567,6 @@ authorize_recv_accept4(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=15 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -636,12 +594,6 @@ authorize_recv_accept4(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=25 dst=r1 src=r1 offset=0 imm=2
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[1].address);
@@ -651,12 +603,6 @@ authorize_recv_accept4(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=28 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 60 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 60 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=29 dst=r1 src=r0 offset=0 imm=0
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -803,12 +749,6 @@ authorize_recv_accept6(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=21 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -836,12 +776,6 @@ authorize_recv_accept6(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=30 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=31 dst=r1 src=r1 offset=0 imm=2
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[1].address);
@@ -851,12 +785,6 @@ authorize_recv_accept6(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=34 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 76 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 76 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=35 dst=r1 src=r0 offset=0 imm=0
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -346,12 +346,6 @@ authorize_connect4(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=15 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -379,12 +373,6 @@ authorize_connect4(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=25 dst=r1 src=r1 offset=0 imm=1
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[0].address);
@@ -394,12 +382,6 @@ authorize_connect4(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=28 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 60 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 60 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=29 dst=r1 src=r0 offset=0 imm=0
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -546,12 +528,6 @@ authorize_connect6(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=21 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -579,12 +555,6 @@ authorize_connect6(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=30 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=31 dst=r1 src=r1 offset=0 imm=1
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[0].address);
@@ -594,12 +564,6 @@ authorize_connect6(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=34 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 76 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 76 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=35 dst=r1 src=r0 offset=0 imm=0
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -728,12 +692,6 @@ authorize_recv_accept4(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=15 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -761,12 +719,6 @@ authorize_recv_accept4(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=25 dst=r1 src=r1 offset=0 imm=2
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[1].address);
@@ -776,12 +728,6 @@ authorize_recv_accept4(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=28 dst=r0 src=r0 offset=0 imm=1
 #line 60 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 60 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 60 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=29 dst=r1 src=r0 offset=0 imm=0
 #line 60 "sample/cgroup_sock_addr.c"
     r1 = r0;
@@ -928,12 +874,6 @@ authorize_recv_accept6(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=26
 #line 44 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 44 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 44 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 44 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_STXDW pc=21 dst=r10 src=r0 offset=-8 imm=0
 #line 44 "sample/cgroup_sock_addr.c"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-8)) = (uint64_t)r0;
@@ -961,12 +901,6 @@ authorize_recv_accept6(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=30 dst=r0 src=r0 offset=0 imm=2
 #line 45 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 45 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 45 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_LDDW pc=31 dst=r1 src=r1 offset=0 imm=2
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = POINTER(runtime_context->map_data[1].address);
@@ -976,12 +910,6 @@ authorize_recv_accept6(void* context, const program_runtime_context_t* runtime_c
     // EBPF_OP_CALL pc=34 dst=r0 src=r0 offset=0 imm=1
 #line 76 "sample/cgroup_sock_addr.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 76 "sample/cgroup_sock_addr.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 76 "sample/cgroup_sock_addr.c"
-        return 0;
-#line 76 "sample/cgroup_sock_addr.c"
-    }
     // EBPF_OP_MOV64_REG pc=35 dst=r1 src=r0 offset=0 imm=0
 #line 76 "sample/cgroup_sock_addr.c"
     r1 = r0;
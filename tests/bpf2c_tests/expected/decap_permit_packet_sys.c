@@ -428,12 +428,6 @@ decapsulate_permit_packet(void* context, const program_runtime_context_t* runtim
     // EBPF_OP_CALL pc=56 dst=r0 src=r0 offset=0 imm=65536
 #line 41 "sample/decap_permit_packet.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 41 "sample/decap_permit_packet.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 41 "sample/decap_permit_packet.c"
-        return 0;
-#line 41 "sample/decap_permit_packet.c"
-    }
     // EBPF_OP_MOV64_REG pc=57 dst=r1 src=r0 offset=0 imm=0
 #line 41 "sample/decap_permit_packet.c"
     r1 = r0;
@@ -586,12 +580,6 @@ label_1:
     // EBPF_OP_CALL pc=101 dst=r0 src=r0 offset=0 imm=65536
 #line 70 "sample/decap_permit_packet.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 70 "sample/decap_permit_packet.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 70 "sample/decap_permit_packet.c"
-        return 0;
-#line 70 "sample/decap_permit_packet.c"
-    }
     // EBPF_OP_MOV64_REG pc=102 dst=r1 src=r0 offset=0 imm=0
 #line 70 "sample/decap_permit_packet.c"
     r1 = r0;
@@ -104,10 +104,6 @@ DropPacket(void* context, const program_runtime_context_t* runtime_context)
     register uint64_t r2 = 0;
 #line 44 "sample/droppacket.c"
     register uint64_t r3 = 0;
-#line 44 "sample/droppacket.c"
-    register uint64_t r4 = 0;
-#line 44 "sample/droppacket.c"
-    register uint64_t r5 = 0;
 #line 44 "sample/droppacket.c"
     register uint64_t r6 = 0;
 #line 44 "sample/droppacket.c"
@@ -138,11 +134,15 @@ DropPacket(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[0].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 57 "sample/droppacket.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
+#line 57 "sample/droppacket.c"
+    if (r0 < 1) {
 #line 57 "sample/droppacket.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+        r0 = POINTER(runtime_context->map_value_data[0].address + r0 * 4);
 #line 57 "sample/droppacket.c"
-        return 0;
+    } else {
+#line 57 "sample/droppacket.c"
+        r0 = 0;
 #line 57 "sample/droppacket.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r1 src=r0 offset=0 imm=0
@@ -268,11 +268,15 @@ label_1:
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=39 dst=r0 src=r0 offset=0 imm=1
 #line 81 "sample/droppacket.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
+#line 81 "sample/droppacket.c"
+    if (r0 < 1) {
+#line 81 "sample/droppacket.c"
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 8);
 #line 81 "sample/droppacket.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    } else {
 #line 81 "sample/droppacket.c"
-        return 0;
+        r0 = 0;
 #line 81 "sample/droppacket.c"
     }
     // EBPF_OP_MOV64_REG pc=40 dst=r1 src=r0 offset=0 imm=0
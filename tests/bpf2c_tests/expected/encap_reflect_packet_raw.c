@@ -187,12 +187,6 @@ encap_reflect_packet(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=26 dst=r0 src=r0 offset=0 imm=65536
 #line 22 "sample/encap_reflect_packet.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 22 "sample/encap_reflect_packet.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 22 "sample/encap_reflect_packet.c"
-        return 0;
-#line 22 "sample/encap_reflect_packet.c"
-    }
     // EBPF_OP_MOV64_REG pc=27 dst=r2 src=r6 offset=0 imm=0
 #line 22 "sample/encap_reflect_packet.c"
     r2 = r6;
@@ -496,12 +490,6 @@ label_1:
     // EBPF_OP_CALL pc=116 dst=r0 src=r0 offset=0 imm=10
 #line 82 "sample/encap_reflect_packet.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/encap_reflect_packet.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 82 "sample/encap_reflect_packet.c"
-        return 0;
-#line 82 "sample/encap_reflect_packet.c"
-    }
     // EBPF_OP_MOV64_REG pc=117 dst=r1 src=r0 offset=0 imm=0
 #line 50 "sample/./xdp_common.h"
     r1 = r0;
@@ -591,12 +579,6 @@ label_2:
     // EBPF_OP_CALL pc=141 dst=r0 src=r0 offset=0 imm=65536
 #line 96 "sample/encap_reflect_packet.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/encap_reflect_packet.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 96 "sample/encap_reflect_packet.c"
-        return 0;
-#line 96 "sample/encap_reflect_packet.c"
-    }
     // EBPF_OP_MOV64_REG pc=142 dst=r1 src=r0 offset=0 imm=0
 #line 96 "sample/encap_reflect_packet.c"
     r1 = r0;
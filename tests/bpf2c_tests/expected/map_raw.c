@@ -320,12 +320,6 @@ test_maps(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=11 dst=r0 src=r0 offset=0 imm=2
 #line 74 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/undocked/map.c"
-        return 0;
-#line 74 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=12 dst=r6 src=r0 offset=0 imm=0
 #line 74 "sample/undocked/map.c"
     r6 = r0;
@@ -377,12 +371,6 @@ label_2:
     // EBPF_OP_CALL pc=30 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 80 "sample/undocked/map.c"
-        return 0;
-#line 80 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=31 dst=r0 src=r0 offset=21 imm=0
 #line 81 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -433,12 +421,6 @@ label_3:
     // EBPF_OP_CALL pc=49 dst=r0 src=r0 offset=0 imm=12
 #line 82 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 82 "sample/undocked/map.c"
-        return 0;
-#line 82 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=50 dst=r6 src=r0 offset=0 imm=-1
 #line 82 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -458,12 +440,6 @@ label_4:
     // EBPF_OP_CALL pc=57 dst=r0 src=r0 offset=0 imm=3
 #line 86 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 86 "sample/undocked/map.c"
-        return 0;
-#line 86 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=58 dst=r6 src=r0 offset=0 imm=0
 #line 86 "sample/undocked/map.c"
     r6 = r0;
@@ -520,12 +496,6 @@ label_5:
     // EBPF_OP_CALL pc=78 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 88 "sample/undocked/map.c"
-        return 0;
-#line 88 "sample/undocked/map.c"
-    }
 label_6:
     // EBPF_OP_MOV64_IMM pc=79 dst=r1 src=r0 offset=0 imm=100
 #line 88 "sample/undocked/map.c"
@@ -585,12 +555,6 @@ label_7:
     // EBPF_OP_CALL pc=101 dst=r0 src=r0 offset=0 imm=13
 #line 202 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 202 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 202 "sample/undocked/map.c"
-        return 0;
-#line 202 "sample/undocked/map.c"
-    }
 label_8:
     // EBPF_OP_MOV64_REG pc=102 dst=r0 src=r6 offset=0 imm=0
 #line 215 "sample/undocked/map.c"
@@ -620,12 +584,6 @@ label_9:
     // EBPF_OP_CALL pc=111 dst=r0 src=r0 offset=0 imm=2
 #line 92 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/undocked/map.c"
-        return 0;
-#line 92 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=112 dst=r6 src=r0 offset=0 imm=0
 #line 92 "sample/undocked/map.c"
     r6 = r0;
@@ -661,12 +619,6 @@ label_10:
     // EBPF_OP_CALL pc=122 dst=r0 src=r0 offset=0 imm=4
 #line 103 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 103 "sample/undocked/map.c"
-        return 0;
-#line 103 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=123 dst=r0 src=r0 offset=23 imm=0
 #line 104 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -762,12 +714,6 @@ label_11:
     // EBPF_OP_CALL pc=158 dst=r0 src=r0 offset=0 imm=2
 #line 74 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/undocked/map.c"
-        return 0;
-#line 74 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=159 dst=r6 src=r0 offset=0 imm=0
 #line 74 "sample/undocked/map.c"
     r6 = r0;
@@ -819,12 +765,6 @@ label_13:
     // EBPF_OP_CALL pc=177 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 80 "sample/undocked/map.c"
-        return 0;
-#line 80 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=178 dst=r0 src=r0 offset=21 imm=0
 #line 81 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -875,12 +815,6 @@ label_14:
     // EBPF_OP_CALL pc=196 dst=r0 src=r0 offset=0 imm=12
 #line 82 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 82 "sample/undocked/map.c"
-        return 0;
-#line 82 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=197 dst=r6 src=r0 offset=0 imm=-1
 #line 82 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -900,12 +834,6 @@ label_15:
     // EBPF_OP_CALL pc=204 dst=r0 src=r0 offset=0 imm=3
 #line 86 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 86 "sample/undocked/map.c"
-        return 0;
-#line 86 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=205 dst=r6 src=r0 offset=0 imm=0
 #line 86 "sample/undocked/map.c"
     r6 = r0;
@@ -962,12 +890,6 @@ label_16:
     // EBPF_OP_CALL pc=225 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 88 "sample/undocked/map.c"
-        return 0;
-#line 88 "sample/undocked/map.c"
-    }
 label_17:
     // EBPF_OP_MOV64_IMM pc=226 dst=r1 src=r0 offset=0 imm=0
 #line 88 "sample/undocked/map.c"
@@ -1054,12 +976,6 @@ label_18:
     // EBPF_OP_CALL pc=259 dst=r0 src=r0 offset=0 imm=2
 #line 92 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/undocked/map.c"
-        return 0;
-#line 92 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=260 dst=r6 src=r0 offset=0 imm=0
 #line 92 "sample/undocked/map.c"
     r6 = r0;
@@ -1095,12 +1011,6 @@ label_19:
     // EBPF_OP_CALL pc=270 dst=r0 src=r0 offset=0 imm=4
 #line 103 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 103 "sample/undocked/map.c"
-        return 0;
-#line 103 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=271 dst=r0 src=r0 offset=23 imm=0
 #line 104 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -1196,12 +1106,6 @@ label_20:
     // EBPF_OP_CALL pc=306 dst=r0 src=r0 offset=0 imm=2
 #line 74 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/undocked/map.c"
-        return 0;
-#line 74 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=307 dst=r6 src=r0 offset=0 imm=0
 #line 74 "sample/undocked/map.c"
     r6 = r0;
@@ -1252,11 +1156,15 @@ label_22:
     r1 = POINTER(runtime_context->map_data[2].address);
     // EBPF_OP_CALL pc=325 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/undocked/map.c"
-    r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
+#line 80 "sample/undocked/map.c"
+    if (r0 < 10) {
+#line 80 "sample/undocked/map.c"
+        r0 = POINTER(runtime_context->map_value_data[2].address + r0 * 4);
 #line 80 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    } else {
 #line 80 "sample/undocked/map.c"
-        return 0;
+        r0 = 0;
 #line 80 "sample/undocked/map.c"
     }
     // EBPF_OP_JNE_IMM pc=326 dst=r0 src=r0 offset=21 imm=0
@@ -1308,12 +1216,6 @@ label_22:
     // EBPF_OP_CALL pc=344 dst=r0 src=r0 offset=0 imm=12
 #line 82 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 82 "sample/undocked/map.c"
-        return 0;
-#line 82 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=345 dst=r6 src=r0 offset=0 imm=-1
 #line 82 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -1333,12 +1235,6 @@ label_23:
     // EBPF_OP_CALL pc=352 dst=r0 src=r0 offset=0 imm=3
 #line 86 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 86 "sample/undocked/map.c"
-        return 0;
-#line 86 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=353 dst=r6 src=r0 offset=0 imm=0
 #line 86 "sample/undocked/map.c"
     r6 = r0;
@@ -1395,12 +1291,6 @@ label_24:
     // EBPF_OP_CALL pc=373 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 88 "sample/undocked/map.c"
-        return 0;
-#line 88 "sample/undocked/map.c"
-    }
 label_25:
     // EBPF_OP_MOV64_IMM pc=374 dst=r1 src=r0 offset=0 imm=0
 #line 88 "sample/undocked/map.c"
@@ -1490,12 +1380,6 @@ label_26:
     // EBPF_OP_CALL pc=407 dst=r0 src=r0 offset=0 imm=2
 #line 92 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/undocked/map.c"
-        return 0;
-#line 92 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=408 dst=r6 src=r0 offset=0 imm=0
 #line 92 "sample/undocked/map.c"
     r6 = r0;
@@ -1549,12 +1433,6 @@ label_27:
     // EBPF_OP_CALL pc=424 dst=r0 src=r0 offset=0 imm=2
 #line 74 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/undocked/map.c"
-        return 0;
-#line 74 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=425 dst=r6 src=r0 offset=0 imm=0
 #line 74 "sample/undocked/map.c"
     r6 = r0;
@@ -1586,12 +1464,6 @@ label_27:
     // EBPF_OP_CALL pc=434 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 80 "sample/undocked/map.c"
-        return 0;
-#line 80 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=435 dst=r0 src=r0 offset=21 imm=0
 #line 81 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -1641,12 +1513,6 @@ label_27:
     // EBPF_OP_CALL pc=453 dst=r0 src=r0 offset=0 imm=12
 #line 82 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 82 "sample/undocked/map.c"
-        return 0;
-#line 82 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=454 dst=r6 src=r0 offset=0 imm=-1
 #line 82 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -1666,12 +1532,6 @@ label_28:
     // EBPF_OP_CALL pc=461 dst=r0 src=r0 offset=0 imm=3
 #line 86 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 86 "sample/undocked/map.c"
-        return 0;
-#line 86 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=462 dst=r6 src=r0 offset=0 imm=0
 #line 86 "sample/undocked/map.c"
     r6 = r0;
@@ -1731,12 +1591,6 @@ label_29:
     // EBPF_OP_CALL pc=483 dst=r0 src=r0 offset=0 imm=2
 #line 92 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/undocked/map.c"
-        return 0;
-#line 92 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=484 dst=r6 src=r0 offset=0 imm=0
 #line 92 "sample/undocked/map.c"
     r6 = r0;
@@ -1794,12 +1648,6 @@ label_31:
     // EBPF_OP_CALL pc=504 dst=r0 src=r0 offset=0 imm=13
 #line 93 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 93 "sample/undocked/map.c"
-        return 0;
-#line 93 "sample/undocked/map.c"
-    }
 label_32:
     // EBPF_OP_MOV64_IMM pc=505 dst=r1 src=r0 offset=0 imm=100
 #line 93 "sample/undocked/map.c"
@@ -1895,12 +1743,6 @@ label_33:
     // EBPF_OP_CALL pc=541 dst=r0 src=r0 offset=0 imm=2
 #line 74 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/undocked/map.c"
-        return 0;
-#line 74 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=542 dst=r6 src=r0 offset=0 imm=0
 #line 74 "sample/undocked/map.c"
     r6 = r0;
@@ -1952,12 +1794,6 @@ label_35:
     // EBPF_OP_CALL pc=560 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 80 "sample/undocked/map.c"
-        return 0;
-#line 80 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=561 dst=r0 src=r0 offset=21 imm=0
 #line 81 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -2008,12 +1844,6 @@ label_36:
     // EBPF_OP_CALL pc=579 dst=r0 src=r0 offset=0 imm=12
 #line 82 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 82 "sample/undocked/map.c"
-        return 0;
-#line 82 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=580 dst=r6 src=r0 offset=0 imm=-1
 #line 82 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -2033,12 +1863,6 @@ label_37:
     // EBPF_OP_CALL pc=587 dst=r0 src=r0 offset=0 imm=3
 #line 86 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 86 "sample/undocked/map.c"
-        return 0;
-#line 86 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=588 dst=r6 src=r0 offset=0 imm=0
 #line 86 "sample/undocked/map.c"
     r6 = r0;
@@ -2095,12 +1919,6 @@ label_38:
     // EBPF_OP_CALL pc=608 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 88 "sample/undocked/map.c"
-        return 0;
-#line 88 "sample/undocked/map.c"
-    }
 label_39:
     // EBPF_OP_MOV64_IMM pc=609 dst=r1 src=r0 offset=0 imm=100
 #line 88 "sample/undocked/map.c"
@@ -2181,12 +1999,6 @@ label_40:
     // EBPF_OP_CALL pc=640 dst=r0 src=r0 offset=0 imm=2
 #line 92 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/undocked/map.c"
-        return 0;
-#line 92 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=641 dst=r6 src=r0 offset=0 imm=0
 #line 92 "sample/undocked/map.c"
     r6 = r0;
@@ -2222,12 +2034,6 @@ label_41:
     // EBPF_OP_CALL pc=651 dst=r0 src=r0 offset=0 imm=4
 #line 103 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 103 "sample/undocked/map.c"
-        return 0;
-#line 103 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=652 dst=r0 src=r0 offset=23 imm=0
 #line 104 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -2323,12 +2129,6 @@ label_42:
     // EBPF_OP_CALL pc=687 dst=r0 src=r0 offset=0 imm=2
 #line 74 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 74 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 74 "sample/undocked/map.c"
-        return 0;
-#line 74 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=688 dst=r6 src=r0 offset=0 imm=0
 #line 74 "sample/undocked/map.c"
     r6 = r0;
@@ -2380,12 +2180,6 @@ label_44:
     // EBPF_OP_CALL pc=706 dst=r0 src=r0 offset=0 imm=1
 #line 80 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 80 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 80 "sample/undocked/map.c"
-        return 0;
-#line 80 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=707 dst=r0 src=r0 offset=21 imm=0
 #line 81 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -2436,12 +2230,6 @@ label_45:
     // EBPF_OP_CALL pc=725 dst=r0 src=r0 offset=0 imm=12
 #line 82 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 82 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 82 "sample/undocked/map.c"
-        return 0;
-#line 82 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=726 dst=r6 src=r0 offset=0 imm=-1
 #line 82 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -2461,12 +2249,6 @@ label_46:
     // EBPF_OP_CALL pc=733 dst=r0 src=r0 offset=0 imm=3
 #line 86 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 86 "sample/undocked/map.c"
-        return 0;
-#line 86 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=734 dst=r6 src=r0 offset=0 imm=0
 #line 86 "sample/undocked/map.c"
     r6 = r0;
@@ -2523,12 +2305,6 @@ label_47:
     // EBPF_OP_CALL pc=754 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 88 "sample/undocked/map.c"
-        return 0;
-#line 88 "sample/undocked/map.c"
-    }
 label_48:
     // EBPF_OP_MOV64_IMM pc=755 dst=r1 src=r0 offset=0 imm=0
 #line 88 "sample/undocked/map.c"
@@ -2615,12 +2391,6 @@ label_49:
     // EBPF_OP_CALL pc=789 dst=r0 src=r0 offset=0 imm=2
 #line 92 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/undocked/map.c"
-        return 0;
-#line 92 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=790 dst=r6 src=r0 offset=0 imm=0
 #line 92 "sample/undocked/map.c"
     r6 = r0;
@@ -2656,12 +2426,6 @@ label_50:
     // EBPF_OP_CALL pc=800 dst=r0 src=r0 offset=0 imm=4
 #line 103 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 103 "sample/undocked/map.c"
-        return 0;
-#line 103 "sample/undocked/map.c"
-    }
     // EBPF_OP_JNE_IMM pc=801 dst=r0 src=r0 offset=23 imm=0
 #line 104 "sample/undocked/map.c"
     if (r0 != IMMEDIATE(0)) {
@@ -2774,12 +2538,6 @@ label_52:
     // EBPF_OP_CALL pc=840 dst=r0 src=r0 offset=0 imm=2
 #line 123 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 123 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 123 "sample/undocked/map.c"
-        return 0;
-#line 123 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=841 dst=r6 src=r0 offset=0 imm=0
 #line 123 "sample/undocked/map.c"
     r6 = r0;
@@ -2869,12 +2627,6 @@ label_54:
     // EBPF_OP_CALL pc=866 dst=r0 src=r0 offset=0 imm=2
 #line 123 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 123 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 123 "sample/undocked/map.c"
-        return 0;
-#line 123 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=867 dst=r6 src=r0 offset=0 imm=0
 #line 123 "sample/undocked/map.c"
     r6 = r0;
@@ -2935,12 +2687,6 @@ label_55:
     // EBPF_OP_CALL pc=884 dst=r0 src=r0 offset=0 imm=18
 #line 173 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 173 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 173 "sample/undocked/map.c"
-        return 0;
-#line 173 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=885 dst=r6 src=r0 offset=0 imm=0
 #line 173 "sample/undocked/map.c"
     r6 = r0;
@@ -3034,12 +2780,6 @@ label_59:
     // EBPF_OP_CALL pc=917 dst=r0 src=r0 offset=0 imm=14
 #line 173 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 173 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 173 "sample/undocked/map.c"
-        return 0;
-#line 173 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=918 dst=r6 src=r0 offset=0 imm=-1
 #line 173 "sample/undocked/map.c"
     r6 = (uint64_t)4294967295;
@@ -3086,12 +2826,6 @@ label_60:
     // EBPF_OP_CALL pc=937 dst=r0 src=r0 offset=0 imm=13
 #line 125 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 125 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 125 "sample/undocked/map.c"
-        return 0;
-#line 125 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_IMM pc=938 dst=r1 src=r0 offset=0 imm=100
 #line 125 "sample/undocked/map.c"
     r1 = IMMEDIATE(100);
@@ -3180,12 +2914,6 @@ label_61:
     // EBPF_OP_CALL pc=974 dst=r0 src=r0 offset=0 imm=13
 #line 125 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 125 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 125 "sample/undocked/map.c"
-        return 0;
-#line 125 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_IMM pc=975 dst=r1 src=r0 offset=0 imm=0
 #line 125 "sample/undocked/map.c"
     r1 = IMMEDIATE(0);
@@ -3263,12 +2991,6 @@ label_63:
     // EBPF_OP_CALL pc=1005 dst=r0 src=r0 offset=0 imm=17
 #line 174 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[8].address(r1, r2, r3, r4, r5, context);
-#line 174 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[8].tail_call) && (r0 == 0)) {
-#line 174 "sample/undocked/map.c"
-        return 0;
-#line 174 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1006 dst=r6 src=r0 offset=0 imm=0
 #line 174 "sample/undocked/map.c"
     r6 = r0;
@@ -3354,12 +3076,6 @@ label_66:
     // EBPF_OP_CALL pc=1038 dst=r0 src=r0 offset=0 imm=14
 #line 174 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 174 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 174 "sample/undocked/map.c"
-        return 0;
-#line 174 "sample/undocked/map.c"
-    }
 label_67:
     // EBPF_OP_MOV64_REG pc=1039 dst=r3 src=r6 offset=0 imm=0
 #line 212 "sample/undocked/map.c"
@@ -3399,12 +3115,6 @@ label_68:
     // EBPF_OP_CALL pc=1050 dst=r0 src=r0 offset=0 imm=18
 #line 173 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 173 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 173 "sample/undocked/map.c"
-        return 0;
-#line 173 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1051 dst=r7 src=r0 offset=0 imm=0
 #line 173 "sample/undocked/map.c"
     r7 = r0;
@@ -3492,12 +3202,6 @@ label_70:
     // EBPF_OP_CALL pc=1084 dst=r0 src=r0 offset=0 imm=14
 #line 173 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 173 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 173 "sample/undocked/map.c"
-        return 0;
-#line 173 "sample/undocked/map.c"
-    }
     // EBPF_OP_JA pc=1085 dst=r0 src=r0 offset=420 imm=0
 #line 173 "sample/undocked/map.c"
     goto label_98;
@@ -3646,12 +3350,6 @@ label_75:
     // EBPF_OP_CALL pc=1140 dst=r0 src=r0 offset=0 imm=16
 #line 179 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[9].address(r1, r2, r3, r4, r5, context);
-#line 179 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[9].tail_call) && (r0 == 0)) {
-#line 179 "sample/undocked/map.c"
-        return 0;
-#line 179 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1141 dst=r6 src=r0 offset=0 imm=0
 #line 179 "sample/undocked/map.c"
     r6 = r0;
@@ -3724,12 +3422,6 @@ label_76:
     // EBPF_OP_CALL pc=1162 dst=r0 src=r0 offset=0 imm=16
 #line 182 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[9].address(r1, r2, r3, r4, r5, context);
-#line 182 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[9].tail_call) && (r0 == 0)) {
-#line 182 "sample/undocked/map.c"
-        return 0;
-#line 182 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1163 dst=r6 src=r0 offset=0 imm=0
 #line 182 "sample/undocked/map.c"
     r6 = r0;
@@ -3846,12 +3538,6 @@ label_77:
     // EBPF_OP_CALL pc=1207 dst=r0 src=r0 offset=0 imm=16
 #line 183 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[9].address(r1, r2, r3, r4, r5, context);
-#line 183 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[9].tail_call) && (r0 == 0)) {
-#line 183 "sample/undocked/map.c"
-        return 0;
-#line 183 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1208 dst=r6 src=r0 offset=0 imm=0
 #line 183 "sample/undocked/map.c"
     r6 = r0;
@@ -4012,12 +3698,6 @@ label_80:
     // EBPF_OP_CALL pc=1270 dst=r0 src=r0 offset=0 imm=15
 #line 179 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[10].address(r1, r2, r3, r4, r5, context);
-#line 179 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[10].tail_call) && (r0 == 0)) {
-#line 179 "sample/undocked/map.c"
-        return 0;
-#line 179 "sample/undocked/map.c"
-    }
     // EBPF_OP_JA pc=1271 dst=r0 src=r0 offset=-233 imm=0
 #line 179 "sample/undocked/map.c"
     goto label_67;
@@ -4040,12 +3720,6 @@ label_81:
     // EBPF_OP_CALL pc=1278 dst=r0 src=r0 offset=0 imm=18
 #line 185 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 185 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 185 "sample/undocked/map.c"
-        return 0;
-#line 185 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1279 dst=r6 src=r0 offset=0 imm=0
 #line 185 "sample/undocked/map.c"
     r6 = r0;
@@ -4262,12 +3936,6 @@ label_86:
     // EBPF_OP_CALL pc=1355 dst=r0 src=r0 offset=0 imm=18
 #line 193 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 193 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 193 "sample/undocked/map.c"
-        return 0;
-#line 193 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1356 dst=r6 src=r0 offset=0 imm=0
 #line 193 "sample/undocked/map.c"
     r6 = r0;
@@ -4367,12 +4035,6 @@ label_88:
     // EBPF_OP_CALL pc=1394 dst=r0 src=r0 offset=0 imm=17
 #line 190 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[8].address(r1, r2, r3, r4, r5, context);
-#line 190 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[8].tail_call) && (r0 == 0)) {
-#line 190 "sample/undocked/map.c"
-        return 0;
-#line 190 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1395 dst=r6 src=r0 offset=0 imm=0
 #line 190 "sample/undocked/map.c"
     r6 = r0;
@@ -4569,12 +4231,6 @@ label_92:
     // EBPF_OP_CALL pc=1467 dst=r0 src=r0 offset=0 imm=17
 #line 194 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[8].address(r1, r2, r3, r4, r5, context);
-#line 194 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[8].tail_call) && (r0 == 0)) {
-#line 194 "sample/undocked/map.c"
-        return 0;
-#line 194 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1468 dst=r6 src=r0 offset=0 imm=0
 #line 194 "sample/undocked/map.c"
     r6 = r0;
@@ -4682,12 +4338,6 @@ label_97:
     // EBPF_OP_CALL pc=1503 dst=r0 src=r0 offset=0 imm=14
 #line 173 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 173 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 173 "sample/undocked/map.c"
-        return 0;
-#line 173 "sample/undocked/map.c"
-    }
     // EBPF_OP_LDDW pc=1504 dst=r7 src=r0 offset=0 imm=-1
 #line 173 "sample/undocked/map.c"
     r7 = (uint64_t)4294967295;
@@ -4753,12 +4403,6 @@ label_98:
     // EBPF_OP_CALL pc=1529 dst=r0 src=r0 offset=0 imm=13
 #line 213 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 213 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 213 "sample/undocked/map.c"
-        return 0;
-#line 213 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1530 dst=r6 src=r7 offset=0 imm=0
 #line 213 "sample/undocked/map.c"
     r6 = r7;
@@ -4784,12 +4428,6 @@ label_99:
     // EBPF_OP_CALL pc=1538 dst=r0 src=r0 offset=0 imm=17
 #line 174 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[8].address(r1, r2, r3, r4, r5, context);
-#line 174 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[8].tail_call) && (r0 == 0)) {
-#line 174 "sample/undocked/map.c"
-        return 0;
-#line 174 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1539 dst=r7 src=r0 offset=0 imm=0
 #line 174 "sample/undocked/map.c"
     r7 = r0;
@@ -4972,12 +4610,6 @@ label_104:
     // EBPF_OP_CALL pc=1606 dst=r0 src=r0 offset=0 imm=16
 #line 179 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[9].address(r1, r2, r3, r4, r5, context);
-#line 179 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[9].tail_call) && (r0 == 0)) {
-#line 179 "sample/undocked/map.c"
-        return 0;
-#line 179 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1607 dst=r7 src=r0 offset=0 imm=0
 #line 179 "sample/undocked/map.c"
     r7 = r0;
@@ -5050,12 +4682,6 @@ label_105:
     // EBPF_OP_CALL pc=1628 dst=r0 src=r0 offset=0 imm=16
 #line 182 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[9].address(r1, r2, r3, r4, r5, context);
-#line 182 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[9].tail_call) && (r0 == 0)) {
-#line 182 "sample/undocked/map.c"
-        return 0;
-#line 182 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1629 dst=r7 src=r0 offset=0 imm=0
 #line 182 "sample/undocked/map.c"
     r7 = r0;
@@ -5172,12 +4798,6 @@ label_106:
     // EBPF_OP_CALL pc=1673 dst=r0 src=r0 offset=0 imm=16
 #line 183 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[9].address(r1, r2, r3, r4, r5, context);
-#line 183 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[9].tail_call) && (r0 == 0)) {
-#line 183 "sample/undocked/map.c"
-        return 0;
-#line 183 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1674 dst=r7 src=r0 offset=0 imm=0
 #line 183 "sample/undocked/map.c"
     r7 = r0;
@@ -5338,12 +4958,6 @@ label_109:
     // EBPF_OP_CALL pc=1736 dst=r0 src=r0 offset=0 imm=15
 #line 179 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[10].address(r1, r2, r3, r4, r5, context);
-#line 179 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[10].tail_call) && (r0 == 0)) {
-#line 179 "sample/undocked/map.c"
-        return 0;
-#line 179 "sample/undocked/map.c"
-    }
     // EBPF_OP_JA pc=1737 dst=r0 src=r0 offset=-232 imm=0
 #line 179 "sample/undocked/map.c"
     goto label_98;
@@ -5366,12 +4980,6 @@ label_110:
     // EBPF_OP_CALL pc=1744 dst=r0 src=r0 offset=0 imm=18
 #line 185 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 185 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 185 "sample/undocked/map.c"
-        return 0;
-#line 185 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1745 dst=r7 src=r0 offset=0 imm=0
 #line 185 "sample/undocked/map.c"
     r7 = r0;
@@ -5455,12 +5063,6 @@ label_111:
     // EBPF_OP_CALL pc=1776 dst=r0 src=r0 offset=0 imm=14
 #line 185 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 185 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 185 "sample/undocked/map.c"
-        return 0;
-#line 185 "sample/undocked/map.c"
-    }
     // EBPF_OP_JA pc=1777 dst=r0 src=r0 offset=-272 imm=0
 #line 185 "sample/undocked/map.c"
     goto label_98;
@@ -5597,12 +5199,6 @@ label_115:
     // EBPF_OP_CALL pc=1822 dst=r0 src=r0 offset=0 imm=18
 #line 193 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 193 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 193 "sample/undocked/map.c"
-        return 0;
-#line 193 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1823 dst=r7 src=r0 offset=0 imm=0
 #line 193 "sample/undocked/map.c"
     r7 = r0;
@@ -5647,12 +5243,6 @@ label_116:
     // EBPF_OP_CALL pc=1837 dst=r0 src=r0 offset=0 imm=17
 #line 190 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[8].address(r1, r2, r3, r4, r5, context);
-#line 190 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[8].tail_call) && (r0 == 0)) {
-#line 190 "sample/undocked/map.c"
-        return 0;
-#line 190 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1838 dst=r7 src=r0 offset=0 imm=0
 #line 190 "sample/undocked/map.c"
     r7 = r0;
@@ -5852,12 +5442,6 @@ label_120:
     // EBPF_OP_CALL pc=1910 dst=r0 src=r0 offset=0 imm=17
 #line 194 "sample/undocked/map.c"
     r0 = runtime_context->helper_data[8].address(r1, r2, r3, r4, r5, context);
-#line 194 "sample/undocked/map.c"
-    if ((runtime_context->helper_data[8].tail_call) && (r0 == 0)) {
-#line 194 "sample/undocked/map.c"
-        return 0;
-#line 194 "sample/undocked/map.c"
-    }
     // EBPF_OP_MOV64_REG pc=1911 dst=r7 src=r0 offset=0 imm=0
 #line 194 "sample/undocked/map.c"
     r7 = r0;
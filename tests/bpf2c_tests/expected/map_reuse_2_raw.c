@@ -159,12 +159,6 @@ lookup_update(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=6 dst=r0 src=r0 offset=0 imm=1
 #line 55 "sample/undocked/map_reuse_2.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 55 "sample/undocked/map_reuse_2.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 55 "sample/undocked/map_reuse_2.c"
-        return 0;
-#line 55 "sample/undocked/map_reuse_2.c"
-    }
     // EBPF_OP_JEQ_IMM pc=7 dst=r0 src=r0 offset=20 imm=0
 #line 56 "sample/undocked/map_reuse_2.c"
     if (r0 == IMMEDIATE(0)) {
@@ -187,12 +181,6 @@ lookup_update(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=12 dst=r0 src=r0 offset=0 imm=1
 #line 58 "sample/undocked/map_reuse_2.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 58 "sample/undocked/map_reuse_2.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 58 "sample/undocked/map_reuse_2.c"
-        return 0;
-#line 58 "sample/undocked/map_reuse_2.c"
-    }
     // EBPF_OP_JNE_IMM pc=13 dst=r0 src=r0 offset=1 imm=0
 #line 59 "sample/undocked/map_reuse_2.c"
     if (r0 != IMMEDIATE(0)) {
@@ -237,12 +225,6 @@ label_1:
     // EBPF_OP_CALL pc=26 dst=r0 src=r0 offset=0 imm=2
 #line 63 "sample/undocked/map_reuse_2.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/undocked/map_reuse_2.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 63 "sample/undocked/map_reuse_2.c"
-        return 0;
-#line 63 "sample/undocked/map_reuse_2.c"
-    }
     // EBPF_OP_LDXW pc=27 dst=r6 src=r6 offset=0 imm=0
 #line 65 "sample/undocked/map_reuse_2.c"
     r6 = *(uint32_t*)(uintptr_t)(r6 + OFFSET(0));
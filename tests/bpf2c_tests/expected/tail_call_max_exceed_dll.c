@@ -204,12 +204,6 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 85 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 85 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 85 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -223,7 +217,7 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 85 "sample/tail_call_max_exceed.c"
         return 0;
 #line 85 "sample/tail_call_max_exceed.c"
@@ -277,12 +271,6 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 85 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 85 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 85 "sample/tail_call_max_exceed.c"
@@ -417,12 +405,6 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 86 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 86 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 86 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -436,7 +418,7 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 86 "sample/tail_call_max_exceed.c"
         return 0;
 #line 86 "sample/tail_call_max_exceed.c"
@@ -490,12 +472,6 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 86 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 86 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 86 "sample/tail_call_max_exceed.c"
@@ -630,12 +606,6 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 95 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 95 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 95 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -649,7 +619,7 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 95 "sample/tail_call_max_exceed.c"
         return 0;
 #line 95 "sample/tail_call_max_exceed.c"
@@ -703,12 +673,6 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 95 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 95 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 95 "sample/tail_call_max_exceed.c"
@@ -843,12 +807,6 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 96 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 96 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 96 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -862,7 +820,7 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 96 "sample/tail_call_max_exceed.c"
         return 0;
 #line 96 "sample/tail_call_max_exceed.c"
@@ -916,12 +874,6 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 96 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 96 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 96 "sample/tail_call_max_exceed.c"
@@ -1056,12 +1008,6 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 97 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 97 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 97 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1075,7 +1021,7 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 97 "sample/tail_call_max_exceed.c"
         return 0;
 #line 97 "sample/tail_call_max_exceed.c"
@@ -1129,12 +1075,6 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 97 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 97 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 97 "sample/tail_call_max_exceed.c"
@@ -1269,12 +1209,6 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 98 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 98 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 98 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1288,7 +1222,7 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 98 "sample/tail_call_max_exceed.c"
         return 0;
 #line 98 "sample/tail_call_max_exceed.c"
@@ -1342,12 +1276,6 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 98 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 98 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 98 "sample/tail_call_max_exceed.c"
@@ -1482,12 +1410,6 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 99 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 99 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 99 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1501,7 +1423,7 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 99 "sample/tail_call_max_exceed.c"
         return 0;
 #line 99 "sample/tail_call_max_exceed.c"
@@ -1555,12 +1477,6 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 99 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 99 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 99 "sample/tail_call_max_exceed.c"
@@ -1695,12 +1611,6 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 100 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 100 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 100 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1714,7 +1624,7 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 100 "sample/tail_call_max_exceed.c"
         return 0;
 #line 100 "sample/tail_call_max_exceed.c"
@@ -1768,12 +1678,6 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 100 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 100 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 100 "sample/tail_call_max_exceed.c"
@@ -1908,12 +1812,6 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 101 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 101 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 101 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1927,7 +1825,7 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 101 "sample/tail_call_max_exceed.c"
         return 0;
 #line 101 "sample/tail_call_max_exceed.c"
@@ -1981,12 +1879,6 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 101 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 101 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 101 "sample/tail_call_max_exceed.c"
@@ -2121,12 +2013,6 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 102 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 102 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 102 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2140,7 +2026,7 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 102 "sample/tail_call_max_exceed.c"
         return 0;
 #line 102 "sample/tail_call_max_exceed.c"
@@ -2194,12 +2080,6 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 102 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 102 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 102 "sample/tail_call_max_exceed.c"
@@ -2334,12 +2214,6 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 103 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 103 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 103 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2353,7 +2227,7 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 103 "sample/tail_call_max_exceed.c"
         return 0;
 #line 103 "sample/tail_call_max_exceed.c"
@@ -2407,12 +2281,6 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 103 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 103 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 103 "sample/tail_call_max_exceed.c"
@@ -2547,12 +2415,6 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 104 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 104 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 104 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2566,7 +2428,7 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 104 "sample/tail_call_max_exceed.c"
         return 0;
 #line 104 "sample/tail_call_max_exceed.c"
@@ -2620,12 +2482,6 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 104 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 104 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 104 "sample/tail_call_max_exceed.c"
@@ -2760,12 +2616,6 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 87 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 87 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 87 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2779,7 +2629,7 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 87 "sample/tail_call_max_exceed.c"
         return 0;
 #line 87 "sample/tail_call_max_exceed.c"
@@ -2833,12 +2683,6 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 87 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 87 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 87 "sample/tail_call_max_exceed.c"
@@ -2973,12 +2817,6 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 105 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 105 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 105 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2992,7 +2830,7 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 105 "sample/tail_call_max_exceed.c"
         return 0;
 #line 105 "sample/tail_call_max_exceed.c"
@@ -3046,12 +2884,6 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 105 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 105 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 105 "sample/tail_call_max_exceed.c"
@@ -3186,12 +3018,6 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 106 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 106 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 106 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3205,7 +3031,7 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 106 "sample/tail_call_max_exceed.c"
         return 0;
 #line 106 "sample/tail_call_max_exceed.c"
@@ -3259,12 +3085,6 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 106 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 106 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 106 "sample/tail_call_max_exceed.c"
@@ -3399,12 +3219,6 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 107 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 107 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 107 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3418,7 +3232,7 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 107 "sample/tail_call_max_exceed.c"
         return 0;
 #line 107 "sample/tail_call_max_exceed.c"
@@ -3472,12 +3286,6 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 107 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 107 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 107 "sample/tail_call_max_exceed.c"
@@ -3612,12 +3420,6 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 108 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 108 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 108 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3631,7 +3433,7 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 108 "sample/tail_call_max_exceed.c"
         return 0;
 #line 108 "sample/tail_call_max_exceed.c"
@@ -3685,12 +3487,6 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 108 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 108 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 108 "sample/tail_call_max_exceed.c"
@@ -3825,12 +3621,6 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 109 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 109 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 109 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3844,7 +3634,7 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 109 "sample/tail_call_max_exceed.c"
         return 0;
 #line 109 "sample/tail_call_max_exceed.c"
@@ -3898,12 +3688,6 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 109 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 109 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 109 "sample/tail_call_max_exceed.c"
@@ -4038,12 +3822,6 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 110 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 110 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 110 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4057,7 +3835,7 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 110 "sample/tail_call_max_exceed.c"
         return 0;
 #line 110 "sample/tail_call_max_exceed.c"
@@ -4111,12 +3889,6 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 110 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 110 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 110 "sample/tail_call_max_exceed.c"
@@ -4251,12 +4023,6 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 111 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 111 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 111 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4270,7 +4036,7 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 111 "sample/tail_call_max_exceed.c"
         return 0;
 #line 111 "sample/tail_call_max_exceed.c"
@@ -4324,12 +4090,6 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 111 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 111 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 111 "sample/tail_call_max_exceed.c"
@@ -4464,12 +4224,6 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 112 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 112 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 112 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4483,7 +4237,7 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 112 "sample/tail_call_max_exceed.c"
         return 0;
 #line 112 "sample/tail_call_max_exceed.c"
@@ -4537,12 +4291,6 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 112 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 112 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 112 "sample/tail_call_max_exceed.c"
@@ -4677,12 +4425,6 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 113 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 113 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 113 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4696,7 +4438,7 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 113 "sample/tail_call_max_exceed.c"
         return 0;
 #line 113 "sample/tail_call_max_exceed.c"
@@ -4750,12 +4492,6 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 113 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 113 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 113 "sample/tail_call_max_exceed.c"
@@ -4890,12 +4626,6 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 114 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 114 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 114 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4909,7 +4639,7 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 114 "sample/tail_call_max_exceed.c"
         return 0;
 #line 114 "sample/tail_call_max_exceed.c"
@@ -4963,12 +4693,6 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 114 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 114 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 114 "sample/tail_call_max_exceed.c"
@@ -5103,12 +4827,6 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 88 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 88 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 88 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5122,7 +4840,7 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 88 "sample/tail_call_max_exceed.c"
         return 0;
 #line 88 "sample/tail_call_max_exceed.c"
@@ -5176,12 +4894,6 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 88 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 88 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 88 "sample/tail_call_max_exceed.c"
@@ -5316,12 +5028,6 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 115 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 115 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 115 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5335,7 +5041,7 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 115 "sample/tail_call_max_exceed.c"
         return 0;
 #line 115 "sample/tail_call_max_exceed.c"
@@ -5389,12 +5095,6 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 115 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 115 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 115 "sample/tail_call_max_exceed.c"
@@ -5529,12 +5229,6 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 116 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 116 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 116 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5548,7 +5242,7 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 116 "sample/tail_call_max_exceed.c"
         return 0;
 #line 116 "sample/tail_call_max_exceed.c"
@@ -5602,12 +5296,6 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 116 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 116 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 116 "sample/tail_call_max_exceed.c"
@@ -5742,12 +5430,6 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 117 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 117 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 117 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5761,7 +5443,7 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 117 "sample/tail_call_max_exceed.c"
         return 0;
 #line 117 "sample/tail_call_max_exceed.c"
@@ -5815,12 +5497,6 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 117 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 117 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 117 "sample/tail_call_max_exceed.c"
@@ -5955,12 +5631,6 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 118 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 118 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 118 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5974,7 +5644,7 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 118 "sample/tail_call_max_exceed.c"
         return 0;
 #line 118 "sample/tail_call_max_exceed.c"
@@ -6028,12 +5698,6 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 118 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 118 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 118 "sample/tail_call_max_exceed.c"
@@ -6135,12 +5799,6 @@ bind_test_callee34(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=12
 #line 138 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 138 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 138 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 138 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_IMM pc=21 dst=r0 src=r0 offset=0 imm=0
 #line 141 "sample/tail_call_max_exceed.c"
     r0 = IMMEDIATE(0);
@@ -6274,12 +5932,6 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 89 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 89 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 89 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6293,7 +5945,7 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 89 "sample/tail_call_max_exceed.c"
         return 0;
 #line 89 "sample/tail_call_max_exceed.c"
@@ -6347,12 +5999,6 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 89 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 89 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 89 "sample/tail_call_max_exceed.c"
@@ -6487,12 +6133,6 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 90 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 90 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 90 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6506,7 +6146,7 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 90 "sample/tail_call_max_exceed.c"
         return 0;
 #line 90 "sample/tail_call_max_exceed.c"
@@ -6560,12 +6200,6 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 90 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 90 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 90 "sample/tail_call_max_exceed.c"
@@ -6700,12 +6334,6 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 91 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 91 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 91 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6719,7 +6347,7 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 91 "sample/tail_call_max_exceed.c"
         return 0;
 #line 91 "sample/tail_call_max_exceed.c"
@@ -6773,12 +6401,6 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 91 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 91 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 91 "sample/tail_call_max_exceed.c"
@@ -6913,12 +6535,6 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 92 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 92 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6932,7 +6548,7 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 92 "sample/tail_call_max_exceed.c"
         return 0;
 #line 92 "sample/tail_call_max_exceed.c"
@@ -6986,12 +6602,6 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 92 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 92 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 92 "sample/tail_call_max_exceed.c"
@@ -7126,12 +6736,6 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 93 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 93 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 93 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7145,7 +6749,7 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 93 "sample/tail_call_max_exceed.c"
         return 0;
 #line 93 "sample/tail_call_max_exceed.c"
@@ -7199,12 +6803,6 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 93 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 93 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 93 "sample/tail_call_max_exceed.c"
@@ -7339,12 +6937,6 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 94 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 94 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 94 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7358,7 +6950,7 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 94 "sample/tail_call_max_exceed.c"
         return 0;
 #line 94 "sample/tail_call_max_exceed.c"
@@ -7412,12 +7004,6 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 94 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 94 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 94 "sample/tail_call_max_exceed.c"
@@ -7540,12 +7126,6 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=12
 #line 126 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 126 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 126 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 126 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_IMM pc=21 dst=r7 src=r0 offset=0 imm=0
 #line 126 "sample/tail_call_max_exceed.c"
     r7 = IMMEDIATE(0);
@@ -7562,7 +7142,7 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
 #line 127 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 127 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 127 "sample/tail_call_max_exceed.c"
         return 0;
 #line 127 "sample/tail_call_max_exceed.c"
@@ -7616,12 +7196,6 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
     // EBPF_OP_CALL pc=44 dst=r0 src=r0 offset=0 imm=13
 #line 128 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 128 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 128 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 128 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=45 dst=r0 src=r0 offset=0 imm=1
 #line 131 "sample/tail_call_max_exceed.c"
@@ -174,12 +174,6 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 85 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 85 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 85 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -193,7 +187,7 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 85 "sample/tail_call_max_exceed.c"
         return 0;
 #line 85 "sample/tail_call_max_exceed.c"
@@ -247,12 +241,6 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 85 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 85 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 85 "sample/tail_call_max_exceed.c"
@@ -387,12 +375,6 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 86 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 86 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 86 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -406,7 +388,7 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 86 "sample/tail_call_max_exceed.c"
         return 0;
 #line 86 "sample/tail_call_max_exceed.c"
@@ -460,12 +442,6 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 86 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 86 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 86 "sample/tail_call_max_exceed.c"
@@ -600,12 +576,6 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 95 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 95 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 95 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -619,7 +589,7 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 95 "sample/tail_call_max_exceed.c"
         return 0;
 #line 95 "sample/tail_call_max_exceed.c"
@@ -673,12 +643,6 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 95 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 95 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 95 "sample/tail_call_max_exceed.c"
@@ -813,12 +777,6 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 96 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 96 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 96 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -832,7 +790,7 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 96 "sample/tail_call_max_exceed.c"
         return 0;
 #line 96 "sample/tail_call_max_exceed.c"
@@ -886,12 +844,6 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 96 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 96 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 96 "sample/tail_call_max_exceed.c"
@@ -1026,12 +978,6 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 97 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 97 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 97 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1045,7 +991,7 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 97 "sample/tail_call_max_exceed.c"
         return 0;
 #line 97 "sample/tail_call_max_exceed.c"
@@ -1099,12 +1045,6 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 97 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 97 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 97 "sample/tail_call_max_exceed.c"
@@ -1239,12 +1179,6 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 98 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 98 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 98 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1258,7 +1192,7 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 98 "sample/tail_call_max_exceed.c"
         return 0;
 #line 98 "sample/tail_call_max_exceed.c"
@@ -1312,12 +1246,6 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 98 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 98 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 98 "sample/tail_call_max_exceed.c"
@@ -1452,12 +1380,6 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 99 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 99 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 99 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1471,7 +1393,7 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 99 "sample/tail_call_max_exceed.c"
         return 0;
 #line 99 "sample/tail_call_max_exceed.c"
@@ -1525,12 +1447,6 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 99 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 99 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 99 "sample/tail_call_max_exceed.c"
@@ -1665,12 +1581,6 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 100 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 100 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 100 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1684,7 +1594,7 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 100 "sample/tail_call_max_exceed.c"
         return 0;
 #line 100 "sample/tail_call_max_exceed.c"
@@ -1738,12 +1648,6 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 100 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 100 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 100 "sample/tail_call_max_exceed.c"
@@ -1878,12 +1782,6 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 101 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 101 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 101 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1897,7 +1795,7 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 101 "sample/tail_call_max_exceed.c"
         return 0;
 #line 101 "sample/tail_call_max_exceed.c"
@@ -1951,12 +1849,6 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 101 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 101 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 101 "sample/tail_call_max_exceed.c"
@@ -2091,12 +1983,6 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 102 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 102 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 102 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2110,7 +1996,7 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 102 "sample/tail_call_max_exceed.c"
         return 0;
 #line 102 "sample/tail_call_max_exceed.c"
@@ -2164,12 +2050,6 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 102 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 102 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 102 "sample/tail_call_max_exceed.c"
@@ -2304,12 +2184,6 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 103 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 103 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 103 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2323,7 +2197,7 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 103 "sample/tail_call_max_exceed.c"
         return 0;
 #line 103 "sample/tail_call_max_exceed.c"
@@ -2377,12 +2251,6 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 103 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 103 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 103 "sample/tail_call_max_exceed.c"
@@ -2517,12 +2385,6 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 104 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 104 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 104 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2536,7 +2398,7 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 104 "sample/tail_call_max_exceed.c"
         return 0;
 #line 104 "sample/tail_call_max_exceed.c"
@@ -2590,12 +2452,6 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 104 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 104 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 104 "sample/tail_call_max_exceed.c"
@@ -2730,12 +2586,6 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 87 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 87 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 87 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2749,7 +2599,7 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 87 "sample/tail_call_max_exceed.c"
         return 0;
 #line 87 "sample/tail_call_max_exceed.c"
@@ -2803,12 +2653,6 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 87 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 87 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 87 "sample/tail_call_max_exceed.c"
@@ -2943,12 +2787,6 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 105 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 105 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 105 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2962,7 +2800,7 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 105 "sample/tail_call_max_exceed.c"
         return 0;
 #line 105 "sample/tail_call_max_exceed.c"
@@ -3016,12 +2854,6 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 105 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 105 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 105 "sample/tail_call_max_exceed.c"
@@ -3156,12 +2988,6 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 106 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 106 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 106 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3175,7 +3001,7 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 106 "sample/tail_call_max_exceed.c"
         return 0;
 #line 106 "sample/tail_call_max_exceed.c"
@@ -3229,12 +3055,6 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 106 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 106 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 106 "sample/tail_call_max_exceed.c"
@@ -3369,12 +3189,6 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 107 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 107 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 107 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3388,7 +3202,7 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 107 "sample/tail_call_max_exceed.c"
         return 0;
 #line 107 "sample/tail_call_max_exceed.c"
@@ -3442,12 +3256,6 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 107 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 107 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 107 "sample/tail_call_max_exceed.c"
@@ -3582,12 +3390,6 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 108 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 108 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 108 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3601,7 +3403,7 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 108 "sample/tail_call_max_exceed.c"
         return 0;
 #line 108 "sample/tail_call_max_exceed.c"
@@ -3655,12 +3457,6 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 108 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 108 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 108 "sample/tail_call_max_exceed.c"
@@ -3795,12 +3591,6 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 109 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 109 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 109 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3814,7 +3604,7 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 109 "sample/tail_call_max_exceed.c"
         return 0;
 #line 109 "sample/tail_call_max_exceed.c"
@@ -3868,12 +3658,6 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 109 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 109 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 109 "sample/tail_call_max_exceed.c"
@@ -4008,12 +3792,6 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 110 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 110 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 110 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4027,7 +3805,7 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 110 "sample/tail_call_max_exceed.c"
         return 0;
 #line 110 "sample/tail_call_max_exceed.c"
@@ -4081,12 +3859,6 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 110 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 110 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 110 "sample/tail_call_max_exceed.c"
@@ -4221,12 +3993,6 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 111 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 111 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 111 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4240,7 +4006,7 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 111 "sample/tail_call_max_exceed.c"
         return 0;
 #line 111 "sample/tail_call_max_exceed.c"
@@ -4294,12 +4060,6 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 111 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 111 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 111 "sample/tail_call_max_exceed.c"
@@ -4434,12 +4194,6 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 112 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 112 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 112 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4453,7 +4207,7 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 112 "sample/tail_call_max_exceed.c"
         return 0;
 #line 112 "sample/tail_call_max_exceed.c"
@@ -4507,12 +4261,6 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 112 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 112 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 112 "sample/tail_call_max_exceed.c"
@@ -4647,12 +4395,6 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 113 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 113 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 113 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4666,7 +4408,7 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 113 "sample/tail_call_max_exceed.c"
         return 0;
 #line 113 "sample/tail_call_max_exceed.c"
@@ -4720,12 +4462,6 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 113 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 113 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 113 "sample/tail_call_max_exceed.c"
@@ -4860,12 +4596,6 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 114 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 114 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 114 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4879,7 +4609,7 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 114 "sample/tail_call_max_exceed.c"
         return 0;
 #line 114 "sample/tail_call_max_exceed.c"
@@ -4933,12 +4663,6 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 114 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 114 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 114 "sample/tail_call_max_exceed.c"
@@ -5073,12 +4797,6 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 88 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 88 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 88 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5092,7 +4810,7 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 88 "sample/tail_call_max_exceed.c"
         return 0;
 #line 88 "sample/tail_call_max_exceed.c"
@@ -5146,12 +4864,6 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 88 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 88 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 88 "sample/tail_call_max_exceed.c"
@@ -5286,12 +4998,6 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 115 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 115 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 115 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5305,7 +5011,7 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 115 "sample/tail_call_max_exceed.c"
         return 0;
 #line 115 "sample/tail_call_max_exceed.c"
@@ -5359,12 +5065,6 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 115 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 115 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 115 "sample/tail_call_max_exceed.c"
@@ -5499,12 +5199,6 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 116 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 116 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 116 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5518,7 +5212,7 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 116 "sample/tail_call_max_exceed.c"
         return 0;
 #line 116 "sample/tail_call_max_exceed.c"
@@ -5572,12 +5266,6 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 116 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 116 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 116 "sample/tail_call_max_exceed.c"
@@ -5712,12 +5400,6 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 117 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 117 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 117 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5731,7 +5413,7 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 117 "sample/tail_call_max_exceed.c"
         return 0;
 #line 117 "sample/tail_call_max_exceed.c"
@@ -5785,12 +5467,6 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 117 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 117 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 117 "sample/tail_call_max_exceed.c"
@@ -5925,12 +5601,6 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 118 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 118 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 118 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5944,7 +5614,7 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 118 "sample/tail_call_max_exceed.c"
         return 0;
 #line 118 "sample/tail_call_max_exceed.c"
@@ -5998,12 +5668,6 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 118 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 118 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 118 "sample/tail_call_max_exceed.c"
@@ -6105,12 +5769,6 @@ bind_test_callee34(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=12
 #line 138 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 138 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 138 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 138 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_IMM pc=21 dst=r0 src=r0 offset=0 imm=0
 #line 141 "sample/tail_call_max_exceed.c"
     r0 = IMMEDIATE(0);
@@ -6244,12 +5902,6 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 89 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 89 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 89 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6263,7 +5915,7 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 89 "sample/tail_call_max_exceed.c"
         return 0;
 #line 89 "sample/tail_call_max_exceed.c"
@@ -6317,12 +5969,6 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 89 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 89 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 89 "sample/tail_call_max_exceed.c"
@@ -6457,12 +6103,6 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 90 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 90 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 90 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6476,7 +6116,7 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 90 "sample/tail_call_max_exceed.c"
         return 0;
 #line 90 "sample/tail_call_max_exceed.c"
@@ -6530,12 +6170,6 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 90 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 90 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 90 "sample/tail_call_max_exceed.c"
@@ -6670,12 +6304,6 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 91 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 91 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 91 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6689,7 +6317,7 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 91 "sample/tail_call_max_exceed.c"
         return 0;
 #line 91 "sample/tail_call_max_exceed.c"
@@ -6743,12 +6371,6 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 91 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 91 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 91 "sample/tail_call_max_exceed.c"
@@ -6883,12 +6505,6 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 92 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 92 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6902,7 +6518,7 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 92 "sample/tail_call_max_exceed.c"
         return 0;
 #line 92 "sample/tail_call_max_exceed.c"
@@ -6956,12 +6572,6 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 92 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 92 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 92 "sample/tail_call_max_exceed.c"
@@ -7096,12 +6706,6 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 93 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 93 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 93 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7115,7 +6719,7 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 93 "sample/tail_call_max_exceed.c"
         return 0;
 #line 93 "sample/tail_call_max_exceed.c"
@@ -7169,12 +6773,6 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 93 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 93 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 93 "sample/tail_call_max_exceed.c"
@@ -7309,12 +6907,6 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 94 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 94 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 94 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7328,7 +6920,7 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 94 "sample/tail_call_max_exceed.c"
         return 0;
 #line 94 "sample/tail_call_max_exceed.c"
@@ -7382,12 +6974,6 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 94 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 94 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 94 "sample/tail_call_max_exceed.c"
@@ -7510,12 +7096,6 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=12
 #line 126 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 126 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 126 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 126 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_IMM pc=21 dst=r7 src=r0 offset=0 imm=0
 #line 126 "sample/tail_call_max_exceed.c"
     r7 = IMMEDIATE(0);
@@ -7532,7 +7112,7 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
 #line 127 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 127 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 127 "sample/tail_call_max_exceed.c"
         return 0;
 #line 127 "sample/tail_call_max_exceed.c"
@@ -7586,12 +7166,6 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
     // EBPF_OP_CALL pc=44 dst=r0 src=r0 offset=0 imm=13
 #line 128 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 128 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 128 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 128 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=45 dst=r0 src=r0 offset=0 imm=1
 #line 131 "sample/tail_call_max_exceed.c"
@@ -329,12 +329,6 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 85 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 85 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 85 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -348,7 +342,7 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 85 "sample/tail_call_max_exceed.c"
         return 0;
 #line 85 "sample/tail_call_max_exceed.c"
@@ -402,12 +396,6 @@ bind_test_callee0(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 85 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 85 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 85 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 85 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 85 "sample/tail_call_max_exceed.c"
@@ -542,12 +530,6 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 86 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 86 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 86 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -561,7 +543,7 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 86 "sample/tail_call_max_exceed.c"
         return 0;
 #line 86 "sample/tail_call_max_exceed.c"
@@ -615,12 +597,6 @@ bind_test_callee1(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 86 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 86 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 86 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 86 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 86 "sample/tail_call_max_exceed.c"
@@ -755,12 +731,6 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 95 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 95 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 95 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -774,7 +744,7 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 95 "sample/tail_call_max_exceed.c"
         return 0;
 #line 95 "sample/tail_call_max_exceed.c"
@@ -828,12 +798,6 @@ bind_test_callee10(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 95 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 95 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 95 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 95 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 95 "sample/tail_call_max_exceed.c"
@@ -968,12 +932,6 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 96 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 96 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 96 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -987,7 +945,7 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 96 "sample/tail_call_max_exceed.c"
         return 0;
 #line 96 "sample/tail_call_max_exceed.c"
@@ -1041,12 +999,6 @@ bind_test_callee11(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 96 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 96 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 96 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 96 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 96 "sample/tail_call_max_exceed.c"
@@ -1181,12 +1133,6 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 97 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 97 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 97 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1200,7 +1146,7 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 97 "sample/tail_call_max_exceed.c"
         return 0;
 #line 97 "sample/tail_call_max_exceed.c"
@@ -1254,12 +1200,6 @@ bind_test_callee12(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 97 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 97 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 97 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 97 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 97 "sample/tail_call_max_exceed.c"
@@ -1394,12 +1334,6 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 98 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 98 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 98 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1413,7 +1347,7 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 98 "sample/tail_call_max_exceed.c"
         return 0;
 #line 98 "sample/tail_call_max_exceed.c"
@@ -1467,12 +1401,6 @@ bind_test_callee13(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 98 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 98 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 98 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 98 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 98 "sample/tail_call_max_exceed.c"
@@ -1607,12 +1535,6 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 99 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 99 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 99 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1626,7 +1548,7 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 99 "sample/tail_call_max_exceed.c"
         return 0;
 #line 99 "sample/tail_call_max_exceed.c"
@@ -1680,12 +1602,6 @@ bind_test_callee14(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 99 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 99 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 99 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 99 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 99 "sample/tail_call_max_exceed.c"
@@ -1820,12 +1736,6 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 100 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 100 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 100 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -1839,7 +1749,7 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 100 "sample/tail_call_max_exceed.c"
         return 0;
 #line 100 "sample/tail_call_max_exceed.c"
@@ -1893,12 +1803,6 @@ bind_test_callee15(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 100 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 100 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 100 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 100 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 100 "sample/tail_call_max_exceed.c"
@@ -2033,12 +1937,6 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 101 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 101 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 101 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2052,7 +1950,7 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 101 "sample/tail_call_max_exceed.c"
         return 0;
 #line 101 "sample/tail_call_max_exceed.c"
@@ -2106,12 +2004,6 @@ bind_test_callee16(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 101 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 101 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 101 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 101 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 101 "sample/tail_call_max_exceed.c"
@@ -2246,12 +2138,6 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 102 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 102 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 102 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2265,7 +2151,7 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 102 "sample/tail_call_max_exceed.c"
         return 0;
 #line 102 "sample/tail_call_max_exceed.c"
@@ -2319,12 +2205,6 @@ bind_test_callee17(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 102 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 102 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 102 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 102 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 102 "sample/tail_call_max_exceed.c"
@@ -2459,12 +2339,6 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 103 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 103 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 103 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2478,7 +2352,7 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 103 "sample/tail_call_max_exceed.c"
         return 0;
 #line 103 "sample/tail_call_max_exceed.c"
@@ -2532,12 +2406,6 @@ bind_test_callee18(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 103 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 103 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 103 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 103 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 103 "sample/tail_call_max_exceed.c"
@@ -2672,12 +2540,6 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 104 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 104 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 104 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2691,7 +2553,7 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 104 "sample/tail_call_max_exceed.c"
         return 0;
 #line 104 "sample/tail_call_max_exceed.c"
@@ -2745,12 +2607,6 @@ bind_test_callee19(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 104 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 104 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 104 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 104 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 104 "sample/tail_call_max_exceed.c"
@@ -2885,12 +2741,6 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 87 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 87 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 87 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -2904,7 +2754,7 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 87 "sample/tail_call_max_exceed.c"
         return 0;
 #line 87 "sample/tail_call_max_exceed.c"
@@ -2958,12 +2808,6 @@ bind_test_callee2(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 87 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 87 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 87 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 87 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 87 "sample/tail_call_max_exceed.c"
@@ -3098,12 +2942,6 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 105 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 105 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 105 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3117,7 +2955,7 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 105 "sample/tail_call_max_exceed.c"
         return 0;
 #line 105 "sample/tail_call_max_exceed.c"
@@ -3171,12 +3009,6 @@ bind_test_callee20(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 105 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 105 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 105 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 105 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 105 "sample/tail_call_max_exceed.c"
@@ -3311,12 +3143,6 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 106 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 106 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 106 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3330,7 +3156,7 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 106 "sample/tail_call_max_exceed.c"
         return 0;
 #line 106 "sample/tail_call_max_exceed.c"
@@ -3384,12 +3210,6 @@ bind_test_callee21(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 106 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 106 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 106 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 106 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 106 "sample/tail_call_max_exceed.c"
@@ -3524,12 +3344,6 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 107 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 107 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 107 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3543,7 +3357,7 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 107 "sample/tail_call_max_exceed.c"
         return 0;
 #line 107 "sample/tail_call_max_exceed.c"
@@ -3597,12 +3411,6 @@ bind_test_callee22(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 107 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 107 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 107 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 107 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 107 "sample/tail_call_max_exceed.c"
@@ -3737,12 +3545,6 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 108 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 108 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 108 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3756,7 +3558,7 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 108 "sample/tail_call_max_exceed.c"
         return 0;
 #line 108 "sample/tail_call_max_exceed.c"
@@ -3810,12 +3612,6 @@ bind_test_callee23(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 108 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 108 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 108 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 108 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 108 "sample/tail_call_max_exceed.c"
@@ -3950,12 +3746,6 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 109 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 109 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 109 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -3969,7 +3759,7 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 109 "sample/tail_call_max_exceed.c"
         return 0;
 #line 109 "sample/tail_call_max_exceed.c"
@@ -4023,12 +3813,6 @@ bind_test_callee24(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 109 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 109 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 109 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 109 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 109 "sample/tail_call_max_exceed.c"
@@ -4163,12 +3947,6 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 110 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 110 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 110 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4182,7 +3960,7 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 110 "sample/tail_call_max_exceed.c"
         return 0;
 #line 110 "sample/tail_call_max_exceed.c"
@@ -4236,12 +4014,6 @@ bind_test_callee25(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 110 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 110 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 110 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 110 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 110 "sample/tail_call_max_exceed.c"
@@ -4376,12 +4148,6 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 111 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 111 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 111 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4395,7 +4161,7 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 111 "sample/tail_call_max_exceed.c"
         return 0;
 #line 111 "sample/tail_call_max_exceed.c"
@@ -4449,12 +4215,6 @@ bind_test_callee26(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 111 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 111 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 111 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 111 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 111 "sample/tail_call_max_exceed.c"
@@ -4589,12 +4349,6 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 112 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 112 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 112 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4608,7 +4362,7 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 112 "sample/tail_call_max_exceed.c"
         return 0;
 #line 112 "sample/tail_call_max_exceed.c"
@@ -4662,12 +4416,6 @@ bind_test_callee27(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 112 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 112 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 112 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 112 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 112 "sample/tail_call_max_exceed.c"
@@ -4802,12 +4550,6 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 113 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 113 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 113 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -4821,7 +4563,7 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 113 "sample/tail_call_max_exceed.c"
         return 0;
 #line 113 "sample/tail_call_max_exceed.c"
@@ -4875,12 +4617,6 @@ bind_test_callee28(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 113 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 113 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 113 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 113 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 113 "sample/tail_call_max_exceed.c"
@@ -5015,12 +4751,6 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 114 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 114 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 114 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5034,7 +4764,7 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 114 "sample/tail_call_max_exceed.c"
         return 0;
 #line 114 "sample/tail_call_max_exceed.c"
@@ -5088,12 +4818,6 @@ bind_test_callee29(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 114 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 114 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 114 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 114 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 114 "sample/tail_call_max_exceed.c"
@@ -5228,12 +4952,6 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 88 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 88 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 88 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5247,7 +4965,7 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 88 "sample/tail_call_max_exceed.c"
         return 0;
 #line 88 "sample/tail_call_max_exceed.c"
@@ -5301,12 +5019,6 @@ bind_test_callee3(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 88 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 88 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 88 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 88 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 88 "sample/tail_call_max_exceed.c"
@@ -5441,12 +5153,6 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 115 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 115 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 115 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5460,7 +5166,7 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 115 "sample/tail_call_max_exceed.c"
         return 0;
 #line 115 "sample/tail_call_max_exceed.c"
@@ -5514,12 +5220,6 @@ bind_test_callee30(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 115 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 115 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 115 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 115 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 115 "sample/tail_call_max_exceed.c"
@@ -5654,12 +5354,6 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 116 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 116 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 116 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5673,7 +5367,7 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 116 "sample/tail_call_max_exceed.c"
         return 0;
 #line 116 "sample/tail_call_max_exceed.c"
@@ -5727,12 +5421,6 @@ bind_test_callee31(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 116 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 116 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 116 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 116 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 116 "sample/tail_call_max_exceed.c"
@@ -5867,12 +5555,6 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 117 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 117 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 117 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -5886,7 +5568,7 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 117 "sample/tail_call_max_exceed.c"
         return 0;
 #line 117 "sample/tail_call_max_exceed.c"
@@ -5940,12 +5622,6 @@ bind_test_callee32(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 117 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 117 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 117 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 117 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 117 "sample/tail_call_max_exceed.c"
@@ -6080,12 +5756,6 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 118 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 118 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 118 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6099,7 +5769,7 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 118 "sample/tail_call_max_exceed.c"
         return 0;
 #line 118 "sample/tail_call_max_exceed.c"
@@ -6153,12 +5823,6 @@ bind_test_callee33(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 118 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 118 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 118 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 118 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 118 "sample/tail_call_max_exceed.c"
@@ -6260,12 +5924,6 @@ bind_test_callee34(void* context, const program_runtime_context_t* runtime_conte
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=12
 #line 138 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 138 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 138 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 138 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_IMM pc=21 dst=r0 src=r0 offset=0 imm=0
 #line 141 "sample/tail_call_max_exceed.c"
     r0 = IMMEDIATE(0);
@@ -6399,12 +6057,6 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 89 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 89 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 89 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6418,7 +6070,7 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 89 "sample/tail_call_max_exceed.c"
         return 0;
 #line 89 "sample/tail_call_max_exceed.c"
@@ -6472,12 +6124,6 @@ bind_test_callee4(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 89 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 89 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 89 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 89 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 89 "sample/tail_call_max_exceed.c"
@@ -6612,12 +6258,6 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 90 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 90 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 90 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6631,7 +6271,7 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 90 "sample/tail_call_max_exceed.c"
         return 0;
 #line 90 "sample/tail_call_max_exceed.c"
@@ -6685,12 +6325,6 @@ bind_test_callee5(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 90 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 90 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 90 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 90 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 90 "sample/tail_call_max_exceed.c"
@@ -6825,12 +6459,6 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 91 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 91 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 91 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -6844,7 +6472,7 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 91 "sample/tail_call_max_exceed.c"
         return 0;
 #line 91 "sample/tail_call_max_exceed.c"
@@ -6898,12 +6526,6 @@ bind_test_callee6(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 91 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 91 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 91 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 91 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 91 "sample/tail_call_max_exceed.c"
@@ -7038,12 +6660,6 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 92 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 92 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 92 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7057,7 +6673,7 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 92 "sample/tail_call_max_exceed.c"
         return 0;
 #line 92 "sample/tail_call_max_exceed.c"
@@ -7111,12 +6727,6 @@ bind_test_callee7(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 92 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 92 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 92 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 92 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 92 "sample/tail_call_max_exceed.c"
@@ -7251,12 +6861,6 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 93 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 93 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 93 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7270,7 +6874,7 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 93 "sample/tail_call_max_exceed.c"
         return 0;
 #line 93 "sample/tail_call_max_exceed.c"
@@ -7324,12 +6928,6 @@ bind_test_callee8(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 93 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 93 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 93 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 93 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 93 "sample/tail_call_max_exceed.c"
@@ -7464,12 +7062,6 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=14
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 94 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 94 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_REG pc=26 dst=r1 src=r6 offset=0 imm=0
 #line 94 "sample/tail_call_max_exceed.c"
     r1 = r6;
@@ -7483,7 +7075,7 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 94 "sample/tail_call_max_exceed.c"
         return 0;
 #line 94 "sample/tail_call_max_exceed.c"
@@ -7537,12 +7129,6 @@ bind_test_callee9(void* context, const program_runtime_context_t* runtime_contex
     // EBPF_OP_CALL pc=48 dst=r0 src=r0 offset=0 imm=13
 #line 94 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 94 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 94 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 94 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=49 dst=r0 src=r0 offset=0 imm=1
 #line 94 "sample/tail_call_max_exceed.c"
@@ -7665,12 +7251,6 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=12
 #line 126 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 126 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 126 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 126 "sample/tail_call_max_exceed.c"
-    }
     // EBPF_OP_MOV64_IMM pc=21 dst=r7 src=r0 offset=0 imm=0
 #line 126 "sample/tail_call_max_exceed.c"
     r7 = IMMEDIATE(0);
@@ -7687,7 +7267,7 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
 #line 127 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
 #line 127 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 127 "sample/tail_call_max_exceed.c"
         return 0;
 #line 127 "sample/tail_call_max_exceed.c"
@@ -7741,12 +7321,6 @@ bind_test_caller(void* context, const program_runtime_context_t* runtime_context
     // EBPF_OP_CALL pc=44 dst=r0 src=r0 offset=0 imm=13
 #line 128 "sample/tail_call_max_exceed.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 128 "sample/tail_call_max_exceed.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 128 "sample/tail_call_max_exceed.c"
-        return 0;
-#line 128 "sample/tail_call_max_exceed.c"
-    }
 label_1:
     // EBPF_OP_MOV64_IMM pc=45 dst=r0 src=r0 offset=0 imm=1
 #line 131 "sample/tail_call_max_exceed.c"
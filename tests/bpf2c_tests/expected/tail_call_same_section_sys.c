@@ -254,12 +254,6 @@ callee(void* context, const program_runtime_context_t* runtime_context)
     register uint64_t r1 = 0;
 #line 33 "sample/undocked/tail_call_same_section.c"
     register uint64_t r2 = 0;
-#line 33 "sample/undocked/tail_call_same_section.c"
-    register uint64_t r3 = 0;
-#line 33 "sample/undocked/tail_call_same_section.c"
-    register uint64_t r4 = 0;
-#line 33 "sample/undocked/tail_call_same_section.c"
-    register uint64_t r5 = 0;
 #line 33 "sample/undocked/tail_call_same_section.c"
     register uint64_t r10 = 0;
 
@@ -285,11 +279,15 @@ callee(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=6 dst=r0 src=r0 offset=0 imm=1
 #line 38 "sample/undocked/tail_call_same_section.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 38 "sample/undocked/tail_call_same_section.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 38 "sample/undocked/tail_call_same_section.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 38 "sample/undocked/tail_call_same_section.c"
+    } else {
+#line 38 "sample/undocked/tail_call_same_section.c"
+        r0 = 0;
 #line 38 "sample/undocked/tail_call_same_section.c"
     }
     // EBPF_OP_MOV64_REG pc=7 dst=r1 src=r0 offset=0 imm=0
@@ -382,7 +380,7 @@ caller(void* context, const program_runtime_context_t* runtime_context)
 #line 38 "sample/undocked/tail_call_same_section.c"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
 #line 38 "sample/undocked/tail_call_same_section.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 38 "sample/undocked/tail_call_same_section.c"
         return 0;
 #line 38 "sample/undocked/tail_call_same_section.c"
@@ -398,11 +396,15 @@ caller(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=10 dst=r0 src=r0 offset=0 imm=1
 #line 41 "sample/undocked/tail_call_same_section.c"
-    r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 41 "sample/undocked/tail_call_same_section.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 41 "sample/undocked/tail_call_same_section.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 41 "sample/undocked/tail_call_same_section.c"
+    } else {
+#line 41 "sample/undocked/tail_call_same_section.c"
+        r0 = 0;
 #line 41 "sample/undocked/tail_call_same_section.c"
     }
     // EBPF_OP_JEQ_IMM pc=11 dst=r0 src=r0 offset=2 imm=0
@@ -182,11 +182,15 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 133 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 133 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 133 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 133 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 133 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -235,12 +239,6 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 133 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 133 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 133 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 133 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -270,7 +268,7 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
 #line 133 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 133 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 133 "sample/undocked/tail_call_sequential.c"
@@ -372,11 +370,15 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 134 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 134 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 134 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 134 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 134 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -425,12 +427,6 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 134 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 134 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 134 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 134 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -460,7 +456,7 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
 #line 134 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 134 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 134 "sample/undocked/tail_call_sequential.c"
@@ -564,11 +560,15 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 143 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 143 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 143 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 143 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 143 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -620,12 +620,6 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 143 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 143 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 143 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 143 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -655,7 +649,7 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
 #line 143 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 143 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 143 "sample/undocked/tail_call_sequential.c"
@@ -759,11 +753,15 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 144 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 144 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 144 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 144 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 144 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -815,12 +813,6 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 144 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 144 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 144 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 144 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -850,7 +842,7 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
 #line 144 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 144 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 144 "sample/undocked/tail_call_sequential.c"
@@ -954,11 +946,15 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 145 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 145 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 145 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 145 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 145 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1010,12 +1006,6 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 145 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 145 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 145 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 145 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1045,7 +1035,7 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
 #line 145 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 145 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 145 "sample/undocked/tail_call_sequential.c"
@@ -1149,11 +1139,15 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 146 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 146 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 146 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 146 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 146 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1205,12 +1199,6 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 146 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 146 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 146 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 146 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1240,7 +1228,7 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
 #line 146 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 146 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 146 "sample/undocked/tail_call_sequential.c"
@@ -1344,11 +1332,15 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 147 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 147 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 147 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 147 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 147 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1400,12 +1392,6 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 147 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 147 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 147 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 147 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1435,7 +1421,7 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
 #line 147 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 147 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 147 "sample/undocked/tail_call_sequential.c"
@@ -1539,11 +1525,15 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 148 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 148 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 148 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 148 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 148 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1595,12 +1585,6 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 148 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 148 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 148 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 148 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1630,7 +1614,7 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
 #line 148 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 148 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 148 "sample/undocked/tail_call_sequential.c"
@@ -1734,11 +1718,15 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 149 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 149 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 149 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 149 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 149 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1790,12 +1778,6 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 149 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 149 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 149 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 149 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1825,7 +1807,7 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
 #line 149 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 149 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 149 "sample/undocked/tail_call_sequential.c"
@@ -1929,11 +1911,15 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 150 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 150 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 150 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 150 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 150 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1985,12 +1971,6 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 150 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 150 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 150 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 150 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2020,7 +2000,7 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
 #line 150 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 150 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 150 "sample/undocked/tail_call_sequential.c"
@@ -2124,11 +2104,15 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 151 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 151 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 151 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 151 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 151 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2180,12 +2164,6 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 151 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 151 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 151 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 151 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2215,7 +2193,7 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
 #line 151 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 151 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 151 "sample/undocked/tail_call_sequential.c"
@@ -2319,11 +2297,15 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 152 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 152 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 152 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 152 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 152 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2375,12 +2357,6 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 152 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 152 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 152 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 152 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2410,7 +2386,7 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
 #line 152 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 152 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 152 "sample/undocked/tail_call_sequential.c"
@@ -2512,11 +2488,15 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 135 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 135 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 135 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 135 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 135 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2565,12 +2545,6 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 135 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 135 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 135 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 135 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2600,7 +2574,7 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
 #line 135 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 135 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 135 "sample/undocked/tail_call_sequential.c"
@@ -2704,11 +2678,15 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 153 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 153 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 153 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 153 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 153 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2760,12 +2738,6 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 153 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 153 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 153 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 153 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2795,7 +2767,7 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
 #line 153 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 153 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 153 "sample/undocked/tail_call_sequential.c"
@@ -2899,11 +2871,15 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 154 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 154 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 154 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 154 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 154 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2955,12 +2931,6 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 154 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 154 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 154 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 154 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2990,7 +2960,7 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
 #line 154 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 154 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 154 "sample/undocked/tail_call_sequential.c"
@@ -3094,11 +3064,15 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 155 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 155 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 155 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 155 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 155 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3150,12 +3124,6 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 155 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 155 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 155 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 155 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3185,7 +3153,7 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
 #line 155 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 155 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 155 "sample/undocked/tail_call_sequential.c"
@@ -3289,11 +3257,15 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 156 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 156 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 156 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 156 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 156 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3345,12 +3317,6 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 156 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 156 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 156 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 156 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3380,7 +3346,7 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
 #line 156 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 156 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 156 "sample/undocked/tail_call_sequential.c"
@@ -3484,11 +3450,15 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 157 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 157 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 157 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 157 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 157 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3543,12 +3513,6 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=26 dst=r0 src=r0 offset=0 imm=13
 #line 157 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 157 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 157 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=27 dst=r1 src=r8 offset=0 imm=0
 #line 157 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3575,7 +3539,7 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
 #line 157 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 157 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 157 "sample/undocked/tail_call_sequential.c"
@@ -3679,11 +3643,15 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 158 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 158 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 158 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 158 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 158 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3735,12 +3703,6 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 158 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 158 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 158 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 158 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3770,7 +3732,7 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
 #line 158 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 158 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 158 "sample/undocked/tail_call_sequential.c"
@@ -3874,11 +3836,15 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 159 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 159 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 159 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 159 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 159 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3930,12 +3896,6 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 159 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 159 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 159 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 159 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3965,7 +3925,7 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
 #line 159 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 159 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 159 "sample/undocked/tail_call_sequential.c"
@@ -4069,11 +4029,15 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 160 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 160 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 160 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 160 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 160 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4125,12 +4089,6 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 160 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 160 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 160 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 160 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4160,7 +4118,7 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
 #line 160 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 160 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 160 "sample/undocked/tail_call_sequential.c"
@@ -4264,11 +4222,15 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 161 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 161 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 161 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 161 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 161 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4320,12 +4282,6 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 161 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 161 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 161 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 161 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4355,7 +4311,7 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
 #line 161 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 161 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 161 "sample/undocked/tail_call_sequential.c"
@@ -4459,11 +4415,15 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 162 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 162 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 162 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 162 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 162 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4515,12 +4475,6 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 162 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 162 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 162 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 162 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4550,7 +4504,7 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
 #line 162 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 162 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 162 "sample/undocked/tail_call_sequential.c"
@@ -4652,11 +4606,15 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 136 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 136 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 136 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 136 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 136 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4705,12 +4663,6 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 136 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 136 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 136 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 136 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4740,7 +4692,7 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
 #line 136 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 136 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 136 "sample/undocked/tail_call_sequential.c"
@@ -4844,11 +4796,15 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 163 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 163 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 163 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 163 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 163 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4900,12 +4856,6 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 163 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 163 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 163 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 163 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4935,7 +4885,7 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
 #line 163 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 163 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 163 "sample/undocked/tail_call_sequential.c"
@@ -5039,11 +4989,15 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 164 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 164 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 164 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 164 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 164 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5095,12 +5049,6 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 164 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 164 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 164 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 164 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5130,7 +5078,7 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
 #line 164 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 164 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 164 "sample/undocked/tail_call_sequential.c"
@@ -5234,11 +5182,15 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 165 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 165 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 165 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 165 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 165 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5290,12 +5242,6 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 165 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 165 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 165 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 165 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5325,7 +5271,7 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
 #line 165 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 165 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 165 "sample/undocked/tail_call_sequential.c"
@@ -5429,11 +5375,15 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 166 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 166 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 166 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 166 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 166 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5485,12 +5435,6 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 166 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 166 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 166 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 166 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5520,7 +5464,7 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
 #line 166 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 166 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 166 "sample/undocked/tail_call_sequential.c"
@@ -5624,11 +5568,15 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 167 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 167 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 167 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 167 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 167 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5680,12 +5628,6 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 167 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 167 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 167 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 167 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5715,7 +5657,7 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
 #line 167 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 167 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 167 "sample/undocked/tail_call_sequential.c"
@@ -5817,11 +5759,15 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 137 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 137 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 137 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 137 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 137 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5870,12 +5816,6 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 137 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 137 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 137 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 137 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5905,7 +5845,7 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
 #line 137 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 137 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 137 "sample/undocked/tail_call_sequential.c"
@@ -6007,11 +5947,15 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 138 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 138 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 138 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 138 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 138 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6060,12 +6004,6 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 138 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 138 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 138 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 138 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6095,7 +6033,7 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
 #line 138 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 138 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 138 "sample/undocked/tail_call_sequential.c"
@@ -6197,11 +6135,15 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 139 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 139 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 139 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 139 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 139 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6250,12 +6192,6 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 139 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 139 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 139 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 139 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6285,7 +6221,7 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
 #line 139 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 139 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 139 "sample/undocked/tail_call_sequential.c"
@@ -6387,11 +6323,15 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 140 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 140 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 140 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 140 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 140 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6440,12 +6380,6 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 140 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 140 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 140 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 140 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6475,7 +6409,7 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
 #line 140 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 140 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 140 "sample/undocked/tail_call_sequential.c"
@@ -6577,11 +6511,15 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 141 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 141 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 141 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 141 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 141 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6630,12 +6568,6 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 141 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 141 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 141 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 141 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6665,7 +6597,7 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
 #line 141 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 141 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 141 "sample/undocked/tail_call_sequential.c"
@@ -6767,11 +6699,15 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 142 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 142 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 142 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 142 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 142 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6820,12 +6756,6 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 142 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 142 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 142 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 142 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6855,7 +6785,7 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
 #line 142 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 142 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 142 "sample/undocked/tail_call_sequential.c"
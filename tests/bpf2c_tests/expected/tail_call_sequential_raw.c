@@ -152,11 +152,15 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 133 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 133 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 133 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 133 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 133 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -205,12 +209,6 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 133 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 133 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 133 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 133 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -240,7 +238,7 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
 #line 133 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 133 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 133 "sample/undocked/tail_call_sequential.c"
@@ -342,11 +340,15 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 134 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 134 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 134 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 134 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 134 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -395,12 +397,6 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 134 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 134 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 134 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 134 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -430,7 +426,7 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
 #line 134 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 134 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 134 "sample/undocked/tail_call_sequential.c"
@@ -534,11 +530,15 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 143 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 143 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 143 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 143 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 143 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -590,12 +590,6 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 143 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 143 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 143 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 143 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -625,7 +619,7 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
 #line 143 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 143 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 143 "sample/undocked/tail_call_sequential.c"
@@ -729,11 +723,15 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 144 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 144 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 144 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 144 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 144 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -785,12 +783,6 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 144 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 144 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 144 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 144 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -820,7 +812,7 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
 #line 144 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 144 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 144 "sample/undocked/tail_call_sequential.c"
@@ -924,11 +916,15 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 145 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 145 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 145 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 145 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 145 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -980,12 +976,6 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 145 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 145 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 145 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 145 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1015,7 +1005,7 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
 #line 145 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 145 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 145 "sample/undocked/tail_call_sequential.c"
@@ -1119,11 +1109,15 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 146 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 146 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 146 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 146 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 146 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1175,12 +1169,6 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 146 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 146 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 146 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 146 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1210,7 +1198,7 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
 #line 146 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 146 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 146 "sample/undocked/tail_call_sequential.c"
@@ -1314,11 +1302,15 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 147 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 147 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 147 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 147 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 147 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1370,12 +1362,6 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 147 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 147 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 147 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 147 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1405,7 +1391,7 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
 #line 147 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 147 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 147 "sample/undocked/tail_call_sequential.c"
@@ -1509,11 +1495,15 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 148 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 148 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 148 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 148 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 148 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1565,12 +1555,6 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 148 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 148 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 148 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 148 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1600,7 +1584,7 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
 #line 148 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 148 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 148 "sample/undocked/tail_call_sequential.c"
@@ -1704,11 +1688,15 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 149 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 149 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 149 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 149 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 149 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1760,12 +1748,6 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 149 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 149 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 149 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 149 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1795,7 +1777,7 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
 #line 149 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 149 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 149 "sample/undocked/tail_call_sequential.c"
@@ -1899,11 +1881,15 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 150 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 150 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 150 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 150 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 150 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1955,12 +1941,6 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 150 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 150 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 150 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 150 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1990,7 +1970,7 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
 #line 150 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 150 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 150 "sample/undocked/tail_call_sequential.c"
@@ -2094,11 +2074,15 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 151 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 151 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 151 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 151 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 151 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2150,12 +2134,6 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 151 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 151 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 151 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 151 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2185,7 +2163,7 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
 #line 151 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 151 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 151 "sample/undocked/tail_call_sequential.c"
@@ -2289,11 +2267,15 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 152 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 152 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 152 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 152 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 152 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2345,12 +2327,6 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 152 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 152 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 152 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 152 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2380,7 +2356,7 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
 #line 152 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 152 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 152 "sample/undocked/tail_call_sequential.c"
@@ -2482,11 +2458,15 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 135 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 135 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 135 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 135 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 135 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2535,12 +2515,6 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 135 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 135 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 135 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 135 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2570,7 +2544,7 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
 #line 135 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 135 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 135 "sample/undocked/tail_call_sequential.c"
@@ -2674,11 +2648,15 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 153 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 153 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 153 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 153 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 153 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2730,12 +2708,6 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 153 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 153 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 153 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 153 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2765,7 +2737,7 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
 #line 153 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 153 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 153 "sample/undocked/tail_call_sequential.c"
@@ -2869,11 +2841,15 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 154 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 154 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 154 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 154 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 154 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2925,12 +2901,6 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 154 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 154 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 154 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 154 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2960,7 +2930,7 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
 #line 154 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 154 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 154 "sample/undocked/tail_call_sequential.c"
@@ -3064,11 +3034,15 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 155 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 155 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 155 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 155 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 155 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3120,12 +3094,6 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 155 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 155 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 155 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 155 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3155,7 +3123,7 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
 #line 155 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 155 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 155 "sample/undocked/tail_call_sequential.c"
@@ -3259,11 +3227,15 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 156 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 156 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 156 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 156 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 156 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3315,12 +3287,6 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 156 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 156 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 156 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 156 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3350,7 +3316,7 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
 #line 156 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 156 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 156 "sample/undocked/tail_call_sequential.c"
@@ -3454,11 +3420,15 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 157 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 157 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 157 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 157 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 157 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3513,12 +3483,6 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=26 dst=r0 src=r0 offset=0 imm=13
 #line 157 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 157 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 157 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=27 dst=r1 src=r8 offset=0 imm=0
 #line 157 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3545,7 +3509,7 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
 #line 157 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 157 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 157 "sample/undocked/tail_call_sequential.c"
@@ -3649,11 +3613,15 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 158 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 158 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 158 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 158 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 158 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3705,12 +3673,6 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 158 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 158 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 158 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 158 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3740,7 +3702,7 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
 #line 158 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 158 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 158 "sample/undocked/tail_call_sequential.c"
@@ -3844,11 +3806,15 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 159 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 159 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 159 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 159 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 159 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3900,12 +3866,6 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 159 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 159 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 159 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 159 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3935,7 +3895,7 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
 #line 159 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 159 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 159 "sample/undocked/tail_call_sequential.c"
@@ -4039,11 +3999,15 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 160 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 160 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 160 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 160 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 160 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4095,12 +4059,6 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 160 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 160 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 160 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 160 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4130,7 +4088,7 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
 #line 160 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 160 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 160 "sample/undocked/tail_call_sequential.c"
@@ -4234,11 +4192,15 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 161 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 161 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 161 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 161 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 161 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4290,12 +4252,6 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 161 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 161 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 161 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 161 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4325,7 +4281,7 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
 #line 161 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 161 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 161 "sample/undocked/tail_call_sequential.c"
@@ -4429,11 +4385,15 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 162 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 162 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 162 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 162 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 162 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4485,12 +4445,6 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 162 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 162 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 162 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 162 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4520,7 +4474,7 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
 #line 162 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 162 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 162 "sample/undocked/tail_call_sequential.c"
@@ -4622,11 +4576,15 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 136 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 136 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 136 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 136 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 136 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4675,12 +4633,6 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 136 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 136 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 136 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 136 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4710,7 +4662,7 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
 #line 136 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 136 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 136 "sample/undocked/tail_call_sequential.c"
@@ -4814,11 +4766,15 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 163 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 163 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 163 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 163 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 163 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4870,12 +4826,6 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 163 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 163 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 163 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 163 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4905,7 +4855,7 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
 #line 163 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 163 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 163 "sample/undocked/tail_call_sequential.c"
@@ -5009,11 +4959,15 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 164 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 164 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 164 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 164 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 164 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5065,12 +5019,6 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 164 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 164 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 164 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 164 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5100,7 +5048,7 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
 #line 164 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 164 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 164 "sample/undocked/tail_call_sequential.c"
@@ -5204,11 +5152,15 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 165 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 165 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 165 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 165 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 165 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5260,12 +5212,6 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 165 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 165 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 165 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 165 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5295,7 +5241,7 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
 #line 165 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 165 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 165 "sample/undocked/tail_call_sequential.c"
@@ -5399,11 +5345,15 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 166 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 166 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 166 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 166 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 166 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5455,12 +5405,6 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 166 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 166 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 166 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 166 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5490,7 +5434,7 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
 #line 166 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 166 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 166 "sample/undocked/tail_call_sequential.c"
@@ -5594,11 +5538,15 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 167 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 167 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 167 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 167 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 167 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5650,12 +5598,6 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 167 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 167 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 167 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 167 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5685,7 +5627,7 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
 #line 167 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 167 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 167 "sample/undocked/tail_call_sequential.c"
@@ -5787,11 +5729,15 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 137 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 137 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 137 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 137 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 137 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5840,12 +5786,6 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 137 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 137 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 137 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 137 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5875,7 +5815,7 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
 #line 137 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 137 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 137 "sample/undocked/tail_call_sequential.c"
@@ -5977,11 +5917,15 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 138 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 138 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 138 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 138 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 138 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6030,12 +5974,6 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 138 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 138 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 138 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 138 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6065,7 +6003,7 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
 #line 138 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 138 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 138 "sample/undocked/tail_call_sequential.c"
@@ -6167,11 +6105,15 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 139 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 139 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 139 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 139 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 139 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6220,12 +6162,6 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 139 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 139 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 139 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 139 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6255,7 +6191,7 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
 #line 139 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 139 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 139 "sample/undocked/tail_call_sequential.c"
@@ -6357,11 +6293,15 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 140 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 140 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 140 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 140 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 140 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6410,12 +6350,6 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 140 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 140 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 140 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 140 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6445,7 +6379,7 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
 #line 140 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 140 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 140 "sample/undocked/tail_call_sequential.c"
@@ -6547,11 +6481,15 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 141 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 141 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 141 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 141 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 141 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6600,12 +6538,6 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 141 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 141 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 141 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 141 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6635,7 +6567,7 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
 #line 141 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 141 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 141 "sample/undocked/tail_call_sequential.c"
@@ -6737,11 +6669,15 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 142 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 142 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 142 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 142 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 142 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6790,12 +6726,6 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 142 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 142 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 142 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 142 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6825,7 +6755,7 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
 #line 142 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 142 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 142 "sample/undocked/tail_call_sequential.c"
@@ -307,11 +307,15 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 133 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 133 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 133 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 133 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 133 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -360,12 +364,6 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 133 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 133 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 133 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 133 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -395,7 +393,7 @@ sequential0(void* context, const program_runtime_context_t* runtime_context)
 #line 133 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 133 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 133 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 133 "sample/undocked/tail_call_sequential.c"
@@ -497,11 +495,15 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 134 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 134 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 134 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 134 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 134 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -550,12 +552,6 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 134 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 134 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 134 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 134 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -585,7 +581,7 @@ sequential1(void* context, const program_runtime_context_t* runtime_context)
 #line 134 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 134 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 134 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 134 "sample/undocked/tail_call_sequential.c"
@@ -689,11 +685,15 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 143 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 143 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 143 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 143 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 143 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -745,12 +745,6 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 143 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 143 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 143 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 143 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -780,7 +774,7 @@ sequential10(void* context, const program_runtime_context_t* runtime_context)
 #line 143 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 143 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 143 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 143 "sample/undocked/tail_call_sequential.c"
@@ -884,11 +878,15 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 144 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 144 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 144 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 144 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 144 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -940,12 +938,6 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 144 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 144 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 144 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 144 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -975,7 +967,7 @@ sequential11(void* context, const program_runtime_context_t* runtime_context)
 #line 144 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 144 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 144 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 144 "sample/undocked/tail_call_sequential.c"
@@ -1079,11 +1071,15 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 145 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 145 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 145 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 145 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 145 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1135,12 +1131,6 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 145 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 145 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 145 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 145 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1170,7 +1160,7 @@ sequential12(void* context, const program_runtime_context_t* runtime_context)
 #line 145 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 145 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 145 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 145 "sample/undocked/tail_call_sequential.c"
@@ -1274,11 +1264,15 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 146 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 146 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 146 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 146 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 146 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1330,12 +1324,6 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 146 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 146 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 146 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 146 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1365,7 +1353,7 @@ sequential13(void* context, const program_runtime_context_t* runtime_context)
 #line 146 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 146 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 146 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 146 "sample/undocked/tail_call_sequential.c"
@@ -1469,11 +1457,15 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 147 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 147 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 147 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 147 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 147 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1525,12 +1517,6 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 147 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 147 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 147 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 147 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1560,7 +1546,7 @@ sequential14(void* context, const program_runtime_context_t* runtime_context)
 #line 147 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 147 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 147 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 147 "sample/undocked/tail_call_sequential.c"
@@ -1664,11 +1650,15 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 148 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 148 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 148 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 148 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 148 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1720,12 +1710,6 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 148 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 148 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 148 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 148 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1755,7 +1739,7 @@ sequential15(void* context, const program_runtime_context_t* runtime_context)
 #line 148 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 148 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 148 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 148 "sample/undocked/tail_call_sequential.c"
@@ -1859,11 +1843,15 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 149 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 149 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 149 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 149 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 149 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -1915,12 +1903,6 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 149 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 149 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 149 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 149 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -1950,7 +1932,7 @@ sequential16(void* context, const program_runtime_context_t* runtime_context)
 #line 149 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 149 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 149 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 149 "sample/undocked/tail_call_sequential.c"
@@ -2054,11 +2036,15 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 150 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 150 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 150 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 150 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 150 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2110,12 +2096,6 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 150 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 150 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 150 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 150 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2145,7 +2125,7 @@ sequential17(void* context, const program_runtime_context_t* runtime_context)
 #line 150 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 150 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 150 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 150 "sample/undocked/tail_call_sequential.c"
@@ -2249,11 +2229,15 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 151 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 151 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 151 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 151 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 151 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2305,12 +2289,6 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 151 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 151 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 151 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 151 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2340,7 +2318,7 @@ sequential18(void* context, const program_runtime_context_t* runtime_context)
 #line 151 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 151 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 151 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 151 "sample/undocked/tail_call_sequential.c"
@@ -2444,11 +2422,15 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 152 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 152 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 152 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 152 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 152 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2500,12 +2482,6 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 152 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 152 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 152 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 152 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2535,7 +2511,7 @@ sequential19(void* context, const program_runtime_context_t* runtime_context)
 #line 152 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 152 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 152 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 152 "sample/undocked/tail_call_sequential.c"
@@ -2637,11 +2613,15 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 135 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 135 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 135 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 135 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 135 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2690,12 +2670,6 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 135 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 135 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 135 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 135 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2725,7 +2699,7 @@ sequential2(void* context, const program_runtime_context_t* runtime_context)
 #line 135 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 135 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 135 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 135 "sample/undocked/tail_call_sequential.c"
@@ -2829,11 +2803,15 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 153 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 153 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 153 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 153 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 153 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -2885,12 +2863,6 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 153 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 153 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 153 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 153 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -2920,7 +2892,7 @@ sequential20(void* context, const program_runtime_context_t* runtime_context)
 #line 153 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 153 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 153 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 153 "sample/undocked/tail_call_sequential.c"
@@ -3024,11 +2996,15 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 154 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 154 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 154 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 154 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 154 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3080,12 +3056,6 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 154 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 154 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 154 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 154 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3115,7 +3085,7 @@ sequential21(void* context, const program_runtime_context_t* runtime_context)
 #line 154 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 154 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 154 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 154 "sample/undocked/tail_call_sequential.c"
@@ -3219,11 +3189,15 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 155 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 155 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 155 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 155 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 155 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3275,12 +3249,6 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 155 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 155 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 155 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 155 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3310,7 +3278,7 @@ sequential22(void* context, const program_runtime_context_t* runtime_context)
 #line 155 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 155 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 155 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 155 "sample/undocked/tail_call_sequential.c"
@@ -3414,11 +3382,15 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 156 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 156 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 156 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 156 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 156 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3470,12 +3442,6 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 156 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 156 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 156 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 156 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3505,7 +3471,7 @@ sequential23(void* context, const program_runtime_context_t* runtime_context)
 #line 156 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 156 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 156 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 156 "sample/undocked/tail_call_sequential.c"
@@ -3609,11 +3575,15 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 157 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 157 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 157 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 157 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 157 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3668,12 +3638,6 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=26 dst=r0 src=r0 offset=0 imm=13
 #line 157 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 157 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 157 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=27 dst=r1 src=r8 offset=0 imm=0
 #line 157 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3700,7 +3664,7 @@ sequential24(void* context, const program_runtime_context_t* runtime_context)
 #line 157 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 157 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 157 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 157 "sample/undocked/tail_call_sequential.c"
@@ -3804,11 +3768,15 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 158 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 158 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 158 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 158 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 158 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -3860,12 +3828,6 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 158 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 158 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 158 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 158 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -3895,7 +3857,7 @@ sequential25(void* context, const program_runtime_context_t* runtime_context)
 #line 158 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 158 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 158 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 158 "sample/undocked/tail_call_sequential.c"
@@ -3999,11 +3961,15 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 159 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 159 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 159 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 159 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 159 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4055,12 +4021,6 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 159 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 159 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 159 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 159 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4090,7 +4050,7 @@ sequential26(void* context, const program_runtime_context_t* runtime_context)
 #line 159 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 159 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 159 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 159 "sample/undocked/tail_call_sequential.c"
@@ -4194,11 +4154,15 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 160 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 160 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 160 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 160 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 160 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4250,12 +4214,6 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 160 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 160 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 160 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 160 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4285,7 +4243,7 @@ sequential27(void* context, const program_runtime_context_t* runtime_context)
 #line 160 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 160 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 160 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 160 "sample/undocked/tail_call_sequential.c"
@@ -4389,11 +4347,15 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 161 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 161 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 161 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 161 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 161 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4445,12 +4407,6 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 161 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 161 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 161 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 161 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4480,7 +4436,7 @@ sequential28(void* context, const program_runtime_context_t* runtime_context)
 #line 161 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 161 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 161 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 161 "sample/undocked/tail_call_sequential.c"
@@ -4584,11 +4540,15 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 162 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 162 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 162 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 162 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 162 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4640,12 +4600,6 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 162 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 162 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 162 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 162 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4675,7 +4629,7 @@ sequential29(void* context, const program_runtime_context_t* runtime_context)
 #line 162 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 162 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 162 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 162 "sample/undocked/tail_call_sequential.c"
@@ -4777,11 +4731,15 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 136 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 136 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 136 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 136 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 136 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -4830,12 +4788,6 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 136 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 136 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 136 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 136 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -4865,7 +4817,7 @@ sequential3(void* context, const program_runtime_context_t* runtime_context)
 #line 136 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 136 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 136 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 136 "sample/undocked/tail_call_sequential.c"
@@ -4969,11 +4921,15 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 163 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 163 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 163 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 163 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 163 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5025,12 +4981,6 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 163 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 163 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 163 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 163 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5060,7 +5010,7 @@ sequential30(void* context, const program_runtime_context_t* runtime_context)
 #line 163 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 163 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 163 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 163 "sample/undocked/tail_call_sequential.c"
@@ -5164,11 +5114,15 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 164 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 164 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 164 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 164 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 164 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5220,12 +5174,6 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 164 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 164 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 164 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 164 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5255,7 +5203,7 @@ sequential31(void* context, const program_runtime_context_t* runtime_context)
 #line 164 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 164 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 164 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 164 "sample/undocked/tail_call_sequential.c"
@@ -5359,11 +5307,15 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 165 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 165 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 165 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 165 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 165 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5415,12 +5367,6 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 165 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 165 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 165 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 165 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5450,7 +5396,7 @@ sequential32(void* context, const program_runtime_context_t* runtime_context)
 #line 165 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 165 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 165 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 165 "sample/undocked/tail_call_sequential.c"
@@ -5554,11 +5500,15 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 166 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 166 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 166 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 166 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 166 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5610,12 +5560,6 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 166 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 166 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 166 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 166 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5645,7 +5589,7 @@ sequential33(void* context, const program_runtime_context_t* runtime_context)
 #line 166 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 166 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 166 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 166 "sample/undocked/tail_call_sequential.c"
@@ -5749,11 +5693,15 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 167 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 167 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 167 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 167 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 167 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5805,12 +5753,6 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=25 dst=r0 src=r0 offset=0 imm=13
 #line 167 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 167 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 167 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=26 dst=r1 src=r8 offset=0 imm=0
 #line 167 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -5840,7 +5782,7 @@ sequential34(void* context, const program_runtime_context_t* runtime_context)
 #line 167 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 167 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 167 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 167 "sample/undocked/tail_call_sequential.c"
@@ -5942,11 +5884,15 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 137 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 137 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 137 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 137 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 137 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -5995,12 +5941,6 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 137 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 137 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 137 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 137 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6030,7 +5970,7 @@ sequential4(void* context, const program_runtime_context_t* runtime_context)
 #line 137 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 137 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 137 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 137 "sample/undocked/tail_call_sequential.c"
@@ -6132,11 +6072,15 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 138 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 138 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 138 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 138 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 138 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6185,12 +6129,6 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 138 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 138 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 138 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 138 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6220,7 +6158,7 @@ sequential5(void* context, const program_runtime_context_t* runtime_context)
 #line 138 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 138 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 138 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 138 "sample/undocked/tail_call_sequential.c"
@@ -6322,11 +6260,15 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 139 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 139 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 139 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 139 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 139 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6375,12 +6317,6 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 139 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 139 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 139 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 139 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6410,7 +6346,7 @@ sequential6(void* context, const program_runtime_context_t* runtime_context)
 #line 139 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 139 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 139 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 139 "sample/undocked/tail_call_sequential.c"
@@ -6512,11 +6448,15 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 140 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 140 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 140 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 140 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 140 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6565,12 +6505,6 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 140 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 140 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 140 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 140 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6600,7 +6534,7 @@ sequential7(void* context, const program_runtime_context_t* runtime_context)
 #line 140 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 140 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 140 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 140 "sample/undocked/tail_call_sequential.c"
@@ -6702,11 +6636,15 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 141 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 141 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 141 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 141 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 141 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6755,12 +6693,6 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 141 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 141 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 141 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 141 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6790,7 +6722,7 @@ sequential8(void* context, const program_runtime_context_t* runtime_context)
 #line 141 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 141 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 141 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 141 "sample/undocked/tail_call_sequential.c"
@@ -6892,11 +6824,15 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
     r1 = POINTER(runtime_context->map_data[1].address);
     // EBPF_OP_CALL pc=7 dst=r0 src=r0 offset=0 imm=1
 #line 142 "sample/undocked/tail_call_sequential.c"
-    r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
+    r0 = *(uint32_t*)(uintptr_t)r2;
 #line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
+    if (r0 < 1) {
 #line 142 "sample/undocked/tail_call_sequential.c"
-        return 0;
+        r0 = POINTER(runtime_context->map_value_data[1].address + r0 * 4);
+#line 142 "sample/undocked/tail_call_sequential.c"
+    } else {
+#line 142 "sample/undocked/tail_call_sequential.c"
+        r0 = 0;
 #line 142 "sample/undocked/tail_call_sequential.c"
     }
     // EBPF_OP_MOV64_REG pc=8 dst=r8 src=r0 offset=0 imm=0
@@ -6945,12 +6881,6 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
     // EBPF_OP_CALL pc=24 dst=r0 src=r0 offset=0 imm=13
 #line 142 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 142 "sample/undocked/tail_call_sequential.c"
-        return 0;
-#line 142 "sample/undocked/tail_call_sequential.c"
-    }
     // EBPF_OP_LDXW pc=25 dst=r1 src=r8 offset=0 imm=0
 #line 142 "sample/undocked/tail_call_sequential.c"
     r1 = *(uint32_t*)(uintptr_t)(r8 + OFFSET(0));
@@ -6980,7 +6910,7 @@ sequential9(void* context, const program_runtime_context_t* runtime_context)
 #line 142 "sample/undocked/tail_call_sequential.c"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
 #line 142 "sample/undocked/tail_call_sequential.c"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
+    if (r0 == 0) {
 #line 142 "sample/undocked/tail_call_sequential.c"
         return 0;
 #line 142 "sample/undocked/tail_call_sequential.c"
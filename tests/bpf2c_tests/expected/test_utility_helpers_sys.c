@@ -313,84 +313,42 @@ test_utility_helpers(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=8 dst=r0 src=r0 offset=0 imm=6
 #line 16 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 16 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 16 "sample/./sample_common_routines.h"
-        return 0;
-#line 16 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXW pc=9 dst=r10 src=r0 offset=-64 imm=0
 #line 16 "sample/./sample_common_routines.h"
     *(uint32_t*)(uintptr_t)(r10 + OFFSET(-64)) = (uint32_t)r0;
     // EBPF_OP_CALL pc=10 dst=r0 src=r0 offset=0 imm=7
 #line 24 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 24 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 24 "sample/./sample_common_routines.h"
-        return 0;
-#line 24 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=11 dst=r10 src=r0 offset=-48 imm=0
 #line 24 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-48)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=12 dst=r0 src=r0 offset=0 imm=9
 #line 27 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 27 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 27 "sample/./sample_common_routines.h"
-        return 0;
-#line 27 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=13 dst=r10 src=r0 offset=-56 imm=0
 #line 27 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-56)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=14 dst=r0 src=r0 offset=0 imm=8
 #line 30 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[3].address(r1, r2, r3, r4, r5, context);
-#line 30 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[3].tail_call) && (r0 == 0)) {
-#line 30 "sample/./sample_common_routines.h"
-        return 0;
-#line 30 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXW pc=15 dst=r10 src=r0 offset=-40 imm=0
 #line 30 "sample/./sample_common_routines.h"
     *(uint32_t*)(uintptr_t)(r10 + OFFSET(-40)) = (uint32_t)r0;
     // EBPF_OP_CALL pc=16 dst=r0 src=r0 offset=0 imm=19
 #line 33 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 33 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 33 "sample/./sample_common_routines.h"
-        return 0;
-#line 33 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=17 dst=r10 src=r0 offset=-32 imm=0
 #line 33 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-32)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=18 dst=r0 src=r0 offset=0 imm=30
 #line 36 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 36 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 36 "sample/./sample_common_routines.h"
-        return 0;
-#line 36 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=19 dst=r10 src=r0 offset=-24 imm=0
 #line 36 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-24)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=20 dst=r0 src=r0 offset=0 imm=31
 #line 39 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 39 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 39 "sample/./sample_common_routines.h"
-        return 0;
-#line 39 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=21 dst=r10 src=r0 offset=-16 imm=0
 #line 39 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-16)) = (uint64_t)r0;
@@ -418,81 +376,39 @@ test_utility_helpers(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=30 dst=r0 src=r0 offset=0 imm=2
 #line 42 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 42 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 42 "sample/./sample_common_routines.h"
-        return 0;
-#line 42 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_CALL pc=31 dst=r0 src=r0 offset=0 imm=6
 #line 45 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[0].address(r1, r2, r3, r4, r5, context);
-#line 45 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[0].tail_call) && (r0 == 0)) {
-#line 45 "sample/./sample_common_routines.h"
-        return 0;
-#line 45 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXW pc=32 dst=r10 src=r0 offset=-64 imm=0
 #line 45 "sample/./sample_common_routines.h"
     *(uint32_t*)(uintptr_t)(r10 + OFFSET(-64)) = (uint32_t)r0;
     // EBPF_OP_CALL pc=33 dst=r0 src=r0 offset=0 imm=9
 #line 48 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[2].address(r1, r2, r3, r4, r5, context);
-#line 48 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[2].tail_call) && (r0 == 0)) {
-#line 48 "sample/./sample_common_routines.h"
-        return 0;
-#line 48 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=34 dst=r10 src=r0 offset=-56 imm=0
 #line 48 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-56)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=35 dst=r0 src=r0 offset=0 imm=7
 #line 51 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[1].address(r1, r2, r3, r4, r5, context);
-#line 51 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[1].tail_call) && (r0 == 0)) {
-#line 51 "sample/./sample_common_routines.h"
-        return 0;
-#line 51 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=36 dst=r10 src=r0 offset=-48 imm=0
 #line 51 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-48)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=37 dst=r0 src=r0 offset=0 imm=19
 #line 54 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[4].address(r1, r2, r3, r4, r5, context);
-#line 54 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[4].tail_call) && (r0 == 0)) {
-#line 54 "sample/./sample_common_routines.h"
-        return 0;
-#line 54 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=38 dst=r10 src=r0 offset=-32 imm=0
 #line 54 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-32)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=39 dst=r0 src=r0 offset=0 imm=30
 #line 57 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[5].address(r1, r2, r3, r4, r5, context);
-#line 57 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[5].tail_call) && (r0 == 0)) {
-#line 57 "sample/./sample_common_routines.h"
-        return 0;
-#line 57 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=40 dst=r10 src=r0 offset=-24 imm=0
 #line 57 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-24)) = (uint64_t)r0;
     // EBPF_OP_CALL pc=41 dst=r0 src=r0 offset=0 imm=31
 #line 60 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[6].address(r1, r2, r3, r4, r5, context);
-#line 60 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[6].tail_call) && (r0 == 0)) {
-#line 60 "sample/./sample_common_routines.h"
-        return 0;
-#line 60 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_STXDW pc=42 dst=r10 src=r0 offset=-16 imm=0
 #line 60 "sample/./sample_common_routines.h"
     *(uint64_t*)(uintptr_t)(r10 + OFFSET(-16)) = (uint64_t)r0;
@@ -514,12 +430,6 @@ test_utility_helpers(void* context, const program_runtime_context_t* runtime_con
     // EBPF_OP_CALL pc=49 dst=r0 src=r0 offset=0 imm=2
 #line 63 "sample/./sample_common_routines.h"
     r0 = runtime_context->helper_data[7].address(r1, r2, r3, r4, r5, context);
-#line 63 "sample/./sample_common_routines.h"
-    if ((runtime_context->helper_data[7].tail_call) && (r0 == 0)) {
-#line 63 "sample/./sample_common_routines.h"
-        return 0;
-#line 63 "sample/./sample_common_routines.h"
-    }
     // EBPF_OP_MOV64_IMM pc=50 dst=r0 src=r0 offset=0 imm=0
 #line 35 "sample/undocked/test_utility_helpers.c"
     r0 = IMMEDIATE(0);
@@ -21,8 +21,12 @@
 #include "socket_tests_common.h"
 #include "watchdog.h"
 
+#include <atomic>
+#include <chrono>
 #include <mstcpip.h>
 #include <ntsecapi.h>
+#include <thread>
+#include <vector>
 
 thread_local bool _is_main_thread = false;
 
@@ -825,6 +829,68 @@ DECLARE_CONNECTION_REDIRECTION_V6_TEST_GROUP(
 // Dual stack socket, IPv6, CONNECTED_UDP
 DECLARE_CONNECTION_REDIRECTION_V6_TEST_GROUP("dual_ipv6", socket_family_t::IPv6, true, connection_type_t::CONNECTED_UDP)
 
+#define BLOCKED_CONNECT_STORM_CONNECTS_PER_THREAD 20000
+
+/**
+ * @brief Issue blocked TCP connects to the loopback address from multiple threads.
+ *
+ * Every connect is rejected by the connect_redirect program, so each one adds a blocked connection context at the
+ * connect_redirect layer and removes it again at the AUTH_CONNECT layer.
+ *
+ * @param[in] thread_count Number of threads issuing connects.
+ * @param[in] connects_per_thread Number of connects issued by each thread.
+ *
+ * @return Number of connects per second.
+ */
+static double
+_blocked_connect_storm(uint32_t thread_count, uint32_t connects_per_thread)
+{
+    std::atomic<uint32_t> blocked_count = 0;
+    std::vector<std::thread> threads;
+    sockaddr_storage destination = _globals.addresses[socket_family_t::IPv4].loopback_address;
+    INETADDR_SET_PORT((PSOCKADDR)&destination, htons(_globals.destination_port));
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads.emplace_back([&]() {
+            for (uint32_t j = 0; j < connects_per_thread; j++) {
+                SOCKET socket_handle = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+                if (socket_handle == INVALID_SOCKET) {
+                    continue;
+                }
+                if (connect(socket_handle, (PSOCKADDR)&destination, sizeof(sockaddr_in)) == SOCKET_ERROR) {
+                    blocked_count++;
+                }
+                closesocket(socket_handle);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    SAFE_REQUIRE(blocked_count == thread_count * connects_per_thread);
+    return (thread_count * connects_per_thread) / elapsed.count();
+}
+
+TEST_CASE("blocked_connect_storm", "[connect_redirect_stress_tests]")
+{
+    _initialize_test_globals();
+    if (!_globals.attach_v4_program) {
+        printf("Skipping test: IPv4 addresses not specified.\n");
+        return;
+    }
+
+    uint32_t maximum_thread_count = std::thread::hardware_concurrency();
+    double single_thread_rate = _blocked_connect_storm(1, BLOCKED_CONNECT_STORM_CONNECTS_PER_THREAD);
+    printf("blocked_connect_storm,1,%.0f connects/sec\n", single_thread_rate);
+    for (uint32_t thread_count = 2; thread_count <= maximum_thread_count; thread_count *= 2) {
+        double rate = _blocked_connect_storm(thread_count, BLOCKED_CONNECT_STORM_CONNECTS_PER_THREAD);
+        printf("blocked_connect_storm,%u,%.0f connects/sec (%.2fx)\n", thread_count, rate, rate / single_thread_rate);
+    }
+}
+
 int
 main(int argc, char* argv[])
 {
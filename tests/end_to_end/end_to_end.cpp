@@ -36,6 +36,7 @@ namespace ebpf {
 #include <array>
 #include <cguid.h>
 #include <chrono>
+#include <fstream>
 #include <lsalookup.h>
 #include <mutex>
 #define _NTDEF_ // UNICODE_STRING is already defined
@@ -1349,6 +1350,133 @@ TEST_CASE("verify program", "[end_to_end]")
     ebpf_free_string(report);
 }
 
+TEST_CASE("verify programs concurrently", "[end_to_end]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    program_info_provider_t sample_test_program_info;
+    REQUIRE(sample_test_program_info.initialize(EBPF_PROGRAM_TYPE_SAMPLE) == EBPF_SUCCESS);
+
+    std::ifstream file(SAMPLE_PATH "test_sample_ebpf.o", std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    REQUIRE(!data.empty());
+
+    const char* error_message = nullptr;
+    ebpf_api_program_info_t* program_data = nullptr;
+    REQUIRE(ebpf_enumerate_programs(SAMPLE_PATH "test_sample_ebpf.o", false, &program_data, &error_message) == 0);
+    ebpf_free_string(error_message);
+    error_message = nullptr;
+
+    // Verify every program several times, with a missing program in the middle, so that results from different
+    // threads have to land in the right entries.
+    std::vector<ebpf_api_program_verification_t> verifications;
+    for (size_t round = 0; round < 4; round++) {
+        for (auto program = program_data; program != nullptr; program = program->next) {
+            ebpf_api_program_verification_t verification = {};
+            verification.section_name = program->section_name;
+            verification.program_name = program->program_name;
+            verifications.push_back(verification);
+        }
+        if (round == 1) {
+            ebpf_api_program_verification_t verification = {};
+            verification.section_name = program_data->section_name;
+            verification.program_name = "no_such_program";
+            verifications.push_back(verification);
+        }
+    }
+
+    REQUIRE(
+        ebpf_api_elf_verify_programs_from_memory(
+            data.c_str(),
+            data.size(),
+            EBPF_VERIFICATION_VERBOSITY_NORMAL,
+            4,
+            verifications.size(),
+            verifications.data()) == EBPF_VERIFICATION_FAILED);
+
+    for (auto& verification : verifications) {
+        if (strcmp(verification.program_name, "no_such_program") == 0) {
+            REQUIRE(verification.result == 1);
+            REQUIRE(verification.program_info == nullptr);
+            REQUIRE(std::string(verification.error_message) == "error: No such program no_such_program");
+            continue;
+        }
+
+        // Each entry must match what verifying the program on its own produces.
+        const char* report = nullptr;
+        ebpf_api_verifier_stats_t stats;
+        REQUIRE(
+            ebpf_api_elf_verify_program_from_memory(
+                data.c_str(),
+                data.size(),
+                verification.section_name,
+                verification.program_name,
+                nullptr,
+                EBPF_VERIFICATION_VERBOSITY_NORMAL,
+                &report,
+                &error_message,
+                &stats) == 0);
+        REQUIRE(verification.result == 0);
+        REQUIRE(verification.error_message == nullptr);
+        REQUIRE(verification.program_info != nullptr);
+        REQUIRE(std::string(verification.report) == std::string(report));
+        REQUIRE(verification.stats.max_loop_count == stats.max_loop_count);
+        ebpf_free_string(report);
+        ebpf_free_string(error_message);
+        error_message = nullptr;
+    }
+
+    ebpf_api_free_program_verifications(verifications.size(), verifications.data());
+    ebpf_free_programs(program_data);
+}
+
+#if !defined(CONFIG_BPF_JIT_DISABLED)
+TEST_CASE("verification cache", "[end_to_end]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    program_info_provider_t xdp_program_info;
+    REQUIRE(xdp_program_info.initialize(EBPF_PROGRAM_TYPE_XDP) == EBPF_SUCCESS);
+
+    ebpf_verification_cache_invalidate(nullptr);
+    REQUIRE(ebpf_verification_cache_get_count() == 0);
+
+    auto load = [](_Out_ bpf_object_ptr* unique_object) {
+        fd_t program_fd;
+        const char* error_message = nullptr;
+        int result = ebpf_program_load(
+            "droppacket.o", BPF_PROG_TYPE_UNSPEC, EBPF_EXECUTION_JIT, unique_object, &program_fd, &error_message);
+        if (error_message) {
+            printf("ebpf_program_load failed with %s\n", error_message);
+            ebpf_free((void*)error_message);
+        }
+        REQUIRE(result == 0);
+    };
+
+    // The second load uses different map file descriptors, which must not prevent it from hitting the cache.
+    bpf_object_ptr first_object;
+    load(&first_object);
+    REQUIRE(ebpf_verification_cache_get_count() == 1);
+
+    bpf_object_ptr second_object;
+    load(&second_object);
+    REQUIRE(ebpf_verification_cache_get_count() == 1);
+
+    // Results for other program types are not affected by invalidation.
+    ebpf_verification_cache_invalidate(&EBPF_PROGRAM_TYPE_SAMPLE);
+    REQUIRE(ebpf_verification_cache_get_count() == 1);
+
+    ebpf_verification_cache_invalidate(&EBPF_PROGRAM_TYPE_XDP);
+    REQUIRE(ebpf_verification_cache_get_count() == 0);
+
+    bpf_object_ptr third_object;
+    load(&third_object);
+    REQUIRE(ebpf_verification_cache_get_count() == 1);
+}
+#endif
+
 TEST_CASE("verify program with invalid program type", "[end_to_end]")
 {
     _test_helper_end_to_end test_helper;
@@ -3407,6 +3535,93 @@ TEST_CASE("native_module_handle_test_negative", "[end-to-end]")
     Platform::_close(module_fd);
 }
 
+static void
+_test_instantiate_native_module(size_t handle_capacity)
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    GUID provider_module_id;
+    SC_HANDLE service_handle = nullptr;
+    std::wstring service_path(SERVICE_PATH_PREFIX);
+    _test_handle_helper module_handle;
+    bool programs_loaded;
+    std::vector<ebpf_handle_t> map_handles;
+    std::vector<ebpf_handle_t> program_handles;
+
+    program_info_provider_t sample_program_info;
+    REQUIRE(sample_program_info.initialize(EBPF_PROGRAM_TYPE_SAMPLE) == EBPF_SUCCESS);
+
+    REQUIRE(UuidCreate(&provider_module_id) == RPC_S_OK);
+
+    // Create a valid service with valid driver.
+    _create_service_helper(
+        L"test_sample_ebpf_um.dll", NATIVE_DRIVER_SERVICE_NAME, &provider_module_id, &service_handle);
+
+    REQUIRE(ebpf_authorize_native_module_wrapper(&provider_module_id, "test_sample_ebpf_um.dll") == EBPF_SUCCESS);
+
+    // Load the module, its maps and its programs in one request.
+    service_path = service_path + NATIVE_DRIVER_SERVICE_NAME;
+    REQUIRE(
+        test_ioctl_instantiate_native_module(
+            service_path,
+            &provider_module_id,
+            handle_capacity,
+            module_handle.get_handle_pointer(),
+            &programs_loaded,
+            &map_handles,
+            &program_handles) == ERROR_SUCCESS);
+    REQUIRE(map_handles.size() == 2);
+    REQUIRE(program_handles.size() == 1);
+
+    if (handle_capacity < map_handles.size() + program_handles.size()) {
+        // The handles don't fit in the reply, so only the module is loaded.
+        REQUIRE(!programs_loaded);
+        REQUIRE(
+            test_ioctl_load_native_programs(
+                &provider_module_id,
+                map_handles.size(),
+                map_handles.data(),
+                program_handles.size(),
+                program_handles.data()) == ERROR_SUCCESS);
+    } else {
+        REQUIRE(programs_loaded);
+    }
+
+    // The maps and programs can only be created once.
+    std::vector<ebpf_handle_t> handles(map_handles.size() + program_handles.size());
+    REQUIRE(
+        test_ioctl_load_native_programs(
+            &provider_module_id,
+            map_handles.size(),
+            handles.data(),
+            program_handles.size(),
+            handles.data() + map_handles.size()) == ERROR_OBJECT_ALREADY_EXISTS);
+
+    for (ebpf_handle_t handle : program_handles) {
+        fd_t fd = Platform::_open_osfhandle(handle, 0);
+        REQUIRE(fd != ebpf_fd_invalid);
+        bpf_prog_info program_info = {};
+        uint32_t program_info_size = sizeof(program_info);
+        REQUIRE(bpf_obj_get_info_by_fd(fd, &program_info, &program_info_size) == 0);
+        Platform::_close(fd);
+    }
+    for (ebpf_handle_t handle : map_handles) {
+        fd_t fd = Platform::_open_osfhandle(handle, 0);
+        REQUIRE(fd != ebpf_fd_invalid);
+        bpf_map_info map_info = {};
+        uint32_t map_info_size = sizeof(map_info);
+        REQUIRE(bpf_obj_get_info_by_fd(fd, &map_info, &map_info_size) == 0);
+        Platform::_close(fd);
+    }
+
+    Platform::_delete_service(service_handle);
+}
+
+TEST_CASE("instantiate_native_module", "[end-to-end]") { _test_instantiate_native_module(16); }
+
+TEST_CASE("instantiate_native_module_small_reply", "[end-to-end]") { _test_instantiate_native_module(0); }
+
 TEST_CASE("ebpf_get_program_type_by_name invalid name", "[end-to-end]")
 {
     _test_helper_end_to_end test_helper;
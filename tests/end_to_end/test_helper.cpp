@@ -414,7 +414,11 @@ _Requires_lock_not_held_(_service_path_to_context_mutex) static void _preprocess
     _In_ const ebpf_operation_header_t* user_request)
 {
     switch (user_request->id) {
-    case EBPF_OPERATION_LOAD_NATIVE_MODULE: {
+    case EBPF_OPERATION_LOAD_NATIVE_MODULE:
+    case EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE: {
+        static_assert(
+            offsetof(ebpf_operation_load_native_module_request_t, data) ==
+            offsetof(ebpf_operation_instantiate_native_module_request_t, data));
         try {
             const ebpf_operation_load_native_module_request_t* request =
                 (ebpf_operation_load_native_module_request_t*)user_request;
@@ -96,3 +96,60 @@ test_ioctl_load_native_programs(
 Done:
     return error;
 }
+
+uint32_t
+test_ioctl_instantiate_native_module(
+    _In_ const std::wstring& service_path,
+    _In_ const GUID* module_id,
+    size_t handle_capacity,
+    _Out_ ebpf_handle_t* module_handle,
+    _Out_ bool* programs_loaded,
+    _Out_ std::vector<ebpf_handle_t>* map_handles,
+    _Out_ std::vector<ebpf_handle_t>* program_handles)
+{
+    uint32_t error = ERROR_SUCCESS;
+    ebpf_protocol_buffer_t request_buffer;
+    ebpf_protocol_buffer_t reply_buffer;
+    ebpf_operation_instantiate_native_module_request_t* request;
+    ebpf_operation_instantiate_native_module_reply_t* reply;
+    size_t service_path_size = service_path.size() * 2;
+
+    *module_handle = ebpf_handle_invalid;
+    *programs_loaded = false;
+    map_handles->clear();
+    program_handles->clear();
+
+    request_buffer.resize(offsetof(ebpf_operation_instantiate_native_module_request_t, data) + service_path_size);
+    reply_buffer.resize(
+        offsetof(ebpf_operation_instantiate_native_module_reply_t, data) + handle_capacity * sizeof(ebpf_handle_t));
+
+    request = reinterpret_cast<ebpf_operation_instantiate_native_module_request_t*>(request_buffer.data());
+    request->header.id = EBPF_OPERATION_INSTANTIATE_NATIVE_MODULE;
+    request->header.length = static_cast<uint16_t>(request_buffer.size());
+    request->module_id = *module_id;
+    memcpy(
+        request_buffer.data() + offsetof(ebpf_operation_instantiate_native_module_request_t, data),
+        (char*)service_path.c_str(),
+        service_path_size);
+
+    error = invoke_ioctl(request_buffer, reply_buffer);
+    if (error != ERROR_SUCCESS) {
+        goto Done;
+    }
+
+    reply = reinterpret_cast<ebpf_operation_instantiate_native_module_reply_t*>(reply_buffer.data());
+    *module_handle = reply->native_module_handle;
+    *programs_loaded = reply->programs_loaded;
+    map_handles->resize(reply->count_of_maps, ebpf_handle_invalid);
+    program_handles->resize(reply->count_of_programs, ebpf_handle_invalid);
+
+    if (reply->programs_loaded) {
+        size_t map_handles_size = map_handles->size() * sizeof(ebpf_handle_t);
+        size_t program_handles_size = program_handles->size() * sizeof(ebpf_handle_t);
+        memcpy(map_handles->data(), reply->data, map_handles_size);
+        memcpy(program_handles->data(), reply->data + map_handles_size, program_handles_size);
+    }
+
+Done:
+    return error;
+}
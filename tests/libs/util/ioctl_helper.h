@@ -18,3 +18,13 @@ test_ioctl_load_native_programs(
     _Out_writes_(count_of_maps) ebpf_handle_t* map_handles,
     size_t count_of_programs,
     _Out_writes_(count_of_programs) ebpf_handle_t* program_handles);
+
+uint32_t
+test_ioctl_instantiate_native_module(
+    _In_ const std::wstring& service_path,
+    _In_ const GUID* module_id,
+    size_t handle_capacity,
+    _Out_ ebpf_handle_t* module_handle,
+    _Out_ bool* programs_loaded,
+    _Out_ std::vector<ebpf_handle_t>* map_handles,
+    _Out_ std::vector<ebpf_handle_t>* program_handles);
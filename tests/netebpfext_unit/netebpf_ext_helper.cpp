@@ -1,7 +1,9 @@
 // Copyright (c) eBPF for Windows contributors
 // SPDX-License-Identifier: MIT
 
+#include "net_ebpf_ext_hook_provider.h"
 #include "net_ebpf_ext_sock_addr.h"
+#include "net_ebpf_ext_xdp.h"
 #include "netebpf_ext_helper.h"
 
 DEVICE_OBJECT* _net_ebpf_ext_driver_device_object;
@@ -86,6 +88,7 @@ _netebpf_ext_helper::_netebpf_ext_helper(
     if (dispatch_function != nullptr && client_context != nullptr) {
         hook_client.ClientRegistrationInstance.NpiSpecificCharacteristics = npi_specific_characteristics;
         client_context->helper = this;
+        hook_client_context = client_context;
         nmr_hook_client_handle = std::make_unique<nmr_client_registration_t>(&hook_client, client_context);
     }
 
@@ -95,6 +98,8 @@ _netebpf_ext_helper::_netebpf_ext_helper(
 
 _netebpf_ext_helper::~_netebpf_ext_helper()
 {
+    additional_hook_client_handles.clear();
+
     if (nmr_hook_client_handle) {
         nmr_hook_client_handle.reset(nullptr);
     }
@@ -147,6 +152,102 @@ _netebpf_ext_helper::get_program_info_provider_data(_In_ const GUID& program_inf
     return nullptr;
 }
 
+void
+_netebpf_ext_helper::attach_hook_client(_Inout_ netebpfext_helper_base_client_context_t* client_context)
+{
+    client_context->helper = this;
+    if (client_context == hook_client_context) {
+        REQUIRE(!nmr_hook_client_handle);
+        nmr_hook_client_handle = std::make_unique<nmr_client_registration_t>(&hook_client, client_context);
+        REQUIRE(nmr_hook_client_handle->nmr_client_handle != INVALID_HANDLE_VALUE);
+        return;
+    }
+
+    auto& handle = additional_hook_client_handles[client_context];
+    REQUIRE(!handle);
+    handle = std::make_unique<nmr_client_registration_t>(&hook_client, client_context);
+    REQUIRE(handle->nmr_client_handle != INVALID_HANDLE_VALUE);
+}
+
+void
+_netebpf_ext_helper::detach_hook_client(_In_ const netebpfext_helper_base_client_context_t* client_context)
+{
+    if (client_context == hook_client_context) {
+        REQUIRE(nmr_hook_client_handle);
+        nmr_hook_client_handle.reset(nullptr);
+        return;
+    }
+
+    auto iter = additional_hook_client_handles.find(client_context);
+    REQUIRE(iter != additional_hook_client_handles.end());
+    additional_hook_client_handles.erase(iter);
+}
+
+void
+_netebpf_ext_helper::classify_test_packet_chain(
+    _In_ const netebpfext_helper_base_client_context_t* client_context,
+    NET_IFINDEX if_index,
+    const std::vector<uint32_t>& net_buffer_counts,
+    _Out_ FWPS_CLASSIFY_OUT* classify_output)
+{
+    const uint32_t packet_size = 64;
+    std::vector<std::vector<uint8_t>> packets;
+    std::vector<NET_BUFFER_LIST*> allocated_nbls;
+    NET_BUFFER_LIST* nbl_chain = nullptr;
+    NET_BUFFER_LIST** nbl_tail = &nbl_chain;
+
+    // Every net buffer is allocated in an NBL of its own, then linked after the previous net buffer of the NBL it is
+    // indicated in.
+    for (uint32_t net_buffer_count : net_buffer_counts) {
+        NET_BUFFER* previous_net_buffer = nullptr;
+        for (uint32_t index = 0; index < net_buffer_count; index++) {
+            packets.emplace_back(packet_size, static_cast<uint8_t>(packets.size()));
+            MDL* mdl = IoAllocateMdl(packets.back().data(), packet_size, FALSE, FALSE, nullptr);
+            REQUIRE(mdl != nullptr);
+            MmBuildMdlForNonPagedPool(mdl);
+            NET_BUFFER_LIST* nbl = nullptr;
+            REQUIRE(
+                FwpsAllocateNetBufferAndNetBufferList(
+                    _net_ebpf_ext_nbl_pool_handle, 0, 0, mdl, 0, packet_size, &nbl) == STATUS_SUCCESS);
+            allocated_nbls.push_back(nbl);
+
+            if (previous_net_buffer == nullptr) {
+                *nbl_tail = nbl;
+                nbl_tail = &NET_BUFFER_LIST_NEXT_NBL(nbl);
+            } else {
+                NET_BUFFER_NEXT_NB(previous_net_buffer) = NET_BUFFER_LIST_FIRST_NB(nbl);
+            }
+            previous_net_buffer = NET_BUFFER_LIST_FIRST_NB(nbl);
+        }
+    }
+
+    std::vector<FWPS_INCOMING_VALUE> values(FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_MAX);
+    values[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_INTERFACE_INDEX].value.type = FWP_UINT32;
+    values[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_INTERFACE_INDEX].value.uint32 = if_index;
+    values[FWPS_FIELD_INBOUND_MAC_FRAME_NATIVE_NDIS_PORT].value.type = FWP_UINT32;
+    const FWPS_INCOMING_VALUES incoming_fixed_values = {
+        FWPS_LAYER_INBOUND_MAC_FRAME_NATIVE, static_cast<UINT32>(values.size()), values.data()};
+    const FWPS_INCOMING_METADATA_VALUES incoming_metadata_values = {};
+
+    // The XDP callout finds the attached clients through the filter context that netebpfext created for the client.
+    FWPS_FILTER filter = {};
+    filter.context = reinterpret_cast<uint64_t>(net_ebpf_extension_hook_client_get_provider_data(
+        reinterpret_cast<const net_ebpf_extension_hook_client_t*>(client_context->provider_binding_context)));
+
+    *classify_output = {};
+    classify_output->rights = FWPS_RIGHT_ACTION_WRITE;
+    net_ebpf_ext_layer_2_classify(
+        &incoming_fixed_values, &incoming_metadata_values, nbl_chain, nullptr, &filter, 0, classify_output);
+
+    for (NET_BUFFER_LIST* nbl : allocated_nbls) {
+        NET_BUFFER* net_buffer = NET_BUFFER_LIST_FIRST_NB(nbl);
+        NET_BUFFER_NEXT_NB(net_buffer) = nullptr;
+        NET_BUFFER_LIST_NEXT_NBL(nbl) = nullptr;
+        IoFreeMdl(NET_BUFFER_FIRST_MDL(net_buffer));
+        FwpsFreeNetBufferList0(nbl);
+    }
+}
+
 NTSTATUS
 _netebpf_ext_helper::_program_info_client_attach_provider(
     _In_ HANDLE nmr_binding_handle,
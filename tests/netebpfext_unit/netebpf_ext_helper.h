@@ -19,6 +19,7 @@
 #include "usersim\fwp_test.h"
 
 #include <iostream>
+#include <map>
 #include <vector>
 
 typedef struct _netebpfext_helper_base_client_context
@@ -53,6 +54,39 @@ typedef class _netebpf_ext_helper
         return usersim_fwp_classify_packet(layer_guid, if_index);
     }
 
+    /**
+     * @brief Indicate a chain of NBLs, as NDIS does for a receive indication, to the XDP callout of an attached hook
+     * client. The first byte of every packet is its index in the indication.
+     *
+     * @param[in] client_context Context of the attached XDP hook client.
+     * @param[in] if_index Interface index of the indication.
+     * @param[in] net_buffer_counts Number of net buffers in each NBL of the chain.
+     * @param[out] classify_output Classify output of the callout.
+     */
+    void
+    classify_test_packet_chain(
+        _In_ const netebpfext_helper_base_client_context_t* client_context,
+        NET_IFINDEX if_index,
+        const std::vector<uint32_t>& net_buffer_counts,
+        _Out_ FWPS_CLASSIFY_OUT* classify_output);
+
+    /**
+     * @brief Attach another hook NPI client that invokes the dispatch function passed to the constructor.
+     *
+     * @param[in, out] client_context Context of the hook client to attach.
+     */
+    void
+    attach_hook_client(_Inout_ netebpfext_helper_base_client_context_t* client_context);
+
+    /**
+     * @brief Detach a hook NPI client, either the one passed to the constructor or one attached by
+     * attach_hook_client. This waits for the detach to complete.
+     *
+     * @param[in] client_context Context of the hook client to detach.
+     */
+    void
+    detach_hook_client(_In_ const netebpfext_helper_base_client_context_t* client_context);
+
     FWP_ACTION_TYPE
     test_bind_ipv4(_In_ fwp_classify_parameters_t* parameters) { return usersim_fwp_bind_ipv4(parameters); }
 
@@ -221,6 +255,9 @@ typedef class _netebpf_ext_helper
 
     std::unique_ptr<nmr_client_registration_t> nmr_program_info_client_handle;
     std::unique_ptr<nmr_client_registration_t> nmr_hook_client_handle;
+    const netebpfext_helper_base_client_context_t* hook_client_context = nullptr;
+    std::map<const netebpfext_helper_base_client_context_t*, std::unique_ptr<nmr_client_registration_t>>
+        additional_hook_client_handles;
 
 } netebpf_ext_helper_t;
 
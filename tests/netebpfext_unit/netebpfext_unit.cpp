@@ -81,6 +81,9 @@ typedef struct _test_xdp_client_context
     netebpfext_helper_base_client_context_t base;
     void* provider_binding_context;
     xdp_test_action_t xdp_action;
+    const xdp_test_action_t* packet_actions; ///< If set, the action for each packet, indexed by its first byte.
+    uint64_t packets_seen;                   ///< Bit mask of the first bytes of the packets the program was run on.
+    uint32_t invoke_count;
 } test_xdp_client_context_t;
 
 typedef struct _test_xdp_client_context_header
@@ -97,9 +100,16 @@ netebpfext_unit_invoke_xdp_program(
 {
     ebpf_result_t return_result = EBPF_SUCCESS;
     auto client_context = (test_xdp_client_context_t*)client_binding_context;
-    UNREFERENCED_PARAMETER(context);
-
-    switch (client_context->xdp_action) {
+    auto xdp_context = (const xdp_md_t*)context;
+    xdp_test_action_t xdp_action = client_context->xdp_action;
+
+    client_context->invoke_count++;
+    if (client_context->packet_actions != nullptr) {
+        uint8_t packet_index = *(const uint8_t*)xdp_context->data;
+        client_context->packets_seen |= 1ull << packet_index;
+        xdp_action = client_context->packet_actions[packet_index];
+    }
+    switch (xdp_action) {
     case XDP_TEST_ACTION_PASS:
         *result = XDP_PASS;
         break;
@@ -158,6 +168,129 @@ TEST_CASE("classify_packet", "[netebpfext]")
     REQUIRE(result == FWP_ACTION_BLOCK);
 }
 
+TEST_CASE("classify_packet_batch", "[netebpfext]")
+{
+    NET_IFINDEX if_index = 0;
+    ebpf_extension_data_t npi_specific_characteristics = {
+        .header = EBPF_ATTACH_CLIENT_DATA_HEADER_VERSION,
+        .data = &if_index,
+        .data_size = sizeof(if_index),
+    };
+    test_xdp_client_context_header_t client_context_header = {0};
+    test_xdp_client_context_t* client_context = &client_context_header.context;
+    client_context->base.desired_attach_type = BPF_XDP_TEST;
+
+    netebpf_ext_helper_t helper(
+        &npi_specific_characteristics,
+        (_ebpf_extension_dispatch_function)netebpfext_unit_invoke_xdp_program,
+        (netebpfext_helper_base_client_context_t*)client_context);
+
+    // Each indication is classified as a batch: the program must run exactly once per net buffer, and the
+    // indication must be permitted only if every net buffer passes.
+    std::vector<std::pair<xdp_test_action_t, FWP_ACTION_TYPE>> sequence = {
+        {XDP_TEST_ACTION_PASS, FWP_ACTION_PERMIT},
+        {XDP_TEST_ACTION_DROP, FWP_ACTION_BLOCK},
+        {XDP_TEST_ACTION_PASS, FWP_ACTION_PERMIT},
+        {XDP_TEST_ACTION_TX, FWP_ACTION_BLOCK},
+        {XDP_TEST_ACTION_FAILURE, FWP_ACTION_BLOCK},
+        {XDP_TEST_ACTION_PASS, FWP_ACTION_PERMIT},
+    };
+    for (const auto& [action, expected_result] : sequence) {
+        client_context->xdp_action = action;
+        uint32_t invoke_count = client_context->invoke_count;
+        FWP_ACTION_TYPE result = helper.classify_test_packet(&FWPM_LAYER_INBOUND_MAC_FRAME_NATIVE, if_index);
+        REQUIRE(result == expected_result);
+        REQUIRE(client_context->invoke_count == invoke_count + 1);
+    }
+}
+
+TEST_CASE("classify_packet_chain", "[netebpfext]")
+{
+    NET_IFINDEX if_index = 0;
+    ebpf_extension_data_t npi_specific_characteristics = {
+        .header = EBPF_ATTACH_CLIENT_DATA_HEADER_VERSION,
+        .data = &if_index,
+        .data_size = sizeof(if_index),
+    };
+    test_xdp_client_context_header_t client_context_header = {0};
+    test_xdp_client_context_t* client_context = &client_context_header.context;
+    client_context->base.desired_attach_type = BPF_XDP_TEST;
+
+    netebpf_ext_helper_t helper(
+        &npi_specific_characteristics,
+        (_ebpf_extension_dispatch_function)netebpfext_unit_invoke_xdp_program,
+        (netebpfext_helper_base_client_context_t*)client_context);
+
+    // Indicate three NBLs holding 3, 1 and 2 net buffers.
+    const std::vector<uint32_t> net_buffer_counts = {3, 1, 2};
+    const uint32_t packet_count = 6;
+    const uint64_t all_packets = (1ull << packet_count) - 1;
+
+    // Each sequence holds the action for each packet. The indication is permitted only if every packet passes,
+    // otherwise it is absorbed and the packets are moved to the PASS, TX and DROP sub-chains.
+    std::vector<std::vector<xdp_test_action_t>> sequences = {
+        // Every packet passes.
+        {XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS},
+        // The split happens in the middle of the first NBL.
+        {XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_DROP,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_TX,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_FAILURE},
+        // The split happens in the single net buffer NBL, after a whole NBL passed.
+        {XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_TX,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS},
+        // The split happens on the last net buffer of the last NBL.
+        {XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_PASS,
+         XDP_TEST_ACTION_DROP},
+        // Every packet is dropped.
+        {XDP_TEST_ACTION_DROP,
+         XDP_TEST_ACTION_DROP,
+         XDP_TEST_ACTION_DROP,
+         XDP_TEST_ACTION_DROP,
+         XDP_TEST_ACTION_DROP,
+         XDP_TEST_ACTION_DROP},
+    };
+    for (const auto& actions : sequences) {
+        REQUIRE(actions.size() == packet_count);
+        client_context->packet_actions = actions.data();
+        client_context->packets_seen = 0;
+        client_context->invoke_count = 0;
+
+        FWPS_CLASSIFY_OUT classify_output;
+        helper.classify_test_packet_chain(&client_context->base, if_index, net_buffer_counts, &classify_output);
+
+        // The program runs exactly once on every packet.
+        REQUIRE(client_context->invoke_count == packet_count);
+        REQUIRE(client_context->packets_seen == all_packets);
+
+        bool all_passed = std::all_of(
+            actions.begin(), actions.end(), [](xdp_test_action_t action) { return action == XDP_TEST_ACTION_PASS; });
+        if (all_passed) {
+            REQUIRE(classify_output.actionType == FWP_ACTION_PERMIT);
+            REQUIRE((classify_output.flags & FWPS_CLASSIFY_OUT_FLAG_ABSORB) == 0);
+        } else {
+            REQUIRE(classify_output.actionType == FWP_ACTION_BLOCK);
+            REQUIRE((classify_output.flags & FWPS_CLASSIFY_OUT_FLAG_ABSORB) != 0);
+        }
+    }
+    client_context->packet_actions = nullptr;
+}
+
 TEST_CASE("xdp_context", "[netebpfext]")
 {
     netebpf_ext_helper_t helper;
@@ -225,6 +358,8 @@ typedef struct test_bind_client_context_t
 {
     netebpfext_helper_base_client_context_t base;
     bind_action_t bind_action;
+    uint32_t invoke_count;
+    KIRQL invoke_irql;
 } test_bind_client_context_t;
 
 typedef struct test_bind_client_context_header_t
@@ -239,6 +374,8 @@ netebpfext_unit_invoke_bind_program(
 {
     auto client_context = (test_bind_client_context_t*)client_binding_context;
     UNREFERENCED_PARAMETER(context);
+    client_context->invoke_count++;
+    client_context->invoke_irql = KeGetCurrentIrql();
     *result = client_context->bind_action;
     return EBPF_SUCCESS;
 }
@@ -273,6 +410,44 @@ TEST_CASE("bind_invoke", "[netebpfext]")
     client_context->bind_action = BIND_DENY;
     result = helper.test_bind_ipv4(&parameters);
     REQUIRE(result == FWP_ACTION_BLOCK);
+
+    // Bind programs are invoked at PASSIVE_LEVEL.
+    REQUIRE(client_context->invoke_count == 3);
+    REQUIRE(client_context->invoke_irql == PASSIVE_LEVEL);
+}
+
+TEST_CASE("bind_dispatch_array_retire", "[netebpfext]")
+{
+    ebpf_extension_data_t npi_specific_characteristics = {
+        .header = EBPF_ATTACH_CLIENT_DATA_HEADER_VERSION,
+    };
+    test_bind_client_context_header_t client_context_header = {0};
+    test_bind_client_context_t* client_context = &client_context_header.context;
+    fwp_classify_parameters_t parameters = {};
+
+    netebpf_ext_helper_t helper(
+        &npi_specific_characteristics,
+        (_ebpf_extension_dispatch_function)netebpfext_unit_invoke_bind_program,
+        (netebpfext_helper_base_client_context_t*)client_context);
+
+    netebpfext_initialize_fwp_classify_parameters(&parameters);
+    client_context->bind_action = BIND_DENY;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        // The dispatch array of the attached client is reference counted, since bind programs run at PASSIVE_LEVEL.
+        uint32_t invoke_count = client_context->invoke_count;
+        client_context->invoke_irql = HIGH_LEVEL;
+        REQUIRE(helper.test_bind_ipv4(&parameters) == FWP_ACTION_BLOCK);
+        REQUIRE(client_context->invoke_count == invoke_count + 1);
+        REQUIRE(client_context->invoke_irql == PASSIVE_LEVEL);
+
+        // Detach only completes once the retired dispatch array has released the client.
+        helper.detach_hook_client(&client_context->base);
+        (void)helper.test_bind_ipv4(&parameters);
+        REQUIRE(client_context->invoke_count == invoke_count + 1);
+
+        helper.attach_hook_client(&client_context->base);
+    }
 }
 
 TEST_CASE("bind_context", "[netebpfext]")
@@ -424,6 +599,7 @@ typedef struct test_sock_addr_client_context_t
     netebpfext_helper_base_client_context_t base;
     int sock_addr_action;
     bool validate_sock_addr_entries = true;
+    std::atomic<uint32_t> invoke_count = 0;
 } test_sock_addr_client_context_t;
 
 typedef struct test_sock_addr_client_context_header_t
@@ -459,6 +635,8 @@ netebpfext_unit_invoke_sock_addr_program(
     int action = SOCK_ADDR_TEST_ACTION_BLOCK;
     int32_t is_admin = 0;
 
+    client_context->invoke_count++;
+
     auto sock_addr_program_data =
         client_context->base.helper->get_program_info_provider_data(EBPF_PROGRAM_TYPE_CGROUP_SOCK_ADDR);
 
@@ -671,6 +849,111 @@ sock_addr_thread_function(
     }
 }
 
+TEST_CASE("sock_addr_dispatch_array_swap", "[netebpfext]")
+{
+    ebpf_extension_data_t npi_specific_characteristics = {
+        .header = EBPF_ATTACH_CLIENT_DATA_HEADER_VERSION,
+    };
+    test_sock_addr_client_context_header_t client_context_header = {0};
+    test_sock_addr_client_context_t* client_context = &client_context_header.context;
+    test_sock_addr_client_context_header_t second_client_context_header = {0};
+    test_sock_addr_client_context_t* second_client_context = &second_client_context_header.context;
+    fwp_classify_parameters_t parameters = {};
+
+    netebpf_ext_helper_t helper(
+        &npi_specific_characteristics,
+        (_ebpf_extension_dispatch_function)netebpfext_unit_invoke_sock_addr_program,
+        (netebpfext_helper_base_client_context_t*)client_context);
+
+    netebpfext_initialize_fwp_classify_parameters(&parameters);
+    client_context->sock_addr_action = SOCK_ADDR_TEST_ACTION_PERMIT;
+    second_client_context->sock_addr_action = SOCK_ADDR_TEST_ACTION_PERMIT;
+
+    // Attaching a second client to the same connect hook publishes a dispatch array with both programs.
+    helper.attach_hook_client(&second_client_context->base);
+    REQUIRE(helper.test_cgroup_inet4_connect(&parameters) == FWP_ACTION_PERMIT);
+    REQUIRE(client_context->invoke_count > 0);
+    REQUIRE(second_client_context->invoke_count > 0);
+
+    // Detaching the second client swaps in a dispatch array with only the first program, and only completes once the
+    // previous array has been retired.
+    helper.detach_hook_client(&second_client_context->base);
+    uint32_t invoke_count = client_context->invoke_count;
+    uint32_t second_invoke_count = second_client_context->invoke_count;
+    REQUIRE(helper.test_cgroup_inet4_connect(&parameters) == FWP_ACTION_PERMIT);
+    REQUIRE(client_context->invoke_count > invoke_count);
+    REQUIRE(second_client_context->invoke_count == second_invoke_count);
+
+    // A program that rejects the connection stops the programs after it from being invoked.
+    helper.attach_hook_client(&second_client_context->base);
+    client_context->sock_addr_action = SOCK_ADDR_TEST_ACTION_BLOCK;
+    invoke_count = client_context->invoke_count;
+    second_invoke_count = second_client_context->invoke_count;
+    REQUIRE(helper.test_cgroup_inet4_connect(&parameters) == FWP_ACTION_BLOCK);
+    REQUIRE(client_context->invoke_count > invoke_count);
+    REQUIRE(second_client_context->invoke_count == second_invoke_count);
+
+    // The helper unloads netebpfext with the second client still attached.
+}
+
+// Attach and detach a second client while SOCK_ADDR_CONNECT is invoked concurrently, then unload with dispatch arrays
+// still being retired.
+TEST_CASE("sock_addr_dispatch_array_swap_concurrent", "[netebpfext_concurrent]")
+{
+    ebpf_extension_data_t npi_specific_characteristics = {
+        .header = EBPF_ATTACH_CLIENT_DATA_HEADER_VERSION,
+    };
+    test_sock_addr_client_context_header_t client_context_header = {0};
+    test_sock_addr_client_context_t* client_context = &client_context_header.context;
+    test_sock_addr_client_context_header_t second_client_context_header = {0};
+    test_sock_addr_client_context_t* second_client_context = &second_client_context_header.context;
+    fwp_classify_parameters_t parameters = {};
+    std::vector<std::jthread> threads;
+    std::atomic<size_t> failure_count = 0;
+
+    netebpf_ext_helper_t helper(
+        &npi_specific_characteristics,
+        (_ebpf_extension_dispatch_function)netebpfext_unit_invoke_sock_addr_program,
+        (netebpfext_helper_base_client_context_t*)client_context);
+
+    netebpfext_initialize_fwp_classify_parameters(&parameters);
+    client_context->validate_sock_addr_entries = false;
+    client_context->sock_addr_action = SOCK_ADDR_TEST_ACTION_PERMIT;
+    second_client_context->validate_sock_addr_entries = false;
+    second_client_context->sock_addr_action = SOCK_ADDR_TEST_ACTION_PERMIT;
+
+    uint32_t thread_count = 2 * ebpf_get_cpu_count();
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads.emplace_back(
+            sock_addr_thread_function,
+            &helper,
+            &parameters,
+            SOCK_ADDR_TEST_TYPE_CONNECT,
+            parameters.destination_port,
+            parameters.destination_port,
+            &failure_count);
+    }
+
+    for (uint32_t i = 0; i < CONCURRENT_THREAD_ITERATION_COUNT; i++) {
+        helper.attach_hook_client(&second_client_context->base);
+        helper.detach_hook_client(&second_client_context->base);
+    }
+    helper.attach_hook_client(&second_client_context->base);
+
+    // Stop all threads.
+    for (auto& thread : threads) {
+        thread.request_stop();
+    }
+
+    // Wait for all threads to stop.
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(failure_count == 0);
+    REQUIRE(second_client_context->invoke_count > 0);
+}
+
 // Invoke SOCK_ADDR_CONNECT concurrently with same classify parameters.
 
 TEST_CASE("sock_addr_invoke_concurrent1", "[netebpfext_concurrent]")
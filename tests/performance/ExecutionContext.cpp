@@ -96,7 +96,7 @@ typedef class _ebpf_program_test_state
 typedef class _ebpf_map_test_state
 {
   public:
-    _ebpf_map_test_state(ebpf_map_type_t type, std::optional<uint32_t> map_size = {})
+    _ebpf_map_test_state(ebpf_map_type_t type, std::optional<uint32_t> map_size = {}, uint32_t map_flags = 0)
     {
         // Since this is perf test, not checking the result.
 
@@ -104,6 +104,7 @@ typedef class _ebpf_map_test_state
         REQUIRE(ebpf_core_initiate() == EBPF_SUCCESS);
         ebpf_map_definition_in_memory_t definition{
             type, sizeof(uint32_t), sizeof(uint64_t), map_size.has_value() ? map_size.value() : ebpf_get_cpu_count()};
+        definition.map_flags = map_flags;
 
         (void)ebpf_map_create(&name, &definition, ebpf_handle_invalid, &map);
 
@@ -117,6 +118,7 @@ typedef class _ebpf_map_test_state
         lru_key_range = definition.max_entries / 10;
         // Start at the end of the key range so that we start evicting keys.
         lru_key_base = definition.max_entries;
+        lru_next_key = definition.max_entries;
     }
     ~_ebpf_map_test_state()
     {
@@ -172,6 +174,18 @@ typedef class _ebpf_map_test_state
         ebpf_epoch_exit(&epoch_state);
     }
 
+    void
+    test_insert_storm_lru()
+    {
+        // Every insert creates a new flow, so every insert needs an entry to be evicted.
+        uint32_t key = static_cast<uint32_t>(InterlockedIncrement(&lru_next_key));
+        uint64_t value = 0;
+        ebpf_epoch_state_t epoch_state;
+        ebpf_epoch_enter(&epoch_state);
+        (void)ebpf_map_update_entry(map, 0, (uint8_t*)&key, 0, (uint8_t*)&value, EBPF_NOEXIST, EBPF_MAP_FLAG_HELPER);
+        ebpf_epoch_exit(&epoch_state);
+    }
+
     void
     test_rolling_update_lru(uint32_t cpu_id)
     {
@@ -201,9 +215,13 @@ typedef class _ebpf_map_test_state
     // Searches are performed in the LRU map using keys in the range [lru_key_base, lru_key_base + lru_key_range).
     uint32_t lru_key_base;
     uint32_t lru_key_range;
+    // Next key inserted by the LRU insert storm.
+    volatile long lru_next_key;
     ebpf_map_t* map;
 } ebpf_map_test_state_t;
 
+#define IPV6_PREFIX_SIZE 16
+
 typedef class _ebpf_map_lpm_trie_test_state
 {
   public:
@@ -239,6 +257,32 @@ typedef class _ebpf_map_lpm_trie_test_state
         }
     }
 
+    void
+    populate_ipv6_routes(size_t route_count)
+    {
+        cxplat_utf8_string_t name{(uint8_t*)"ipv6_route_table", 16};
+        ebpf_map_definition_in_memory_t definition{
+            BPF_MAP_TYPE_LPM_TRIE,
+            sizeof(uint32_t) + IPV6_PREFIX_SIZE,
+            sizeof(uint64_t),
+            static_cast<uint32_t>(route_count)};
+
+        (void)ebpf_map_create(&name, &definition, ebpf_handle_invalid, &map);
+
+        // Spread the routes across every prefix length from /16 to /64 so that lookups can't be satisfied by probing
+        // only a handful of distinct prefix lengths.
+        for (size_t count = 0; count < route_count; count++) {
+            std::vector<uint8_t> prefix(IPV6_PREFIX_SIZE);
+            for (size_t offset = 0; offset < prefix.size(); offset += sizeof(uint32_t)) {
+                uint32_t random = ebpf_random_uint32();
+                memcpy(prefix.data() + offset, &random, sizeof(random));
+            }
+            uint32_t prefix_length = 16 + static_cast<uint32_t>(count % 49);
+            populate_route(prefix, prefix_length);
+            ipv6_routes.push_back(std::move(prefix));
+        }
+    }
+
     void
     populate_route(const std::vector<uint8_t>& prefix, uint32_t length)
     {
@@ -271,6 +315,25 @@ typedef class _ebpf_map_lpm_trie_test_state
         ebpf_epoch_exit(&epoch_state);
     }
 
+    void
+    test_find_ipv6_route()
+    {
+        struct _key
+        {
+            uint32_t prefix_length;
+            uint8_t prefix[IPV6_PREFIX_SIZE];
+        } ipv6_key = {128};
+        memcpy(
+            ipv6_key.prefix, ipv6_routes[ebpf_random_uint32() % ipv6_routes.size()].data(), sizeof(ipv6_key.prefix));
+        volatile uint64_t* value = nullptr;
+
+        ebpf_epoch_state_t epoch_state;
+        ebpf_epoch_enter(&epoch_state);
+        (void)ebpf_map_find_entry(map, sizeof(ipv6_key), (uint8_t*)&ipv6_key, sizeof(value), (uint8_t*)&value, 0);
+        UNREFERENCED_PARAMETER(value);
+        ebpf_epoch_exit(&epoch_state);
+    }
+
     ~_ebpf_map_lpm_trie_test_state()
     {
         EBPF_OBJECT_RELEASE_REFERENCE((ebpf_core_object_t*)map);
@@ -280,6 +343,7 @@ typedef class _ebpf_map_lpm_trie_test_state
   private:
     ebpf_map_t* map;
     std::vector<std::pair<uint32_t, uint32_t>> ipv4_routes;
+    std::vector<std::vector<uint8_t>> ipv6_routes;
 } ebpf_map_lpm_trie_test_state_t;
 
 static ebpf_program_test_state_t* _ebpf_program_test_state_instance = nullptr;
@@ -323,6 +387,12 @@ _map_update_lru_test()
     _ebpf_map_test_state_instance->test_update_lru();
 }
 
+static void
+_map_insert_storm_lru_test()
+{
+    _ebpf_map_test_state_instance->test_insert_storm_lru();
+}
+
 static void
 _map_lookup_lru_test(uint32_t cpu_id)
 {
@@ -335,6 +405,12 @@ _lpm_trie_ipv4_find()
     _ebpf_map_lpm_trie_test_state_instance->test_find_ipv4_route();
 }
 
+static void
+_lpm_trie_ipv6_find()
+{
+    _ebpf_map_lpm_trie_test_state_instance->test_find_ipv6_route();
+}
+
 static const char*
 _ebpf_map_type_t_to_string(ebpf_map_type_t type)
 {
@@ -441,6 +517,21 @@ test_bpf_map_lookup_lru_elem(bool preemptible)
     measure.run_test();
 }
 
+template <uint32_t map_flags>
+void
+test_bpf_map_insert_storm_lru_elem(bool preemptible)
+{
+    size_t iterations = PERFORMANCE_MEASURE_ITERATION_COUNT / 10;
+    ebpf_map_test_state_t map_test_state(BPF_MAP_TYPE_LRU_HASH, {LRU_MAP_SIZE}, map_flags);
+    _ebpf_map_test_state_instance = &map_test_state;
+    std::string name = __FUNCTION__;
+    name += "<";
+    name += (map_flags & EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION) ? "background_eviction" : "inline_eviction";
+    name += ">";
+    _performance_measure measure(name.c_str(), preemptible, _map_insert_storm_lru_test, iterations);
+    measure.run_test();
+}
+
 #if !defined(CONFIG_BPF_JIT_DISABLED) || !defined(CONFIG_BPF_INTERPRETER_DISABLED)
 void
 test_program_invoke_jit(bool preemptible)
@@ -487,6 +578,23 @@ test_lpm_trie_ipv4(bool preemptible)
     measure.run_test();
 }
 
+template <size_t route_count>
+void
+test_lpm_trie_ipv6(bool preemptible)
+{
+    size_t iterations = PERFORMANCE_MEASURE_ITERATION_COUNT;
+    _ebpf_map_lpm_trie_test_state lpm_trie_state;
+    lpm_trie_state.populate_ipv6_routes(route_count);
+    _ebpf_map_lpm_trie_test_state_instance = &lpm_trie_state;
+    std::string name = __FUNCTION__;
+    name += "<";
+    name += std::to_string(route_count);
+    name += ">";
+
+    _performance_measure measure(name.c_str(), preemptible, _lpm_trie_ipv6_find, iterations);
+    measure.run_test();
+}
+
 #if !defined(CONFIG_BPF_JIT_DISABLED)
 PERF_TEST(test_program_invoke_jit);
 #endif
@@ -513,8 +621,12 @@ PERF_TEST(test_bpf_map_update_elem<BPF_MAP_TYPE_LRU_HASH>);
 
 PERF_TEST(test_bpf_map_update_lru_elem<BPF_MAP_TYPE_LRU_HASH>);
 PERF_TEST(test_bpf_map_lookup_lru_elem<BPF_MAP_TYPE_LRU_HASH>);
+PERF_TEST(test_bpf_map_insert_storm_lru_elem<0>);
+PERF_TEST(test_bpf_map_insert_storm_lru_elem<EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION>);
 
 PERF_TEST(test_lpm_trie_ipv4<1024>);
 PERF_TEST(test_lpm_trie_ipv4<1024 * 16>);
 PERF_TEST(test_lpm_trie_ipv4<1024 * 256>);
 PERF_TEST(test_lpm_trie_ipv4<1024 * 1024>);
+PERF_TEST(test_lpm_trie_ipv6<1024>);
+PERF_TEST(test_lpm_trie_ipv6<1024 * 64>);
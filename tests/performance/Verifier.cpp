@@ -0,0 +1,89 @@
+// Copyright (c) eBPF for Windows contributors
+// SPDX-License-Identifier: MIT
+
+#define TEST_AREA "Verifier"
+
+#include "ebpf_api.h"
+#include "performance.h"
+#include "test_helper.hpp"
+
+#include <fstream>
+
+#define PERFORMANCE_VERIFY_ITERATION_COUNT 10
+
+/**
+ * @brief Measure the average time to verify all of the programs in an ELF file.
+ *
+ * @param[in] file_name ELF file to verify.
+ * @param[in] max_threads Maximum number of threads to verify the programs on.
+ */
+static void
+_test_verify_programs(_In_z_ const char* file_name, uint32_t max_threads)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    REQUIRE(!data.empty());
+
+    const char* error_message = nullptr;
+    ebpf_api_program_info_t* program_data = nullptr;
+    REQUIRE(ebpf_enumerate_programs(file_name, false, &program_data, &error_message) == 0);
+    ebpf_free_string(error_message);
+
+    std::vector<ebpf_api_program_verification_t> verifications;
+    for (auto program = program_data; program != nullptr; program = program->next) {
+        ebpf_api_program_verification_t verification = {};
+        verification.section_name = program->section_name;
+        verification.program_name = program->program_name;
+        verifications.push_back(verification);
+    }
+
+    LARGE_INTEGER start_time;
+    LARGE_INTEGER end_time;
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&start_time);
+    for (size_t i = 0; i < PERFORMANCE_VERIFY_ITERATION_COUNT; i++) {
+        ebpf_result_t result = ebpf_api_elf_verify_programs_from_memory(
+            data.c_str(),
+            data.size(),
+            EBPF_VERIFICATION_VERBOSITY_NORMAL,
+            max_threads,
+            verifications.size(),
+            verifications.data());
+        ebpf_api_free_program_verifications(verifications.size(), verifications.data());
+        REQUIRE(result == EBPF_SUCCESS);
+    }
+    QueryPerformanceCounter(&end_time);
+    ebpf_free_programs(program_data);
+
+    double average_duration = static_cast<double>(end_time.QuadPart - start_time.QuadPart);
+    average_duration /= PERFORMANCE_VERIFY_ITERATION_COUNT;
+    average_duration *= 1e9;
+    average_duration /= static_cast<double>(frequency.QuadPart);
+    // Verification always runs preemptible.
+    printf("verify_programs_%s_%u_threads,%d,%.0f\n", file_name, max_threads, true, average_duration);
+}
+
+TEST_CASE("verify_programs", "[performance_" TEST_AREA "]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    program_info_provider_t xdp_program_info;
+    REQUIRE(xdp_program_info.initialize(EBPF_PROGRAM_TYPE_XDP) == EBPF_SUCCESS);
+    program_info_provider_t bind_program_info;
+    REQUIRE(bind_program_info.initialize(EBPF_PROGRAM_TYPE_BIND) == EBPF_SUCCESS);
+    program_info_provider_t sock_addr_program_info;
+    REQUIRE(sock_addr_program_info.initialize(EBPF_PROGRAM_TYPE_CGROUP_SOCK_ADDR) == EBPF_SUCCESS);
+    program_info_provider_t sock_ops_program_info;
+    REQUIRE(sock_ops_program_info.initialize(EBPF_PROGRAM_TYPE_SOCK_OPS) == EBPF_SUCCESS);
+
+    // Report the average time in nanoseconds to verify every program of each object, sequentially and then on one
+    // thread per CPU.
+    uint32_t cpu_count = ebpf_get_cpu_count();
+    for (const char* file_name :
+         {"droppacket.o", "bindmonitor_tailcall.o", "cgroup_sock_addr.o", "cgroup_sock_addr2.o", "sockops.o"}) {
+        _test_verify_programs(file_name, 1);
+        _test_verify_programs(file_name, cpu_count);
+    }
+}
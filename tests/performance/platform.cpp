@@ -69,6 +69,15 @@ _perf_bpf_get_smp_processor_id()
     ebpf_epoch_exit(&epoch_state);
 }
 
+static volatile int64_t _ebpf_hash_table_test_allocation_count = 0;
+
+static _Must_inspect_result_ _Ret_writes_maybenull_(size) void*
+_ebpf_hash_table_test_allocate(size_t size, uint32_t tag)
+{
+    ebpf_interlocked_increment_int64_no_fence(&_ebpf_hash_table_test_allocation_count);
+    return ebpf_epoch_allocate_with_tag(size, tag);
+}
+
 /**
  * @brief Helper function to set up the hash-table for testing.
  * All tests perform the operation under test multiplier() times.
@@ -76,7 +85,7 @@ _perf_bpf_get_smp_processor_id()
 typedef class _ebpf_hash_table_test_state
 {
   public:
-    _ebpf_hash_table_test_state()
+    _ebpf_hash_table_test_state(bool update_in_place = false)
     {
         cpu_count = ebpf_get_cpu_count();
         REQUIRE(ebpf_platform_initiate() == EBPF_SUCCESS);
@@ -91,7 +100,9 @@ typedef class _ebpf_hash_table_test_state
         const ebpf_hash_table_creation_options_t options = {
             .key_size = sizeof(uint32_t),
             .value_size = sizeof(uint64_t),
+            .allocate = _ebpf_hash_table_test_allocate,
             .minimum_bucket_count = keys.size(),
+            .update_in_place = update_in_place,
         };
         REQUIRE(ebpf_hash_table_create(&table, &options) == EBPF_SUCCESS);
         for (auto& key : keys) {
@@ -193,6 +204,33 @@ typedef class _ebpf_hash_table_test_state
         return keys.size();
     }
 
+    /**
+     * @brief Reset the count of allocations made by the hash table.
+     */
+    void
+    reset_allocation_count()
+    {
+        _ebpf_hash_table_test_allocation_count = 0;
+    }
+
+    /**
+     * @brief Print the average number of allocations made by each operation since the last reset.
+     *
+     * @param[in] test_name Display name of the test.
+     * @param[in] preemptible Whether the test ran in preemptible mode.
+     * @param[in] iterations Iteration count each CPU ran.
+     */
+    void
+    report_allocation_count(_In_z_ const char* test_name, bool preemptible, size_t iterations)
+    {
+        double operation_count = static_cast<double>(iterations) * cpu_count * multiplier();
+        printf(
+            "%s_allocations,%d,%.2f\n",
+            test_name,
+            preemptible,
+            static_cast<double>(_ebpf_hash_table_test_allocation_count) / operation_count);
+    }
+
   private:
     ebpf_hash_table_t* table;
     std::vector<uint32_t> keys;
@@ -306,27 +344,52 @@ test_ebpf_hash_table_next_key(bool preemptible)
     measure.run_test(instance.multiplier());
 }
 
-void
-test_ebpf_hash_table_update(bool preemptible)
+static void
+_test_ebpf_hash_table_update(_In_z_ const char* test_name, bool preemptible, bool update_in_place)
 {
-    _ebpf_hash_table_test_state instance;
+    _ebpf_hash_table_test_state instance(update_in_place);
     _ebpf_hash_table_test_state_instance = &instance;
-    _performance_measure measure(
-        __FUNCTION__, preemptible, _ebpf_hash_table_test_replace_value, PERFORMANCE_MEASURE_ITERATION_COUNT / 10);
+    size_t iterations = PERFORMANCE_MEASURE_ITERATION_COUNT / 10;
+    _performance_measure measure(test_name, preemptible, _ebpf_hash_table_test_replace_value, iterations);
+    instance.reset_allocation_count();
     measure.run_test(instance.multiplier());
+    instance.report_allocation_count(test_name, preemptible, iterations);
 }
 
-void
-test_ebpf_hash_table_update_overlapping(bool preemptible)
+static void
+_test_ebpf_hash_table_update_overlapping(_In_z_ const char* test_name, bool preemptible, bool update_in_place)
 {
-    _ebpf_hash_table_test_state instance;
+    _ebpf_hash_table_test_state instance(update_in_place);
     _ebpf_hash_table_test_state_instance = &instance;
-    _performance_measure measure(
-        __FUNCTION__,
-        preemptible,
-        _ebpf_hash_table_test_replace_value_overlap,
-        PERFORMANCE_MEASURE_ITERATION_COUNT / 10);
+    size_t iterations = PERFORMANCE_MEASURE_ITERATION_COUNT / 10;
+    _performance_measure measure(test_name, preemptible, _ebpf_hash_table_test_replace_value_overlap, iterations);
+    instance.reset_allocation_count();
     measure.run_test(instance.multiplier());
+    instance.report_allocation_count(test_name, preemptible, iterations);
+}
+
+void
+test_ebpf_hash_table_update(bool preemptible)
+{
+    _test_ebpf_hash_table_update(__FUNCTION__, preemptible, false);
+}
+
+void
+test_ebpf_hash_table_update_in_place(bool preemptible)
+{
+    _test_ebpf_hash_table_update(__FUNCTION__, preemptible, true);
+}
+
+void
+test_ebpf_hash_table_update_overlapping(bool preemptible)
+{
+    _test_ebpf_hash_table_update_overlapping(__FUNCTION__, preemptible, false);
+}
+
+void
+test_ebpf_hash_table_update_overlapping_in_place(bool preemptible)
+{
+    _test_ebpf_hash_table_update_overlapping(__FUNCTION__, preemptible, true);
 }
 
 PERF_TEST(test_epoch_enter_exit);
@@ -334,7 +397,9 @@ PERF_TEST(test_epoch_enter_exit_alloc_free);
 PERF_TEST(test_ebpf_hash_table_find);
 PERF_TEST(test_ebpf_hash_table_next_key);
 PERF_TEST(test_ebpf_hash_table_update);
+PERF_TEST(test_ebpf_hash_table_update_in_place);
 PERF_TEST(test_ebpf_hash_table_update_overlapping);
+PERF_TEST(test_ebpf_hash_table_update_overlapping_in_place);
 
 PERF_TEST(test_bpf_get_prandom_u32);
 PERF_TEST(test_bpf_ktime_get_boot_ns);
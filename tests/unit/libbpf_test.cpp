@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <fstream>
+#include <future>
 #include <stop_token>
 #include <thread>
 
@@ -177,6 +178,134 @@ TEST_CASE("libbpf prog test run", "[libbpf][deprecated]")
 
     bpf_object__close(object);
 }
+
+TEST_CASE("libbpf program run statistics", "[libbpf]")
+{
+    _test_helper_libbpf test_helper;
+    test_helper.initialize();
+    struct bpf_object* object;
+    int program_fd;
+#pragma warning(suppress : 4996) // deprecated
+    int result = bpf_prog_load_deprecated("test_sample_ebpf.o", BPF_PROG_TYPE_SAMPLE, &object, &program_fd);
+    REQUIRE(result == 0);
+    REQUIRE(program_fd != ebpf_fd_invalid);
+
+    bpf_test_run_opts opts = {};
+    sample_program_context_t in_ctx{0};
+    opts.repeat = 10;
+    opts.ctx_in = reinterpret_cast<uint8_t*>(&in_ctx);
+    opts.ctx_size_in = sizeof(in_ctx);
+
+    // Statistics are not collected by default.
+    REQUIRE(bpf_prog_test_run_opts(program_fd, &opts) == 0);
+    bpf_prog_info program_info = {};
+    uint32_t program_info_size = sizeof(program_info);
+    REQUIRE(bpf_obj_get_info_by_fd(program_fd, &program_info, &program_info_size) == 0);
+    REQUIRE(program_info.run_cnt == 0);
+    REQUIRE(program_info.run_time_ns == 0);
+    REQUIRE(program_info.tail_call_cnt == 0);
+
+    REQUIRE(ebpf_enable_program_statistics(true) == EBPF_SUCCESS);
+    REQUIRE(bpf_prog_test_run_opts(program_fd, &opts) == 0);
+    REQUIRE(ebpf_enable_program_statistics(false) == EBPF_SUCCESS);
+
+    REQUIRE(bpf_obj_get_info_by_fd(program_fd, &program_info, &program_info_size) == 0);
+    REQUIRE(program_info.run_cnt == static_cast<uint64_t>(opts.repeat));
+    REQUIRE(program_info.tail_call_cnt == 0);
+
+    // Statistics collected so far are kept once collection stops.
+    REQUIRE(bpf_prog_test_run_opts(program_fd, &opts) == 0);
+    REQUIRE(bpf_obj_get_info_by_fd(program_fd, &program_info, &program_info_size) == 0);
+    REQUIRE(program_info.run_cnt == static_cast<uint64_t>(opts.repeat));
+
+    // The statistics are also returned by the bpf() syscall.
+    sys_bpf_prog_info_t sys_program_info = {};
+    bpf_attr attr = {};
+    attr.info.bpf_fd = program_fd;
+    attr.info.info = (uintptr_t)&sys_program_info;
+    attr.info.info_len = sizeof(sys_program_info);
+    REQUIRE(bpf(BPF_OBJ_GET_INFO_BY_FD, &attr, sizeof(attr)) == 0);
+    REQUIRE(sys_program_info.run_cnt == program_info.run_cnt);
+    REQUIRE(sys_program_info.run_time_ns == program_info.run_time_ns);
+
+    bpf_object__close(object);
+}
+
+TEST_CASE("ebpf_program_test_run_batch", "[libbpf]")
+{
+    _test_helper_libbpf test_helper;
+    test_helper.initialize();
+    struct bpf_object* object;
+    int program_fd;
+#pragma warning(suppress : 4996) // deprecated
+    int result = bpf_prog_load_deprecated("test_sample_ebpf.o", BPF_PROG_TYPE_SAMPLE, &object, &program_fd);
+    REQUIRE(result == 0);
+    REQUIRE(object != nullptr);
+    REQUIRE(program_fd != ebpf_fd_invalid);
+
+    // The program searches the data for the string in test_map[0] and fails with -1 if it is not found. An empty
+    // replacement string in test_map[1] leaves the data unchanged across repeats.
+    fd_t map_fd = bpf_object__find_map_fd_by_name(object, "test_map");
+    REQUIRE(map_fd != ebpf_fd_invalid);
+    char pattern[32] = "pattern";
+    uint32_t key = 0;
+    REQUIRE(bpf_map_update_elem(map_fd, &key, pattern, BPF_ANY) == 0);
+
+    // Inputs without data, with data holding the pattern, and with data missing the pattern.
+    char matching_packet[] = "xxxxpatternxxxx";
+    char mismatching_packet[] = "xxxxxxxxxxxxxxx";
+    const uint64_t expected_return_values[] = {42, 42, UINT32_MAX};
+    sample_program_context_t contexts[_countof(expected_return_values)] = {};
+    ebpf_test_run_batch_input_t inputs[_countof(expected_return_values)] = {};
+    for (size_t index = 0; index < _countof(inputs); index++) {
+        inputs[index].context_in = reinterpret_cast<uint8_t*>(&contexts[index]);
+        inputs[index].context_size_in = sizeof(contexts[index]);
+    }
+    inputs[1].data_in = reinterpret_cast<uint8_t*>(matching_packet);
+    inputs[1].data_size_in = sizeof(matching_packet);
+    inputs[2].data_in = reinterpret_cast<uint8_t*>(mismatching_packet);
+    inputs[2].data_size_in = sizeof(mismatching_packet);
+
+    uint64_t return_values[_countof(inputs)] = {};
+    ebpf_test_run_batch_options_t options = {};
+    options.inputs = inputs;
+    options.input_count = _countof(inputs);
+    options.return_values = return_values;
+    options.repeat_count = 100;
+
+    REQUIRE(ebpf_program_test_run_batch(program_fd, &options) == EBPF_SUCCESS);
+    for (size_t index = 0; index < _countof(inputs); index++) {
+        REQUIRE(return_values[index] == expected_return_values[index]);
+    }
+    REQUIRE(options.latency_p50 <= options.latency_p99);
+    REQUIRE(options.latency_p99 <= options.latency_p999);
+
+    // Reordering the inputs reorders the per-input results.
+    std::swap(inputs[0], inputs[2]);
+    REQUIRE(ebpf_program_test_run_batch(program_fd, &options) == EBPF_SUCCESS);
+    REQUIRE(return_values[0] == UINT32_MAX);
+    REQUIRE(return_values[1] == 42);
+    REQUIRE(return_values[2] == 42);
+    std::swap(inputs[0], inputs[2]);
+
+    // Negative tests.
+
+    // Bad fd.
+    REQUIRE(ebpf_program_test_run_batch(nonexistent_fd, &options) != EBPF_SUCCESS);
+
+    // No inputs.
+    options.input_count = 0;
+    REQUIRE(ebpf_program_test_run_batch(program_fd, &options) == EBPF_INVALID_ARGUMENT);
+
+    // Input too large to fit in a single request.
+    std::vector<uint8_t> large_packet(MAXUINT16);
+    inputs[1].data_in = large_packet.data();
+    inputs[1].data_size_in = large_packet.size();
+    options.input_count = _countof(inputs);
+    REQUIRE(ebpf_program_test_run_batch(program_fd, &options) == EBPF_INVALID_ARGUMENT);
+
+    bpf_object__close(object);
+}
 #endif
 
 TEST_CASE("empty bpf_load_program", "[libbpf][deprecated]")
@@ -411,6 +540,7 @@ TEST_CASE("valid bpf_load_program_xattr", "[libbpf][deprecated]")
 #define BPF_CALL_FUNC(imm) {INST_OP_CALL, 0, 0, 0, (imm)}
 #define BPF_STX_MEM(sz, dst, src, off) {INST_CLS_STX | INST_MODE_MEM | (sz), (dst), (src), (off), 0}
 #define BPF_W INST_SIZE_W
+#define BPF_DW INST_SIZE_DW
 #define BPF_REG_1 R1_ARG
 #define BPF_REG_2 R2_ARG
 #define BPF_REG_3 R3_ARG
@@ -463,6 +593,71 @@ TEST_CASE("valid bpf_load_program with map", "[libbpf][deprecated]")
     Platform::_close(map_fd);
 }
 
+/**
+ * @brief Load a program that reserves a record of the given size from a ring buffer map, writes 8 bytes to it at the
+ * given offset and submits it. The program returns 1 if the record was reserved, and 0 otherwise.
+ *
+ * @param[in] map_fd Ring buffer map to reserve the record in.
+ * @param[in] size Size of the record to reserve.
+ * @param[in] offset Offset in the record to write to.
+ * @return File descriptor of the program, or a negative value if it failed to load.
+ */
+static fd_t
+_load_ring_buffer_reserve_program(fd_t map_fd, int32_t size, int16_t offset)
+{
+    prevail::EbpfInst instructions[] = {
+        BPF_LD_MAP_FD(BPF_REG_1, map_fd),                        // r1 = map_fd ll
+        BPF_MOV64_IMM(BPF_REG_2, size),                          // r2 = size
+        BPF_MOV64_IMM(BPF_REG_3, 0),                             // r3 = 0
+        BPF_CALL_FUNC(BPF_FUNC_ringbuf_reserve),                 // call ringbuf_reserve
+        {0x55, R0_RETURN_VALUE, 0, 1, 0},                        // if r0 != 0 goto +1
+        BPF_EXIT_INSN(),                                         // return r0
+        BPF_MOV64_IMM(BPF_REG_1, 42),                            // r1 = 42
+        BPF_STX_MEM(BPF_DW, R0_RETURN_VALUE, BPF_REG_1, offset), // *(u64 *)(r0 + offset) = r1
+        BPF_MOV64_REG(BPF_REG_1, R0_RETURN_VALUE),               // r1 = r0
+        BPF_MOV64_IMM(BPF_REG_2, 0),                             // r2 = 0
+        BPF_CALL_FUNC(BPF_FUNC_ringbuf_submit),                  // call ringbuf_submit
+        BPF_MOV64_IMM(R0_RETURN_VALUE, 1),                       // r0 = 1
+        BPF_EXIT_INSN(),                                         // return r0
+    };
+
+    return bpf_prog_load(
+        BPF_PROG_TYPE_SAMPLE, "name", "license", (struct bpf_insn*)instructions, _countof(instructions), nullptr);
+}
+
+TEST_CASE("bpf_ringbuf_reserve record size", "[libbpf]")
+{
+    _test_helper_libbpf test_helper;
+    test_helper.initialize();
+
+    // The verifier bounds accesses to a reserved record by the value size of the map.
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, "MapName", 0, sizeof(uint64_t), 128 * 1024, nullptr);
+    REQUIRE(map_fd > 0);
+
+    // Writing past the value size is rejected by the verifier.
+    REQUIRE(_load_ring_buffer_reserve_program(map_fd, sizeof(uint64_t), sizeof(uint64_t)) < 0);
+    REQUIRE(errno == EACCES);
+
+    // The verifier doesn't check the requested size, so the helper must refuse any record that isn't exactly the
+    // value size. Otherwise a program could write past a smaller record.
+    const int32_t sizes[] = {sizeof(uint32_t), sizeof(uint64_t), 2 * sizeof(uint64_t)};
+    for (int32_t size : sizes) {
+        fd_t program_fd = _load_ring_buffer_reserve_program(map_fd, size, 0);
+        REQUIRE(program_fd >= 0);
+
+        bpf_test_run_opts opts = {};
+        sample_program_context_t context{0};
+        opts.ctx_in = reinterpret_cast<uint8_t*>(&context);
+        opts.ctx_size_in = sizeof(context);
+        REQUIRE(bpf_prog_test_run_opts(program_fd, &opts) == 0);
+        REQUIRE(opts.retval == ((size == static_cast<int32_t>(sizeof(uint64_t))) ? 1u : 0u));
+
+        Platform::_close(program_fd);
+    }
+
+    Platform::_close(map_fd);
+}
+
 TEST_CASE("libbpf program", "[libbpf]")
 {
     _test_helper_libbpf test_helper;
@@ -1147,6 +1342,114 @@ TEST_CASE("libbpf create ringbuf", "[libbpf]")
     Platform::_close(map_fd);
 }
 
+TEST_CASE("libbpf per-CPU ringbuf", "[libbpf]")
+{
+    _test_helper_libbpf test_helper;
+    test_helper.initialize();
+
+    const uint32_t max_entries = 128 * 1024;
+    const uint32_t records_per_cpu = 16;
+    // Writers are pinned with a single affinity mask.
+    uint32_t cpu_count = static_cast<uint32_t>(libbpf_num_possible_cpus());
+    if (cpu_count > 64) {
+        cpu_count = 64;
+    }
+
+    bpf_map_create_opts opts = {0};
+    opts.sz = sizeof(opts);
+    opts.map_flags = EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU;
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, "per_cpu_ringbuf", 0, 0, max_entries, &opts);
+    REQUIRE(map_fd > 0);
+
+    bpf_map_info info;
+    uint32_t info_size = sizeof(info);
+    REQUIRE(bpf_obj_get_info_by_fd(map_fd, &info, &info_size) == 0);
+    REQUIRE(info.map_flags == EBPF_MAP_CREATE_FLAG_RINGBUF_PER_CPU);
+
+    // The sub-rings cannot be mapped directly.
+    void* consumer = nullptr;
+    const void* producer = nullptr;
+    const uint8_t* data = nullptr;
+    size_t data_size = 0;
+    REQUIRE(ebpf_ring_buffer_map_map_buffer(map_fd, &consumer, &producer, &data, &data_size) != EBPF_SUCCESS);
+
+    struct _test_context
+    {
+        std::vector<uint32_t> values;
+        size_t expected_count = 0;
+        size_t bad_record_count = 0;
+        std::promise<void> done;
+    } context;
+    context.expected_count = cpu_count * records_per_cpu;
+    auto done = context.done.get_future();
+
+    ebpf_ring_buffer_opts_t ring_buffer_opts = {sizeof(ring_buffer_opts), EBPF_RING_BUFFER_FLAG_ORDERED};
+    struct ring_buffer* ring_buffer = nullptr;
+    REQUIRE(
+        ebpf_ring_buffer_create(
+            map_fd,
+            [](void* ctx, void* data, size_t size) {
+                auto context = reinterpret_cast<_test_context*>(ctx);
+                if (size != sizeof(uint32_t)) {
+                    context->bad_record_count++;
+                    return 0;
+                }
+                context->values.push_back(*reinterpret_cast<uint32_t*>(data));
+                if (context->values.size() == context->expected_count) {
+                    context->done.set_value();
+                }
+                return 0;
+            },
+            &context,
+            &ring_buffer_opts,
+            &ring_buffer) == EBPF_SUCCESS);
+
+    // Write records from every CPU, so that each sub-ring receives some.
+    size_t write_failure_count = 0;
+    for (uint32_t cpu = 0; cpu < cpu_count; cpu++) {
+        std::thread writer([&]() {
+            SetThreadAffinityMask(GetCurrentThread(), 1ULL << cpu);
+            for (uint32_t i = 0; i < records_per_cpu; i++) {
+                uint32_t value = cpu * records_per_cpu + i;
+                if (ebpf_ring_buffer_map_write(map_fd, &value, sizeof(value)) != EBPF_SUCCESS) {
+                    write_failure_count++;
+                }
+            }
+        });
+        writer.join();
+    }
+    REQUIRE(write_failure_count == 0);
+
+    // Every record is indicated exactly once, whichever sub-ring it was written to.
+    REQUIRE(done.wait_for(std::chrono::seconds(1)) == std::future_status::ready);
+    ring_buffer__free(ring_buffer);
+    REQUIRE(context.bad_record_count == 0);
+    std::sort(context.values.begin(), context.values.end());
+    for (uint32_t i = 0; i < context.expected_count; i++) {
+        REQUIRE(context.values[i] == i);
+    }
+
+    // Ordering is only supported on per-CPU ring buffer maps, and the options must include the flags.
+    ring_buffer_opts.sz = sizeof(size_t);
+    REQUIRE(
+        ebpf_ring_buffer_create(
+            map_fd, [](void*, void*, size_t) { return 0; }, nullptr, &ring_buffer_opts, &ring_buffer) ==
+        EBPF_INVALID_ARGUMENT);
+    Platform::_close(map_fd);
+
+    map_fd = bpf_map_create(BPF_MAP_TYPE_RINGBUF, "ringbuf", 0, 0, max_entries, nullptr);
+    REQUIRE(map_fd > 0);
+    ring_buffer_opts.sz = sizeof(ring_buffer_opts);
+    REQUIRE(
+        ebpf_ring_buffer_create(
+            map_fd, [](void*, void*, size_t) { return 0; }, nullptr, &ring_buffer_opts, &ring_buffer) ==
+        EBPF_INVALID_ARGUMENT);
+    Platform::_close(map_fd);
+
+    // Other map types cannot be backed by per-CPU sub-rings.
+    REQUIRE(bpf_map_create(BPF_MAP_TYPE_ARRAY, "array", sizeof(uint32_t), sizeof(uint32_t), 1, &opts) < 0);
+}
+
 #if !defined(CONFIG_BPF_JIT_DISABLED)
 TEST_CASE("libbpf map binding", "[libbpf]")
 {
@@ -2052,6 +2355,114 @@ TEST_CASE("enumerate map IDs", "[libbpf]")
     Platform::_close(fd2);
 }
 
+TEST_CASE("enumerate object IDs in pages", "[libbpf]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    ebpf_id_t ids[4];
+    uint32_t id_count = _countof(ids);
+    REQUIRE(ebpf_get_next_object_ids(EBPF_OBJECT_MAP, 0, ids, &id_count) == EBPF_NO_MORE_KEYS);
+    REQUIRE(id_count == 0);
+
+    // Create some maps, and close one in the middle so that the IDs are not contiguous.
+    const int map_count = 5;
+    fd_t map_fds[map_count];
+    for (int i = 0; i < map_count; i++) {
+        map_fds[i] = bpf_map_create(BPF_MAP_TYPE_ARRAY, nullptr, sizeof(__u32), sizeof(__u32), 1, nullptr);
+        REQUIRE(map_fds[i] > 0);
+    }
+    Platform::_close(map_fds[2]);
+
+    std::vector<ebpf_id_t> expected_ids;
+    uint32_t id = 0;
+    while (bpf_map_get_next_id(id, &id) == 0) {
+        expected_ids.push_back(id);
+    }
+    REQUIRE(expected_ids.size() == map_count - 1);
+
+    // Fetch the IDs two at a time.
+    std::vector<ebpf_id_t> paged_ids;
+    ebpf_id_t start_id = 0;
+    for (;;) {
+        id_count = 2;
+        ebpf_result_t result = ebpf_get_next_object_ids(EBPF_OBJECT_MAP, start_id, ids, &id_count);
+        if (result == EBPF_NO_MORE_KEYS) {
+            break;
+        }
+        REQUIRE(result == EBPF_SUCCESS);
+        REQUIRE(id_count > 0);
+        REQUIRE(id_count <= 2);
+        paged_ids.insert(paged_ids.end(), ids, ids + id_count);
+        start_id = ids[id_count - 1];
+    }
+    REQUIRE(paged_ids == expected_ids);
+
+    // Objects of other types are not returned.
+    id_count = _countof(ids);
+    REQUIRE(ebpf_get_next_object_ids(EBPF_OBJECT_PROGRAM, 0, ids, &id_count) == EBPF_NO_MORE_KEYS);
+
+    id_count = 0;
+    REQUIRE(ebpf_get_next_object_ids(EBPF_OBJECT_MAP, 0, ids, &id_count) == EBPF_INVALID_ARGUMENT);
+    id_count = _countof(ids);
+    REQUIRE(ebpf_get_next_object_ids(EBPF_OBJECT_UNKNOWN, 0, ids, &id_count) == EBPF_INVALID_ARGUMENT);
+
+    for (int i = 0; i < map_count; i++) {
+        if (i != 2) {
+            Platform::_close(map_fds[i]);
+        }
+    }
+}
+
+TEST_CASE("enumerate pinned paths by prefix", "[libbpf]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_ARRAY, nullptr, sizeof(__u32), sizeof(__u32), 1, nullptr);
+    REQUIRE(map_fd > 0);
+
+    // Pin out of order, including paths that share a prefix without being under the directory.
+    const char* pin_paths[] = {"/sys/fs/bpf/app/b", "/sys/fs/bpf/app2/c", "/sys/fs/bpf/app/a", "/sys/fs/bpf/other"};
+    for (const char* pin_path : pin_paths) {
+        REQUIRE(bpf_obj_pin(map_fd, pin_path) == 0);
+    }
+
+    std::vector<std::string> expected_paths;
+    for (const char* pin_path : {"/sys/fs/bpf/app/a", "/sys/fs/bpf/app/b"}) {
+        char canonical_path[EBPF_MAX_PIN_PATH_LENGTH];
+        REQUIRE(ebpf_canonicalize_pin_path(canonical_path, sizeof(canonical_path), pin_path) == EBPF_SUCCESS);
+        expected_paths.push_back(canonical_path);
+    }
+
+    uint32_t path_count = 0;
+    ebpf_pinned_object_path_t* paths = nullptr;
+    REQUIRE(ebpf_get_pinned_object_paths_by_prefix("/sys/fs/bpf/app/", EBPF_OBJECT_UNKNOWN, &path_count, &paths) ==
+            EBPF_SUCCESS);
+    REQUIRE(path_count == expected_paths.size());
+    for (uint32_t i = 0; i < path_count; i++) {
+        REQUIRE(paths[i].type == EBPF_OBJECT_MAP);
+        REQUIRE(std::string(paths[i].path) == expected_paths[i]);
+    }
+    ebpf_free_pinned_object_paths(path_count, paths);
+
+    // Filtering by type.
+    REQUIRE(ebpf_get_pinned_object_paths_by_prefix("/sys/fs/bpf/app/", EBPF_OBJECT_PROGRAM, &path_count, &paths) ==
+            EBPF_SUCCESS);
+    REQUIRE(path_count == 0);
+    REQUIRE(paths == nullptr);
+
+    // The root prefix returns every pinned path.
+    REQUIRE(ebpf_get_pinned_object_paths_by_prefix("/", EBPF_OBJECT_MAP, &path_count, &paths) == EBPF_SUCCESS);
+    REQUIRE(path_count == _countof(pin_paths));
+    ebpf_free_pinned_object_paths(path_count, paths);
+
+    for (const char* pin_path : pin_paths) {
+        REQUIRE(ebpf_object_unpin(pin_path) == EBPF_SUCCESS);
+    }
+    Platform::_close(map_fd);
+}
+
 #if !defined(CONFIG_BPF_JIT_DISABLED)
 TEST_CASE("enumerate link IDs", "[libbpf]")
 {
@@ -4018,6 +4429,259 @@ TEST_CASE("libbpf percpu hash map batch", "[libbpf]") { _test_maps_batch(BPF_MAP
 
 TEST_CASE("libbpf lru percpu hash map batch", "[libbpf]") { _test_maps_batch(BPF_MAP_TYPE_LRU_PERCPU_HASH); }
 
+static void
+_test_percpu_cache_aligned_map(bpf_map_type map_type)
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    // Each per-CPU value is a pair of 32-bit counters, so the default layout packs two CPUs per cache line.
+    typedef struct _counter_pair
+    {
+        uint32_t first;
+        uint32_t second;
+    } counter_pair_t;
+    const uint32_t entry_count = 16;
+
+    int num_of_cpus = libbpf_num_possible_cpus();
+    REQUIRE(num_of_cpus > 0);
+
+    bpf_map_create_opts opts = {0};
+    opts.sz = sizeof(opts);
+    opts.map_flags = EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED;
+    fd_t map_fd = bpf_map_create(map_type, "aligned_map", sizeof(uint32_t), sizeof(counter_pair_t), entry_count, &opts);
+    REQUIRE(map_fd > 0);
+
+    bpf_map_info info;
+    uint32_t info_size = sizeof(info);
+    REQUIRE(bpf_obj_get_info_by_fd(map_fd, &info, &info_size) == 0);
+    REQUIRE(info.map_flags == EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED);
+    REQUIRE(info.value_size == sizeof(counter_pair_t));
+
+    // Values exchanged with user mode keep the packed per-CPU layout.
+    for (uint32_t key = 0; key < entry_count; key++) {
+        std::vector<counter_pair_t> values(num_of_cpus);
+        for (int cpu = 0; cpu < num_of_cpus; cpu++) {
+            values[cpu] = {key + cpu, UINT32_MAX - cpu};
+        }
+        REQUIRE(bpf_map_update_elem(map_fd, &key, values.data(), BPF_ANY) == 0);
+
+        std::vector<counter_pair_t> fetched_values(num_of_cpus);
+        REQUIRE(bpf_map_lookup_elem(map_fd, &key, fetched_values.data()) == 0);
+        REQUIRE(memcmp(values.data(), fetched_values.data(), values.size() * sizeof(counter_pair_t)) == 0);
+    }
+
+    std::vector<uint32_t> keys(entry_count);
+    std::vector<counter_pair_t> aggregates(entry_count);
+    uint32_t next_key = 0;
+    uint32_t count = entry_count;
+
+    REQUIRE(
+        ebpf_map_aggregate_batch(
+            map_fd,
+            EBPF_MAP_AGGREGATE_SUM,
+            sizeof(uint32_t),
+            nullptr,
+            &next_key,
+            keys.data(),
+            aggregates.data(),
+            &count) == EBPF_SUCCESS);
+    REQUIRE(count == entry_count);
+    uint32_t cpu_sum = static_cast<uint32_t>(num_of_cpus * (num_of_cpus - 1) / 2);
+    for (uint32_t index = 0; index < count; index++) {
+        REQUIRE(aggregates[index].first == keys[index] * num_of_cpus + cpu_sum);
+        REQUIRE(aggregates[index].second == static_cast<uint32_t>(0 - num_of_cpus - cpu_sum));
+    }
+
+    count = entry_count;
+    REQUIRE(
+        ebpf_map_aggregate_batch(
+            map_fd,
+            EBPF_MAP_AGGREGATE_MIN,
+            sizeof(uint32_t),
+            nullptr,
+            &next_key,
+            keys.data(),
+            aggregates.data(),
+            &count) == EBPF_SUCCESS);
+    REQUIRE(count == entry_count);
+    for (uint32_t index = 0; index < count; index++) {
+        REQUIRE(aggregates[index].first == keys[index]);
+        REQUIRE(aggregates[index].second == UINT32_MAX - (num_of_cpus - 1));
+    }
+
+    count = entry_count;
+    REQUIRE(
+        ebpf_map_aggregate_batch(
+            map_fd,
+            EBPF_MAP_AGGREGATE_MAX,
+            sizeof(uint32_t),
+            nullptr,
+            &next_key,
+            keys.data(),
+            aggregates.data(),
+            &count) == EBPF_SUCCESS);
+    REQUIRE(count == entry_count);
+    for (uint32_t index = 0; index < count; index++) {
+        REQUIRE(aggregates[index].first == keys[index] + num_of_cpus - 1);
+        REQUIRE(aggregates[index].second == UINT32_MAX);
+    }
+
+    // Continuing after the last key returns no more keys.
+    count = entry_count;
+    REQUIRE(
+        ebpf_map_aggregate_batch(
+            map_fd,
+            EBPF_MAP_AGGREGATE_SUM,
+            sizeof(uint32_t),
+            &next_key,
+            &next_key,
+            keys.data(),
+            aggregates.data(),
+            &count) == EBPF_NO_MORE_KEYS);
+
+    // Element sizes that don't divide the value are rejected.
+    count = entry_count;
+    REQUIRE(
+        ebpf_map_aggregate_batch(
+            map_fd, EBPF_MAP_AGGREGATE_SUM, 3, nullptr, &next_key, keys.data(), aggregates.data(), &count) ==
+        EBPF_INVALID_ARGUMENT);
+
+    Platform::_close(map_fd);
+}
+
+TEST_CASE("libbpf percpu array cache aligned", "[libbpf]")
+{
+    _test_percpu_cache_aligned_map(BPF_MAP_TYPE_PERCPU_ARRAY);
+}
+
+TEST_CASE("libbpf percpu hash cache aligned", "[libbpf]") { _test_percpu_cache_aligned_map(BPF_MAP_TYPE_PERCPU_HASH); }
+
+TEST_CASE("libbpf cache aligned flag rejected on non-percpu map", "[libbpf]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    bpf_map_create_opts opts = {0};
+    opts.sz = sizeof(opts);
+    opts.map_flags = EBPF_MAP_CREATE_FLAG_PERCPU_CACHE_ALIGNED;
+    REQUIRE(bpf_map_create(BPF_MAP_TYPE_HASH, "aligned_map", sizeof(uint32_t), sizeof(uint64_t), 1, &opts) < 0);
+
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_HASH, "hash_map", sizeof(uint32_t), sizeof(uint64_t), 1, nullptr);
+    REQUIRE(map_fd > 0);
+    uint32_t key = 0;
+    uint64_t value = 0;
+    uint32_t next_key = 0;
+    uint32_t count = 1;
+    REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_ANY) == 0);
+    REQUIRE(
+        ebpf_map_aggregate_batch(
+            map_fd, EBPF_MAP_AGGREGATE_SUM, sizeof(uint64_t), nullptr, &next_key, &key, &value, &count) ==
+        EBPF_OPERATION_NOT_SUPPORTED);
+    Platform::_close(map_fd);
+}
+
+TEST_CASE("libbpf map statistics", "[libbpf]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    bpf_map_create_opts opts = {0};
+    opts.sz = sizeof(opts);
+    opts.map_flags = EBPF_MAP_CREATE_FLAG_STATISTICS;
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_HASH, "stats_map", sizeof(uint32_t), sizeof(uint64_t), 2, &opts);
+    REQUIRE(map_fd > 0);
+
+    uint32_t key = 1;
+    uint64_t value = 0;
+    REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_ANY) == 0);
+    REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_ANY) == 0);
+    key = 2;
+    REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_NOEXIST) == 0);
+    key = 3;
+    REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_NOEXIST) < 0);
+
+    key = 1;
+    REQUIRE(bpf_map_lookup_elem(map_fd, &key, &value) == 0);
+    key = 3;
+    REQUIRE(bpf_map_lookup_elem(map_fd, &key, &value) < 0);
+    key = 2;
+    REQUIRE(bpf_map_delete_elem(map_fd, &key) == 0);
+
+    bpf_map_info info;
+    uint32_t info_size = sizeof(info);
+    REQUIRE(bpf_obj_get_info_by_fd(map_fd, &info, &info_size) == 0);
+    REQUIRE(info.map_flags == EBPF_MAP_CREATE_FLAG_STATISTICS);
+    REQUIRE(info.entry_count == 1);
+    REQUIRE(info.lookup_count == 1);
+    REQUIRE(info.lookup_miss_count == 1);
+    REQUIRE(info.insert_count == 2);
+    REQUIRE(info.replace_count == 1);
+    REQUIRE(info.delete_count == 1);
+    REQUIRE(info.eviction_count == 0);
+    REQUIRE(info.out_of_space_count == 1);
+    REQUIRE(info.no_memory_count == 0);
+    Platform::_close(map_fd);
+
+    // Inserting past capacity into an LRU map evicts the oldest entries.
+    map_fd = bpf_map_create(BPF_MAP_TYPE_LRU_HASH, "lru_stats_map", sizeof(uint32_t), sizeof(uint64_t), 16, &opts);
+    REQUIRE(map_fd > 0);
+    for (key = 0; key < 32; key++) {
+        REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_ANY) == 0);
+    }
+    info_size = sizeof(info);
+    REQUIRE(bpf_obj_get_info_by_fd(map_fd, &info, &info_size) == 0);
+    REQUIRE(info.insert_count == 32);
+    REQUIRE(info.eviction_count > 0);
+    REQUIRE(info.out_of_space_count == 0);
+    Platform::_close(map_fd);
+
+    // Maps created without the flag report their entry count but no operation counters.
+    map_fd = bpf_map_create(BPF_MAP_TYPE_HASH, "hash_map", sizeof(uint32_t), sizeof(uint64_t), 2, nullptr);
+    REQUIRE(map_fd > 0);
+    REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_ANY) == 0);
+    REQUIRE(bpf_map_lookup_elem(map_fd, &key, &value) == 0);
+    info_size = sizeof(info);
+    REQUIRE(bpf_obj_get_info_by_fd(map_fd, &info, &info_size) == 0);
+    REQUIRE(info.entry_count == 1);
+    REQUIRE(info.lookup_count == 0);
+    REQUIRE(info.insert_count == 0);
+    Platform::_close(map_fd);
+}
+
+TEST_CASE("libbpf lru map background eviction", "[libbpf]")
+{
+    _test_helper_end_to_end test_helper;
+    test_helper.initialize();
+
+    bpf_map_create_opts opts = {0};
+    opts.sz = sizeof(opts);
+    opts.map_flags = EBPF_MAP_CREATE_FLAG_LRU_BACKGROUND_EVICTION;
+    REQUIRE(bpf_map_create(BPF_MAP_TYPE_HASH, "hash_map", sizeof(uint32_t), sizeof(uint64_t), 64, &opts) < 0);
+
+    opts.map_flags |= EBPF_MAP_CREATE_FLAG_STATISTICS;
+    fd_t map_fd = bpf_map_create(BPF_MAP_TYPE_LRU_HASH, "lru_map", sizeof(uint32_t), sizeof(uint64_t), 64, &opts);
+    REQUIRE(map_fd > 0);
+
+    // Fill the map past its high watermark (7/8 of max_entries) without filling it.
+    uint64_t value = 0;
+    for (uint32_t key = 0; key < 60; key++) {
+        REQUIRE(bpf_map_update_elem(map_fd, &key, &value, BPF_ANY) == 0);
+    }
+
+    // Eviction itself is covered deterministically by the execution context tests. Whether or not it has run yet, every
+    // insert was counted.
+    bpf_map_info info;
+    uint32_t info_size = sizeof(info);
+    REQUIRE(bpf_obj_get_info_by_fd(map_fd, &info, &info_size) == 0);
+    REQUIRE(info.insert_count == 60);
+
+    // The most recently inserted key is still present.
+    uint32_t key = 59;
+    REQUIRE(bpf_map_lookup_elem(map_fd, &key, &value) == 0);
+    Platform::_close(map_fd);
+}
+
 void
 _hash_of_map_initial_value_test(ebpf_execution_type_t execution_type)
 {
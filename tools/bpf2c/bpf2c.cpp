@@ -70,15 +70,13 @@ elf_everparse_error(_In_ const char* struct_name, _In_ const char* field_name, _
 }
 
 std::vector<uint8_t>
-get_program_info_type_hash(const std::vector<int32_t>& actual_helper_ids, const std::string& algorithm)
+get_program_info_type_hash(
+    _In_ const ebpf_program_info_t* program_info,
+    const std::vector<int32_t>& actual_helper_ids,
+    const std::string& algorithm)
 {
     std::map<uint32_t, size_t> helper_id_ordering;
     size_t actual_helper_id_count = actual_helper_ids.size();
-    const ebpf_program_info_t* program_info;
-    ebpf_result_t result = ebpf_get_program_info_from_verifier(&program_info);
-    if (result != EBPF_SUCCESS) {
-        throw std::runtime_error(std::string("Failed to get program information"));
-    }
 
     // Note:
     // Only the helper functions which are actually called by the eBPF program are to be included in the hash.
@@ -296,41 +294,51 @@ main(int argc, char** argv)
             global_program_type_set = true;
         }
 
-        // Parse per-program data.
+        // Verify all programs first. Verification of the programs is independent, so it runs concurrently, and
+        // failures are reported in program order.
+        std::vector<const ebpf_api_program_info_t*> programs;
+        std::vector<ebpf_api_program_verification_t> verifications;
         for (const ebpf_api_program_info_t* program = infos; program; program = program->next) {
             // Skip if a subprogram.  A subprogram is defined by libbpf as any
             // program in the .text section when multiple programs exist.
             if (!strcmp(program->section_name, ".text") && infos->next != nullptr) {
                 continue;
             }
+            ebpf_api_program_verification_t verification = {};
+            verification.section_name = program->section_name;
+            verification.program_name = program->program_name;
+            verification.program_type = (global_program_type_set) ? &program_type : &program->program_type;
+            programs.push_back(program);
+            verifications.push_back(verification);
+        }
 
-            const char* report = nullptr;
-            ebpf_api_verifier_stats_t stats;
-            if (ebpf_api_elf_verify_program_from_memory(
-                    data.c_str(),
-                    data.size(),
-                    program->section_name,
-                    program->program_name,
-                    (global_program_type_set) ? &program_type : &program->program_type,
-                    verbose ? EBPF_VERIFICATION_VERBOSITY_INFORMATIONAL : EBPF_VERIFICATION_VERBOSITY_NORMAL,
-                    &report,
-                    &error_message,
-                    &stats) != 0) {
-                report = ((report == nullptr) ? "" : report);
-                throw std::runtime_error(
-                    std::string("Verification failed for ") + std::string(program->program_name) +
-                    std::string(" with error ") + std::string(error_message) + std::string("\n Report:\n") +
-                    std::string(report));
+        result = ebpf_api_elf_verify_programs_from_memory(
+            data.c_str(),
+            data.size(),
+            verbose ? EBPF_VERIFICATION_VERBOSITY_INFORMATIONAL : EBPF_VERIFICATION_VERBOSITY_NORMAL,
+            0,
+            verifications.size(),
+            verifications.data());
+        if (result != EBPF_SUCCESS) {
+            std::string message = "Verification failed";
+            for (size_t i = 0; i < verifications.size(); i++) {
+                if (verifications[i].result != 0) {
+                    const char* error = verifications[i].error_message;
+                    const char* report = verifications[i].report;
+                    message = std::string("Verification failed for ") + std::string(programs[i]->program_name) +
+                              std::string(" with error ") + std::string((error == nullptr) ? "" : error) +
+                              std::string("\n Report:\n") + std::string((report == nullptr) ? "" : report);
+                    break;
+                }
             }
-            ebpf_free_string(report);
-            ebpf_free_string(error_message);
-            error_message = nullptr;
+            ebpf_api_free_program_verifications(verifications.size(), verifications.data());
+            throw std::runtime_error(message);
+        }
 
-            const ebpf_program_info_t* program_info = nullptr;
-            result = ebpf_get_program_info_from_verifier(&program_info);
-            if (result != EBPF_SUCCESS) {
-                throw std::runtime_error(std::string("Failed to get program information"));
-            }
+        // Parse per-program data.
+        for (size_t i = 0; i < programs.size(); i++) {
+            const ebpf_api_program_info_t* program = programs[i];
+            const ebpf_program_info_t* program_info = verifications[i].program_info;
             generator.parse(
                 program,
                 program_info,
@@ -342,7 +350,7 @@ main(int argc, char** argv)
             if (hash_algorithm != "none") {
                 std::vector<int32_t> helper_ids = generator.get_helper_ids(program->program_name);
                 std::optional<std::vector<uint8_t>> program_info_hash =
-                    get_program_info_type_hash(helper_ids, hash_algorithm);
+                    get_program_info_type_hash(program_info, helper_ids, hash_algorithm);
                 generator.set_program_hash_info(program->program_name, program_info_hash);
             }
         }
@@ -376,6 +384,7 @@ main(int argc, char** argv)
             throw std::runtime_error("Invalid output type");
         }
         generator.emit_c_code(out_stream);
+        ebpf_api_free_program_verifications(verifications.size(), verifications.data());
     } catch (std::runtime_error err) {
         std::cerr << err.what() << std::endl;
         return 1;
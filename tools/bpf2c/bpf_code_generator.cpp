@@ -23,6 +23,8 @@
 #undef ebpf_inst
 
 #include <windows.h>
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <format>
 #include <iomanip>
@@ -1066,11 +1068,19 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
     auto effective_program_name = !program_name.empty() ? program_name : elf_section_name;
     auto helper_array_prefix = "runtime_context->helper_data[{}]";
 
+    // Map known to be held by each register within the current basic block. Used to inline array map lookups.
+    std::array<const map_info_t*, _countof(_register_names)> register_maps = {};
+
     // Encode instructions
     for (size_t i = 0; i < program_output.size(); i++) {
         auto& output = program_output[i];
         auto& inst = output.instruction;
 
+        if (output.jump_target) {
+            // This instruction can be reached from more than one place, so nothing is known about the registers.
+            register_maps.fill(nullptr);
+        }
+
         switch (inst.opcode & INST_CLS_MASK) {
         case INST_CLS_ALU:
         case INST_CLS_ALU64: {
@@ -1315,7 +1325,11 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
             if (!is64bit) {
                 output.lines.push_back(std::format("{} &= UINT32_MAX;", destination));
             }
-
+            if (inst.opcode == EBPF_OP_MOV64_REG && inst.offset == 0) {
+                register_maps[inst.dst] = register_maps[inst.src];
+            } else {
+                register_maps[inst.dst] = nullptr;
+            }
         } break;
         case INST_CLS_LD: {
             i++;
@@ -1326,6 +1340,7 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
                 throw bpf_code_generator_exception("invalid operand", output.instruction_offset);
             }
             std::string destination = get_register_name(inst.dst);
+            register_maps[inst.dst] = nullptr;
             if (inst.src == INST_LD_MODE_IMM) {
                 uint64_t imm = static_cast<uint32_t>(program_output[i].instruction.imm);
                 imm <<= 32;
@@ -1344,6 +1359,7 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
                     std::format("runtime_context->map_data[{}].address", std::to_string(map_definition->second.index));
                 output.lines.push_back(std::format("{} = POINTER({});", destination, source));
                 referenced_map_indices.insert(map_definitions[output.relocation].index);
+                register_maps[inst.dst] = &map_definition->second;
             } else if (inst.src == INST_LD_MODE_MAP_VALUE) {
                 std::string source;
                 uint64_t imm = static_cast<uint32_t>(program_output[i].instruction.imm);
@@ -1385,6 +1401,7 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
             }
             output.lines.push_back(
                 std::format("{} = *({}*)(uintptr_t)({} + {});", destination, size_type, source, offset));
+            register_maps[inst.dst] = nullptr;
         } break;
         case INST_CLS_ST:
         case INST_CLS_STX: {
@@ -1495,6 +1512,8 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
                 } else {
                     output.lines.push_back(line);
                 }
+                register_maps[inst.src] = nullptr;
+                register_maps[0] = nullptr;
             } else if ((inst.opcode & INST_MODE_MASK) == EBPF_MODE_MEM) {
                 output.lines.push_back(
                     std::format("*({}*)(uintptr_t)({} + {}) = {};", size_type, destination, offset, source));
@@ -1535,34 +1554,59 @@ bpf_code_generator::bpf_code_generator_program::encode_instructions(
             } else if (inst.opcode == INST_OP_JA32) {
                 std::string target = program_output[i + inst.imm + 1].label;
                 output.lines.push_back("goto " + target + ";");
+            } else if (
+                inst.opcode == INST_OP_CALL && inst.src == INST_CALL_STATIC_HELPER && output.relocation.empty() &&
+                inst.imm == BPF_FUNC_map_lookup_elem && register_maps[1] != nullptr &&
+                register_maps[1]->definition.type == BPF_MAP_TYPE_ARRAY &&
+                register_maps[1]->definition.key_size == sizeof(uint32_t)) {
+                // Array map values are stored contiguously and never move, so the lookup is a bounds check on the
+                // key followed by an offset from the value address resolved when the program is loaded.
+                const map_info_t* map = register_maps[1];
+                std::string result = get_register_name(0);
+                output.lines.push_back(std::format("{} = *(uint32_t*)(uintptr_t){};", result, get_register_name(2)));
+                output.lines.push_back(std::format("if ({} < {}) {{", result, map->definition.max_entries));
+                output.lines.push_back(std::format(
+                    INDENT "{} = POINTER(runtime_context->map_value_data[{}].address + {} * {});",
+                    result,
+                    map->index,
+                    result,
+                    map->definition.value_size));
+                output.lines.push_back("} else {");
+                output.lines.push_back(std::format(INDENT "{} = 0;", result));
+                output.lines.push_back("}");
+                std::fill(register_maps.begin(), register_maps.begin() + 6, nullptr);
             } else if (inst.opcode == INST_OP_CALL && inst.src == INST_CALL_STATIC_HELPER) {
                 std::string function_name;
+                helper_function_t helper_function;
                 if (output.relocation.empty()) {
-                    auto str =
-                        std::to_string(helper_functions["helper_id_" + std::to_string(output.instruction.imm)].index);
-                    function_name = std::vformat(helper_array_prefix, make_format_args(str));
+                    helper_function = helper_functions["helper_id_" + std::to_string(output.instruction.imm)];
                 } else {
-                    auto helper_function = helper_functions.find(output.relocation);
-                    assert(helper_function != helper_functions.end());
-                    auto str = std::to_string(helper_functions[output.relocation].index);
-                    function_name = std::vformat(helper_array_prefix, make_format_args(str));
+                    assert(helper_functions.find(output.relocation) != helper_functions.end());
+                    helper_function = helper_functions[output.relocation];
                 }
+                auto str = std::to_string(helper_function.index);
+                function_name = std::vformat(helper_array_prefix, make_format_args(str));
 
                 output.lines.push_back(
                     get_register_name(0) + " = " + function_name + ".address(" + get_register_name(1) + ", " +
                     get_register_name(2) + ", " + get_register_name(3) + ", " + get_register_name(4) + ", " +
                     get_register_name(5) + ", context);");
 
-                output.lines.push_back(
-                    std::format("if (({}.tail_call) && ({} == 0)) {{", function_name, get_register_name(0)));
-                output.lines.push_back(INDENT "return 0;");
-                output.lines.push_back("}");
+                // The runtime only flags bpf_tail_call as a tail call, and the helper ID is known here, so
+                // the check is only needed after calls to it.
+                if (helper_function.id == BPF_FUNC_tail_call) {
+                    output.lines.push_back(std::format("if ({} == 0) {{", get_register_name(0)));
+                    output.lines.push_back(INDENT "return 0;");
+                    output.lines.push_back("}");
+                }
+                std::fill(register_maps.begin(), register_maps.begin() + 6, nullptr);
             } else if (inst.opcode == INST_OP_CALL && inst.src == INST_CALL_LOCAL) {
                 std::string function_name = output.relocation.c_identifier();
                 output.lines.push_back(
                     get_register_name(0) + " = " + function_name + "(" + get_register_name(1) + ", " +
                     get_register_name(2) + ", " + get_register_name(3) + ", " + get_register_name(4) + ", " +
                     get_register_name(5) + ", " + get_register_name(10) + ", context);");
+                std::fill(register_maps.begin(), register_maps.begin() + 6, nullptr);
             } else if (inst.opcode == INST_OP_EXIT) {
                 output.lines.push_back("return " + get_register_name(0) + ";");
             } else {